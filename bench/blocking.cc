@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <cpuinfo.h>
+
+
+static const uint32_t kMR = 4;
+static const uint32_t kNR = 4;
+
+/* C[mr x nr] += A[mr x kc] * B[kc x nr], row-major operands with leading dimensions */
+static void micro_kernel(
+	uint32_t mr, uint32_t nr, uint32_t kc,
+	const float* a, size_t lda,
+	const float* b, size_t ldb,
+	float* c, size_t ldc)
+{
+	float acc[kMR][kNR] = { { 0.0f } };
+	for (uint32_t p = 0; p < kc; p++) {
+		for (uint32_t i = 0; i < mr; i++) {
+			const float a_ip = a[i * lda + p];
+			for (uint32_t j = 0; j < nr; j++) {
+				acc[i][j] += a_ip * b[p * ldb + j];
+			}
+		}
+	}
+	for (uint32_t i = 0; i < mr; i++) {
+		for (uint32_t j = 0; j < nr; j++) {
+			c[i * ldc + j] += acc[i][j];
+		}
+	}
+}
+
+/* Naive GotoBLAS-style loop nest without packing */
+static void blocked_matmul(
+	uint32_t m, uint32_t n, uint32_t k,
+	uint32_t mc, uint32_t kc, uint32_t nc,
+	const float* a, const float* b, float* c)
+{
+	for (uint32_t jc = 0; jc < n; jc += nc) {
+		const uint32_t nb = std::min(nc, n - jc);
+		for (uint32_t pc = 0; pc < k; pc += kc) {
+			const uint32_t kb = std::min(kc, k - pc);
+			for (uint32_t ic = 0; ic < m; ic += mc) {
+				const uint32_t mb = std::min(mc, m - ic);
+				for (uint32_t jr = 0; jr < nb; jr += kNR) {
+					for (uint32_t ir = 0; ir < mb; ir += kMR) {
+						micro_kernel(
+							std::min(kMR, mb - ir), std::min(kNR, nb - jr), kb,
+							a + (ic + ir) * k + pc, k,
+							b + pc * n + jc + jr, n,
+							c + (ic + ir) * n + jc + jr, n);
+					}
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Arguments: cluster index, and log2 of the factor applied to recommended kc and mc (0 = recommended parameters).
+ * Recommended parameters should be close to the fastest among the variants.
+ */
+static void matmul(benchmark::State& state) {
+	cpuinfo_initialize();
+	const uint32_t cluster_index = static_cast<uint32_t>(state.range(0));
+	const int scale = static_cast<int>(state.range(1));
+
+	cpuinfo_blocking blocking;
+	if (!cpuinfo_get_cluster_blocking(cpuinfo_get_cluster(cluster_index), sizeof(float), kMR, kNR, 1, &blocking)) {
+		state.SkipWithError("failed to compute blocking parameters");
+		return;
+	}
+	uint32_t kc = blocking.kc, mc = blocking.mc;
+	if (scale >= 0) {
+		kc <<= scale;
+		mc <<= scale;
+	} else {
+		kc = std::max<uint32_t>(kc >> -scale, 1);
+		mc = std::max<uint32_t>((mc >> -scale) / kMR * kMR, kMR);
+	}
+
+	const uint32_t m = 512, n = 512, k = 512;
+	std::vector<float> a(m * k, 1.0f), b(k * n, 1.0f), c(m * n);
+	for (auto _ : state) {
+		blocked_matmul(m, n, k, mc, kc, blocking.nc, a.data(), b.data(), c.data());
+		benchmark::DoNotOptimize(c.data());
+	}
+
+	state.counters["mc"] = mc;
+	state.counters["kc"] = kc;
+	state.counters["nc"] = blocking.nc;
+	state.counters["FLOPS"] = benchmark::Counter(
+		2.0 * m * n * k * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void ClustersAndScales(benchmark::internal::Benchmark* b) {
+	cpuinfo_initialize();
+	b->ArgNames({"cluster", "scale"});
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		for (int scale = -2; scale <= 2; scale++) {
+			b->Args({i, scale});
+		}
+	}
+}
+BENCHMARK(matmul)->Apply(ClustersAndScales)->Unit(benchmark::kMillisecond);
+
+static void cpuinfo_get_cluster_blocking(benchmark::State& state) {
+	cpuinfo_initialize();
+	const cpuinfo_cluster* cluster = cpuinfo_get_cluster(0);
+	cpuinfo_blocking blocking;
+	while (state.KeepRunning()) {
+		cpuinfo_get_cluster_blocking(cluster, sizeof(float), kMR, kNR, 1, &blocking);
+		benchmark::DoNotOptimize(blocking);
+	}
+}
+BENCHMARK(cpuinfo_get_cluster_blocking)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
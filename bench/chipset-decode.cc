@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+#include <benchmark/benchmark.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+
+/*
+ * Chipset decoding on all strings from the chipset-test sources. The test sources are compiled with the functions
+ * which decode and format chipset names replaced by functions which record their inputs, and each test case becomes a
+ * function which records its test strings. Benchmarks decode the recorded strings without formatting chipset names.
+ */
+
+#define CPUINFO_HARDWARE_VALUE_MAX 64
+#define CPUINFO_BUILD_PROP_VALUE_MAX 92
+#define CPUINFO_ARM_CHIPSET_NAME_MAX 48
+
+extern "C" {
+	uint32_t cpuinfo_arm_android_decode_chipset_properties(
+		const char proc_cpuinfo_hardware[CPUINFO_HARDWARE_VALUE_MAX],
+		const char ro_product_board[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_board_platform[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_mediatek_platform[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_arch[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_chipname[CPUINFO_BUILD_PROP_VALUE_MAX],
+		uint32_t cores,
+		uint32_t max_cpu_freq_max);
+	uint32_t cpuinfo_arm_android_decode_proc_cpuinfo_hardware(
+		const char hardware[CPUINFO_HARDWARE_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max, bool is_tegra);
+	uint32_t cpuinfo_arm_android_decode_ro_product_board(
+		const char board[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max);
+	uint32_t cpuinfo_arm_android_decode_ro_board_platform(
+		const char platform[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max);
+	uint32_t cpuinfo_arm_android_decode_ro_mediatek_platform(
+		const char platform[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max);
+	uint32_t cpuinfo_arm_android_decode_ro_arch(
+		const char arch[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max);
+	uint32_t cpuinfo_arm_android_decode_ro_chipname(
+		const char chipname[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max);
+}
+
+/* Value of a single chipset property and system parameters */
+struct ChipsetProperty {
+	char value[CPUINFO_BUILD_PROP_VALUE_MAX];
+	uint32_t cores;
+	uint32_t max_cpu_freq_max;
+	bool is_tegra;
+};
+
+/* Values of all Android chipset properties and system parameters */
+struct ChipsetProperties {
+	char proc_cpuinfo_hardware[CPUINFO_HARDWARE_VALUE_MAX];
+	char ro_product_board[CPUINFO_BUILD_PROP_VALUE_MAX];
+	char ro_board_platform[CPUINFO_BUILD_PROP_VALUE_MAX];
+	char ro_mediatek_platform[CPUINFO_BUILD_PROP_VALUE_MAX];
+	char ro_arch[CPUINFO_BUILD_PROP_VALUE_MAX];
+	char ro_chipname[CPUINFO_BUILD_PROP_VALUE_MAX];
+	uint32_t cores;
+	uint32_t max_cpu_freq_max;
+};
+
+static std::vector<ChipsetProperty> proc_cpuinfo_hardware_strings;
+static std::vector<ChipsetProperty> ro_product_board_strings;
+static std::vector<ChipsetProperty> ro_board_platform_strings;
+static std::vector<ChipsetProperty> ro_mediatek_platform_strings;
+static std::vector<ChipsetProperty> ro_arch_strings;
+static std::vector<ChipsetProperty> ro_chipname_strings;
+static std::vector<ChipsetProperties> android_properties_strings;
+
+static void record_property(
+	std::vector<ChipsetProperty>& strings,
+	const char* value, size_t value_max, uint32_t cores, uint32_t max_cpu_freq_max, bool is_tegra,
+	char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+{
+	ChipsetProperty property = { };
+	strncpy(property.value, value, value_max);
+	property.cores = cores;
+	property.max_cpu_freq_max = max_cpu_freq_max;
+	property.is_tegra = is_tegra;
+	strings.push_back(property);
+	chipset_name[0] = 0;
+}
+
+extern "C" {
+	void record_proc_cpuinfo_hardware(
+		const char hardware[CPUINFO_HARDWARE_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max, bool is_tegra,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		record_property(proc_cpuinfo_hardware_strings,
+			hardware, CPUINFO_HARDWARE_VALUE_MAX, cores, max_cpu_freq_max, is_tegra, chipset_name);
+	}
+
+	void record_ro_product_board(
+		const char board[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		record_property(ro_product_board_strings,
+			board, CPUINFO_BUILD_PROP_VALUE_MAX, cores, max_cpu_freq_max, false, chipset_name);
+	}
+
+	void record_ro_board_platform(
+		const char platform[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		record_property(ro_board_platform_strings,
+			platform, CPUINFO_BUILD_PROP_VALUE_MAX, cores, max_cpu_freq_max, false, chipset_name);
+	}
+
+	void record_ro_mediatek_platform(
+		const char platform[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		record_property(ro_mediatek_platform_strings,
+			platform, CPUINFO_BUILD_PROP_VALUE_MAX, cores, max_cpu_freq_max, false, chipset_name);
+	}
+
+	void record_ro_arch(
+		const char arch[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		record_property(ro_arch_strings,
+			arch, CPUINFO_BUILD_PROP_VALUE_MAX, cores, max_cpu_freq_max, false, chipset_name);
+	}
+
+	void record_ro_chipname(
+		const char chipname[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		record_property(ro_chipname_strings,
+			chipname, CPUINFO_BUILD_PROP_VALUE_MAX, cores, max_cpu_freq_max, false, chipset_name);
+	}
+
+	void record_chipset_properties(
+		const char proc_cpuinfo_hardware[CPUINFO_HARDWARE_VALUE_MAX],
+		const char ro_product_board[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_board_platform[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_mediatek_platform[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_arch[CPUINFO_BUILD_PROP_VALUE_MAX],
+		const char ro_chipname[CPUINFO_BUILD_PROP_VALUE_MAX],
+		uint32_t cores,
+		uint32_t max_cpu_freq_max,
+		char chipset_name[CPUINFO_ARM_CHIPSET_NAME_MAX])
+	{
+		ChipsetProperties properties = { };
+		strncpy(properties.proc_cpuinfo_hardware, proc_cpuinfo_hardware, CPUINFO_HARDWARE_VALUE_MAX);
+		strncpy(properties.ro_product_board, ro_product_board, CPUINFO_BUILD_PROP_VALUE_MAX);
+		strncpy(properties.ro_board_platform, ro_board_platform, CPUINFO_BUILD_PROP_VALUE_MAX);
+		strncpy(properties.ro_mediatek_platform, ro_mediatek_platform, CPUINFO_BUILD_PROP_VALUE_MAX);
+		strncpy(properties.ro_arch, ro_arch, CPUINFO_BUILD_PROP_VALUE_MAX);
+		strncpy(properties.ro_chipname, ro_chipname, CPUINFO_BUILD_PROP_VALUE_MAX);
+		properties.cores = cores;
+		properties.max_cpu_freq_max = max_cpu_freq_max;
+		android_properties_strings.push_back(properties);
+		chipset_name[0] = 0;
+	}
+}
+
+static std::vector<void (*)()>& test_cases() {
+	static std::vector<void (*)()> test_cases;
+	return test_cases;
+}
+
+struct TestCaseRegistration {
+	explicit TestCaseRegistration(void (*function)()) {
+		test_cases().push_back(function);
+	}
+};
+
+#undef TEST
+#undef EXPECT_EQ
+#define TEST(suite, name) \
+	static void suite##_##name(); \
+	static TestCaseRegistration suite##_##name##_registration(suite##_##name); \
+	static void suite##_##name()
+#define EXPECT_EQ(expected, actual) (void) (actual)
+
+#define cpuinfo_arm_android_parse_proc_cpuinfo_hardware record_proc_cpuinfo_hardware
+#define cpuinfo_arm_android_parse_ro_product_board record_ro_product_board
+#define cpuinfo_arm_android_parse_ro_board_platform record_ro_board_platform
+#define cpuinfo_arm_android_parse_ro_mediatek_platform record_ro_mediatek_platform
+#define cpuinfo_arm_android_parse_ro_arch record_ro_arch
+#define cpuinfo_arm_android_parse_ro_chipname record_ro_chipname
+#define cpuinfo_arm_android_parse_chipset_properties record_chipset_properties
+
+#include "../test/name/proc-cpuinfo-hardware.cc"
+#include "../test/name/ro-product-board.cc"
+#include "../test/name/ro-board-platform.cc"
+#include "../test/name/ro-mediatek-platform.cc"
+#include "../test/name/ro-arch.cc"
+#include "../test/name/ro-chipname.cc"
+#include "../test/name/android-properties.cc"
+
+static void report_strings(benchmark::State& state, size_t strings) {
+	state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(strings));
+	state.counters["strings"] = strings;
+	state.counters["time/string"] = benchmark::Counter(strings,
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+static void decode_property(benchmark::State& state,
+	uint32_t (*decode)(const char*, uint32_t, uint32_t), const std::vector<ChipsetProperty>* strings)
+{
+	for (auto _ : state) {
+		for (const ChipsetProperty& property : *strings) {
+			benchmark::DoNotOptimize(decode(property.value, property.cores, property.max_cpu_freq_max));
+		}
+	}
+	report_strings(state, strings->size());
+}
+
+static void decode_proc_cpuinfo_hardware(benchmark::State& state) {
+	for (auto _ : state) {
+		for (const ChipsetProperty& property : proc_cpuinfo_hardware_strings) {
+			benchmark::DoNotOptimize(cpuinfo_arm_android_decode_proc_cpuinfo_hardware(
+				property.value, property.cores, property.max_cpu_freq_max, property.is_tegra));
+		}
+	}
+	report_strings(state, proc_cpuinfo_hardware_strings.size());
+}
+
+static void decode_android_properties(benchmark::State& state) {
+	for (auto _ : state) {
+		for (const ChipsetProperties& properties : android_properties_strings) {
+			benchmark::DoNotOptimize(cpuinfo_arm_android_decode_chipset_properties(
+				properties.proc_cpuinfo_hardware, properties.ro_product_board, properties.ro_board_platform,
+				properties.ro_mediatek_platform, properties.ro_arch, properties.ro_chipname,
+				properties.cores, properties.max_cpu_freq_max));
+		}
+	}
+	report_strings(state, android_properties_strings.size());
+}
+
+int main(int argc, char** argv) {
+	/* Record test strings */
+	for (void (*test_case)() : test_cases()) {
+		test_case();
+	}
+
+	benchmark::RegisterBenchmark("decode_chipset/proc_cpuinfo_hardware", decode_proc_cpuinfo_hardware)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("decode_chipset/ro_product_board",
+			decode_property, cpuinfo_arm_android_decode_ro_product_board, &ro_product_board_strings)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("decode_chipset/ro_board_platform",
+			decode_property, cpuinfo_arm_android_decode_ro_board_platform, &ro_board_platform_strings)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("decode_chipset/ro_mediatek_platform",
+			decode_property, cpuinfo_arm_android_decode_ro_mediatek_platform, &ro_mediatek_platform_strings)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("decode_chipset/ro_arch",
+			decode_property, cpuinfo_arm_android_decode_ro_arch, &ro_arch_strings)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("decode_chipset/ro_chipname",
+			decode_property, cpuinfo_arm_android_decode_ro_chipname, &ro_chipname_strings)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("decode_chipset/android_properties", decode_android_properties)
+		->Unit(benchmark::kMicrosecond);
+
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+#include <decode-interface.h>
+
+
+/*
+ * Decoding of CPUID dumps of the corpus: vendor, microarchitecture, caches, TLBs, topology, ISA, and the brand string,
+ * as cpuinfo_initialize decodes them on every x86 system. Dumps are tools/cpuid-dump logs in CPUINFO_CPUID_DUMPS_DIR.
+ */
+
+static void cpuid_decode(benchmark::State& state, cpuinfo_mock_cpuid_dump dump) {
+	cpuinfo_x86_decoded_cpuid decoded;
+	for (auto _ : state) {
+		cpuinfo_x86_decode_cpuid_dump(dump.data, dump.entries, &decoded);
+		benchmark::DoNotOptimize(decoded);
+	}
+	state.counters["entries"] = dump.entries;
+}
+
+int main(int argc, char** argv) {
+	const char* directory_path = getenv("CPUINFO_CPUID_DUMPS_DIR");
+#ifdef CPUINFO_CPUID_DUMPS_DIR
+	if (directory_path == nullptr) {
+		directory_path = CPUINFO_CPUID_DUMPS_DIR;
+	}
+#endif
+	if (directory_path == nullptr) {
+		directory_path = "test/cpuid";
+	}
+
+	std::vector<std::string> names;
+	if (DIR* directory = opendir(directory_path)) {
+		while (const struct dirent* entry = readdir(directory)) {
+			const std::string name = entry->d_name;
+			if (name.size() > 4 && name.compare(name.size() - 4, 4, ".log") == 0) {
+				names.push_back(name.substr(0, name.size() - 4));
+			}
+		}
+		closedir(directory);
+	}
+	std::sort(names.begin(), names.end());
+
+	std::vector<std::pair<cpuinfo_mock_cpuid_dump*, uint32_t>> logs;
+	for (const std::string& name : names) {
+		const std::string path = std::string(directory_path) + "/" + name + ".log";
+		uint32_t processors_count = 0;
+		cpuinfo_mock_cpuid_dump* dumps = cpuinfo_mock_cpuid_from_log(path.c_str(), &processors_count);
+		if (dumps == nullptr) {
+			continue;
+		}
+		logs.emplace_back(dumps, processors_count);
+		for (uint32_t i = 0; i < processors_count; i++) {
+			/* Dumps of all processors of a log mostly repeat, except on hybrid processors */
+			if (dumps[i].data != nullptr) {
+				const std::string benchmark_name = processors_count == 1 ?
+					"cpuid_decode/" + name : "cpuid_decode/" + name + "/processor:" + std::to_string(i);
+				benchmark::RegisterBenchmark(benchmark_name.c_str(), cpuid_decode, dumps[i]);
+			}
+		}
+	}
+
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+	for (const auto& log : logs) {
+		cpuinfo_mock_free_cpuid_dumps(log.first, log.second);
+	}
+	return 0;
+}
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <cpuinfo.hpp>
+
+
+static uint32_t increment_portable(uint32_t x) {
+	benchmark::ClobberMemory();
+	return x + 1;
+}
+
+static uint32_t increment_tuned(uint32_t x) {
+	benchmark::ClobberMemory();
+	return x + 1;
+}
+
+struct tuned_impl {
+	typedef cpuinfo::requirements<cpuinfo::isa::x86_avx2, cpuinfo::isa::x86_fma3> requirements;
+	static uint32_t run(uint32_t x) { return increment_tuned(x); }
+};
+
+struct portable_impl {
+	typedef cpuinfo::requirements<> requirements;
+	static uint32_t run(uint32_t x) { return increment_portable(x); }
+};
+
+static void c_dispatch(benchmark::State& state) {
+	cpuinfo_initialize();
+	uint32_t x = 0;
+	while (state.KeepRunning()) {
+		if (cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3()) {
+			x = increment_tuned(x);
+		} else {
+			x = increment_portable(x);
+		}
+	}
+	benchmark::DoNotOptimize(x);
+}
+BENCHMARK(c_dispatch)->Unit(benchmark::kNanosecond);
+
+static void cxx_dispatch(benchmark::State& state) {
+	cpuinfo_initialize();
+	uint32_t x = 0;
+	while (state.KeepRunning()) {
+		x = cpuinfo::dispatch<tuned_impl, portable_impl>::run(x);
+	}
+	benchmark::DoNotOptimize(x);
+}
+BENCHMARK(cxx_dispatch)->Unit(benchmark::kNanosecond);
+
+static void cxx_resolved_dispatch(benchmark::State& state) {
+	cpuinfo_initialize();
+	uint32_t (*kernel)(uint32_t) = cpuinfo::dispatch<tuned_impl, portable_impl>::resolve<uint32_t(uint32_t)>();
+	benchmark::DoNotOptimize(kernel);
+	uint32_t x = 0;
+	while (state.KeepRunning()) {
+		x = kernel(x);
+	}
+	benchmark::DoNotOptimize(x);
+}
+BENCHMARK(cxx_resolved_dispatch)->Unit(benchmark::kNanosecond);
+
+static void c_processor_loop(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		uint32_t smt_id_sum = 0;
+		const uint32_t processors_count = cpuinfo_get_processors_count();
+		for (uint32_t i = 0; i < processors_count; i++) {
+			smt_id_sum += cpuinfo_get_processor(i)->smt_id;
+		}
+		benchmark::DoNotOptimize(smt_id_sum);
+	}
+}
+BENCHMARK(c_processor_loop)->Unit(benchmark::kNanosecond);
+
+static void cxx_processor_loop(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		uint32_t smt_id_sum = 0;
+		for (const cpuinfo_processor& processor : cpuinfo::processors()) {
+			smt_id_sum += processor.smt_id;
+		}
+		benchmark::DoNotOptimize(smt_id_sum);
+	}
+}
+BENCHMARK(cxx_processor_loop)->Unit(benchmark::kNanosecond);
+
+static void c_cache_sharing_loop(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		uint32_t core_id_sum = 0;
+		const uint32_t l2_count = cpuinfo_get_l2_caches_count();
+		for (uint32_t i = 0; i < l2_count; i++) {
+			const struct cpuinfo_cache* l2 = cpuinfo_get_l2_cache(i);
+			for (uint32_t j = 0; j < l2->processor_count; j++) {
+				core_id_sum += cpuinfo_get_processor(l2->processor_start + j)->core->core_id;
+			}
+		}
+		benchmark::DoNotOptimize(core_id_sum);
+	}
+}
+BENCHMARK(c_cache_sharing_loop)->Unit(benchmark::kNanosecond);
+
+static void cxx_cache_sharing_loop(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		uint32_t core_id_sum = 0;
+		for (const cpuinfo_cache& l2 : cpuinfo::l2_caches()) {
+			for (const cpuinfo_processor& processor : cpuinfo::processors(l2)) {
+				core_id_sum += processor.core->core_id;
+			}
+		}
+		benchmark::DoNotOptimize(core_id_sum);
+	}
+}
+BENCHMARK(cxx_cache_sharing_loop)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <cpuinfo.h>
+
+
+typedef uint32_t (*kernel_function)(uint32_t);
+
+static uint32_t increment_portable(uint32_t x) {
+	benchmark::ClobberMemory();
+	return x + 1;
+}
+
+static uint32_t increment_tuned(uint32_t x) {
+	benchmark::ClobberMemory();
+	return x + 1;
+}
+
+static cpuinfo_dispatch_table resolve_increment() {
+	static cpuinfo_isa_bits tuned_isa = { { 0 } };
+	cpuinfo_isa_bits_add(&tuned_isa, cpuinfo_isa_x86_avx2);
+	static const cpuinfo_dispatch_candidate candidates[] = {
+		{ reinterpret_cast<cpuinfo_dispatch_function>(increment_tuned), tuned_isa, NULL, 0, 0, NULL },
+		{ reinterpret_cast<cpuinfo_dispatch_function>(increment_portable), { { 0 } }, NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 2, NULL, NULL, 0 };
+	cpuinfo_dispatch_table_resolve(&table);
+	return table;
+}
+
+static void plain_indirect_call(benchmark::State& state) {
+	kernel_function kernel = increment_portable;
+	benchmark::DoNotOptimize(kernel);
+	uint32_t x = 0;
+	while (state.KeepRunning()) {
+		x = kernel(x);
+	}
+	benchmark::DoNotOptimize(x);
+}
+BENCHMARK(plain_indirect_call)->Unit(benchmark::kNanosecond);
+
+static void resolved_call(benchmark::State& state) {
+	cpuinfo_initialize();
+	cpuinfo_dispatch_table table = resolve_increment();
+	kernel_function kernel = reinterpret_cast<kernel_function>(cpuinfo_dispatch_get(&table));
+	benchmark::DoNotOptimize(kernel);
+	uint32_t x = 0;
+	while (state.KeepRunning()) {
+		x = kernel(x);
+	}
+	benchmark::DoNotOptimize(x);
+	cpuinfo_dispatch_table_release(&table);
+}
+BENCHMARK(resolved_call)->Unit(benchmark::kNanosecond);
+
+static void resolved_call_through_table(benchmark::State& state) {
+	cpuinfo_initialize();
+	cpuinfo_dispatch_table table = resolve_increment();
+	uint32_t x = 0;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(table);
+		x = reinterpret_cast<kernel_function>(cpuinfo_dispatch_get(&table))(x);
+	}
+	benchmark::DoNotOptimize(x);
+	cpuinfo_dispatch_table_release(&table);
+}
+BENCHMARK(resolved_call_through_table)->Unit(benchmark::kNanosecond);
+
+static void resolve(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		cpuinfo_dispatch_table table = resolve_increment();
+		benchmark::DoNotOptimize(table.function);
+		cpuinfo_dispatch_table_release(&table);
+	}
+}
+BENCHMARK(resolve)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+
+#include <cpuinfo.h>
+
+
+static void cpuinfo_measure_current_core_frequency(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		const uint64_t frequency = cpuinfo_measure_current_core_frequency();
+		benchmark::DoNotOptimize(frequency);
+	}
+}
+BENCHMARK(cpuinfo_measure_current_core_frequency)->Iterations(5)->Unit(benchmark::kMillisecond);
+
+static void cpuinfo_get_current_core_frequency(benchmark::State& state) {
+	cpuinfo_initialize();
+	cpuinfo_get_current_core_frequency();
+	while (state.KeepRunning()) {
+		const uint64_t frequency = cpuinfo_get_current_core_frequency();
+		benchmark::DoNotOptimize(frequency);
+	}
+}
+BENCHMARK(cpuinfo_get_current_core_frequency)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <stdint.h>
+
+#include <vector>
+
+
+/*
+ * GPU lookup on Android: the table of GPUs for known chipsets, which cpuinfo_initialize consults first, and decoding
+ * of the OpenGL ES GL_RENDERER string for other chipsets.
+ */
+
+extern "C" {
+	uint32_t cpuinfo_arm_android_lookup_chipset_gpu(uint32_t chipset_series, uint32_t chipset_model, char chipset_suffix);
+	uint32_t cpuinfo_android_decode_gpu_renderer(const char* renderer);
+}
+
+struct Chipset {
+	uint32_t series;
+	uint32_t model;
+};
+
+/* Chipsets with and without an entry in the GPU table, collected by a sweep over chipset series and models */
+static std::vector<Chipset> known_chipsets;
+static std::vector<Chipset> unknown_chipsets;
+
+static void collect_chipsets() {
+	for (uint32_t series = 1; series < 64; series++) {
+		for (uint32_t model = 0; model < 10000; model++) {
+			if (cpuinfo_arm_android_lookup_chipset_gpu(series, model, 0) != 0) {
+				known_chipsets.push_back(Chipset { series, model });
+			} else if (model % 97 == 0) {
+				unknown_chipsets.push_back(Chipset { series, model });
+			}
+		}
+	}
+}
+
+/* GL_RENDERER strings of Android GPUs, both in naming patterns of GPU series and special names */
+static const char* renderers[] = {
+	"Adreno (TM) 306",
+	"Adreno (TM) 430",
+	"Adreno (TM) 530",
+	"Adreno (TM) 540",
+	"GC1000 core",
+	"Immersion.16",
+	"Intel(R) HD Graphics for Atom(TM) x5/x7",
+	"Intel(R) HD Graphics for BayTrail",
+	"Mali-400 MP",
+	"Mali-450 MP",
+	"Mali-G71",
+	"Mali-G72",
+	"Mali-T628",
+	"Mali-T760",
+	"Mali-T880",
+	"Mesa DRI Intel(R) HD Graphics 400 (Braswell)",
+	"Mesa DRI Intel(R) Sandybridge Mobile x86/MMX/SSE2",
+	"NVIDIA Tegra",
+	"NVIDIA Tegra 3",
+	"PXA1928 GPU",
+	"PowerVR Rogue G6200",
+	"PowerVR Rogue GE8100",
+	"PowerVR Rogue GX6250",
+	"PowerVR Rogue Han",
+	"PowerVR Rogue Hood",
+	"PowerVR Rogue Marlowe",
+	"PowerVR SGX 540",
+	"PowerVR SGX 544MP",
+	"Sapphire 650",
+	"VideoCore IV HW",
+	"Vivante GC1000",
+	"Vivante GC7000UL",
+};
+
+static void report_lookups(benchmark::State& state, size_t lookups) {
+	state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(lookups));
+	state.counters["lookups"] = lookups;
+	state.counters["time/lookup"] = benchmark::Counter(lookups,
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+static void lookup_gpu(benchmark::State& state, const std::vector<Chipset>* chipsets) {
+	for (auto _ : state) {
+		for (const Chipset& chipset : *chipsets) {
+			benchmark::DoNotOptimize(cpuinfo_arm_android_lookup_chipset_gpu(chipset.series, chipset.model, 0));
+		}
+	}
+	report_lookups(state, chipsets->size());
+}
+
+static void decode_gpu_renderer(benchmark::State& state) {
+	for (auto _ : state) {
+		for (const char* renderer : renderers) {
+			benchmark::DoNotOptimize(cpuinfo_android_decode_gpu_renderer(renderer));
+		}
+	}
+	report_lookups(state, sizeof(renderers) / sizeof(renderers[0]));
+}
+BENCHMARK(decode_gpu_renderer)->Name("decode_gpu/gl_renderer")->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv) {
+	collect_chipsets();
+
+	benchmark::RegisterBenchmark("lookup_gpu/known_chipsets", lookup_gpu, &known_chipsets)
+		->Unit(benchmark::kMicrosecond);
+	benchmark::RegisterBenchmark("lookup_gpu/unknown_chipsets", lookup_gpu, &unknown_chipsets)
+		->Unit(benchmark::kMicrosecond);
+
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
@@ -4,10 +4,14 @@
 
 
 static void cpuinfo_initialize(benchmark::State& state) {
-	while (state.KeepRunning()) {
+	for (auto _ : state) {
 		cpuinfo_initialize();
+
+		state.PauseTiming();
+		cpuinfo_deinitialize();
+		state.ResumeTiming();
 	}
 }
-BENCHMARK(cpuinfo_initialize)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(cpuinfo_initialize)->Unit(benchmark::kMillisecond);
 
 BENCHMARK_MAIN();
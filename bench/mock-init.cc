@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+#include <corpus.h>
+
+
+/*
+ * Initialization on every device of the mock corpus. cpuinfo_deinitialize() resets the library after every iteration,
+ * so each iteration detects the topology from scratch. Besides time, benchmarks report memory allocations and accesses
+ * to the mock filesystem per initialization.
+ */
+
+#if defined(__GLIBC__)
+/* Counts allocations in the measured region by interposing the glibc allocator */
+extern "C" {
+	void* __libc_malloc(size_t size);
+	void* __libc_calloc(size_t count, size_t size);
+	void* __libc_realloc(void* pointer, size_t size);
+}
+
+static bool count_allocations = false;
+static uint64_t allocations = 0;
+static uint64_t allocated_bytes = 0;
+
+static inline void record_allocation(size_t size) {
+	if (count_allocations) {
+		allocations += 1;
+		allocated_bytes += size;
+	}
+}
+
+extern "C" void* malloc(size_t size) {
+	record_allocation(size);
+	return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+	record_allocation(count * size);
+	return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size) {
+	record_allocation(size);
+	return __libc_realloc(pointer, size);
+}
+#endif
+
+struct InitStats {
+	uint64_t nanoseconds = 0;
+	uint64_t allocations = 0;
+	uint64_t allocated_bytes = 0;
+	uint64_t files_opened = 0;
+	uint64_t files_missing = 0;
+	uint64_t bytes_read = 0;
+};
+
+static uint64_t get_nanoseconds() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+/* Initializes cpuinfo on the installed mock data, measures, and deinitializes it */
+static bool measure_initialize(InitStats& stats) {
+	cpuinfo_mock_filesystem_stats filesystem_start, filesystem_end;
+	cpuinfo_mock_get_filesystem_stats(&filesystem_start);
+#if defined(__GLIBC__)
+	const uint64_t allocations_start = allocations, allocated_bytes_start = allocated_bytes;
+	count_allocations = true;
+#endif
+
+	const uint64_t start = get_nanoseconds();
+	const bool initialized = cpuinfo_initialize();
+	const uint64_t end = get_nanoseconds();
+
+#if defined(__GLIBC__)
+	count_allocations = false;
+	stats.allocations += allocations - allocations_start;
+	stats.allocated_bytes += allocated_bytes - allocated_bytes_start;
+#endif
+	cpuinfo_mock_get_filesystem_stats(&filesystem_end);
+	stats.files_opened += filesystem_end.files_opened - filesystem_start.files_opened;
+	stats.files_missing += filesystem_end.files_missing - filesystem_start.files_missing;
+	stats.bytes_read += filesystem_end.bytes_read - filesystem_start.bytes_read;
+	stats.nanoseconds = end - start;
+
+	const bool detected = initialized && cpuinfo_get_processors_count() != 0;
+	cpuinfo_deinitialize();
+	return detected;
+}
+
+static void report_stats(benchmark::State& state, const InitStats& stats, uint32_t processors_count) {
+	state.counters["processors"] = processors_count;
+#if defined(__GLIBC__)
+	state.counters["allocations"] = benchmark::Counter(stats.allocations, benchmark::Counter::kAvgIterations);
+	state.counters["allocated_bytes"] = benchmark::Counter(stats.allocated_bytes,
+		benchmark::Counter::kAvgIterations, benchmark::Counter::kIs1024);
+#endif
+	state.counters["files_opened"] = benchmark::Counter(stats.files_opened, benchmark::Counter::kAvgIterations);
+	state.counters["files_missing"] = benchmark::Counter(stats.files_missing, benchmark::Counter::kAvgIterations);
+	state.counters["bytes_read"] = benchmark::Counter(stats.bytes_read,
+		benchmark::Counter::kAvgIterations, benchmark::Counter::kIs1024);
+}
+
+static void cpuinfo_initialize_mock_dump(benchmark::State& state, MockDump* dump) {
+	if (!dump->error().empty()) {
+		state.SkipWithError(dump->error().c_str());
+		return;
+	}
+	dump->install();
+	/* Number of processors of the device, which the benchmark reports */
+	uint32_t processors_count = 0;
+	if (cpuinfo_initialize()) {
+		processors_count = cpuinfo_get_processors_count();
+	}
+	cpuinfo_deinitialize();
+
+	InitStats stats;
+	for (auto _ : state) {
+		if (!measure_initialize(stats)) {
+			state.SkipWithError("cpuinfo failed to initialize on the mock dump");
+			break;
+		}
+		state.SetIterationTime((double) stats.nanoseconds * 1.0e-9);
+	}
+	report_stats(state, stats, processors_count);
+}
+
+int main(int argc, char** argv) {
+	std::vector<std::unique_ptr<MockDump>> dumps;
+	for (const std::string& name : list_mock_dumps()) {
+		dumps.emplace_back(new MockDump(name));
+		std::string device = name;
+		if (device.size() > 2 && device.compare(device.size() - 2, 2, ".h") == 0) {
+			device.resize(device.size() - 2);
+		}
+		benchmark::RegisterBenchmark(("cpuinfo_initialize_mock/" + device).c_str(),
+				cpuinfo_initialize_mock_dump, dumps.back().get())
+			->UseManualTime()
+			->Unit(benchmark::kMicrosecond);
+	}
+
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
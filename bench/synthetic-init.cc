@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <stdint.h>
+#include <time.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+#include <synthetic-topology.h>
+
+
+/*
+ * Scaling of initialization with the number of logical processors, on synthetic servers of 16 to 4096 processors.
+ * cpuinfo_deinitialize() resets the library after every iteration, so each iteration detects the topology from
+ * scratch. The benchmark fits the time to a complexity class: detection sorts processors, and is expected to take
+ * O(N log N) time for N processors. On ARM64 mock filesystem lookups add another logarithmic factor, which real sysfs
+ * does not have.
+ */
+
+static uint64_t get_nanoseconds() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+static void cpuinfo_initialize_synthetic(benchmark::State& state) {
+	SyntheticTopology topology(
+		(uint32_t) state.range(0), (uint32_t) state.range(1), (uint32_t) state.range(2), (uint32_t) state.range(3));
+	topology.install();
+
+	for (auto _ : state) {
+		const uint64_t start = get_nanoseconds();
+		const bool initialized = cpuinfo_initialize();
+		const uint64_t end = get_nanoseconds();
+		const bool detected = initialized && cpuinfo_get_processors_count() == topology.processors_count();
+		cpuinfo_deinitialize();
+		if (!detected) {
+			state.SkipWithError("cpuinfo failed to initialize on the synthetic topology");
+			break;
+		}
+		state.SetIterationTime((double) (end - start) * 1.0e-9);
+	}
+	state.SetComplexityN(topology.processors_count());
+	state.counters["processors"] = topology.processors_count();
+	state.counters["time/processor"] = benchmark::Counter(topology.processors_count(),
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK(cpuinfo_initialize_synthetic)
+	->ArgNames({"packages", "dies", "cores", "threads"})
+	->Args({1, 1, 8, 2})
+	->Args({1, 1, 32, 2})
+	->Args({2, 1, 32, 2})
+	->Args({2, 2, 32, 2})
+	->Args({2, 4, 32, 2})
+	->Args({4, 4, 32, 2})
+	->Args({8, 4, 32, 2})
+	->Args({8, 4, 64, 2})
+	->UseManualTime()
+	->Complexity()
+	->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
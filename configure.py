@@ -17,14 +17,15 @@ def main(args):
         "CPUINFO_MOCK": int(options.mock)
     }
 
-    build.export_cpath("include", ["cpuinfo.h"])
+    build.export_cpath("include", ["cpuinfo.h", "cpuinfo.hpp"])
 
     with build.options(source_dir="src", macros=macros, extra_include_dirs="src"):
-        sources = ["init.c", "api.c", "log.c"]
+        sources = ["init.c", "api.c", "log.c", "throughput.c", "uarch-info.c", "blocking.c", "isa-bits.c",
+            "dispatch.c", "core-classes.c"]
         if build.target.is_x86 or build.target.is_x86_64:
             sources += [
                 "x86/init.c", "x86/info.c", "x86/vendor.c", "x86/uarch.c", "x86/name.c",
-                "x86/topology.c",
+                "x86/topology.c", "x86/amx.c", "x86/xsave.c",
                 "x86/cache/init.c", "x86/cache/descriptor.c", "x86/cache/deterministic.c",
             ]
             if build.target.is_macos:
@@ -33,6 +34,7 @@ def main(args):
                 sources += [
                     "x86/linux/init.c",
                     "x86/linux/cpuinfo.c",
+                    "x86/linux/hybrid.c",
                 ]
             sources.append("x86/isa.c" if not build.target.is_nacl else "x86/nacl/isa.c")
         if build.target.is_arm or build.target.is_arm64:
@@ -65,9 +67,13 @@ def main(args):
                 "linux/smallfile.c",
                 "linux/multiline.c",
                 "linux/processors.c",
+                "linux/cache.c",
+                "linux/frequency.c",
+                "linux/latency.c",
+                "linux/sve.c",
             ]
             if options.mock:
-                sources += ["linux/mockfile.c"]
+                sources += ["linux/mockfile.c", "linux/mockdump.c"]
         if build.target.is_android:
             sources.append("linux/gpu.c")
             if options.mock:
@@ -80,6 +86,9 @@ def main(args):
         build.executable("cpu-info", build.cc("cpu-info.c"))
         build.executable("isa-info", build.cc("isa-info.c"))
         build.executable("cache-info", build.cc("cache-info.c"))
+        if build.target.is_linux or build.target.is_android:
+            build.executable("frequency-info", build.cc("frequency-info.c"))
+            build.executable("core-latency", build.cc("core-latency.c"))
 
     if build.target.is_x86_64:
         with build.options(source_dir="tools", include_dirs=["src", "include"]):
@@ -87,20 +96,42 @@ def main(args):
 
     with build.options(source_dir="test", deps=[build, build.deps.googletest]):
         build.smoketest("init-test", build.cxx("init.cc"))
+        build.smoketest("dispatch-test", build.cxx("dispatch.cc"))
+        build.smoketest("cpuinfo-hpp-test", build.cxx("cpuinfo-hpp.cc"))
         if build.target.is_linux:
             build.smoketest("get-current-test", build.cxx("get-current.cc"))
+            build.smoketest("frequency-test", build.cxx("frequency.cc"))
+            build.smoketest("core-latency-test", build.cxx("core-latency.cc"))
         if build.target.is_x86_64:
             build.smoketest("brand-string-test", build.cxx("name/brand-string.cc"))
     if options.mock:
-        with build.options(source_dir="test", include_dirs="test", macros="CPUINFO_MOCK", deps=[build, build.deps.googletest]):
+        with build.options(source_dir="test", include_dirs=["test", "test/mock"], macros="CPUINFO_MOCK", deps=[build, build.deps.googletest]):
             if build.target.is_arm64 and build.target.is_linux:
                 build.unittest("scaleway-test", build.cxx("scaleway.cc"))
+            if (build.target.is_x86_64 or build.target.is_arm64) and build.target.is_linux:
+                build.unittest("synthetic-server-test", build.cxx("mock/synthetic-server.cc"))
+            if build.target.is_linux or build.target.is_android:
+                build.unittest("mock-corpus-test", build.cxx("mock/corpus.cc"))
+        with build.options(source_dir="test", include_dirs=["src", "test/cpuid"], macros="CPUINFO_MOCK", deps=[build, build.deps.googletest]):
+            if build.target.is_x86_64 and build.target.is_linux:
+                build.unittest("cpuid-decode-test", [build.cxx("cpuid/decode.cc"), build.cc("cpuid/decode-interface.c")])
+        with build.options(source_dir="bench", include_dirs="test/mock", macros="CPUINFO_MOCK", deps=[build, build.deps.googlebenchmark]):
+            if (build.target.is_x86_64 or build.target.is_arm64) and build.target.is_linux:
+                build.benchmark("mock-init-bench", build.cxx("mock-init.cc"))
+                build.benchmark("synthetic-init-bench", build.cxx("synthetic-init.cc"))
+        with build.options(source_dir=".", include_dirs=["src", "test/cpuid"], macros="CPUINFO_MOCK", deps=[build, build.deps.googlebenchmark]):
+            if build.target.is_x86_64 and build.target.is_linux:
+                build.benchmark("cpuid-decode-bench", [build.cxx("bench/cpuid-decode.cc"), build.cc("test/cpuid/decode-interface.c")])
 
     if not options.mock:
         with build.options(source_dir="bench", deps=[build, build.deps.googlebenchmark]):
             build.benchmark("init-bench", build.cxx("init.cc"))
+            build.benchmark("blocking-bench", build.cxx("blocking.cc"))
+            build.benchmark("dispatch-bench", build.cxx("dispatch.cc"))
+            build.benchmark("cpuinfo-hpp-bench", build.cxx("cpuinfo-hpp.cc"))
             if not build.target.is_macos:
                 build.benchmark("get-current-bench", build.cxx("get-current.cc"))
+                build.benchmark("frequency-bench", build.cxx("frequency.cc"))
 
     return build
 
@@ -36,8 +36,31 @@ extern "C" {
 	};
 
 	void CPUINFO_ABI cpuinfo_mock_set_cpuid(struct cpuinfo_mock_cpuid* dump, size_t entries);
+	/* Overrides CPUID dump for one logical processor, e.g. for cores of different types in a hybrid processor */
+	void CPUINFO_ABI cpuinfo_mock_set_processor_cpuid(uint32_t processor, struct cpuinfo_mock_cpuid* dump, size_t entries);
+	/* Emulates migration to a logical processor: UINT32_MAX restores the default dump */
+	void CPUINFO_ABI cpuinfo_mock_select_processor_cpuid(uint32_t processor);
 	void CPUINFO_ABI cpuinfo_mock_get_cpuid(uint32_t eax, uint32_t regs[4]);
 	void CPUINFO_ABI cpuinfo_mock_get_cpuidex(uint32_t eax, uint32_t ecx, uint32_t regs[4]);
+	void CPUINFO_ABI cpuinfo_mock_set_xcr0(uint64_t xcr0);
+	uint64_t CPUINFO_ABI cpuinfo_mock_xgetbv(uint32_t ext_ctrl_reg);
+
+	/* CPUID dump of one logical processor */
+	struct cpuinfo_mock_cpuid_dump {
+		struct cpuinfo_mock_cpuid* data;
+		uint32_t entries;
+	};
+
+	/*
+	 * Parses output of tools/cpuid-dump into CPUID dumps of logical processors. In logs of all processors (cpuid-dump
+	 * --all-processors) a "CPU <n>:" line precedes the dump of every processor; other logs describe processor 0.
+	 * Returns the array of dumps indexed by processor (data is NULL for processors without a dump) and stores its
+	 * length in processors_count, or returns NULL on failure.
+	 */
+	struct cpuinfo_mock_cpuid_dump* CPUINFO_ABI cpuinfo_mock_cpuid_from_log(const char* filename, uint32_t* processors_count);
+	/* Installs dumps of logical processors: the first dump is also the default one, as in cpuinfo_mock_set_cpuid */
+	void CPUINFO_ABI cpuinfo_mock_set_cpuid_dumps(struct cpuinfo_mock_cpuid_dump* dumps, uint32_t processors_count);
+	void CPUINFO_ABI cpuinfo_mock_free_cpuid_dumps(struct cpuinfo_mock_cpuid_dump* dumps, uint32_t processors_count);
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
 
 struct cpuinfo_mock_file {
@@ -52,17 +75,50 @@ struct cpuinfo_mock_property {
 	const char* value;
 };
 
+/* Accesses to the mock filesystem since it was installed with cpuinfo_mock_filesystem */
+struct cpuinfo_mock_filesystem_stats {
+	/* Successful calls to cpuinfo_mock_open */
+	uint32_t files_opened;
+	/* Calls to cpuinfo_mock_open for files absent in the mock filesystem */
+	uint32_t files_missing;
+	uint64_t bytes_read;
+};
+
+/* Number of times cache geometry of clusters was computed for cpuinfo_get_cluster_blocking since initialization */
+uint32_t CPUINFO_ABI cpuinfo_mock_get_cluster_geometry_computations(void);
+
 #if defined(__linux__)
 	void CPUINFO_ABI cpuinfo_mock_filesystem(struct cpuinfo_mock_file* files);
 	int CPUINFO_ABI cpuinfo_mock_open(const char* path, int oflag);
 	int CPUINFO_ABI cpuinfo_mock_close(int fd);
 	ssize_t CPUINFO_ABI cpuinfo_mock_read(int fd, void* buffer, size_t capacity);
-
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
-		void CPUINFO_ABI cpuinfo_set_hwcap(uint32_t hwcap);
+	void CPUINFO_ABI cpuinfo_mock_get_filesystem_stats(struct cpuinfo_mock_filesystem_stats* stats);
+
+	/*
+	 * Loaders of filesystem dumps at run-time. Dumps are either directory trees which mirror the dumped files (e.g.
+	 * <root>/proc/cpuinfo), or archives, i.e. C headers which scripts/android-filesystem-dump.py and
+	 * scripts/arm-linux-filesystem-dump.py generate. Loaders return NULL on failure, and the results must be released
+	 * with the matching cpuinfo_mock_free_* function after cpuinfo no longer uses them.
+	 */
+	struct cpuinfo_mock_file* CPUINFO_ABI cpuinfo_mock_filesystem_from_directory(const char* root);
+	struct cpuinfo_mock_file* CPUINFO_ABI cpuinfo_mock_filesystem_from_archive(const char* filename);
+	void CPUINFO_ABI cpuinfo_mock_free_filesystem(struct cpuinfo_mock_file* files);
+	/* Archives of non-Android systems produce an empty list of properties */
+	struct cpuinfo_mock_property* CPUINFO_ABI cpuinfo_mock_properties_from_archive(const char* filename);
+	void CPUINFO_ABI cpuinfo_mock_free_properties(struct cpuinfo_mock_property* properties);
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		/* Loads the named CPUID dump array (e.g. "cpuid_dump") from an archive; release the result with free() */
+		struct cpuinfo_mock_cpuid* CPUINFO_ABI cpuinfo_mock_cpuid_from_archive(const char* filename, const char* name, size_t* entries);
 	#endif
+
+	/* Sets the result of the maximum SVE vector length query, in bytes, or -1 if SVE is not supported */
+	void CPUINFO_ABI cpuinfo_set_sve_vl(int vl);
 	#if CPUINFO_ARCH_ARM
+		void CPUINFO_ABI cpuinfo_set_hwcap(uint32_t hwcap);
 		void CPUINFO_ABI cpuinfo_set_hwcap2(uint32_t hwcap2);
+	#elif CPUINFO_ARCH_ARM64
+		void CPUINFO_ABI cpuinfo_set_hwcap(uint64_t hwcap);
+		void CPUINFO_ABI cpuinfo_set_hwcap2(uint64_t hwcap2);
 	#endif
 #endif
 
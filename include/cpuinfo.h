@@ -272,6 +272,10 @@ enum cpuinfo_uarch {
 	cpuinfo_uarch_sky_lake     = 0x0010020A,
 	/** Intel Kaby Lake microarchitecture. */
 	cpuinfo_uarch_kaby_lake    = 0x0010020B,
+	/** Intel Sunny Cove microarchitecture (Ice Lake). */
+	cpuinfo_uarch_sunny_cove   = 0x0010020C,
+	/** Intel Golden Cove microarchitecture (Sapphire Rapids, performance cores of Alder Lake). */
+	cpuinfo_uarch_golden_cove  = 0x0010020D,
 
 	/** Pentium 4 with Willamette, Northwood, or Foster cores. */
 	cpuinfo_uarch_willamette = 0x00100300,
@@ -286,6 +290,8 @@ enum cpuinfo_uarch {
 	cpuinfo_uarch_silvermont = 0x00100402,
 	/** Intel Airmont microarchitecture (14 nm out-of-order Atom). */
 	cpuinfo_uarch_airmont    = 0x00100403,
+	/** Intel Gracemont microarchitecture (Intel 7 out-of-order Atom, efficiency cores of Alder Lake and Raptor Lake). */
+	cpuinfo_uarch_gracemont  = 0x00100404,
 
 	/** Intel Knights Ferry HPC boards. */
 	cpuinfo_uarch_knights_ferry   = 0x00100500,
@@ -376,6 +382,11 @@ enum cpuinfo_uarch {
 	/** ARM Cortex-A75. */
 	cpuinfo_uarch_cortex_a75 = 0x00300375,
 
+	/** ARM Neoverse N1. */
+	cpuinfo_uarch_neoverse_n1 = 0x00300400,
+	/** ARM Neoverse V1. */
+	cpuinfo_uarch_neoverse_v1 = 0x00300402,
+
 	/** Qualcomm Scorpion. */
 	cpuinfo_uarch_scorpion = 0x00400100,
 	/** Qualcomm Krait. */
@@ -410,6 +421,8 @@ enum cpuinfo_uarch {
 
 	/** Cavium ThunderX. */
 	cpuinfo_uarch_thunderx = 0x00800100,
+	/** Cavium ThunderX2 (originally Broadcom Vulcan). */
+	cpuinfo_uarch_thunderx2 = 0x00800101,
 
 	/** Marvell PJ4. */
 	cpuinfo_uarch_pj4 = 0x00900100,
@@ -481,8 +494,15 @@ struct cpuinfo_core {
 	/** Value of Main ID Register (MIDR) for this core */
 	uint32_t midr;
 #endif
-	/** Clock rate (non-Turbo) of the core, in Hz */
+	/**
+	 * Clock rate (non-Turbo) of the core, in Hz, as reported by the OS.
+	 *
+	 * Stays 0 if the OS does not report it, e.g. without cpufreq on Linux: it is never filled in by measurement.
+	 * Callers which need a frequency in this case use cpuinfo_get_current_core_frequency().
+	 */
 	uint64_t frequency;
+	/** Performance class of the core: 0 for the highest-performance cores (see cpuinfo_get_core_class) */
+	uint32_t core_class;
 };
 
 struct cpuinfo_cluster {
@@ -509,8 +529,16 @@ struct cpuinfo_cluster {
 	/** Value of Main ID Register (MIDR) of the cores in the cluster */
 	uint32_t midr;
 #endif
-	/** Clock rate (non-Turbo) of the cores in the cluster, in Hz */
+	/**
+	 * Clock rate (non-Turbo) of the cores in the cluster, in Hz, as reported by the OS, or 0 if the OS does not report
+	 * it. See cpuinfo_core::frequency.
+	 */
 	uint64_t frequency;
+	/**
+	 * Performance of the cores in the cluster relative to the highest-performance cores in the system, which have
+	 * capacity 1024. Clusters with higher capacity are faster. 0 if the operating system does not report capacity.
+	 */
+	uint32_t capacity;
 };
 
 #define CPUINFO_PACKAGE_NAME_MAX 48
@@ -537,14 +565,609 @@ struct cpuinfo_package {
 	uint32_t cluster_count;
 };
 
+/**
+ * Cores with the same performance, possibly in several clusters (e.g. identical clusters of a server processor).
+ *
+ * Core classes are ordered by decreasing per-core performance: class 0 contains the fastest cores in the system,
+ * and the last class contains the most efficient ones. Processors with cores of a single type have one core class.
+ */
+struct cpuinfo_core_class {
+	/** Index of the first cluster of the class in the order of cpuinfo_get_cluster_by_performance() */
+	uint32_t cluster_start;
+	/** Number of clusters in the class */
+	uint32_t cluster_count;
+	/** Number of cores in the class */
+	uint32_t core_count;
+	/** Number of logical processors in the class */
+	uint32_t processor_count;
+	/** Logical processors of the cores in the class, in the order of cpuinfo_get_processors() */
+	const struct cpuinfo_processor* const* processors;
+	/** Estimated performance of a core relative to cores of class 0, which have performance 1024 */
+	uint32_t performance;
+};
+
+/**
+ * Theoretical peak throughput of a core, or a group of cores.
+ *
+ * Per-cycle rates are derived from the microarchitecture and the instruction set extensions supported by the
+ * processor and the OS. Per-second rates additionally use the core frequency, and are zero if it is unknown.
+ * For clusters and packages, rates are summed over all cores in the group.
+ */
+struct cpuinfo_throughput {
+	/** Peak single-precision floating-point operations per cycle. Fused multiply-add counts as 2 operations. */
+	uint32_t fp32_ops_per_cycle;
+	/** Peak double-precision floating-point operations per cycle. Fused multiply-add counts as 2 operations. */
+	uint32_t fp64_ops_per_cycle;
+	/** Peak 8-bit integer operations per cycle. Multiply-accumulate counts as 2 operations. */
+	uint32_t int8_ops_per_cycle;
+	/** Peak number of bytes loaded from L1 data cache per cycle */
+	uint32_t load_bytes_per_cycle;
+	/** Peak number of bytes stored to L1 data cache per cycle */
+	uint32_t store_bytes_per_cycle;
+	/** Clock rate of the cores, in Hz, or 0 if it is unknown or different for cores in the group */
+	uint64_t frequency;
+	/** Peak single-precision floating-point operations per second */
+	uint64_t fp32_ops_per_second;
+	/** Peak double-precision floating-point operations per second */
+	uint64_t fp64_ops_per_second;
+	/** Peak 8-bit integer operations per second */
+	uint64_t int8_ops_per_second;
+	/** Peak L1 data cache load bandwidth, in bytes per second */
+	uint64_t load_bytes_per_second;
+	/** Peak L1 data cache store bandwidth, in bytes per second */
+	uint64_t store_bytes_per_second;
+};
+
+/**
+ * Approximate performance characteristics of a microarchitecture.
+ *
+ * The numbers describe peak rates of a single core and come from vendor optimization manuals and public
+ * microbenchmark data. They are meant for heuristics, such as selection of kernels and blocking parameters.
+ */
+struct cpuinfo_uarch_info {
+	/** Microarchitecture described by this structure */
+	enum cpuinfo_uarch uarch;
+	/** Maximum number of instructions decoded per cycle */
+	uint32_t decode_width;
+	/** Maximum number of micro-operations issued to execution units per cycle */
+	uint32_t issue_width;
+	/** Width, in bits, of the SIMD datapath of execution units, or 0 if the core has no SIMD unit */
+	uint32_t vector_bits;
+	/** Number of units executing floating-point multiply-add (or multiplication, if FMA is not supported) */
+	uint32_t fma_units;
+	/** Number of SIMD units executing integer multiplication */
+	uint32_t int_vector_units;
+	/** Maximum number of loads per cycle */
+	uint32_t load_units;
+	/** Maximum number of stores per cycle */
+	uint32_t store_units;
+	/** Width, in bits, of each load and store port */
+	uint32_t load_store_bits;
+	/** Load-to-use latency of L1 data cache, in cycles */
+	uint32_t l1d_latency;
+	/** Size of the out-of-order window (reorder buffer), in micro-operations, or 0 for in-order cores */
+	uint32_t rob_size;
+	/** Heavy AVX-512 instructions reduce clock frequency of the core */
+	bool avx512_frequency_drop;
+};
+
+/**
+ * Recommended cache blocking parameters for GEMM-like computations (including convolutions lowered to GEMM) on a
+ * cluster of cores. The parameters follow the BLIS/GotoBLAS loop structure: C (m x n) += A (m x k) * B (k x n) is
+ * computed in mr x nr register tiles, with mc x kc blocks of A resident in L2 and kc x nc panels of B in L3.
+ */
+struct cpuinfo_blocking {
+	/** Number of rows in the register tile, as specified by the caller */
+	uint32_t mr;
+	/** Number of columns in the register tile, as specified by the caller */
+	uint32_t nr;
+	/** Number of rows in the block of A. Multiple of mr. */
+	uint32_t mc;
+	/** Depth of the blocks of A and B: mr x kc and kc x nr micro-panels fit in L1 data cache */
+	uint32_t kc;
+	/** Number of columns in the panel of B. Multiple of nr. */
+	uint32_t nc;
+	/** Bytes of L1 data cache available to one thread for resident tiles, or 0 if there is no L1 data cache */
+	uint32_t l1_tile_bytes;
+	/** Bytes of L2 cache available to one thread for resident tiles, or 0 if there is no L2 cache */
+	uint32_t l2_tile_bytes;
+	/** Bytes of L3 cache available to one thread for resident tiles, or 0 if there is no L3 cache */
+	uint32_t l3_tile_bytes;
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 bool CPUINFO_ABI cpuinfo_initialize(void);
 
+/**
+ * Releases all memory allocated by cpuinfo_initialize() and functions which memoize their results, and resets the
+ * library to the uninitialized state: a subsequent cpuinfo_initialize() detects the processor from scratch.
+ * Pointers returned by cpuinfo functions become invalid. Must not run concurrently with any other cpuinfo function.
+ */
 void CPUINFO_ABI cpuinfo_deinitialize(void);
 
+/**
+ * Compile-time instruction set baseline.
+ *
+ * CPUINFO_BASELINE_<FEATURE> is 1 if the compilation target guarantees the feature, and cpuinfo_has_<feature>() then
+ * folds to a constant true, letting the compiler eliminate fallback code paths. By default the baseline is detected
+ * from predefined compiler macros, such as __AVX2__ with -mavx2 or -march=x86-64-v3. Each macro can be defined to 0
+ * or 1 on the command line to override detection, and CPUINFO_BASELINE_DETECT=0 disables detection altogether.
+ *
+ * Features which need register state enabled by the operating system (AVX and AVX-512 in XCR0, SVE in the kernel) are
+ * folded too: the compiler emits their instructions throughout a translation unit built for them, and detection only
+ * reports them if the operating system enables their state, so a host without it fails the baseline check.
+ *
+ * cpuinfo_initialize() fails if the host lacks a feature in the baseline of the library build. Code compiled with a
+ * different baseline than the library calls cpuinfo_check_baseline() after cpuinfo_initialize() to verify its own.
+ */
+#ifndef CPUINFO_BASELINE_DETECT
+	#if defined(CPUINFO_MOCK) && CPUINFO_MOCK
+		/* Mock builds emulate processors unrelated to the compilation target */
+		#define CPUINFO_BASELINE_DETECT 0
+	#else
+		#define CPUINFO_BASELINE_DETECT 1
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SSE
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_X86 && (defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+		#define CPUINFO_BASELINE_X86_SSE 1
+	#else
+		#define CPUINFO_BASELINE_X86_SSE 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SSE2
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_X86 && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+		#define CPUINFO_BASELINE_X86_SSE2 1
+	#else
+		#define CPUINFO_BASELINE_X86_SSE2 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SSE3
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__SSE3__))
+		#define CPUINFO_BASELINE_X86_SSE3 1
+	#else
+		#define CPUINFO_BASELINE_X86_SSE3 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SSSE3
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__SSSE3__))
+		#define CPUINFO_BASELINE_X86_SSSE3 1
+	#else
+		#define CPUINFO_BASELINE_X86_SSSE3 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SSE4_1
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__SSE4_1__))
+		#define CPUINFO_BASELINE_X86_SSE4_1 1
+	#else
+		#define CPUINFO_BASELINE_X86_SSE4_1 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SSE4_2
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__SSE4_2__))
+		#define CPUINFO_BASELINE_X86_SSE4_2 1
+	#else
+		#define CPUINFO_BASELINE_X86_SSE4_2 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX__))
+		#define CPUINFO_BASELINE_X86_AVX 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_FMA3
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__FMA__))
+		#define CPUINFO_BASELINE_X86_FMA3 1
+	#else
+		#define CPUINFO_BASELINE_X86_FMA3 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_F16C
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__F16C__))
+		#define CPUINFO_BASELINE_X86_F16C 1
+	#else
+		#define CPUINFO_BASELINE_X86_F16C 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX2
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX2__))
+		#define CPUINFO_BASELINE_X86_AVX2 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX2 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512F
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512F__))
+		#define CPUINFO_BASELINE_X86_AVX512F 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512F 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512CD
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512CD__))
+		#define CPUINFO_BASELINE_X86_AVX512CD 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512CD 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512DQ
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512DQ__))
+		#define CPUINFO_BASELINE_X86_AVX512DQ 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512DQ 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512BW
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512BW__))
+		#define CPUINFO_BASELINE_X86_AVX512BW 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512BW 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512VL
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512VL__))
+		#define CPUINFO_BASELINE_X86_AVX512VL 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512VL 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512VNNI
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512VNNI__))
+		#define CPUINFO_BASELINE_X86_AVX512VNNI 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512VNNI 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512BF16
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512BF16__))
+		#define CPUINFO_BASELINE_X86_AVX512BF16 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512BF16 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVX512FP16
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVX512FP16__))
+		#define CPUINFO_BASELINE_X86_AVX512FP16 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVX512FP16 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AVXVNNI
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AVXVNNI__))
+		#define CPUINFO_BASELINE_X86_AVXVNNI 1
+	#else
+		#define CPUINFO_BASELINE_X86_AVXVNNI 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_MOVBE
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__MOVBE__))
+		#define CPUINFO_BASELINE_X86_MOVBE 1
+	#else
+		#define CPUINFO_BASELINE_X86_MOVBE 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_LZCNT
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__LZCNT__))
+		#define CPUINFO_BASELINE_X86_LZCNT 1
+	#else
+		#define CPUINFO_BASELINE_X86_LZCNT 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_POPCNT
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__POPCNT__))
+		#define CPUINFO_BASELINE_X86_POPCNT 1
+	#else
+		#define CPUINFO_BASELINE_X86_POPCNT 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_BMI
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__BMI__))
+		#define CPUINFO_BASELINE_X86_BMI 1
+	#else
+		#define CPUINFO_BASELINE_X86_BMI 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_BMI2
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__BMI2__))
+		#define CPUINFO_BASELINE_X86_BMI2 1
+	#else
+		#define CPUINFO_BASELINE_X86_BMI2 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_ADX
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__ADX__))
+		#define CPUINFO_BASELINE_X86_ADX 1
+	#else
+		#define CPUINFO_BASELINE_X86_ADX 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_AES
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__AES__))
+		#define CPUINFO_BASELINE_X86_AES 1
+	#else
+		#define CPUINFO_BASELINE_X86_AES 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_PCLMULQDQ
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__PCLMUL__))
+		#define CPUINFO_BASELINE_X86_PCLMULQDQ 1
+	#else
+		#define CPUINFO_BASELINE_X86_PCLMULQDQ 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_SHA
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__SHA__))
+		#define CPUINFO_BASELINE_X86_SHA 1
+	#else
+		#define CPUINFO_BASELINE_X86_SHA 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_RDRAND
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__RDRND__))
+		#define CPUINFO_BASELINE_X86_RDRAND 1
+	#else
+		#define CPUINFO_BASELINE_X86_RDRAND 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_X86_RDSEED
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && (defined(__RDSEED__))
+		#define CPUINFO_BASELINE_X86_RDSEED 1
+	#else
+		#define CPUINFO_BASELINE_X86_RDSEED 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_IDIV
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM && (defined(__ARM_FEATURE_IDIV))
+		#define CPUINFO_BASELINE_ARM_IDIV 1
+	#else
+		#define CPUINFO_BASELINE_ARM_IDIV 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_VFPV4
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM && (defined(__ARM_FEATURE_FMA) && defined(__ARM_FP))
+		#define CPUINFO_BASELINE_ARM_VFPV4 1
+	#else
+		#define CPUINFO_BASELINE_ARM_VFPV4 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_NEON
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+		#define CPUINFO_BASELINE_ARM_NEON 1
+	#else
+		#define CPUINFO_BASELINE_ARM_NEON 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_NEON_FMA
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM && ((defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__ARM_FEATURE_FMA))
+		#define CPUINFO_BASELINE_ARM_NEON_FMA 1
+	#else
+		#define CPUINFO_BASELINE_ARM_NEON_FMA 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_ATOMICS
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_ATOMICS))
+		#define CPUINFO_BASELINE_ARM_ATOMICS 1
+	#else
+		#define CPUINFO_BASELINE_ARM_ATOMICS 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_NEON_RDM
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_QRDMX))
+		#define CPUINFO_BASELINE_ARM_NEON_RDM 1
+	#else
+		#define CPUINFO_BASELINE_ARM_NEON_RDM 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_FP16_ARITH
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC))
+		#define CPUINFO_BASELINE_ARM_FP16_ARITH 1
+	#else
+		#define CPUINFO_BASELINE_ARM_FP16_ARITH 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_JSCVT
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_JCVT))
+		#define CPUINFO_BASELINE_ARM_JSCVT 1
+	#else
+		#define CPUINFO_BASELINE_ARM_JSCVT 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_FCMA
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_COMPLEX))
+		#define CPUINFO_BASELINE_ARM_FCMA 1
+	#else
+		#define CPUINFO_BASELINE_ARM_FCMA 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_NEON_DOT
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_DOTPROD))
+		#define CPUINFO_BASELINE_ARM_NEON_DOT 1
+	#else
+		#define CPUINFO_BASELINE_ARM_NEON_DOT 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_FHM
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_FP16_FML))
+		#define CPUINFO_BASELINE_ARM_FHM 1
+	#else
+		#define CPUINFO_BASELINE_ARM_FHM 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_I8MM
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_MATMUL_INT8))
+		#define CPUINFO_BASELINE_ARM_I8MM 1
+	#else
+		#define CPUINFO_BASELINE_ARM_I8MM 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_BF16
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC))
+		#define CPUINFO_BASELINE_ARM_BF16 1
+	#else
+		#define CPUINFO_BASELINE_ARM_BF16 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_SVE
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_SVE))
+		#define CPUINFO_BASELINE_ARM_SVE 1
+	#else
+		#define CPUINFO_BASELINE_ARM_SVE 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_SVE2
+	#if CPUINFO_BASELINE_DETECT && CPUINFO_ARCH_ARM64 && (defined(__ARM_FEATURE_SVE2))
+		#define CPUINFO_BASELINE_ARM_SVE2 1
+	#else
+		#define CPUINFO_BASELINE_ARM_SVE2 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_AES
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+		#define CPUINFO_BASELINE_ARM_AES 1
+	#else
+		#define CPUINFO_BASELINE_ARM_AES 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_PMULL
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+		#define CPUINFO_BASELINE_ARM_PMULL 1
+	#else
+		#define CPUINFO_BASELINE_ARM_PMULL 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_SHA1
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+		#define CPUINFO_BASELINE_ARM_SHA1 1
+	#else
+		#define CPUINFO_BASELINE_ARM_SHA1 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_SHA2
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+		#define CPUINFO_BASELINE_ARM_SHA2 1
+	#else
+		#define CPUINFO_BASELINE_ARM_SHA2 0
+	#endif
+#endif
+
+#ifndef CPUINFO_BASELINE_ARM_CRC32
+	#if CPUINFO_BASELINE_DETECT && (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && (defined(__ARM_FEATURE_CRC32))
+		#define CPUINFO_BASELINE_ARM_CRC32 1
+	#else
+		#define CPUINFO_BASELINE_ARM_CRC32 0
+	#endif
+#endif
+
+/**
+ * X-macro list of the features covered by the baseline: X(name, value) for every cpuinfo_isa_<name> feature with a
+ * CPUINFO_BASELINE_<NAME> macro, where value is the macro.
+ */
+#define CPUINFO_BASELINE_FEATURES(X) \
+	X(x86_sse, CPUINFO_BASELINE_X86_SSE) \
+	X(x86_sse2, CPUINFO_BASELINE_X86_SSE2) \
+	X(x86_sse3, CPUINFO_BASELINE_X86_SSE3) \
+	X(x86_ssse3, CPUINFO_BASELINE_X86_SSSE3) \
+	X(x86_sse4_1, CPUINFO_BASELINE_X86_SSE4_1) \
+	X(x86_sse4_2, CPUINFO_BASELINE_X86_SSE4_2) \
+	X(x86_avx, CPUINFO_BASELINE_X86_AVX) \
+	X(x86_fma3, CPUINFO_BASELINE_X86_FMA3) \
+	X(x86_f16c, CPUINFO_BASELINE_X86_F16C) \
+	X(x86_avx2, CPUINFO_BASELINE_X86_AVX2) \
+	X(x86_avx512f, CPUINFO_BASELINE_X86_AVX512F) \
+	X(x86_avx512cd, CPUINFO_BASELINE_X86_AVX512CD) \
+	X(x86_avx512dq, CPUINFO_BASELINE_X86_AVX512DQ) \
+	X(x86_avx512bw, CPUINFO_BASELINE_X86_AVX512BW) \
+	X(x86_avx512vl, CPUINFO_BASELINE_X86_AVX512VL) \
+	X(x86_avx512vnni, CPUINFO_BASELINE_X86_AVX512VNNI) \
+	X(x86_avx512bf16, CPUINFO_BASELINE_X86_AVX512BF16) \
+	X(x86_avx512fp16, CPUINFO_BASELINE_X86_AVX512FP16) \
+	X(x86_avxvnni, CPUINFO_BASELINE_X86_AVXVNNI) \
+	X(x86_movbe, CPUINFO_BASELINE_X86_MOVBE) \
+	X(x86_lzcnt, CPUINFO_BASELINE_X86_LZCNT) \
+	X(x86_popcnt, CPUINFO_BASELINE_X86_POPCNT) \
+	X(x86_bmi, CPUINFO_BASELINE_X86_BMI) \
+	X(x86_bmi2, CPUINFO_BASELINE_X86_BMI2) \
+	X(x86_adx, CPUINFO_BASELINE_X86_ADX) \
+	X(x86_aes, CPUINFO_BASELINE_X86_AES) \
+	X(x86_pclmulqdq, CPUINFO_BASELINE_X86_PCLMULQDQ) \
+	X(x86_sha, CPUINFO_BASELINE_X86_SHA) \
+	X(x86_rdrand, CPUINFO_BASELINE_X86_RDRAND) \
+	X(x86_rdseed, CPUINFO_BASELINE_X86_RDSEED) \
+	X(arm_idiv, CPUINFO_BASELINE_ARM_IDIV) \
+	X(arm_vfpv4, CPUINFO_BASELINE_ARM_VFPV4) \
+	X(arm_neon, CPUINFO_BASELINE_ARM_NEON) \
+	X(arm_neon_fma, CPUINFO_BASELINE_ARM_NEON_FMA) \
+	X(arm_atomics, CPUINFO_BASELINE_ARM_ATOMICS) \
+	X(arm_neon_rdm, CPUINFO_BASELINE_ARM_NEON_RDM) \
+	X(arm_fp16_arith, CPUINFO_BASELINE_ARM_FP16_ARITH) \
+	X(arm_jscvt, CPUINFO_BASELINE_ARM_JSCVT) \
+	X(arm_fcma, CPUINFO_BASELINE_ARM_FCMA) \
+	X(arm_neon_dot, CPUINFO_BASELINE_ARM_NEON_DOT) \
+	X(arm_fhm, CPUINFO_BASELINE_ARM_FHM) \
+	X(arm_i8mm, CPUINFO_BASELINE_ARM_I8MM) \
+	X(arm_bf16, CPUINFO_BASELINE_ARM_BF16) \
+	X(arm_sve, CPUINFO_BASELINE_ARM_SVE) \
+	X(arm_sve2, CPUINFO_BASELINE_ARM_SVE2) \
+	X(arm_aes, CPUINFO_BASELINE_ARM_AES) \
+	X(arm_pmull, CPUINFO_BASELINE_ARM_PMULL) \
+	X(arm_sha1, CPUINFO_BASELINE_ARM_SHA1) \
+	X(arm_sha2, CPUINFO_BASELINE_ARM_SHA2) \
+	X(arm_crc32, CPUINFO_BASELINE_ARM_CRC32)
+
 #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 	/* This structure is not a part of stable API. Use cpuinfo_has_x86_* functions instead. */
 	struct cpuinfo_x86_isa {
@@ -613,6 +1236,13 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 		bool avx512vnni;
 		bool avx512_4vnniw;
 		bool avx512_4fmaps;
+		bool avx512vp2intersect;
+		bool avx512bf16;
+		bool avx512fp16;
+		bool avxvnni;
+		bool amx_tile;
+		bool amx_int8;
+		bool amx_bf16;
 		bool hle;
 		bool rtm;
 		bool xtest;
@@ -651,6 +1281,19 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 	};
 
 	extern struct cpuinfo_x86_isa cpuinfo_isa;
+
+	/**
+	 * Returns ISA features supported by every core in a cluster.
+	 *
+	 * Cores of different types in heterogeneous processors may support different features. The global ISA description,
+	 * used by cpuinfo_has_x86_* functions, is the intersection of ISA features of all clusters, and is safe to use on
+	 * any core. Features reported for a cluster are safe only for threads pinned to cores of this cluster.
+	 *
+	 * @param cluster_index - index of the cluster, the same as for cpuinfo_get_cluster().
+	 *
+	 * @returns ISA features of the cluster, or NULL if cpuinfo is not initialized or the index is out of range.
+	 */
+	const struct cpuinfo_x86_isa* CPUINFO_ABI cpuinfo_get_cluster_isa(uint32_t cluster_index);
 #endif
 
 static inline bool cpuinfo_has_x86_rdtsc(void) {
@@ -834,7 +1477,9 @@ static inline bool cpuinfo_has_x86_daz(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SSE
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return true;
 	#elif CPUINFO_ARCH_X86
 		#if defined(__ANDROID__)
@@ -848,7 +1493,9 @@ static inline bool cpuinfo_has_x86_sse(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse2(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SSE2
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return true;
 	#elif CPUINFO_ARCH_X86
 		#if defined(__ANDROID__)
@@ -862,7 +1509,9 @@ static inline bool cpuinfo_has_x86_sse2(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse3(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SSE3
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -874,7 +1523,9 @@ static inline bool cpuinfo_has_x86_sse3(void) {
 }
 
 static inline bool cpuinfo_has_x86_ssse3(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SSSE3
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -886,7 +1537,9 @@ static inline bool cpuinfo_has_x86_ssse3(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse4_1(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SSE4_1
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -900,7 +1553,9 @@ static inline bool cpuinfo_has_x86_sse4_1(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse4_2(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SSE4_2
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -930,7 +1585,9 @@ static inline bool cpuinfo_has_x86_misaligned_sse(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx;
 	#else
 		return false;
@@ -938,7 +1595,9 @@ static inline bool cpuinfo_has_x86_avx(void) {
 }
 
 static inline bool cpuinfo_has_x86_fma3(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_FMA3
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.fma3;
 	#else
 		return false;
@@ -962,7 +1621,9 @@ static inline bool cpuinfo_has_x86_xop(void) {
 }
 
 static inline bool cpuinfo_has_x86_f16c(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_F16C
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.f16c;
 	#else
 		return false;
@@ -970,7 +1631,9 @@ static inline bool cpuinfo_has_x86_f16c(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx2(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX2
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx2;
 	#else
 		return false;
@@ -978,7 +1641,9 @@ static inline bool cpuinfo_has_x86_avx2(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512f(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX512F
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512f;
 	#else
 		return false;
@@ -1002,7 +1667,9 @@ static inline bool cpuinfo_has_x86_avx512er(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512cd(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX512CD
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512cd;
 	#else
 		return false;
@@ -1010,7 +1677,9 @@ static inline bool cpuinfo_has_x86_avx512cd(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512dq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX512DQ
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512dq;
 	#else
 		return false;
@@ -1018,7 +1687,9 @@ static inline bool cpuinfo_has_x86_avx512dq(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512bw(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX512BW
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512bw;
 	#else
 		return false;
@@ -1026,7 +1697,9 @@ static inline bool cpuinfo_has_x86_avx512bw(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vl(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AVX512VL
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vl;
 	#else
 		return false;
@@ -1065,33 +1738,97 @@ static inline bool cpuinfo_has_x86_avx512bitalg(void) {
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_avx512vpopcntdq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.avx512vpopcntdq;
+static inline bool cpuinfo_has_x86_avx512vpopcntdq(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512vpopcntdq;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avx512vnni(void) {
+	#if CPUINFO_BASELINE_X86_AVX512VNNI
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512vnni;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avx512_4vnniw(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512_4vnniw;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avx512_4fmaps(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512_4fmaps;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avx512vp2intersect(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512vp2intersect;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avx512bf16(void) {
+	#if CPUINFO_BASELINE_X86_AVX512BF16
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512bf16;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avx512fp16(void) {
+	#if CPUINFO_BASELINE_X86_AVX512FP16
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512fp16;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_avxvnni(void) {
+	#if CPUINFO_BASELINE_X86_AVXVNNI
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avxvnni;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_avx512vnni(void) {
+static inline bool cpuinfo_has_x86_amx_tile(void) {
 	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.avx512vnni;
+		return cpuinfo_isa.amx_tile;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_avx512_4vnniw(void) {
+static inline bool cpuinfo_has_x86_amx_int8(void) {
 	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.avx512_4vnniw;
+		return cpuinfo_isa.amx_int8;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_avx512_4fmaps(void) {
+static inline bool cpuinfo_has_x86_amx_bf16(void) {
 	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.avx512_4fmaps;
+		return cpuinfo_isa.amx_bf16;
 	#else
 		return false;
 	#endif
@@ -1166,7 +1903,9 @@ static inline bool cpuinfo_has_x86_clwb(void) {
 }
 
 static inline bool cpuinfo_has_x86_movbe(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_MOVBE
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.movbe;
 	#else
 		return false;
@@ -1184,7 +1923,9 @@ static inline bool cpuinfo_has_x86_lahf_sahf(void) {
 }
 
 static inline bool cpuinfo_has_x86_lzcnt(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_LZCNT
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.lzcnt;
 	#else
 		return false;
@@ -1192,7 +1933,9 @@ static inline bool cpuinfo_has_x86_lzcnt(void) {
 }
 
 static inline bool cpuinfo_has_x86_popcnt(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_POPCNT
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -1214,7 +1957,9 @@ static inline bool cpuinfo_has_x86_tbm(void) {
 }
 
 static inline bool cpuinfo_has_x86_bmi(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_BMI
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.bmi;
 	#else
 		return false;
@@ -1222,7 +1967,9 @@ static inline bool cpuinfo_has_x86_bmi(void) {
 }
 
 static inline bool cpuinfo_has_x86_bmi2(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_BMI2
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.bmi2;
 	#else
 		return false;
@@ -1230,7 +1977,9 @@ static inline bool cpuinfo_has_x86_bmi2(void) {
 }
 
 static inline bool cpuinfo_has_x86_adx(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_ADX
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.adx;
 	#else
 		return false;
@@ -1238,7 +1987,9 @@ static inline bool cpuinfo_has_x86_adx(void) {
 }
 
 static inline bool cpuinfo_has_x86_aes(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_AES
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.aes;
 	#else
 		return false;
@@ -1254,7 +2005,9 @@ static inline bool cpuinfo_has_x86_vaes(void) {
 }
 
 static inline bool cpuinfo_has_x86_pclmulqdq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_PCLMULQDQ
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.pclmulqdq;
 	#else
 		return false;
@@ -1278,7 +2031,9 @@ static inline bool cpuinfo_has_x86_gfni(void) {
 }
 
 static inline bool cpuinfo_has_x86_rdrand(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_RDRAND
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.rdrand;
 	#else
 		return false;
@@ -1286,7 +2041,9 @@ static inline bool cpuinfo_has_x86_rdrand(void) {
 }
 
 static inline bool cpuinfo_has_x86_rdseed(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_RDSEED
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.rdseed;
 	#else
 		return false;
@@ -1294,7 +2051,9 @@ static inline bool cpuinfo_has_x86_rdseed(void) {
 }
 
 static inline bool cpuinfo_has_x86_sha(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if CPUINFO_BASELINE_X86_SHA
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.sha;
 	#else
 		return false;
@@ -1332,6 +2091,14 @@ static inline bool cpuinfo_has_x86_sha(void) {
 			bool fp16arith;
 			bool jscvt;
 			bool fcma;
+			bool dot;
+			bool fhm;
+			bool i8mm;
+			bool bf16;
+			bool sve;
+			bool sve2;
+			bool svebf16;
+			bool svei8mm;
 		#endif
 
 		bool aes;
@@ -1342,6 +2109,19 @@ static inline bool cpuinfo_has_x86_sha(void) {
 	};
 
 	extern struct cpuinfo_arm_isa cpuinfo_isa;
+
+	/**
+	 * Returns ISA features supported by every core in a cluster.
+	 *
+	 * Cores of different types in heterogeneous processors may support different features. The global ISA description,
+	 * used by cpuinfo_has_arm_* functions, is the intersection of ISA features of all clusters, and is safe to use on
+	 * any core. Features reported for a cluster are safe only for threads pinned to cores of this cluster.
+	 *
+	 * @param cluster_index - index of the cluster, the same as for cpuinfo_get_cluster().
+	 *
+	 * @returns ISA features of the cluster, or NULL if cpuinfo is not initialized or the index is out of range.
+	 */
+	const struct cpuinfo_arm_isa* CPUINFO_ABI cpuinfo_get_cluster_isa(uint32_t cluster_index);
 #endif
 
 static inline bool cpuinfo_has_arm_thumb(void) {
@@ -1401,7 +2181,9 @@ static inline bool cpuinfo_has_arm_v7mp(void) {
 }
 
 static inline bool cpuinfo_has_arm_idiv(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_IDIV
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.idiv;
@@ -1459,7 +2241,9 @@ static inline bool cpuinfo_has_arm_vfpv3_fp16_d32(void) {
 }
 
 static inline bool cpuinfo_has_arm_vfpv4(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_VFPV4
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.vfpv3 && cpuinfo_isa.fma;
@@ -1495,7 +2279,9 @@ static inline bool cpuinfo_has_arm_wmmx2(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_NEON
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.neon;
@@ -1515,7 +2301,9 @@ static inline bool cpuinfo_has_arm_neon_fp16(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon_fma(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_NEON_FMA
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.neon && cpuinfo_isa.fma;
@@ -1525,7 +2313,9 @@ static inline bool cpuinfo_has_arm_neon_fma(void) {
 }
 
 static inline bool cpuinfo_has_arm_atomics(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_ATOMICS
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.atomics;
 	#else
 		return false;
@@ -1533,7 +2323,9 @@ static inline bool cpuinfo_has_arm_atomics(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon_rdm(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_NEON_RDM
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.rdm;
 	#else
 		return false;
@@ -1541,7 +2333,9 @@ static inline bool cpuinfo_has_arm_neon_rdm(void) {
 }
 
 static inline bool cpuinfo_has_arm_fp16_arith(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_FP16_ARITH
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.fp16arith;
 	#else
 		return false;
@@ -1549,7 +2343,9 @@ static inline bool cpuinfo_has_arm_fp16_arith(void) {
 }
 
 static inline bool cpuinfo_has_arm_jscvt(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_JSCVT
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.jscvt;
 	#else
 		return false;
@@ -1557,15 +2353,95 @@ static inline bool cpuinfo_has_arm_jscvt(void) {
 }
 
 static inline bool cpuinfo_has_arm_fcma(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_FCMA
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.fcma;
 	#else
 		return false;
 	#endif
 }
 
+static inline bool cpuinfo_has_arm_neon_dot(void) {
+	#if CPUINFO_BASELINE_ARM_NEON_DOT
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.dot;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_fhm(void) {
+	#if CPUINFO_BASELINE_ARM_FHM
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.fhm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_i8mm(void) {
+	#if CPUINFO_BASELINE_ARM_I8MM
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.i8mm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_bf16(void) {
+	#if CPUINFO_BASELINE_ARM_BF16
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.bf16;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sve(void) {
+	#if CPUINFO_BASELINE_ARM_SVE
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sve;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sve2(void) {
+	#if CPUINFO_BASELINE_ARM_SVE2
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sve2;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sve_bf16(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svebf16;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sve_i8mm(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svei8mm;
+	#else
+		return false;
+	#endif
+}
+
 static inline bool cpuinfo_has_arm_aes(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_AES
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.aes;
 	#else
 		return false;
@@ -1573,7 +2449,9 @@ static inline bool cpuinfo_has_arm_aes(void) {
 }
 
 static inline bool cpuinfo_has_arm_sha1(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_SHA1
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.sha1;
 	#else
 		return false;
@@ -1581,7 +2459,9 @@ static inline bool cpuinfo_has_arm_sha1(void) {
 }
 
 static inline bool cpuinfo_has_arm_sha2(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_SHA2
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.sha2;
 	#else
 		return false;
@@ -1589,7 +2469,9 @@ static inline bool cpuinfo_has_arm_sha2(void) {
 }
 
 static inline bool cpuinfo_has_arm_pmull(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_PMULL
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.pmull;
 	#else
 		return false;
@@ -1597,13 +2479,234 @@ static inline bool cpuinfo_has_arm_pmull(void) {
 }
 
 static inline bool cpuinfo_has_arm_crc32(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_BASELINE_ARM_CRC32
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.crc32;
 	#else
 		return false;
 	#endif
 }
 
+/**
+ * Number of 64-bit words in packed representation of instruction set features.
+ *
+ * Features of x86 and x86-64 occupy words 0 and 1, features of ARM and ARM64 occupy word 2.
+ */
+#define CPUINFO_ISA_BITS_WORDS 3
+
+/** Index of the 64-bit word holding the bit of a feature in packed representation. */
+#define CPUINFO_ISA_BIT_WORD(feature) ((feature) / 64)
+/** Mask of the bit of a feature within its 64-bit word in packed representation. */
+#define CPUINFO_ISA_BIT_MASK(feature) (UINT64_C(1) << ((feature) % 64))
+
+/**
+ * Instruction set features, as indices of bits in packed representation.
+ *
+ * Each feature corresponds to the cpuinfo_has_<feature> function with the same suffix. Indices are stable within a
+ * version of the library, but are not part of the ABI: do not store packed feature sets across versions.
+ */
+enum cpuinfo_isa_feature {
+	cpuinfo_isa_x86_rdtsc = 0,
+	cpuinfo_isa_x86_rdtscp,
+	cpuinfo_isa_x86_rdpid,
+	cpuinfo_isa_x86_clzero,
+	cpuinfo_isa_x86_mwait,
+	cpuinfo_isa_x86_mwaitx,
+	cpuinfo_isa_x86_fxsave,
+	cpuinfo_isa_x86_xsave,
+	cpuinfo_isa_x86_fpu,
+	cpuinfo_isa_x86_mmx,
+	cpuinfo_isa_x86_mmx_plus,
+	cpuinfo_isa_x86_3dnow,
+	cpuinfo_isa_x86_3dnow_plus,
+	cpuinfo_isa_x86_3dnow_geode,
+	cpuinfo_isa_x86_prefetch,
+	cpuinfo_isa_x86_prefetchw,
+	cpuinfo_isa_x86_prefetchwt1,
+	cpuinfo_isa_x86_daz,
+	cpuinfo_isa_x86_sse,
+	cpuinfo_isa_x86_sse2,
+	cpuinfo_isa_x86_sse3,
+	cpuinfo_isa_x86_ssse3,
+	cpuinfo_isa_x86_sse4_1,
+	cpuinfo_isa_x86_sse4_2,
+	cpuinfo_isa_x86_sse4a,
+	cpuinfo_isa_x86_misaligned_sse,
+	cpuinfo_isa_x86_avx,
+	cpuinfo_isa_x86_fma3,
+	cpuinfo_isa_x86_fma4,
+	cpuinfo_isa_x86_xop,
+	cpuinfo_isa_x86_f16c,
+	cpuinfo_isa_x86_avx2,
+	cpuinfo_isa_x86_avx512f,
+	cpuinfo_isa_x86_avx512pf,
+	cpuinfo_isa_x86_avx512er,
+	cpuinfo_isa_x86_avx512cd,
+	cpuinfo_isa_x86_avx512dq,
+	cpuinfo_isa_x86_avx512bw,
+	cpuinfo_isa_x86_avx512vl,
+	cpuinfo_isa_x86_avx512ifma,
+	cpuinfo_isa_x86_avx512vbmi,
+	cpuinfo_isa_x86_avx512vbmi2,
+	cpuinfo_isa_x86_avx512bitalg,
+	cpuinfo_isa_x86_avx512vpopcntdq,
+	cpuinfo_isa_x86_avx512vnni,
+	cpuinfo_isa_x86_avx512_4vnniw,
+	cpuinfo_isa_x86_avx512_4fmaps,
+	cpuinfo_isa_x86_avx512vp2intersect,
+	cpuinfo_isa_x86_avx512bf16,
+	cpuinfo_isa_x86_avx512fp16,
+	cpuinfo_isa_x86_avxvnni,
+	cpuinfo_isa_x86_amx_tile,
+	cpuinfo_isa_x86_amx_int8,
+	cpuinfo_isa_x86_amx_bf16,
+	cpuinfo_isa_x86_hle,
+	cpuinfo_isa_x86_rtm,
+	cpuinfo_isa_x86_xtest,
+	cpuinfo_isa_x86_mpx,
+	cpuinfo_isa_x86_cmov,
+	cpuinfo_isa_x86_cmpxchg8b,
+	cpuinfo_isa_x86_cmpxchg16b,
+	cpuinfo_isa_x86_clwb,
+	cpuinfo_isa_x86_movbe,
+	cpuinfo_isa_x86_lahf_sahf,
+	cpuinfo_isa_x86_lzcnt,
+	cpuinfo_isa_x86_popcnt,
+	cpuinfo_isa_x86_tbm,
+	cpuinfo_isa_x86_bmi,
+	cpuinfo_isa_x86_bmi2,
+	cpuinfo_isa_x86_adx,
+	cpuinfo_isa_x86_aes,
+	cpuinfo_isa_x86_vaes,
+	cpuinfo_isa_x86_pclmulqdq,
+	cpuinfo_isa_x86_vpclmulqdq,
+	cpuinfo_isa_x86_gfni,
+	cpuinfo_isa_x86_rdrand,
+	cpuinfo_isa_x86_rdseed,
+	cpuinfo_isa_x86_sha,
+
+	cpuinfo_isa_arm_thumb = 128,
+	cpuinfo_isa_arm_thumb2,
+	cpuinfo_isa_arm_v5e,
+	cpuinfo_isa_arm_v6,
+	cpuinfo_isa_arm_v6k,
+	cpuinfo_isa_arm_v7,
+	cpuinfo_isa_arm_v7mp,
+	cpuinfo_isa_arm_idiv,
+	cpuinfo_isa_arm_vfpv2,
+	cpuinfo_isa_arm_vfpv3,
+	cpuinfo_isa_arm_vfpv3_d32,
+	cpuinfo_isa_arm_vfpv3_fp16,
+	cpuinfo_isa_arm_vfpv3_fp16_d32,
+	cpuinfo_isa_arm_vfpv4,
+	cpuinfo_isa_arm_vfpv4_d32,
+	cpuinfo_isa_arm_wmmx,
+	cpuinfo_isa_arm_wmmx2,
+	cpuinfo_isa_arm_neon,
+	cpuinfo_isa_arm_neon_fp16,
+	cpuinfo_isa_arm_neon_fma,
+	cpuinfo_isa_arm_atomics,
+	cpuinfo_isa_arm_neon_rdm,
+	cpuinfo_isa_arm_fp16_arith,
+	cpuinfo_isa_arm_jscvt,
+	cpuinfo_isa_arm_fcma,
+	cpuinfo_isa_arm_neon_dot,
+	cpuinfo_isa_arm_fhm,
+	cpuinfo_isa_arm_i8mm,
+	cpuinfo_isa_arm_bf16,
+	cpuinfo_isa_arm_sve,
+	cpuinfo_isa_arm_sve2,
+	cpuinfo_isa_arm_sve_bf16,
+	cpuinfo_isa_arm_sve_i8mm,
+	cpuinfo_isa_arm_aes,
+	cpuinfo_isa_arm_sha1,
+	cpuinfo_isa_arm_sha2,
+	cpuinfo_isa_arm_pmull,
+	cpuinfo_isa_arm_crc32,
+
+	/** Set in cpuinfo_isa_bits_supported when cpuinfo is initialized; not a feature itself. */
+	cpuinfo_isa_initialized = 191,
+
+	/** Number of valid feature indices; not a feature itself. */
+	cpuinfo_isa_feature_max = 192,
+};
+
+/**
+ * Packed set of instruction set features: bit CPUINFO_ISA_BIT_MASK(f) in word CPUINFO_ISA_BIT_WORD(f) is set when
+ * feature f is in the set.
+ */
+struct cpuinfo_isa_bits {
+	uint64_t words[CPUINFO_ISA_BITS_WORDS];
+};
+
+/**
+ * Instruction set features supported by the host, populated by cpuinfo_initialize() from cpuinfo_has_* checks.
+ * Prefer cpuinfo_isa_has_all() to direct access.
+ */
+extern struct cpuinfo_isa_bits cpuinfo_isa_bits_supported;
+
+/** Adds a feature to a packed feature set. */
+static inline void cpuinfo_isa_bits_add(struct cpuinfo_isa_bits* bits, enum cpuinfo_isa_feature feature) {
+	bits->words[CPUINFO_ISA_BIT_WORD(feature)] |= CPUINFO_ISA_BIT_MASK(feature);
+}
+
+/** Checks if a packed feature set includes a feature. */
+static inline bool cpuinfo_isa_bits_has(const struct cpuinfo_isa_bits* bits, enum cpuinfo_isa_feature feature) {
+	return (bits->words[CPUINFO_ISA_BIT_WORD(feature)] & CPUINFO_ISA_BIT_MASK(feature)) != 0;
+}
+
+/** Checks if a packed feature set includes all features of another set. */
+static inline bool cpuinfo_isa_bits_has_all(
+	const struct cpuinfo_isa_bits* bits,
+	const struct cpuinfo_isa_bits* required)
+{
+	uint64_t missing = 0;
+	for (uint32_t i = 0; i < CPUINFO_ISA_BITS_WORDS; i++) {
+		missing |= required->words[i] & ~bits->words[i];
+	}
+	return missing == 0;
+}
+
+/**
+ * Checks if the host supports all features in a packed feature set.
+ *
+ * The check takes a few AND and compare operations regardless of the number of features in the set, which makes it
+ * suitable for selecting among many kernel implementations, each with its own set of requirements.
+ *
+ * @param required - features required by a kernel. An empty set is supported once cpuinfo is initialized.
+ *
+ * @returns true if all features in the set are supported, false otherwise or if cpuinfo is not initialized.
+ */
+static inline bool cpuinfo_isa_has_all(const struct cpuinfo_isa_bits* required) {
+	if (!cpuinfo_isa_bits_has(&cpuinfo_isa_bits_supported, cpuinfo_isa_initialized)) {
+		return false;
+	}
+	return cpuinfo_isa_bits_has_all(&cpuinfo_isa_bits_supported, required);
+}
+
+#define CPUINFO_BASELINE_ADD(name, value) \
+	if (value) { \
+		cpuinfo_isa_bits_add(&baseline, cpuinfo_isa_##name); \
+	}
+
+/**
+ * Checks if the host supports the instruction set baseline of the calling translation unit.
+ *
+ * cpuinfo_has_* functions for baseline features return true without checking the host, so code compiled with a
+ * baseline calls this function after cpuinfo_initialize() to fail early on an unsupported processor.
+ *
+ * @returns true if the host supports all features in CPUINFO_BASELINE_FEATURES with a non-zero CPUINFO_BASELINE_*
+ *          macro, false otherwise or if cpuinfo is not initialized.
+ */
+static inline bool cpuinfo_check_baseline(void) {
+	struct cpuinfo_isa_bits baseline = { { 0 } };
+	CPUINFO_BASELINE_FEATURES(CPUINFO_BASELINE_ADD)
+	return cpuinfo_isa_has_all(&baseline);
+}
+
+#undef CPUINFO_BASELINE_ADD
+
 const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_processors(void);
 const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_cores(void);
 const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_clusters(void);
@@ -1637,6 +2740,305 @@ uint32_t CPUINFO_ABI cpuinfo_get_l4_caches_count(void);
 const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_current_processor(void);
 const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_current_core(void);
 
+/**
+ * Returns core classes, ordered from the fastest cores to the most efficient ones.
+ *
+ * Per-core performance of each cluster is estimated once in cpuinfo_initialize(), from the capacity reported by the
+ * operating system if it is known for all clusters, and from the issue width of the microarchitecture (doubled for
+ * out-of-order cores) and the maximum frequency otherwise. Clusters with the same estimate form a core class.
+ *
+ * @returns Array of cpuinfo_get_core_classes_count() core classes, or NULL if cpuinfo is not initialized.
+ */
+const struct cpuinfo_core_class* CPUINFO_ABI cpuinfo_get_core_classes(void);
+const struct cpuinfo_core_class* CPUINFO_ABI cpuinfo_get_core_class(uint32_t index);
+uint32_t CPUINFO_ABI cpuinfo_get_core_classes_count(void);
+
+/**
+ * Returns clusters of cores ordered by decreasing per-core performance.
+ *
+ * Index 0 is the fastest cluster, and index cpuinfo_get_clusters_count() - 1 is the most efficient cluster.
+ * Clusters of the same core class are listed in the order of cpuinfo_get_clusters().
+ *
+ * @returns Cluster at the specified position, or NULL if cpuinfo is not initialized or the index is out of range.
+ */
+const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_cluster_by_performance(uint32_t index);
+
+/**
+ * Measures effective clock frequency of the current core, in Hz.
+ *
+ * The calling thread is temporarily pinned to the current logical processor and kept busy for a few dozen
+ * milliseconds. The frequency is computed from APERF/MPERF counters if they are readable through /dev/cpu/<N>/msr,
+ * or from a calibrated loop of dependent additions timed with a monotonic clock otherwise. The result is cached for
+ * the cluster of the current core and returned by cpuinfo_get_current_core_frequency(). The frequency fields of
+ * cpuinfo_core and cpuinfo_cluster structures are not modified.
+ *
+ * @returns Effective clock frequency, in Hz, or 0 if the measurement failed.
+ */
+uint64_t CPUINFO_ABI cpuinfo_measure_current_core_frequency(void);
+
+/**
+ * Returns effective clock frequency of the current core, in Hz, measured on the first call for its cluster of cores.
+ * Subsequent calls on cores of the same cluster return the cached result without measurement. Unlike the frequency
+ * field of cpuinfo_core, which stays 0 if the OS does not report it, the result does not depend on OS support.
+ *
+ * @returns Effective clock frequency, in Hz, or 0 if the measurement failed.
+ */
+uint64_t CPUINFO_ABI cpuinfo_get_current_core_frequency(void);
+
+/**
+ * Measures cache line round-trip latency between every pair of logical processors.
+ *
+ * For each pair, two threads are pinned to the processors and bounce a cache line with atomic stores. Pairs which
+ * do not share cores are measured in parallel. The measurement takes O(processors count) rounds of a few milliseconds
+ * each. Results replace the results of previous measurements, and are returned by cpuinfo_get_processor_latency().
+ *
+ * @retval true if latencies were measured for all pairs of processors.
+ * @retval false if cpuinfo is not initialized, or threads could not be created or pinned.
+ */
+bool CPUINFO_ABI cpuinfo_measure_processor_latencies(void);
+
+/**
+ * Returns measured cache line round-trip latency between two logical processors, in nanoseconds.
+ *
+ * @returns Round-trip latency, or 0 if the processors are the same, or cpuinfo_measure_processor_latencies() did
+ *          not succeed yet.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_processor_latency(
+	const struct cpuinfo_processor* first,
+	const struct cpuinfo_processor* second);
+
+/**
+ * Estimates theoretical peak throughput of a core from its microarchitecture and the ISA of its cluster.
+ *
+ * Per-second rates use the frequency field of cpuinfo_core. If it is 0, e.g. because the OS does not report maximum
+ * frequency, the frequency and all per-second rates are 0, and only per-cycle rates are valid.
+ *
+ * @param core - core from cpuinfo_get_core() or cpuinfo_get_cores().
+ * @param throughput - structure to receive the estimate.
+ *
+ * @retval true if the throughput was estimated.
+ * @retval false if cpuinfo is not initialized, or an argument is NULL or does not point into the cores table.
+ */
+bool CPUINFO_ABI cpuinfo_get_core_throughput(
+	const struct cpuinfo_core* core,
+	struct cpuinfo_throughput* throughput);
+
+/**
+ * Estimates theoretical peak throughput of all cores in a cluster, summed over the cores.
+ *
+ * The frequency field is set only if all cores in the cluster report the same frequency. If any core reports
+ * frequency 0, all per-second rates are 0 rather than an underestimate, and only per-cycle rates are valid.
+ *
+ * @param cluster - cluster from cpuinfo_get_cluster() or cpuinfo_get_clusters().
+ * @param throughput - structure to receive the estimate.
+ *
+ * @retval true if the throughput was estimated.
+ * @retval false if cpuinfo is not initialized, an argument is NULL, or the cluster has no cores in the cores table.
+ */
+bool CPUINFO_ABI cpuinfo_get_cluster_throughput(
+	const struct cpuinfo_cluster* cluster,
+	struct cpuinfo_throughput* throughput);
+
+/**
+ * Estimates theoretical peak throughput of all cores in a package, summed over the cores.
+ *
+ * The frequency field is set only if all cores in the package report the same frequency, so it is 0 on hybrid
+ * processors whose core types differ in frequency. If any core reports frequency 0, all per-second rates are 0, and
+ * only per-cycle rates are valid.
+ *
+ * @param package - package from cpuinfo_get_package() or cpuinfo_get_packages().
+ * @param throughput - structure to receive the estimate.
+ *
+ * @retval true if the throughput was estimated.
+ * @retval false if cpuinfo is not initialized, an argument is NULL, or the package has no cores in the cores table.
+ */
+bool CPUINFO_ABI cpuinfo_get_package_throughput(
+	const struct cpuinfo_package* package,
+	struct cpuinfo_throughput* throughput);
+
+/**
+ * Requests permission to use AMX tile registers in the calling process.
+ *
+ * Linux 5.16+ enables AMX state in XCR0 but keeps the large tile data state disabled (via XFD) until the process
+ * requests it with arch_prctl(ARCH_REQ_XCOMP_PERM). AMX instructions executed without the permission raise SIGILL.
+ * Other operating systems do not require the request. The function must be called after cpuinfo_initialize(), and
+ * before threads that use AMX are created: the permission is inherited only by threads created after the request.
+ *
+ * @retval true if the processor and the OS support AMX tiles, and the calling process may use them.
+ * @retval false if cpuinfo is not initialized, AMX is not supported, or the OS denied the request.
+ */
+bool CPUINFO_ABI cpuinfo_request_x86_amx(void);
+
+/** Number of XSAVE state components described by struct cpuinfo_x86_xsave, indexed by their bit in XCR0 */
+#define CPUINFO_X86_XSAVE_COMPONENTS_MAX 32
+
+/** Layout of an XSAVE state component, as reported in a sub-leaf of CPUID leaf 0xD. */
+struct cpuinfo_x86_xsave_component {
+	/** Size of the component, in bytes, or 0 if the processor does not support the component */
+	uint32_t size;
+	/** Offset of the component in the standard (non-compacted) format of the XSAVE area, in bytes */
+	uint32_t offset;
+	/** Whether the component is aligned on a 64-byte boundary in the compacted format of the XSAVE area */
+	bool aligned;
+};
+
+/** XSAVE state components enabled by the operating system, and sizes of the XSAVE area. */
+struct cpuinfo_x86_xsave {
+	/** Bit mask of state components enabled by the operating system in XCR0 */
+	uint64_t enabled_components;
+	/** Bit mask of user state components supported by the processor */
+	uint64_t supported_components;
+	/** Size, in bytes, of the standard format XSAVE area (XSAVE, XSAVEOPT) for components enabled in XCR0 */
+	uint32_t size;
+	/** Size, in bytes, of the standard format XSAVE area if all supported user components were enabled */
+	uint32_t max_size;
+	/** Size, in bytes, of the compacted format XSAVE area (XSAVEC) for components enabled in XCR0 */
+	uint32_t compacted_size;
+	/** Layout of user state components, indexed by their bit in XCR0 */
+	struct cpuinfo_x86_xsave_component components[CPUINFO_X86_XSAVE_COMPONENTS_MAX];
+};
+
+/**
+ * Returns XSAVE state components enabled by the operating system, and the sizes of the XSAVE area.
+ *
+ * The size of the XSAVE area bounds the cost of saving vector state on context switches, and the size of the state
+ * that user-space context switching (e.g. coroutines) needs to save. On Linux, the AMX tile data component is
+ * enabled in XCR0, but the kernel saves it for a process only after cpuinfo_request_x86_amx().
+ *
+ * @returns XSAVE components and sizes, or NULL if cpuinfo is not initialized, the processor is not x86, or the OS
+ *          did not enable XSAVE.
+ */
+const struct cpuinfo_x86_xsave* CPUINFO_ABI cpuinfo_get_x86_xsave(void);
+
+/**
+ * Returns the maximum length of SVE vector registers supported by the processor and the OS, in bits.
+ *
+ * On Linux the length is queried once, in a scratch thread, with prctl(PR_SVE_SET_VL) of the largest architectural
+ * length. The result does not depend on the length of the calling thread, which prctl(PR_SVE_SET_VL) can reduce.
+ * The function does not require cpuinfo_initialize().
+ *
+ * @returns SVE vector length (128 to 2048 bits, in multiples of 128), or 0 if SVE is not supported by the processor
+ *          or the OS.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_max_arm_sve_length(void);
+
+/**
+ * Returns performance characteristics of the specified microarchitecture.
+ *
+ * The function does not require cpuinfo_initialize() and can be called for microarchitectures of any architecture.
+ *
+ * @returns Pointer to constant characteristics of the microarchitecture, or NULL if it is unknown to cpuinfo.
+ */
+const struct cpuinfo_uarch_info* CPUINFO_ABI cpuinfo_get_uarch_info(enum cpuinfo_uarch uarch);
+
+/**
+ * Computes recommended cache blocking parameters for cores of a cluster.
+ *
+ * The parameters are derived from size, associativity, and sharing of L1 data, L2, and L3 caches of the cluster.
+ * Cache geometry is computed once per cluster and memoized, so clusters of heterogeneous processors get different
+ * parameters, and repeated calls are cheap.
+ *
+ * @param cluster - cluster of cores which will run the computation.
+ * @param element_size - size, in bytes, of matrix elements.
+ * @param mr - number of rows in the register tile of the micro-kernel.
+ * @param nr - number of columns in the register tile of the micro-kernel.
+ * @param threads - number of threads running the computation on the cluster. Threads are assumed to share caches
+ *                  to the extent the caches are shared between logical processors.
+ * @param[out] blocking - recommended blocking parameters.
+ *
+ * @retval true if the parameters were computed.
+ * @retval false if cpuinfo is not initialized, or arguments are invalid.
+ */
+bool CPUINFO_ABI cpuinfo_get_cluster_blocking(
+	const struct cpuinfo_cluster* cluster,
+	uint32_t element_size,
+	uint32_t mr,
+	uint32_t nr,
+	uint32_t threads,
+	struct cpuinfo_blocking* blocking);
+
+/** Generic function pointer type for dispatch tables. Callers cast it to the actual type of their kernels. */
+typedef void (*cpuinfo_dispatch_function)(void);
+
+/**
+ * The candidate is eligible only on cores with one of the listed microarchitectures.
+ * Without this flag the list of microarchitectures is a preference rather than a requirement.
+ */
+#define CPUINFO_DISPATCH_UARCH_REQUIRED 0x00000001
+
+/**
+ * Predicate restricting an implementation to some clusters of cores, e.g. to the clusters of the fastest core class.
+ * It is called by cpuinfo_dispatch_table_resolve() only.
+ */
+typedef bool (*cpuinfo_dispatch_cluster_filter)(const struct cpuinfo_cluster* cluster);
+
+/** An implementation of a kernel, with the requirements for selecting it. */
+struct cpuinfo_dispatch_candidate {
+	/** Implementation of the kernel */
+	cpuinfo_dispatch_function function;
+	/** Instruction set features required by the implementation */
+	struct cpuinfo_isa_bits isa;
+	/** Microarchitectures the implementation is tuned for, or NULL if it is not tuned for specific cores */
+	const enum cpuinfo_uarch* uarchs;
+	/** Number of elements in the uarchs array */
+	uint32_t uarchs_count;
+	/** Combination of CPUINFO_DISPATCH_* flags */
+	uint32_t flags;
+	/** Clusters the implementation is restricted to, or NULL if it is eligible on all clusters */
+	cpuinfo_dispatch_cluster_filter cluster_filter;
+};
+
+/**
+ * Table of implementations of a kernel, resolved to the best implementation by cpuinfo_dispatch_table_resolve().
+ *
+ * Candidates are listed in the order of preference, from the fastest to the most portable. An eligible candidate
+ * tuned for the microarchitecture of the cores wins over earlier candidates that are not tuned for it; otherwise the
+ * first eligible candidate wins. A candidate is eligible on a cluster if the cores of the cluster support its
+ * instruction set features, and its cluster filter, if any, accepts the cluster.
+ *
+ * Callers initialize the candidates and candidates_count fields, and zero-initialize the other fields, which are
+ * written by cpuinfo_dispatch_table_resolve() and cleared by cpuinfo_dispatch_table_release().
+ */
+struct cpuinfo_dispatch_table {
+	const struct cpuinfo_dispatch_candidate* candidates;
+	uint32_t candidates_count;
+	/** Best implementation eligible on all cores, or NULL if the table is not resolved */
+	cpuinfo_dispatch_function function;
+	/** Best implementation for each cluster of cores, indexed by cluster */
+	cpuinfo_dispatch_function* cluster_functions;
+	uint32_t clusters_count;
+};
+
+/**
+ * Selects the best implementations in a dispatch table for the system and for each cluster of cores.
+ *
+ * The function must be called after cpuinfo_initialize(), and must not be called concurrently with other accesses to
+ * the same table. After it returns, the resolved implementations never change, and may be cached by the caller.
+ * A resolved table must be released with cpuinfo_dispatch_table_release() before it is resolved again.
+ *
+ * @param[in,out] table - dispatch table to resolve.
+ *
+ * @retval true if an eligible implementation was found for the system and for each cluster.
+ * @retval false if cpuinfo is not initialized, no candidate is eligible, or memory allocation failed.
+ */
+bool CPUINFO_ABI cpuinfo_dispatch_table_resolve(struct cpuinfo_dispatch_table* table);
+
+/** Releases memory allocated by cpuinfo_dispatch_table_resolve(). The table can then be resolved again. */
+void CPUINFO_ABI cpuinfo_dispatch_table_release(struct cpuinfo_dispatch_table* table);
+
+/** Returns the best implementation in a resolved table eligible on all cores in the system. */
+static inline cpuinfo_dispatch_function cpuinfo_dispatch_get(const struct cpuinfo_dispatch_table* table) {
+	return table->function;
+}
+
+/**
+ * Returns the best implementation in a resolved table for a cluster of cores.
+ * Kernels running on heterogeneous systems can use it to pick implementations tuned for the core they run on.
+ */
+cpuinfo_dispatch_function CPUINFO_ABI cpuinfo_dispatch_get_for_cluster(
+	const struct cpuinfo_dispatch_table* table,
+	const struct cpuinfo_cluster* cluster);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
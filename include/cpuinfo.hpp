@@ -0,0 +1,334 @@
+#pragma once
+#ifndef CPUINFO_HPP
+#define CPUINFO_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include <cpuinfo.h>
+
+
+/*
+ * Header-only C++11 wrapper over the cpuinfo C API.
+ *
+ * - cpuinfo::isa::<feature> tags describe instruction set features. A tag is statically known to be available when
+ *   the compilation target guarantees the feature (see CPUINFO_BASELINE_* macros in cpuinfo.h).
+ * - cpuinfo::dispatch<Impl...> calls the first implementation whose requirements are satisfied. Checks that are
+ *   statically satisfied fold to constants, so dispatch over baseline features compiles to a direct call.
+ * - cpuinfo::processors(), cpuinfo::cores(), etc. return ranges over the tables of the C API, and overloads taking a
+ *   core, cluster, package, or cache return the processors (cores, clusters) sharing it.
+ */
+namespace cpuinfo {
+
+/** Instruction set feature, identified by its bit in packed feature sets. */
+template<enum cpuinfo_isa_feature Feature, bool Baseline>
+struct feature {
+	static constexpr enum cpuinfo_isa_feature index = Feature;
+	/** True if the compilation target guarantees the feature */
+	static constexpr bool baseline = Baseline;
+
+	/** Checks if the host supports the feature. Requires cpuinfo_initialize(). */
+	static bool available() {
+		return Baseline || cpuinfo_isa_bits_has(&cpuinfo_isa_bits_supported, Feature);
+	}
+};
+
+namespace isa {
+	typedef feature<cpuinfo_isa_x86_rdtsc, false> x86_rdtsc;
+	typedef feature<cpuinfo_isa_x86_rdtscp, false> x86_rdtscp;
+	typedef feature<cpuinfo_isa_x86_rdpid, false> x86_rdpid;
+	typedef feature<cpuinfo_isa_x86_clzero, false> x86_clzero;
+	typedef feature<cpuinfo_isa_x86_mwait, false> x86_mwait;
+	typedef feature<cpuinfo_isa_x86_mwaitx, false> x86_mwaitx;
+	typedef feature<cpuinfo_isa_x86_fxsave, false> x86_fxsave;
+	typedef feature<cpuinfo_isa_x86_xsave, false> x86_xsave;
+	typedef feature<cpuinfo_isa_x86_fpu, false> x86_fpu;
+	typedef feature<cpuinfo_isa_x86_mmx, false> x86_mmx;
+	typedef feature<cpuinfo_isa_x86_mmx_plus, false> x86_mmx_plus;
+	typedef feature<cpuinfo_isa_x86_3dnow, false> x86_3dnow;
+	typedef feature<cpuinfo_isa_x86_3dnow_plus, false> x86_3dnow_plus;
+	typedef feature<cpuinfo_isa_x86_3dnow_geode, false> x86_3dnow_geode;
+	typedef feature<cpuinfo_isa_x86_prefetch, false> x86_prefetch;
+	typedef feature<cpuinfo_isa_x86_prefetchw, false> x86_prefetchw;
+	typedef feature<cpuinfo_isa_x86_prefetchwt1, false> x86_prefetchwt1;
+	typedef feature<cpuinfo_isa_x86_daz, false> x86_daz;
+	typedef feature<cpuinfo_isa_x86_sse, CPUINFO_BASELINE_X86_SSE> x86_sse;
+	typedef feature<cpuinfo_isa_x86_sse2, CPUINFO_BASELINE_X86_SSE2> x86_sse2;
+	typedef feature<cpuinfo_isa_x86_sse3, CPUINFO_BASELINE_X86_SSE3> x86_sse3;
+	typedef feature<cpuinfo_isa_x86_ssse3, CPUINFO_BASELINE_X86_SSSE3> x86_ssse3;
+	typedef feature<cpuinfo_isa_x86_sse4_1, CPUINFO_BASELINE_X86_SSE4_1> x86_sse4_1;
+	typedef feature<cpuinfo_isa_x86_sse4_2, CPUINFO_BASELINE_X86_SSE4_2> x86_sse4_2;
+	typedef feature<cpuinfo_isa_x86_sse4a, false> x86_sse4a;
+	typedef feature<cpuinfo_isa_x86_misaligned_sse, false> x86_misaligned_sse;
+	typedef feature<cpuinfo_isa_x86_avx, CPUINFO_BASELINE_X86_AVX> x86_avx;
+	typedef feature<cpuinfo_isa_x86_fma3, CPUINFO_BASELINE_X86_FMA3> x86_fma3;
+	typedef feature<cpuinfo_isa_x86_fma4, false> x86_fma4;
+	typedef feature<cpuinfo_isa_x86_xop, false> x86_xop;
+	typedef feature<cpuinfo_isa_x86_f16c, CPUINFO_BASELINE_X86_F16C> x86_f16c;
+	typedef feature<cpuinfo_isa_x86_avx2, CPUINFO_BASELINE_X86_AVX2> x86_avx2;
+	typedef feature<cpuinfo_isa_x86_avx512f, CPUINFO_BASELINE_X86_AVX512F> x86_avx512f;
+	typedef feature<cpuinfo_isa_x86_avx512pf, false> x86_avx512pf;
+	typedef feature<cpuinfo_isa_x86_avx512er, false> x86_avx512er;
+	typedef feature<cpuinfo_isa_x86_avx512cd, CPUINFO_BASELINE_X86_AVX512CD> x86_avx512cd;
+	typedef feature<cpuinfo_isa_x86_avx512dq, CPUINFO_BASELINE_X86_AVX512DQ> x86_avx512dq;
+	typedef feature<cpuinfo_isa_x86_avx512bw, CPUINFO_BASELINE_X86_AVX512BW> x86_avx512bw;
+	typedef feature<cpuinfo_isa_x86_avx512vl, CPUINFO_BASELINE_X86_AVX512VL> x86_avx512vl;
+	typedef feature<cpuinfo_isa_x86_avx512ifma, false> x86_avx512ifma;
+	typedef feature<cpuinfo_isa_x86_avx512vbmi, false> x86_avx512vbmi;
+	typedef feature<cpuinfo_isa_x86_avx512vbmi2, false> x86_avx512vbmi2;
+	typedef feature<cpuinfo_isa_x86_avx512bitalg, false> x86_avx512bitalg;
+	typedef feature<cpuinfo_isa_x86_avx512vpopcntdq, false> x86_avx512vpopcntdq;
+	typedef feature<cpuinfo_isa_x86_avx512vnni, CPUINFO_BASELINE_X86_AVX512VNNI> x86_avx512vnni;
+	typedef feature<cpuinfo_isa_x86_avx512_4vnniw, false> x86_avx512_4vnniw;
+	typedef feature<cpuinfo_isa_x86_avx512_4fmaps, false> x86_avx512_4fmaps;
+	typedef feature<cpuinfo_isa_x86_avx512vp2intersect, false> x86_avx512vp2intersect;
+	typedef feature<cpuinfo_isa_x86_avx512bf16, CPUINFO_BASELINE_X86_AVX512BF16> x86_avx512bf16;
+	typedef feature<cpuinfo_isa_x86_avx512fp16, CPUINFO_BASELINE_X86_AVX512FP16> x86_avx512fp16;
+	typedef feature<cpuinfo_isa_x86_avxvnni, CPUINFO_BASELINE_X86_AVXVNNI> x86_avxvnni;
+	typedef feature<cpuinfo_isa_x86_amx_tile, false> x86_amx_tile;
+	typedef feature<cpuinfo_isa_x86_amx_int8, false> x86_amx_int8;
+	typedef feature<cpuinfo_isa_x86_amx_bf16, false> x86_amx_bf16;
+	typedef feature<cpuinfo_isa_x86_hle, false> x86_hle;
+	typedef feature<cpuinfo_isa_x86_rtm, false> x86_rtm;
+	typedef feature<cpuinfo_isa_x86_xtest, false> x86_xtest;
+	typedef feature<cpuinfo_isa_x86_mpx, false> x86_mpx;
+	typedef feature<cpuinfo_isa_x86_cmov, false> x86_cmov;
+	typedef feature<cpuinfo_isa_x86_cmpxchg8b, false> x86_cmpxchg8b;
+	typedef feature<cpuinfo_isa_x86_cmpxchg16b, false> x86_cmpxchg16b;
+	typedef feature<cpuinfo_isa_x86_clwb, false> x86_clwb;
+	typedef feature<cpuinfo_isa_x86_movbe, CPUINFO_BASELINE_X86_MOVBE> x86_movbe;
+	typedef feature<cpuinfo_isa_x86_lahf_sahf, false> x86_lahf_sahf;
+	typedef feature<cpuinfo_isa_x86_lzcnt, CPUINFO_BASELINE_X86_LZCNT> x86_lzcnt;
+	typedef feature<cpuinfo_isa_x86_popcnt, CPUINFO_BASELINE_X86_POPCNT> x86_popcnt;
+	typedef feature<cpuinfo_isa_x86_tbm, false> x86_tbm;
+	typedef feature<cpuinfo_isa_x86_bmi, CPUINFO_BASELINE_X86_BMI> x86_bmi;
+	typedef feature<cpuinfo_isa_x86_bmi2, CPUINFO_BASELINE_X86_BMI2> x86_bmi2;
+	typedef feature<cpuinfo_isa_x86_adx, CPUINFO_BASELINE_X86_ADX> x86_adx;
+	typedef feature<cpuinfo_isa_x86_aes, CPUINFO_BASELINE_X86_AES> x86_aes;
+	typedef feature<cpuinfo_isa_x86_vaes, false> x86_vaes;
+	typedef feature<cpuinfo_isa_x86_pclmulqdq, CPUINFO_BASELINE_X86_PCLMULQDQ> x86_pclmulqdq;
+	typedef feature<cpuinfo_isa_x86_vpclmulqdq, false> x86_vpclmulqdq;
+	typedef feature<cpuinfo_isa_x86_gfni, false> x86_gfni;
+	typedef feature<cpuinfo_isa_x86_rdrand, CPUINFO_BASELINE_X86_RDRAND> x86_rdrand;
+	typedef feature<cpuinfo_isa_x86_rdseed, CPUINFO_BASELINE_X86_RDSEED> x86_rdseed;
+	typedef feature<cpuinfo_isa_x86_sha, CPUINFO_BASELINE_X86_SHA> x86_sha;
+	typedef feature<cpuinfo_isa_arm_thumb, false> arm_thumb;
+	typedef feature<cpuinfo_isa_arm_thumb2, false> arm_thumb2;
+	typedef feature<cpuinfo_isa_arm_v5e, false> arm_v5e;
+	typedef feature<cpuinfo_isa_arm_v6, false> arm_v6;
+	typedef feature<cpuinfo_isa_arm_v6k, false> arm_v6k;
+	typedef feature<cpuinfo_isa_arm_v7, false> arm_v7;
+	typedef feature<cpuinfo_isa_arm_v7mp, false> arm_v7mp;
+	typedef feature<cpuinfo_isa_arm_idiv, CPUINFO_BASELINE_ARM_IDIV> arm_idiv;
+	typedef feature<cpuinfo_isa_arm_vfpv2, false> arm_vfpv2;
+	typedef feature<cpuinfo_isa_arm_vfpv3, false> arm_vfpv3;
+	typedef feature<cpuinfo_isa_arm_vfpv3_d32, false> arm_vfpv3_d32;
+	typedef feature<cpuinfo_isa_arm_vfpv3_fp16, false> arm_vfpv3_fp16;
+	typedef feature<cpuinfo_isa_arm_vfpv3_fp16_d32, false> arm_vfpv3_fp16_d32;
+	typedef feature<cpuinfo_isa_arm_vfpv4, CPUINFO_BASELINE_ARM_VFPV4> arm_vfpv4;
+	typedef feature<cpuinfo_isa_arm_vfpv4_d32, false> arm_vfpv4_d32;
+	typedef feature<cpuinfo_isa_arm_wmmx, false> arm_wmmx;
+	typedef feature<cpuinfo_isa_arm_wmmx2, false> arm_wmmx2;
+	typedef feature<cpuinfo_isa_arm_neon, CPUINFO_BASELINE_ARM_NEON> arm_neon;
+	typedef feature<cpuinfo_isa_arm_neon_fp16, false> arm_neon_fp16;
+	typedef feature<cpuinfo_isa_arm_neon_fma, CPUINFO_BASELINE_ARM_NEON_FMA> arm_neon_fma;
+	typedef feature<cpuinfo_isa_arm_atomics, CPUINFO_BASELINE_ARM_ATOMICS> arm_atomics;
+	typedef feature<cpuinfo_isa_arm_neon_rdm, CPUINFO_BASELINE_ARM_NEON_RDM> arm_neon_rdm;
+	typedef feature<cpuinfo_isa_arm_fp16_arith, CPUINFO_BASELINE_ARM_FP16_ARITH> arm_fp16_arith;
+	typedef feature<cpuinfo_isa_arm_jscvt, CPUINFO_BASELINE_ARM_JSCVT> arm_jscvt;
+	typedef feature<cpuinfo_isa_arm_fcma, CPUINFO_BASELINE_ARM_FCMA> arm_fcma;
+	typedef feature<cpuinfo_isa_arm_neon_dot, CPUINFO_BASELINE_ARM_NEON_DOT> arm_neon_dot;
+	typedef feature<cpuinfo_isa_arm_fhm, CPUINFO_BASELINE_ARM_FHM> arm_fhm;
+	typedef feature<cpuinfo_isa_arm_i8mm, CPUINFO_BASELINE_ARM_I8MM> arm_i8mm;
+	typedef feature<cpuinfo_isa_arm_bf16, CPUINFO_BASELINE_ARM_BF16> arm_bf16;
+	typedef feature<cpuinfo_isa_arm_sve, CPUINFO_BASELINE_ARM_SVE> arm_sve;
+	typedef feature<cpuinfo_isa_arm_sve2, CPUINFO_BASELINE_ARM_SVE2> arm_sve2;
+	typedef feature<cpuinfo_isa_arm_sve_bf16, false> arm_sve_bf16;
+	typedef feature<cpuinfo_isa_arm_sve_i8mm, false> arm_sve_i8mm;
+	typedef feature<cpuinfo_isa_arm_aes, CPUINFO_BASELINE_ARM_AES> arm_aes;
+	typedef feature<cpuinfo_isa_arm_sha1, CPUINFO_BASELINE_ARM_SHA1> arm_sha1;
+	typedef feature<cpuinfo_isa_arm_sha2, CPUINFO_BASELINE_ARM_SHA2> arm_sha2;
+	typedef feature<cpuinfo_isa_arm_pmull, CPUINFO_BASELINE_ARM_PMULL> arm_pmull;
+	typedef feature<cpuinfo_isa_arm_crc32, CPUINFO_BASELINE_ARM_CRC32> arm_crc32;
+} /* namespace isa */
+
+/** Set of instruction set features, all of which are required by an implementation. */
+template<class... Features>
+struct requirements;
+
+template<>
+struct requirements<> {
+	static constexpr bool baseline = true;
+
+	static bool available() {
+		return true;
+	}
+};
+
+template<class Feature, class... Features>
+struct requirements<Feature, Features...> {
+	static constexpr bool baseline = Feature::baseline && requirements<Features...>::baseline;
+
+	/** Checks all features with a single packed comparison; see cpuinfo_isa_has_all(). */
+	static bool available() {
+		return baseline || cpuinfo_isa_has_all(&bits());
+	}
+
+	static const struct cpuinfo_isa_bits& bits() {
+		static const struct cpuinfo_isa_bits required = make_bits();
+		return required;
+	}
+
+private:
+	static struct cpuinfo_isa_bits make_bits() {
+		struct cpuinfo_isa_bits required = { { 0 } };
+		const enum cpuinfo_isa_feature features[] = { Feature::index, Features::index... };
+		for (std::size_t i = 0; i < sizeof(features) / sizeof(features[0]); i++) {
+			cpuinfo_isa_bits_add(&required, features[i]);
+		}
+		return required;
+	}
+};
+
+/**
+ * Calls the first implementation with satisfied requirements.
+ *
+ * Each implementation is a type with a `requirements` member type (an instantiation of cpuinfo::requirements) and a
+ * static `run` function. All implementations take the same arguments and return the same type. The last
+ * implementation is a fallback, called without checking its requirements.
+ */
+template<class... Impls>
+struct dispatch;
+
+template<class Impl>
+struct dispatch<Impl> {
+	template<class... Args>
+	static auto run(Args&&... args) -> decltype(Impl::run(std::forward<Args>(args)...)) {
+		return Impl::run(std::forward<Args>(args)...);
+	}
+
+	/** Returns the first implementation with satisfied requirements, to be cached by the caller. */
+	template<class Function>
+	static Function* resolve() {
+		return &Impl::run;
+	}
+};
+
+template<class Impl, class... Impls>
+struct dispatch<Impl, Impls...> {
+	template<class... Args>
+	static auto run(Args&&... args) -> decltype(Impl::run(std::forward<Args>(args)...)) {
+		if (Impl::requirements::baseline || Impl::requirements::available()) {
+			return Impl::run(std::forward<Args>(args)...);
+		}
+		return dispatch<Impls...>::run(std::forward<Args>(args)...);
+	}
+
+	template<class Function>
+	static Function* resolve() {
+		if (Impl::requirements::baseline || Impl::requirements::available()) {
+			return &Impl::run;
+		}
+		return dispatch<Impls...>::template resolve<Function>();
+	}
+};
+
+/** Contiguous range of objects in cpuinfo tables. */
+template<class T>
+class range {
+public:
+	typedef const T* iterator;
+
+	range() : first_(nullptr), last_(nullptr) {}
+	range(const T* first, std::size_t count) : first_(first), last_(first == nullptr ? first : first + count) {}
+
+	iterator begin() const { return first_; }
+	iterator end() const { return last_; }
+	std::size_t size() const { return static_cast<std::size_t>(last_ - first_); }
+	bool empty() const { return first_ == last_; }
+	const T& operator[](std::size_t index) const { return first_[index]; }
+
+private:
+	const T* first_;
+	const T* last_;
+};
+
+inline range<cpuinfo_processor> processors() {
+	return range<cpuinfo_processor>(cpuinfo_get_processors(), cpuinfo_get_processors_count());
+}
+
+inline range<cpuinfo_core> cores() {
+	return range<cpuinfo_core>(cpuinfo_get_cores(), cpuinfo_get_cores_count());
+}
+
+inline range<cpuinfo_cluster> clusters() {
+	return range<cpuinfo_cluster>(cpuinfo_get_clusters(), cpuinfo_get_clusters_count());
+}
+
+inline range<cpuinfo_package> packages() {
+	return range<cpuinfo_package>(cpuinfo_get_packages(), cpuinfo_get_packages_count());
+}
+
+inline range<cpuinfo_cache> l1i_caches() {
+	return range<cpuinfo_cache>(cpuinfo_get_l1i_caches(), cpuinfo_get_l1i_caches_count());
+}
+
+inline range<cpuinfo_cache> l1d_caches() {
+	return range<cpuinfo_cache>(cpuinfo_get_l1d_caches(), cpuinfo_get_l1d_caches_count());
+}
+
+inline range<cpuinfo_cache> l2_caches() {
+	return range<cpuinfo_cache>(cpuinfo_get_l2_caches(), cpuinfo_get_l2_caches_count());
+}
+
+inline range<cpuinfo_cache> l3_caches() {
+	return range<cpuinfo_cache>(cpuinfo_get_l3_caches(), cpuinfo_get_l3_caches_count());
+}
+
+inline range<cpuinfo_cache> l4_caches() {
+	return range<cpuinfo_cache>(cpuinfo_get_l4_caches(), cpuinfo_get_l4_caches_count());
+}
+
+/** Core classes, from the fastest cores to the most efficient ones */
+inline range<cpuinfo_core_class> core_classes() {
+	return range<cpuinfo_core_class>(cpuinfo_get_core_classes(), cpuinfo_get_core_classes_count());
+}
+
+/* Sharing domains: logical processors sharing a core, a cluster, a package, or a cache */
+
+inline range<cpuinfo_processor> processors(const cpuinfo_core& core) {
+	return range<cpuinfo_processor>(cpuinfo_get_processor(core.processor_start), core.processor_count);
+}
+
+inline range<cpuinfo_processor> processors(const cpuinfo_cluster& cluster) {
+	return range<cpuinfo_processor>(cpuinfo_get_processor(cluster.processor_start), cluster.processor_count);
+}
+
+inline range<cpuinfo_processor> processors(const cpuinfo_package& package) {
+	return range<cpuinfo_processor>(cpuinfo_get_processor(package.processor_start), package.processor_count);
+}
+
+inline range<cpuinfo_processor> processors(const cpuinfo_cache& cache) {
+	return range<cpuinfo_processor>(cpuinfo_get_processor(cache.processor_start), cache.processor_count);
+}
+
+/** Logical processors of a core class are not contiguous in cpuinfo tables: the range holds pointers to them */
+inline range<const cpuinfo_processor*> processors(const cpuinfo_core_class& core_class) {
+	return range<const cpuinfo_processor*>(core_class.processors, core_class.processor_count);
+}
+
+inline range<cpuinfo_core> cores(const cpuinfo_cluster& cluster) {
+	return range<cpuinfo_core>(cpuinfo_get_core(cluster.core_start), cluster.core_count);
+}
+
+inline range<cpuinfo_core> cores(const cpuinfo_package& package) {
+	return range<cpuinfo_core>(cpuinfo_get_core(package.core_start), package.core_count);
+}
+
+inline range<cpuinfo_cluster> clusters(const cpuinfo_package& package) {
+	return range<cpuinfo_cluster>(cpuinfo_get_cluster(package.cluster_start), package.cluster_count);
+}
+
+} /* namespace cpuinfo */
+
+#endif /* CPUINFO_HPP */
@@ -5,10 +5,20 @@ LOCAL_MODULE := cpuinfo
 LOCAL_SRC_FILES := $(LOCAL_PATH)/src/init.c \
 	$(LOCAL_PATH)/src/api.c \
 	$(LOCAL_PATH)/src/log.c \
+	$(LOCAL_PATH)/src/throughput.c \
+	$(LOCAL_PATH)/src/uarch-info.c \
+	$(LOCAL_PATH)/src/blocking.c \
+	$(LOCAL_PATH)/src/isa-bits.c \
+	$(LOCAL_PATH)/src/dispatch.c \
+	$(LOCAL_PATH)/src/core-classes.c \
 	$(LOCAL_PATH)/src/gpu/gles2.c \
 	$(LOCAL_PATH)/src/linux/gpu.c \
 	$(LOCAL_PATH)/src/linux/current.c \
 	$(LOCAL_PATH)/src/linux/processors.c \
+	$(LOCAL_PATH)/src/linux/cache.c \
+	$(LOCAL_PATH)/src/linux/frequency.c \
+	$(LOCAL_PATH)/src/linux/latency.c \
+	$(LOCAL_PATH)/src/linux/sve.c \
 	$(LOCAL_PATH)/src/linux/smallfile.c \
 	$(LOCAL_PATH)/src/linux/multiline.c \
 	$(LOCAL_PATH)/src/linux/cpulist.c
@@ -40,6 +50,8 @@ LOCAL_SRC_FILES += \
 	$(LOCAL_PATH)/src/x86/info.c \
 	$(LOCAL_PATH)/src/x86/name.c \
 	$(LOCAL_PATH)/src/x86/isa.c \
+	$(LOCAL_PATH)/src/x86/amx.c \
+	$(LOCAL_PATH)/src/x86/xsave.c \
 	$(LOCAL_PATH)/src/x86/vendor.c \
 	$(LOCAL_PATH)/src/x86/uarch.c \
 	$(LOCAL_PATH)/src/x86/topology.c \
@@ -47,6 +59,7 @@ LOCAL_SRC_FILES += \
 	$(LOCAL_PATH)/src/x86/cache/descriptor.c \
 	$(LOCAL_PATH)/src/x86/cache/deterministic.c \
 	$(LOCAL_PATH)/src/x86/linux/cpuinfo.c \
+	$(LOCAL_PATH)/src/x86/linux/hybrid.c \
 	$(LOCAL_PATH)/src/x86/linux/init.c
 endif # x86 or x86_64
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)/include
@@ -59,11 +72,22 @@ LOCAL_MODULE := cpuinfo_mock
 LOCAL_SRC_FILES := $(LOCAL_PATH)/src/init.c \
 	$(LOCAL_PATH)/src/api.c \
 	$(LOCAL_PATH)/src/log.c \
+	$(LOCAL_PATH)/src/throughput.c \
+	$(LOCAL_PATH)/src/uarch-info.c \
+	$(LOCAL_PATH)/src/blocking.c \
+	$(LOCAL_PATH)/src/isa-bits.c \
+	$(LOCAL_PATH)/src/dispatch.c \
+	$(LOCAL_PATH)/src/core-classes.c \
 	$(LOCAL_PATH)/src/gpu/gles2-mock.c \
 	$(LOCAL_PATH)/src/linux/gpu.c \
 	$(LOCAL_PATH)/src/linux/current.c \
 	$(LOCAL_PATH)/src/linux/mockfile.c \
+	$(LOCAL_PATH)/src/linux/mockdump.c \
 	$(LOCAL_PATH)/src/linux/processors.c \
+	$(LOCAL_PATH)/src/linux/cache.c \
+	$(LOCAL_PATH)/src/linux/frequency.c \
+	$(LOCAL_PATH)/src/linux/latency.c \
+	$(LOCAL_PATH)/src/linux/sve.c \
 	$(LOCAL_PATH)/src/linux/smallfile.c \
 	$(LOCAL_PATH)/src/linux/multiline.c \
 	$(LOCAL_PATH)/src/linux/cpulist.c
@@ -95,6 +119,8 @@ LOCAL_SRC_FILES += \
 	$(LOCAL_PATH)/src/x86/info.c \
 	$(LOCAL_PATH)/src/x86/name.c \
 	$(LOCAL_PATH)/src/x86/isa.c \
+	$(LOCAL_PATH)/src/x86/amx.c \
+	$(LOCAL_PATH)/src/x86/xsave.c \
 	$(LOCAL_PATH)/src/x86/vendor.c \
 	$(LOCAL_PATH)/src/x86/uarch.c \
 	$(LOCAL_PATH)/src/x86/topology.c \
@@ -103,6 +129,7 @@ LOCAL_SRC_FILES += \
 	$(LOCAL_PATH)/src/x86/cache/descriptor.c \
 	$(LOCAL_PATH)/src/x86/cache/deterministic.c \
 	$(LOCAL_PATH)/src/x86/linux/cpuinfo.c \
+	$(LOCAL_PATH)/src/x86/linux/hybrid.c \
 	$(LOCAL_PATH)/src/x86/linux/init.c
 endif # x86 or x86_64
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)/include
@@ -460,7 +487,8 @@ LOCAL_SRC_FILES := \
 	$(LOCAL_PATH)/test/name/ro-mediatek-platform.cc \
 	$(LOCAL_PATH)/test/name/ro-arch.cc \
 	$(LOCAL_PATH)/test/name/ro-chipname.cc \
-	$(LOCAL_PATH)/test/name/android-properties.cc
+	$(LOCAL_PATH)/test/name/android-properties.cc \
+	$(LOCAL_PATH)/test/name/android-gpu.cc
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/src
 LOCAL_STATIC_LIBRARIES := android_properties_interface gtest gtest_main
 include $(BUILD_EXECUTABLE)
@@ -11,6 +11,9 @@ import tempfile
 parser = argparse.ArgumentParser(description='Android system files extractor')
 parser.add_argument("-p", "--prefix", metavar="NAME", required=True,
                     help="Prefix for stored files, e.g. galaxy-s7-us")
+parser.add_argument("-d", "--directory", metavar="DIR",
+                    help="Also store dumped files as a directory tree in DIR, e.g. test/mock/galaxy-s7-us, "
+                         "for loading with cpuinfo_mock_filesystem_from_directory")
 
 
 # System files which need to be read with `adb shell cat filename`
@@ -275,7 +278,16 @@ def adb_getprop():
         properties_list.append((key, value))
     return properties_list
 
-def dump_device_file(stream, path):
+def store_raw_file(directory, path, content):
+    if directory is not None:
+        raw_path = os.path.join(directory, path.lstrip("/"))
+        if not os.path.isdir(os.path.dirname(raw_path)):
+            os.makedirs(os.path.dirname(raw_path))
+        with open(raw_path, "wb") as raw_file:
+            raw_file.write(content)
+
+
+def dump_device_file(stream, path, directory=None):
     temp_fd, temp_path = tempfile.mkstemp()
     os.close(temp_fd)
     try:
@@ -293,6 +305,7 @@ def dump_device_file(stream, path):
                 else:
                     stream.write("\t\t.content = \"%s\",\n" % c_escape(content))
                 stream.write("\t},\n")
+                store_raw_file(directory, path, content)
                 return content
     finally:
         if os.path.exists(temp_path):
@@ -315,7 +328,7 @@ def main(args):
     with open(os.path.join("test", "mock", options.prefix + ".h"), "w") as file_header:
         file_header.write("struct cpuinfo_mock_file filesystem[] = {\n")
         for path in SYSTEM_FILES:
-            content = dump_device_file(file_header, path)
+            content = dump_device_file(file_header, path, options.directory)
             if content is not None:
                 if path == "/proc/cpuinfo":
                     proc_cpuinfo_content = content
@@ -326,11 +339,11 @@ def main(args):
         for cpu in range(kernel_max + 1):
             for filename in CPU_FILES:
                 path = "/sys/devices/system/cpu/cpu%d/%s" % (cpu, filename)
-                dump_device_file(file_header, path)
+                dump_device_file(file_header, path, options.directory)
             for index in range(5):
                 for filename in CACHE_FILES:
                     path = "/sys/devices/system/cpu/cpu%d/cache/index%d/%s" % (cpu, index, filename)
-                    dump_device_file(file_header, path)
+                    dump_device_file(file_header, path, options.directory)
         file_header.write("\t{ NULL },\n")
         file_header.write("};\n")
         file_header.write("#ifdef __ANDROID__\n")
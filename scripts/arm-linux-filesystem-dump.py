@@ -9,6 +9,9 @@ import shutil
 parser = argparse.ArgumentParser(description='Android system files extractor')
 parser.add_argument("-p", "--prefix", metavar="NAME", required=True,
                     help="Prefix for stored files, e.g. galaxy-s7-us")
+parser.add_argument("-d", "--directory", metavar="DIR",
+                    help="Also store dumped files as a directory tree in DIR, e.g. test/mock/galaxy-s7-us, "
+                         "for loading with cpuinfo_mock_filesystem_from_directory")
 
 
 SYSTEM_FILES = [
@@ -61,7 +64,16 @@ def c_escape(string):
     return c_string
 
 
-def dump_system_file(stream, path):
+def store_raw_file(directory, path, content):
+    if directory is not None:
+        raw_path = os.path.join(directory, path.lstrip("/"))
+        if not os.path.isdir(os.path.dirname(raw_path)):
+            os.makedirs(os.path.dirname(raw_path))
+        with open(raw_path, "wb") as raw_file:
+            raw_file.write(content)
+
+
+def dump_system_file(stream, path, directory=None):
     try:
         with open(path, "rb") as device_file:
             content = device_file.read()
@@ -76,6 +88,7 @@ def dump_system_file(stream, path):
             else:
                 stream.write("\t\t.content = \"%s\",\n" % c_escape(content))
             stream.write("\t},\n")
+            store_raw_file(directory, path, content)
             return True
     except IOError:
         pass
@@ -89,15 +102,15 @@ def main(args):
     with open(os.path.join("test", options.prefix + ".h"), "w") as file_header:
         file_header.write("struct cpuinfo_mock_file filesystem[] = {\n")
         for path in SYSTEM_FILES:
-            dump_system_file(file_header, path)
+            dump_system_file(file_header, path, options.directory)
         for cpu in range(16):
             for filename in CPU_FILES:
                 path = "/sys/devices/system/cpu/cpu%d/%s" % (cpu, filename)
-                dump_system_file(file_header, path)
+                dump_system_file(file_header, path, options.directory)
             for index in range(10):
                 for filename in CACHE_FILES:
                     path = "/sys/devices/system/cpu/cpu%d/cache/index%d/%s" % (cpu, index, filename)
-                    dump_system_file(file_header, path)
+                    dump_system_file(file_header, path, options.directory)
         file_header.write("\t{ NULL },\n")
         file_header.write("};\n")
     shutil.copy("/proc/cpuinfo",
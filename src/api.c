@@ -2,6 +2,9 @@
 
 #include <cpuinfo.h>
 #include <api.h>
+#ifdef __linux__
+	#include <linux/api.h>
+#endif
 
 
 struct cpuinfo_processor* cpuinfo_processors = NULL;
@@ -15,6 +18,11 @@ uint32_t cpuinfo_cores_count = 0;
 uint32_t cpuinfo_clusters_count = 0;
 uint32_t cpuinfo_packages_count = 0;
 uint32_t cpuinfo_cache_count[cpuinfo_cache_level_max] = { 0 };
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	struct cpuinfo_x86_isa* cpuinfo_cluster_isa = NULL;
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	struct cpuinfo_arm_isa* cpuinfo_cluster_isa = NULL;
+#endif
 
 
 const struct cpuinfo_processor* cpuinfo_get_processors(void) {
@@ -141,6 +149,21 @@ const struct cpuinfo_cache* CPUINFO_ABI cpuinfo_get_l4_cache(uint32_t index) {
 	}
 }
 
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+const struct cpuinfo_x86_isa* CPUINFO_ABI cpuinfo_get_cluster_isa(uint32_t cluster_index) {
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+const struct cpuinfo_arm_isa* CPUINFO_ABI cpuinfo_get_cluster_isa(uint32_t cluster_index) {
+#endif
+	if (cluster_index >= cpuinfo_clusters_count) {
+		return NULL;
+	}
+	if (cpuinfo_cluster_isa == NULL) {
+		/* Platform does not report per-cluster features: all clusters support the same ISA */
+		return &cpuinfo_isa;
+	}
+	return cpuinfo_cluster_isa + cluster_index;
+}
+
 uint32_t CPUINFO_ABI cpuinfo_get_l1i_caches_count(void) {
 	return cpuinfo_cache_count[cpuinfo_cache_level_1i];
 }
@@ -160,3 +183,22 @@ uint32_t CPUINFO_ABI cpuinfo_get_l3_caches_count(void) {
 uint32_t CPUINFO_ABI cpuinfo_get_l4_caches_count(void) {
 	return cpuinfo_cache_count[cpuinfo_cache_level_4];
 }
+
+uint32_t CPUINFO_ABI cpuinfo_get_max_arm_sve_length(void) {
+	#ifdef __linux__
+		/* The kernel reports vector length in bytes */
+		return cpuinfo_linux_get_max_sve_vector_length() * 8;
+	#else
+		return 0;
+	#endif
+}
+
+#if !CPUINFO_ARCH_X86 && !CPUINFO_ARCH_X86_64
+	bool CPUINFO_ABI cpuinfo_request_x86_amx(void) {
+		return false;
+	}
+
+	const struct cpuinfo_x86_xsave* CPUINFO_ABI cpuinfo_get_x86_xsave(void) {
+		return NULL;
+	}
+#endif
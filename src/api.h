@@ -28,6 +28,22 @@ extern uint32_t cpuinfo_cores_count;
 extern uint32_t cpuinfo_clusters_count;
 extern uint32_t cpuinfo_packages_count;
 extern uint32_t cpuinfo_cache_count[cpuinfo_cache_level_max];
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	extern struct cpuinfo_x86_isa* cpuinfo_cluster_isa;
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	extern struct cpuinfo_arm_isa* cpuinfo_cluster_isa;
+#endif
+
+/* Restricts ISA features to those also supported by the other ISA, e.g. to features common to all clusters */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	void cpuinfo_intersect_isa(
+		struct cpuinfo_x86_isa isa[restrict static 1],
+		const struct cpuinfo_x86_isa other[restrict static 1]);
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	void cpuinfo_intersect_isa(
+		struct cpuinfo_arm_isa isa[restrict static 1],
+		const struct cpuinfo_arm_isa other[restrict static 1]);
+#endif
 
 void cpuinfo_x86_mach_init(void);
 void cpuinfo_x86_linux_init(void);
@@ -37,4 +53,13 @@ void cpuinfo_x86_linux_init(void);
 void cpuinfo_arm_mach_init(void);
 void cpuinfo_arm_linux_init(void);
 
+/* Build the state derived from the topology; called by cpuinfo_initialize() under its lock, once per initialization */
+void cpuinfo_init_isa_bits(void);
+void cpuinfo_init_core_classes(void);
+void cpuinfo_deinit_isa_bits(void);
+void cpuinfo_deinit_core_classes(void);
+void cpuinfo_deinit_cluster_geometry(void);
+/* Features of a cluster, a superset of cpuinfo_isa_bits_supported, or NULL if the index is out of range */
+const struct cpuinfo_isa_bits* cpuinfo_get_cluster_isa_bits(uint32_t cluster_index);
+
 typedef void (*cpuinfo_processor_callback)(uint32_t);
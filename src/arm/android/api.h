@@ -19,3 +19,11 @@ void cpuinfo_arm_android_parse_properties(struct cpuinfo_android_properties prop
 bool cpuinfo_arm_android_lookup_gpu(
 	const struct cpuinfo_arm_chipset chipset[restrict static 1],
 	struct cpuinfo_android_gpu gpu[restrict static 1]);
+/*
+ * Reads the entry of the chipset GPU table at the index, in table order. The chipset suffix is '*' for entries which
+ * match any suffix, and the chipset vendor is not set. Returns false if the index is past the end of the table.
+ */
+bool cpuinfo_arm_android_get_chipset_gpu_entry(
+	size_t index,
+	struct cpuinfo_arm_chipset chipset[restrict static 1],
+	struct cpuinfo_android_gpu gpu[restrict static 1]);
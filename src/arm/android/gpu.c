@@ -15,309 +15,444 @@ struct cpuinfo_chipset_gpu_entry {
 
 /*
  * Table of Android GPUs for different chipsets.
+ * Entries are sorted by chipset series (in the order of enum cpuinfo_arm_chipset_series) and chipset model, and
+ * cpuinfo_arm_android_lookup_gpu relies on this order for binary search. Entries for the same chipset series and model
+ * are checked for a matching suffix in the order of the table.
  */
 static const struct cpuinfo_chipset_gpu_entry chipset_gpu_map[] = {
 	{
-		/* Actions ATM7029 -> Vivante GC1000 */
-		.chipset_series = cpuinfo_arm_chipset_series_actions_atm,
-		.chipset_model = 7029,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 1000,
+		/* Qualcomm MSM7225AB -> Qualcomm Adreno 200 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 7225,
+		.chipset_suffix = 'A',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 200,
 	},
 	{
-		/* Actions ATM7029B -> PowerVR SGX 540 */
-		.chipset_series = cpuinfo_arm_chipset_series_actions_atm,
-		.chipset_model = 7029,
-		.chipset_suffix = 'B',
-		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
-		.gpu_model = 540,
+		/* Qualcomm MSM7625A -> Qualcomm Adreno 200 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 7625,
+		.chipset_suffix = 'A',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 200,
 	},
 	{
-		/* Allwinner A10 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 10,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
+		/* Qualcomm MSM7630 -> Qualcomm Adreno 205 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 7630,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 205,
 	},
 	{
-		/* Allwinner A13 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 13,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
+		/* Qualcomm MSM8208 -> Qualcomm Adreno 304 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8208,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 304,
 	},
 	{
-		/* Allwinner A20 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 20,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
+		/* Qualcomm MSM8209 -> Qualcomm Adreno 304 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8209,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 304,
 	},
 	{
-		/* Allwinner A23 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 23,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
+		/* Qualcomm MSM8210 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8210,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Allwinner A31 -> PowerVR SGX 544 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 31,
-		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
-		.gpu_model = 544,
+		/* Qualcomm MSM8212 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8212,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Allwinner A33 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 33,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
+		/* Qualcomm MSM8225 -> Qualcomm Adreno 203 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8225,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 203,
 	},
 	{
-		/* Allwinner A80 -> PowerVR Rogue G6230 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 80,
-		.gpu_series = cpuinfo_android_gpu_series_powervr_rogue_g,
-		.gpu_model = 6230,
+		/* Qualcomm MSM8226 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8226,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Allwinner A83T -> PowerVR SGX 544 */
-		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
-		.chipset_model = 83,
-		.chipset_suffix = 'T',
-		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
-		.gpu_model = 544,
+		/* Qualcomm MSM8228 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8228,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Amlogic AML8726* -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_amlogic_aml,
-		.chipset_model = 8726,
+		/* Qualcomm MSM8230* -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8230,
 		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Amlogic S805 -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
-		.chipset_model = 805,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8239 -> Qualcomm Adreno 405 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8239,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 405,
 	},
 	{
-		/* Amlogic S812 -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
-		.chipset_model = 812,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8260A -> Qualcomm Adreno 225 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8260,
+		.chipset_suffix = 'A',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 225,
 	},
 	{
-		/* Amlogic S905* -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
-		.chipset_model = 905,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8274 -> Qualcomm Adreno 330 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8274,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 330,
 	},
 	{
-		/* Amlogic S912 -> ARM Mali-T820 */
-		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
-		.chipset_model = 912,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 820,
+		/* Qualcomm MSM8609 -> Qualcomm Adreno 304 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8609,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 304,
 	},
 	{
-		/* Broadcom BCM21654* -> Broadcom VideoCore IV */
-		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
-		.chipset_model = 21654,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
-		.gpu_model = 4,
+		/* Qualcomm MSM8610 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8610,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Broadcom BCM21663 -> Broadcom VideoCore IV */
-		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
-		.chipset_model = 21663,
-		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
-		.gpu_model = 4,
+		/* Qualcomm MSM8612 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8612,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* Broadcom BCM21664* -> Broadcom VideoCore IV */
-		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
-		.chipset_model = 21664,
+		/* Qualcomm MSM8625* -> Qualcomm Adreno 203 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8625,
 		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
-		.gpu_model = 4,
-	},
-	{
-		/* Broadcom BCM23550 -> Broadcom VideoCore IV */
-		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
-		.chipset_model = 23550,
-		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
-		.gpu_model = 4,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 203,
 	},
 	{
-		/* Broadcom BCM28155 -> Broadcom VideoCore IV */
-		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
-		.chipset_model = 28155,
-		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
-		.gpu_model = 4,
+		/* Qualcomm MSM8626 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8626,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* HiSilicon Hi3751 -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_hi,
-		.chipset_model = 3751,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8627 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8627,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* HiSilicon K3V2 -> Vivante GC4000 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_k3v,
-		.chipset_model = 2,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 4000,
+		/* Qualcomm MSM8628 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8628,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* HiSilicon Kirin 620 -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 620,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8660 -> Qualcomm Adreno 220 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8660,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 220,
 	},
 	{
-		/* HiSilicon Kirin 650 -> ARM Mali-T830 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 650,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 830,
+		/* Qualcomm MSM8674PRO -> Qualcomm Adreno 330 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8674,
+		.chipset_suffix = 'P',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 330,
 	},
 	{
-		/* HiSilicon Kirin 659 -> ARM Mali-T830 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 659,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 830,
+		/* Qualcomm MSM8909 -> Qualcomm Adreno 304 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8909,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 304,
 	},
 	{
-		/* HiSilicon Kirin 910T -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 910,
-		.chipset_suffix = 'T',
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8916 -> Qualcomm Adreno 306 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8916,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 306,
 	},
 	{
-		/* HiSilicon Kirin 920 -> ARM Mali-T624 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 920,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 624,
+		/* Qualcomm MSM8917 -> Qualcomm Adreno 308 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8917,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 308,
 	},
 	{
-		/* HiSilicon Kirin 925 -> ARM Mali-T624 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 925,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 624,
+		/* Qualcomm MSM8920 -> Qualcomm Adreno 308 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8920,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 308,
 	},
 	{
-		/* HiSilicon Kirin 930 -> ARM Mali-T624 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 930,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 624,
+		/* Qualcomm MSM8926 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8926,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* HiSilicon Kirin 935 -> ARM Mali-T624 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 935,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 624,
+		/* Qualcomm MSM8928 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8928,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* HiSilicon Kirin 950 -> ARM Mali-T880 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 950,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 880,
+		/* Qualcomm MSM8929 -> Qualcomm Adreno 405 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8929,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 405,
 	},
 	{
-		/* HiSilicon Kirin 955 -> ARM Mali-T880 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 955,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 880,
+		/* Qualcomm MSM8930* -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8930,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
 	},
 	{
-		/* HiSilicon Kirin 960 -> ARM Mali-G71 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 960,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
-		.gpu_model = 71,
+		/* Qualcomm MSM8937 -> Qualcomm Adreno 505 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8937,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 505,
 	},
 	{
-		/* HiSilicon Kirin 970 -> ARM Mali-G72 */
-		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
-		.chipset_model = 970,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
-		.gpu_model = 72,
+		/* Qualcomm MSM8939 -> Qualcomm Adreno 405 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8939,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 405,
 	},
 	{
-		/* LG Nuclun 7111 -> PowerVR Rogue G6430 */
-		.chipset_series = cpuinfo_arm_chipset_series_lg_nuclun,
-		.chipset_model = 7111,
-		.gpu_series = cpuinfo_android_gpu_series_powervr_rogue_g,
-		.gpu_model = 6430,
+		/* Qualcomm MSM8940 -> Qualcomm Adreno 505 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8940,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 505,
 	},
 	{
-		/* Leadcore LC1860 -> ARM Mali-T622 */
-		.chipset_series = cpuinfo_arm_chipset_series_leadcore_lc,
-		.chipset_model = 1860,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 622,
+		/* Qualcomm MSM8952 -> Qualcomm Adreno 405 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8952,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 405,
 	},
 	{
-		/* MStar 6A338 -> ARM Mali-450 */
-		.chipset_series = cpuinfo_arm_chipset_series_mstar_6a,
-		.chipset_model = 338,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 450,
+		/* Qualcomm MSM8953* -> Qualcomm Adreno 506 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8953,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 506,
 	},
 	{
-		/* Marvell PXA1088 -> Vivante GC1000 */
-		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
-		.chipset_model = 1088,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 1000,
+		/* Qualcomm MSM8956 -> Qualcomm Adreno 510 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8956,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 510,
 	},
 	{
-		/* Marvell PXA1908 -> Vivante GC7000UL */
-		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
-		.chipset_model = 1908,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 7000,
-		.gpu_suffix = 'U',
+		/* Qualcomm MSM8974* -> Qualcomm Adreno 330 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8974,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 330,
 	},
 	{
-		/* Marvell PXA1928 -> Vivante GC5000 */
-		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
-		.chipset_model = 1928,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 5000,
+		/* Qualcomm MSM8976* -> Qualcomm Adreno 510 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8976,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 510,
 	},
 	{
-		/* Marvell PXA986 -> Vivante GC1000 */
-		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
-		.chipset_model = 986,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 1000,
+		/* Qualcomm MSM8992 -> Qualcomm Adreno 418 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8992,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 418,
 	},
 	{
-		/* Marvell PXA988 -> Vivante GC1000 */
-		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
-		.chipset_model = 988,
-		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
-		.gpu_model = 1000,
+		/* Qualcomm MSM8994* -> Qualcomm Adreno 430 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8994,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 430,
+	},
+	{
+		/* Qualcomm MSM8996* -> Qualcomm Adreno 530 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8996,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 530,
+	},
+	{
+		/* Qualcomm MSM8998 -> Qualcomm Adreno 540 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.chipset_model = 8998,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 540,
+	},
+	{
+		/* Qualcomm APQ8009 -> Qualcomm Adreno 304 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8009,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 304,
+	},
+	{
+		/* Qualcomm APQ8016 -> Qualcomm Adreno 306 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8016,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 306,
+	},
+	{
+		/* Qualcomm APQ8017 -> Qualcomm Adreno 308 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8017,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 308,
+	},
+	{
+		/* Qualcomm APQ8026 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8026,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
+	},
+	{
+		/* Qualcomm APQ8028 -> Qualcomm Adreno 305 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8028,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 305,
+	},
+	{
+		/* Qualcomm APQ8039 -> Qualcomm Adreno 405 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8039,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 405,
+	},
+	{
+		/* Qualcomm APQ8053 -> Qualcomm Adreno 506 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8053,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 506,
+	},
+	{
+		/* Qualcomm APQ8064* -> Qualcomm Adreno 320 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8064,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 320,
+	},
+	{
+		/* Qualcomm APQ8074* -> Qualcomm Adreno 330 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8074,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 330,
+	},
+	{
+		/* Qualcomm APQ8076 -> Qualcomm Adreno 510 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8076,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 510,
+	},
+	{
+		/* Qualcomm APQ8084 -> Qualcomm Adreno 420 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8084,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 420,
+	},
+	{
+		/* Qualcomm APQ8094 -> Qualcomm Adreno 430 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.chipset_model = 8094,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 430,
+	},
+	{
+		/* Qualcomm Snapdragon 450 -> Qualcomm Adreno 506 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
+		.chipset_model = 450,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 506,
+	},
+	{
+		/* Qualcomm Snapdragon 630 -> Qualcomm Adreno 508 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
+		.chipset_model = 630,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 508,
+	},
+	{
+		/* Qualcomm Snapdragon 660 -> Qualcomm Adreno 512 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
+		.chipset_model = 660,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 512,
+	},
+	{
+		/* Qualcomm Snapdragon 670 -> Qualcomm Adreno 615 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
+		.chipset_model = 670,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 615,
+	},
+	{
+		/* Qualcomm Snapdragon 845 -> Qualcomm Adreno 630 */
+		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
+		.chipset_model = 845,
+		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
+		.gpu_model = 630,
 	},
 	{
 		/* MediaTek MT5507 -> ARM Mali-450 */
@@ -715,525 +850,554 @@ static const struct cpuinfo_chipset_gpu_entry chipset_gpu_map[] = {
 		.gpu_model = 860,
 	},
 	{
-		/* NovaThor U8500 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_novathor_u,
-		.chipset_model = 8500,
+		/* Samsung Exynos 3110 -> PowerVR SGX 540 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 3110,
+		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
+		.gpu_model = 540,
+	},
+	{
+		/* Samsung Exynos 3470 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 3470,
 		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
 		.gpu_model = 400,
 	},
 	{
-		/* Nvidia Tegra AP20H -> Nvidia Tegra 2 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_ap,
-		.chipset_model = 20,
-		.chipset_suffix = 'H',
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 2,
+		/* Samsung Exynos 3475 -> ARM Mali-T720 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 3475,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 720,
 	},
 	{
-		/* Nvidia Tegra AP33 -> Nvidia Tegra 3 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_ap,
-		.chipset_model = 33,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 3,
+		/* Samsung Exynos 4210 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 4210,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Nvidia Tegra SL460N -> Nvidia Tegra 3 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_sl,
-		.chipset_model = 460,
-		.chipset_suffix = 'N',
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 3,
+		/* Samsung Exynos 4412 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 4412,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Nvidia Tegra T114 -> Nvidia Tegra 4 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 114,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 4,
+		/* Samsung Exynos 4415 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 4415,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Nvidia Tegra T124 -> Nvidia Tegra K1 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 124,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra_k,
-		.gpu_model = 1,
+		/* Samsung Exynos 5250 -> ARM Mali-T604 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5250,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 604,
 	},
 	{
-		/* Nvidia Tegra T132 -> Nvidia Tegra K1 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 132,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra_k,
-		.gpu_model = 1,
+		/* Samsung Exynos 5260 -> ARM Mali-T624 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5260,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 624,
 	},
 	{
-		/* Nvidia Tegra T20 -> Nvidia Tegra 2 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 20,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 2,
+		/* Samsung Exynos 5410 -> PowerVR SGX 544 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5410,
+		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
+		.gpu_model = 544,
 	},
 	{
-		/* Nvidia Tegra T210 -> Nvidia Tegra X1 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 210,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra_x,
-		.gpu_model = 1,
+		/* Samsung Exynos 5420 -> ARM Mali-T628 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5420,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 628,
 	},
 	{
-		/* Nvidia Tegra T30* -> Nvidia Tegra 3 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 30,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 3,
+		/* Samsung Exynos 5422 -> ARM Mali-T628 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5422,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 628,
 	},
 	{
-		/* Nvidia Tegra T33 -> Nvidia Tegra 3 */
-		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
-		.chipset_model = 33,
-		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
-		.gpu_model = 3,
+		/* Samsung Exynos 5430 -> ARM Mali-T628 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5430,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 628,
 	},
 	{
-		/* Pinecone Surge S1 -> ARM Mali-T860 */
-		.chipset_series = cpuinfo_arm_chipset_series_pinecone_surge_s,
-		.chipset_model = 1,
+		/* Samsung Exynos 5433 -> ARM Mali-T760 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 5433,
 		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 860,
+		.gpu_model = 760,
 	},
 	{
-		/* Qualcomm APQ8009 -> Qualcomm Adreno 304 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8009,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 304,
+		/* Samsung Exynos 7420 -> ARM Mali-T760 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7420,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 760,
 	},
 	{
-		/* Qualcomm APQ8016 -> Qualcomm Adreno 306 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8016,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 306,
+		/* Samsung Exynos 7570 -> ARM Mali-T720 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7570,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 720,
 	},
 	{
-		/* Qualcomm APQ8017 -> Qualcomm Adreno 308 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8017,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 308,
+		/* Samsung Exynos 7578 -> ARM Mali-T720 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7578,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 720,
 	},
 	{
-		/* Qualcomm APQ8026 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8026,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Samsung Exynos 7580 -> ARM Mali-T720 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7580,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 720,
+	},
+	{
+		/* Samsung Exynos 7870 -> ARM Mali-T830 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7870,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 830,
+	},
+	{
+		/* Samsung Exynos 7880 -> ARM Mali-T830 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7880,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 830,
+	},
+	{
+		/* Samsung Exynos 7885 -> ARM Mali-G71 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 7885,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
+		.gpu_model = 71,
 	},
 	{
-		/* Qualcomm APQ8028 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8028,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Samsung Exynos 8890 -> ARM Mali-T880 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 8890,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 880,
 	},
 	{
-		/* Qualcomm APQ8039 -> Qualcomm Adreno 405 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8039,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 405,
+		/* Samsung Exynos 8895 -> ARM Mali-G71 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 8895,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
+		.gpu_model = 71,
 	},
 	{
-		/* Qualcomm APQ8053 -> Qualcomm Adreno 506 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8053,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 506,
+		/* Samsung Exynos 9810 -> ARM Mali-G72 */
+		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.chipset_model = 9810,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
+		.gpu_model = 72,
 	},
 	{
-		/* Qualcomm APQ8064* -> Qualcomm Adreno 320 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8064,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 320,
+		/* HiSilicon K3V2 -> Vivante GC4000 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_k3v,
+		.chipset_model = 2,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 4000,
 	},
 	{
-		/* Qualcomm APQ8074* -> Qualcomm Adreno 330 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8074,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 330,
+		/* HiSilicon Hi3751 -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_hi,
+		.chipset_model = 3751,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm APQ8076 -> Qualcomm Adreno 510 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8076,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 510,
+		/* HiSilicon Kirin 620 -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 620,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm APQ8084 -> Qualcomm Adreno 420 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8084,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 420,
+		/* HiSilicon Kirin 650 -> ARM Mali-T830 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 650,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 830,
 	},
 	{
-		/* Qualcomm APQ8094 -> Qualcomm Adreno 430 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_apq,
-		.chipset_model = 8094,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 430,
+		/* HiSilicon Kirin 659 -> ARM Mali-T830 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 659,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 830,
 	},
 	{
-		/* Qualcomm MSM7225AB -> Qualcomm Adreno 200 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 7225,
-		.chipset_suffix = 'A',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 200,
+		/* HiSilicon Kirin 910T -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 910,
+		.chipset_suffix = 'T',
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm MSM7625A -> Qualcomm Adreno 200 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 7625,
-		.chipset_suffix = 'A',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 200,
+		/* HiSilicon Kirin 920 -> ARM Mali-T624 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 920,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 624,
 	},
 	{
-		/* Qualcomm MSM7630 -> Qualcomm Adreno 205 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 7630,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 205,
+		/* HiSilicon Kirin 925 -> ARM Mali-T624 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 925,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 624,
 	},
 	{
-		/* Qualcomm MSM8208 -> Qualcomm Adreno 304 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8208,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 304,
+		/* HiSilicon Kirin 930 -> ARM Mali-T624 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 930,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 624,
 	},
 	{
-		/* Qualcomm MSM8209 -> Qualcomm Adreno 304 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8209,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 304,
+		/* HiSilicon Kirin 935 -> ARM Mali-T624 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 935,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 624,
 	},
 	{
-		/* Qualcomm MSM8210 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8210,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* HiSilicon Kirin 950 -> ARM Mali-T880 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 950,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 880,
 	},
 	{
-		/* Qualcomm MSM8212 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8212,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* HiSilicon Kirin 955 -> ARM Mali-T880 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 955,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 880,
 	},
 	{
-		/* Qualcomm MSM8225 -> Qualcomm Adreno 203 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8225,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 203,
+		/* HiSilicon Kirin 960 -> ARM Mali-G71 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 960,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
+		.gpu_model = 71,
 	},
 	{
-		/* Qualcomm MSM8226 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8226,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* HiSilicon Kirin 970 -> ARM Mali-G72 */
+		.chipset_series = cpuinfo_arm_chipset_series_hisilicon_kirin,
+		.chipset_model = 970,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
+		.gpu_model = 72,
 	},
 	{
-		/* Qualcomm MSM8228 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8228,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Actions ATM7029 -> Vivante GC1000 */
+		.chipset_series = cpuinfo_arm_chipset_series_actions_atm,
+		.chipset_model = 7029,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 1000,
 	},
 	{
-		/* Qualcomm MSM8230* -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8230,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Actions ATM7029B -> PowerVR SGX 540 */
+		.chipset_series = cpuinfo_arm_chipset_series_actions_atm,
+		.chipset_model = 7029,
+		.chipset_suffix = 'B',
+		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
+		.gpu_model = 540,
 	},
 	{
-		/* Qualcomm MSM8239 -> Qualcomm Adreno 405 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8239,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 405,
+		/* Allwinner A10 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 10,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8260A -> Qualcomm Adreno 225 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8260,
-		.chipset_suffix = 'A',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 225,
+		/* Allwinner A13 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 13,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8274 -> Qualcomm Adreno 330 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8274,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 330,
+		/* Allwinner A20 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 20,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8609 -> Qualcomm Adreno 304 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8609,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 304,
+		/* Allwinner A23 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 23,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8610 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8610,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Allwinner A31 -> PowerVR SGX 544 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 31,
+		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
+		.gpu_model = 544,
 	},
 	{
-		/* Qualcomm MSM8612 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8612,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Allwinner A33 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 33,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8625* -> Qualcomm Adreno 203 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8625,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 203,
+		/* Allwinner A80 -> PowerVR Rogue G6230 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 80,
+		.gpu_series = cpuinfo_android_gpu_series_powervr_rogue_g,
+		.gpu_model = 6230,
 	},
 	{
-		/* Qualcomm MSM8626 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8626,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Allwinner A83T -> PowerVR SGX 544 */
+		.chipset_series = cpuinfo_arm_chipset_series_allwinner_a,
+		.chipset_model = 83,
+		.chipset_suffix = 'T',
+		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
+		.gpu_model = 544,
 	},
 	{
-		/* Qualcomm MSM8627 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8627,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Amlogic AML8726* -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_amlogic_aml,
+		.chipset_model = 8726,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8628 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8628,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Amlogic S805 -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
+		.chipset_model = 805,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm MSM8660 -> Qualcomm Adreno 220 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8660,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 220,
+		/* Amlogic S812 -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
+		.chipset_model = 812,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm MSM8674PRO -> Qualcomm Adreno 330 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8674,
-		.chipset_suffix = 'P',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 330,
+		/* Amlogic S905* -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
+		.chipset_model = 905,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm MSM8909 -> Qualcomm Adreno 304 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8909,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 304,
+		/* Amlogic S912 -> ARM Mali-T820 */
+		.chipset_series = cpuinfo_arm_chipset_series_amlogic_s,
+		.chipset_model = 912,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 820,
 	},
 	{
-		/* Qualcomm MSM8916 -> Qualcomm Adreno 306 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8916,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 306,
+		/* Broadcom BCM21654* -> Broadcom VideoCore IV */
+		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
+		.chipset_model = 21654,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
+		.gpu_model = 4,
 	},
 	{
-		/* Qualcomm MSM8917 -> Qualcomm Adreno 308 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8917,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 308,
+		/* Broadcom BCM21663 -> Broadcom VideoCore IV */
+		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
+		.chipset_model = 21663,
+		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
+		.gpu_model = 4,
 	},
 	{
-		/* Qualcomm MSM8920 -> Qualcomm Adreno 308 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8920,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 308,
+		/* Broadcom BCM21664* -> Broadcom VideoCore IV */
+		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
+		.chipset_model = 21664,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
+		.gpu_model = 4,
 	},
 	{
-		/* Qualcomm MSM8926 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8926,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Broadcom BCM23550 -> Broadcom VideoCore IV */
+		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
+		.chipset_model = 23550,
+		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
+		.gpu_model = 4,
 	},
 	{
-		/* Qualcomm MSM8928 -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8928,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Broadcom BCM28155 -> Broadcom VideoCore IV */
+		.chipset_series = cpuinfo_arm_chipset_series_broadcom_bcm,
+		.chipset_model = 28155,
+		.gpu_series = cpuinfo_android_gpu_series_broadcom_videocore,
+		.gpu_model = 4,
 	},
 	{
-		/* Qualcomm MSM8929 -> Qualcomm Adreno 405 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8929,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 405,
+		/* LG Nuclun 7111 -> PowerVR Rogue G6430 */
+		.chipset_series = cpuinfo_arm_chipset_series_lg_nuclun,
+		.chipset_model = 7111,
+		.gpu_series = cpuinfo_android_gpu_series_powervr_rogue_g,
+		.gpu_model = 6430,
 	},
 	{
-		/* Qualcomm MSM8930* -> Qualcomm Adreno 305 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8930,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 305,
+		/* Leadcore LC1860 -> ARM Mali-T622 */
+		.chipset_series = cpuinfo_arm_chipset_series_leadcore_lc,
+		.chipset_model = 1860,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 622,
 	},
 	{
-		/* Qualcomm MSM8937 -> Qualcomm Adreno 505 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8937,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 505,
+		/* Marvell PXA986 -> Vivante GC1000 */
+		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
+		.chipset_model = 986,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 1000,
 	},
 	{
-		/* Qualcomm MSM8939 -> Qualcomm Adreno 405 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8939,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 405,
+		/* Marvell PXA988 -> Vivante GC1000 */
+		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
+		.chipset_model = 988,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 1000,
 	},
 	{
-		/* Qualcomm MSM8940 -> Qualcomm Adreno 505 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8940,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 505,
+		/* Marvell PXA1088 -> Vivante GC1000 */
+		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
+		.chipset_model = 1088,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 1000,
 	},
 	{
-		/* Qualcomm MSM8952 -> Qualcomm Adreno 405 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8952,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 405,
+		/* Marvell PXA1908 -> Vivante GC7000UL */
+		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
+		.chipset_model = 1908,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 7000,
+		.gpu_suffix = 'U',
 	},
 	{
-		/* Qualcomm MSM8953* -> Qualcomm Adreno 506 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8953,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 506,
+		/* Marvell PXA1928 -> Vivante GC5000 */
+		.chipset_series = cpuinfo_arm_chipset_series_marvell_pxa,
+		.chipset_model = 1928,
+		.gpu_series = cpuinfo_android_gpu_series_vivante_gc,
+		.gpu_model = 5000,
 	},
 	{
-		/* Qualcomm MSM8956 -> Qualcomm Adreno 510 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8956,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 510,
+		/* MStar 6A338 -> ARM Mali-450 */
+		.chipset_series = cpuinfo_arm_chipset_series_mstar_6a,
+		.chipset_model = 338,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 450,
 	},
 	{
-		/* Qualcomm MSM8974* -> Qualcomm Adreno 330 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8974,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 330,
+		/* NovaThor U8500 -> ARM Mali-400 */
+		.chipset_series = cpuinfo_arm_chipset_series_novathor_u,
+		.chipset_model = 8500,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
+		.gpu_model = 400,
 	},
 	{
-		/* Qualcomm MSM8976* -> Qualcomm Adreno 510 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8976,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 510,
+		/* Nvidia Tegra T20 -> Nvidia Tegra 2 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 20,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 2,
 	},
 	{
-		/* Qualcomm MSM8992 -> Qualcomm Adreno 418 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8992,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 418,
+		/* Nvidia Tegra T30* -> Nvidia Tegra 3 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 30,
+		.chipset_suffix = '*',
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 3,
 	},
 	{
-		/* Qualcomm MSM8994* -> Qualcomm Adreno 430 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8994,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 430,
+		/* Nvidia Tegra T33 -> Nvidia Tegra 3 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 33,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 3,
 	},
 	{
-		/* Qualcomm MSM8996* -> Qualcomm Adreno 530 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8996,
-		.chipset_suffix = '*',
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 530,
+		/* Nvidia Tegra T114 -> Nvidia Tegra 4 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 114,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 4,
 	},
 	{
-		/* Qualcomm MSM8998 -> Qualcomm Adreno 540 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_msm,
-		.chipset_model = 8998,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 540,
+		/* Nvidia Tegra T124 -> Nvidia Tegra K1 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 124,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra_k,
+		.gpu_model = 1,
 	},
 	{
-		/* Qualcomm Snapdragon 450 -> Qualcomm Adreno 506 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
-		.chipset_model = 450,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 506,
+		/* Nvidia Tegra T132 -> Nvidia Tegra K1 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 132,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra_k,
+		.gpu_model = 1,
 	},
 	{
-		/* Qualcomm Snapdragon 630 -> Qualcomm Adreno 508 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
-		.chipset_model = 630,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 508,
+		/* Nvidia Tegra T210 -> Nvidia Tegra X1 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_t,
+		.chipset_model = 210,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra_x,
+		.gpu_model = 1,
 	},
 	{
-		/* Qualcomm Snapdragon 660 -> Qualcomm Adreno 512 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
-		.chipset_model = 660,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 512,
+		/* Nvidia Tegra AP20H -> Nvidia Tegra 2 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_ap,
+		.chipset_model = 20,
+		.chipset_suffix = 'H',
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 2,
 	},
 	{
-		/* Qualcomm Snapdragon 670 -> Qualcomm Adreno 615 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
-		.chipset_model = 670,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 615,
+		/* Nvidia Tegra AP33 -> Nvidia Tegra 3 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_ap,
+		.chipset_model = 33,
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 3,
 	},
 	{
-		/* Qualcomm Snapdragon 845 -> Qualcomm Adreno 630 */
-		.chipset_series = cpuinfo_arm_chipset_series_qualcomm_snapdragon,
-		.chipset_model = 845,
-		.gpu_series = cpuinfo_android_gpu_series_qualcomm_adreno,
-		.gpu_model = 630,
+		/* Nvidia Tegra SL460N -> Nvidia Tegra 3 */
+		.chipset_series = cpuinfo_arm_chipset_series_nvidia_tegra_sl,
+		.chipset_model = 460,
+		.chipset_suffix = 'N',
+		.gpu_series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.gpu_model = 3,
+	},
+	{
+		/* Pinecone Surge S1 -> ARM Mali-T860 */
+		.chipset_series = cpuinfo_arm_chipset_series_pinecone_surge_s,
+		.chipset_model = 1,
+		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
+		.gpu_model = 860,
 	},
 	{
 		/* Renesas MP5232 -> PowerVR SGX 544 */
@@ -1320,167 +1484,6 @@ static const struct cpuinfo_chipset_gpu_entry chipset_gpu_map[] = {
 		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
 		.gpu_model = 860,
 	},
-	{
-		/* Samsung Exynos 3110 -> PowerVR SGX 540 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 3110,
-		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
-		.gpu_model = 540,
-	},
-	{
-		/* Samsung Exynos 3470 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 3470,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
-	},
-	{
-		/* Samsung Exynos 3475 -> ARM Mali-T720 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 3475,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 720,
-	},
-	{
-		/* Samsung Exynos 4210 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 4210,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
-	},
-	{
-		/* Samsung Exynos 4412 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 4412,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
-	},
-	{
-		/* Samsung Exynos 4415 -> ARM Mali-400 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 4415,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali,
-		.gpu_model = 400,
-	},
-	{
-		/* Samsung Exynos 5250 -> ARM Mali-T604 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5250,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 604,
-	},
-	{
-		/* Samsung Exynos 5260 -> ARM Mali-T624 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5260,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 624,
-	},
-	{
-		/* Samsung Exynos 5410 -> PowerVR SGX 544 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5410,
-		.gpu_series = cpuinfo_android_gpu_series_powervr_sgx,
-		.gpu_model = 544,
-	},
-	{
-		/* Samsung Exynos 5420 -> ARM Mali-T628 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5420,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 628,
-	},
-	{
-		/* Samsung Exynos 5422 -> ARM Mali-T628 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5422,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 628,
-	},
-	{
-		/* Samsung Exynos 5430 -> ARM Mali-T628 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5430,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 628,
-	},
-	{
-		/* Samsung Exynos 5433 -> ARM Mali-T760 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 5433,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 760,
-	},
-	{
-		/* Samsung Exynos 7420 -> ARM Mali-T760 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7420,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 760,
-	},
-	{
-		/* Samsung Exynos 7570 -> ARM Mali-T720 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7570,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 720,
-	},
-	{
-		/* Samsung Exynos 7578 -> ARM Mali-T720 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7578,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 720,
-	},
-	{
-		/* Samsung Exynos 7580 -> ARM Mali-T720 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7580,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 720,
-	},
-	{
-		/* Samsung Exynos 7870 -> ARM Mali-T830 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7870,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 830,
-	},
-	{
-		/* Samsung Exynos 7880 -> ARM Mali-T830 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7880,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 830,
-	},
-	{
-		/* Samsung Exynos 7885 -> ARM Mali-G71 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 7885,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
-		.gpu_model = 71,
-	},
-	{
-		/* Samsung Exynos 8890 -> ARM Mali-T880 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 8890,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_t,
-		.gpu_model = 880,
-	},
-	{
-		/* Samsung Exynos 8895 -> ARM Mali-G71 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 8895,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
-		.gpu_model = 71,
-	},
-	{
-		/* Samsung Exynos 9810 -> ARM Mali-G72 */
-		.chipset_series = cpuinfo_arm_chipset_series_samsung_exynos,
-		.chipset_model = 9810,
-		.gpu_series = cpuinfo_android_gpu_series_arm_mali_g,
-		.gpu_model = 72,
-	},
 	{
 		/* Spreadtrum SC5735 -> ARM Mali-400 */
 		.chipset_series = cpuinfo_arm_chipset_series_spreadtrum_sc,
@@ -1657,6 +1660,18 @@ static enum cpuinfo_android_gpu_vendor gpu_series_vendor[cpuinfo_android_gpu_ser
 	[cpuinfo_android_gpu_series_vivante_gc]              = cpuinfo_android_gpu_vendor_vivante,
 };
 
+static struct cpuinfo_android_gpu entry_gpu(const struct cpuinfo_chipset_gpu_entry entry[restrict static 1]) {
+	return (struct cpuinfo_android_gpu) {
+		.vendor = gpu_series_vendor[entry->gpu_series],
+		.series = (enum cpuinfo_android_gpu_series) entry->gpu_series,
+		.model = entry->gpu_model,
+		.suffix = {
+			[0] = entry->gpu_suffix,
+			[1] = entry->gpu_suffix == 'U' ? 'L' : '\0',
+		},
+	};
+}
+
 bool cpuinfo_arm_android_lookup_gpu(
 	const struct cpuinfo_arm_chipset chipset[restrict static 1],
 	struct cpuinfo_android_gpu gpu[restrict static 1])
@@ -1665,22 +1680,50 @@ bool cpuinfo_arm_android_lookup_gpu(
 		return false;
 	}
 
-	for (uint32_t i = 0; i < CPUINFO_COUNT_OF(chipset_gpu_map); i++) {
-		if (chipset_gpu_map[i].chipset_series == chipset->series &&
-			chipset_gpu_map[i].chipset_model == chipset->model &&
-			(chipset_gpu_map[i].chipset_suffix == '*' || chipset_gpu_map[i].chipset_suffix == chipset->suffix[0]))
-		{
-			*gpu = (struct cpuinfo_android_gpu) {
-				.vendor = gpu_series_vendor[chipset_gpu_map[i].gpu_series],
-				.series = (enum cpuinfo_android_gpu_series) chipset_gpu_map[i].gpu_series,
-				.model = chipset_gpu_map[i].gpu_model,
-				.suffix = {
-					[0] = chipset_gpu_map[i].gpu_suffix,
-					[1] = chipset_gpu_map[i].gpu_suffix == 'U' ? 'L' : '\0',
-				},
-			};
+	/* Binary search for the first entry with the same chipset series and model */
+	const uint32_t series = (uint32_t) chipset->series;
+	const uint32_t model = chipset->model;
+	size_t first = 0, last = CPUINFO_COUNT_OF(chipset_gpu_map);
+	while (first != last) {
+		const size_t middle = first + (last - first) / 2;
+		const struct cpuinfo_chipset_gpu_entry* entry = &chipset_gpu_map[middle];
+		if (entry->chipset_series < series || (entry->chipset_series == series && entry->chipset_model < model)) {
+			first = middle + 1;
+		} else {
+			last = middle;
+		}
+	}
+
+	for (size_t i = first; i < CPUINFO_COUNT_OF(chipset_gpu_map); i++) {
+		const struct cpuinfo_chipset_gpu_entry* entry = &chipset_gpu_map[i];
+		if (entry->chipset_series != series || entry->chipset_model != model) {
+			break;
+		}
+		if (entry->chipset_suffix == '*' || entry->chipset_suffix == chipset->suffix[0]) {
+			*gpu = entry_gpu(entry);
 			return true;
 		}
 	}
 	return false;
 }
+
+bool cpuinfo_arm_android_get_chipset_gpu_entry(
+	size_t index,
+	struct cpuinfo_arm_chipset chipset[restrict static 1],
+	struct cpuinfo_android_gpu gpu[restrict static 1])
+{
+	if (index >= CPUINFO_COUNT_OF(chipset_gpu_map)) {
+		return false;
+	}
+
+	const struct cpuinfo_chipset_gpu_entry* entry = &chipset_gpu_map[index];
+	*chipset = (struct cpuinfo_arm_chipset) {
+		.series = (enum cpuinfo_arm_chipset_series) entry->chipset_series,
+		.model = entry->chipset_model,
+		.suffix = {
+			[0] = entry->chipset_suffix,
+		},
+	};
+	*gpu = entry_gpu(entry);
+	return true;
+}
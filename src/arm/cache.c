@@ -987,6 +987,82 @@ void cpuinfo_arm_decode_cache(
 				.line_size = 64 /* assumption */
 			};
 			break;
+		case cpuinfo_uarch_thunderx2:
+			/*
+			 * "32 KB L1 instruction cache, 32 KB L1 data cache, 256 KB L2 cache per core, 1 MB L3 cache per core,
+			 *  shared by all cores on the die" [1]
+			 *
+			 * L2 is private to the core, and the distributed L3 is not described here:
+			 * when sysfs reports the cache hierarchy, it takes precedence over these values.
+			 *
+			 * [1] https://en.wikichip.org/wiki/cavium/microarchitectures/vulcan
+			 */
+			*l1i = (struct cpuinfo_cache) {
+				.size = 32 * 1024,
+				.associativity = 8,
+				.line_size = 64
+			};
+			*l1d = (struct cpuinfo_cache) {
+				.size = 32 * 1024,
+				.associativity = 8,
+				.line_size = 64
+			};
+			*l2 = (struct cpuinfo_cache) {
+				.size = 256 * 1024,
+				.associativity = 8,
+				.line_size = 64
+			};
+			break;
+		case cpuinfo_uarch_neoverse_n1:
+			/*
+			 * ARM Neoverse N1 Core Technical Reference Manual
+			 * - L1 instruction cache: 64 KB, 4-way set associative, 64-byte lines.
+			 * - L1 data cache: 64 KB, 4-way set associative, 64-byte lines.
+			 * - L2 cache: private, 256 KB, 512 KB, or 1 MB, 8-way set associative, 64-byte lines.
+			 *
+			 * L2 size is implementation-defined: assume the 1 MB configuration of Ampere Altra and AWS Graviton2.
+			 */
+			*l1i = (struct cpuinfo_cache) {
+				.size = 64 * 1024,
+				.associativity = 4,
+				.line_size = 64
+			};
+			*l1d = (struct cpuinfo_cache) {
+				.size = 64 * 1024,
+				.associativity = 4,
+				.line_size = 64
+			};
+			*l2 = (struct cpuinfo_cache) {
+				.size = 1024 * 1024,
+				.associativity = 8,
+				.line_size = 64
+			};
+			break;
+		case cpuinfo_uarch_neoverse_v1:
+			/*
+			 * ARM Neoverse V1 Core Technical Reference Manual
+			 * - L1 instruction cache: 64 KB, 4-way set associative, 64-byte lines.
+			 * - L1 data cache: 64 KB, 4-way set associative, 64-byte lines.
+			 * - L2 cache: private, 512 KB or 1 MB, 8-way set associative, 64-byte lines.
+			 *
+			 * L2 size is implementation-defined: assume the 1 MB configuration of AWS Graviton3.
+			 */
+			*l1i = (struct cpuinfo_cache) {
+				.size = 64 * 1024,
+				.associativity = 4,
+				.line_size = 64
+			};
+			*l1d = (struct cpuinfo_cache) {
+				.size = 64 * 1024,
+				.associativity = 4,
+				.line_size = 64
+			};
+			*l2 = (struct cpuinfo_cache) {
+				.size = 1024 * 1024,
+				.associativity = 8,
+				.line_size = 64
+			};
+			break;
 		case cpuinfo_uarch_cortex_a12:
 		case cpuinfo_uarch_cortex_a32:
 		default:
@@ -5,7 +5,8 @@
 
 
 void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
-	uint32_t features,
+	uint64_t features,
+	uint64_t features2,
 	struct cpuinfo_arm_isa isa[restrict static 1])
 {
 	if (features & CPUINFO_ARM_LINUX_FEATURE_AES) {
@@ -49,4 +50,29 @@ void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
 	if (features & CPUINFO_ARM_LINUX_FEATURE_FCMA) {
 		isa->fcma = true;
 	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_ASIMDDP) {
+		isa->dot = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_ASIMDFHM) {
+		isa->fhm = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_SVE) {
+		isa->sve = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVE2) {
+		isa->sve2 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_I8MM) {
+		isa->i8mm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_BF16) {
+		isa->bf16 = true;
+	}
+	/* SVE variants of BF16 and Int8 matrix multiplication instructions also require SVE */
+	if ((features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEBF16) && isa->sve) {
+		isa->svebf16 = true;
+	}
+	if ((features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM) && isa->sve) {
+		isa->svei8mm = true;
+	}
 }
@@ -94,6 +94,41 @@ struct cpuinfo_arm_linux_proc_cpuinfo_cache {
 	#define CPUINFO_ARM_LINUX_FEATURE_JSCVT    UINT32_C(0x00002000)
 	#define CPUINFO_ARM_LINUX_FEATURE_FCMA     UINT32_C(0x00004000)
 	#define CPUINFO_ARM_LINUX_FEATURE_LRCPC    UINT32_C(0x00008000)
+	#define CPUINFO_ARM_LINUX_FEATURE_DCPOP    UINT32_C(0x00010000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SHA3     UINT32_C(0x00020000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SM3      UINT32_C(0x00040000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SM4      UINT32_C(0x00080000)
+	#define CPUINFO_ARM_LINUX_FEATURE_ASIMDDP  UINT32_C(0x00100000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SHA512   UINT32_C(0x00200000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SVE      UINT32_C(0x00400000)
+	#define CPUINFO_ARM_LINUX_FEATURE_ASIMDFHM UINT32_C(0x00800000)
+	#define CPUINFO_ARM_LINUX_FEATURE_DIT      UINT32_C(0x01000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_USCAT    UINT32_C(0x02000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_ILRCPC   UINT32_C(0x04000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_FLAGM    UINT32_C(0x08000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SSBS     UINT32_C(0x10000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_SB       UINT32_C(0x20000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_PACA     UINT32_C(0x40000000)
+	#define CPUINFO_ARM_LINUX_FEATURE_PACG     UINT32_C(0x80000000)
+
+	#define CPUINFO_ARM_LINUX_FEATURE2_DCPODP     UINT32_C(0x00000001)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVE2       UINT32_C(0x00000002)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEAES     UINT32_C(0x00000004)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEPMULL   UINT32_C(0x00000008)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEBITPERM UINT32_C(0x00000010)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVESHA3    UINT32_C(0x00000020)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVESM4     UINT32_C(0x00000040)
+	#define CPUINFO_ARM_LINUX_FEATURE2_FLAGM2     UINT32_C(0x00000080)
+	#define CPUINFO_ARM_LINUX_FEATURE2_FRINT      UINT32_C(0x00000100)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM    UINT32_C(0x00000200)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEF32MM   UINT32_C(0x00000400)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEF64MM   UINT32_C(0x00000800)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEBF16    UINT32_C(0x00001000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_I8MM       UINT32_C(0x00002000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_BF16       UINT32_C(0x00004000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_DGH        UINT32_C(0x00008000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_RNG        UINT32_C(0x00010000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_BTI        UINT32_C(0x00020000)
 #endif
 
 #define CPUINFO_ARM_LINUX_VALID_ARCHITECTURE UINT32_C(0x00010000)
@@ -129,9 +164,7 @@ struct cpuinfo_arm_linux_processor {
 	struct cpuinfo_arm_linux_proc_cpuinfo_cache proc_cpuinfo_cache;
 #endif
 	uint32_t features;
-#if CPUINFO_ARCH_ARM
 	uint32_t features2;
-#endif
 	/**
 	 * Main ID Register value.
 	 */
@@ -153,6 +186,17 @@ struct cpuinfo_arm_linux_processor {
 	 * Number of logical processors in the package.
 	 */
 	uint32_t package_processor_count;
+	/**
+	 * ID of the core cluster which includes this logical processor.
+	 * The value is parsed from /sys/devices/system/cpu/cpu<N>/topology/cluster_id (Linux 5.16+)
+	 */
+	uint32_t cluster_id;
+	/**
+	 * Minimum processor ID among hardware threads of the core which includes this logical processor.
+	 * This value can serve as an ID for the core: it is the same for all logical processors on the same core.
+	 * The value is inferred from /sys/devices/system/cpu/cpu<N>/topology/thread_siblings_list
+	 */
+	uint32_t core_leader_id;
 	/**
 	 * Maximum frequency, in kHZ.
 	 * The value is parsed from /sys/devices/system/cpu/cpu<N>/cpufreq/cpuinfo_max_freq
@@ -165,6 +209,12 @@ struct cpuinfo_arm_linux_processor {
 	 * If failed to read or parse the file, the value is 0.
 	 */
 	uint32_t min_frequency;
+	/**
+	 * Performance of the core relative to the highest-performance core in the system, which has capacity 1024.
+	 * The value is parsed from /sys/devices/system/cpu/cpu<N>/cpu_capacity
+	 * If failed to read or parse the file, the value is 0.
+	 */
+	uint32_t capacity;
 	/** Linux processor ID */
 	uint32_t system_processor_id;
 	uint32_t flags;
@@ -262,9 +312,12 @@ bool cpuinfo_arm_linux_parse_proc_cpuinfo(
 		uint32_t architecture_flags,
 		struct cpuinfo_arm_isa isa[restrict static 1]);
 #elif CPUINFO_ARCH_ARM64
-	uint32_t cpuinfo_arm_linux_hwcap_from_getauxval(void);
+	void cpuinfo_arm_linux_hwcap_from_getauxval(
+		uint64_t hwcap[restrict static 1],
+		uint64_t hwcap2[restrict static 1]);
 	void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
-		uint32_t features,
+		uint64_t features,
+		uint64_t features2,
 		struct cpuinfo_arm_isa isa[restrict static 1]);
 #endif
 
@@ -299,6 +352,10 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 		const char ro_chipname[restrict static CPUINFO_BUILD_PROP_VALUE_MAX]);
 #endif
 
+bool cpuinfo_arm_linux_detect_core_clusters_by_capacity(
+	uint32_t max_processors,
+	struct cpuinfo_arm_linux_processor processors[restrict static max_processors]);
+
 bool cpuinfo_arm_linux_detect_core_clusters_by_heuristic(
 	uint32_t usable_processors,
 	uint32_t max_processors,
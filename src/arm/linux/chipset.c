@@ -1350,6 +1350,7 @@ struct huawei_map_entry {
 	uint32_t model;
 };
 
+/* Platforms which start with a new letter must also be added to chipset_signature_prefix_map */
 static const struct huawei_map_entry huawei_platform_map[] = {
 	{
 		/* "ALP" -> Kirin 970 */
@@ -1594,6 +1595,204 @@ static bool is_tegra(const char* start, const char* end) {
 	return (length == 5 || start[5] == '3');
 }
 
+/* Vendor-specific chipset signatures recognized by the match_* functions */
+enum chipset_signature {
+	chipset_signature_msm_apq,
+	chipset_signature_sdm,
+	chipset_signature_samsung_exynos,
+	chipset_signature_exynos,
+	chipset_signature_universal,
+	chipset_signature_smdk,
+	chipset_signature_mt,
+	chipset_signature_kirin,
+	chipset_signature_rk,
+	chipset_signature_sc,
+	chipset_signature_lc,
+	chipset_signature_pxa,
+	chipset_signature_omap,
+	chipset_signature_broadcom,
+	chipset_signature_sunxi,
+	chipset_signature_wmt,
+	chipset_signature_huawei,
+	chipset_signature_tcc,
+	chipset_signature_max,
+};
+
+#define CHIPSET_SIGNATURE(name) (UINT32_C(1) << chipset_signature_##name)
+
+/* Descriptions of chipset signatures for log messages */
+static const char* chipset_signature_description[chipset_signature_max] = {
+	[chipset_signature_msm_apq]        = "Qualcomm MSM/APQ",
+	[chipset_signature_sdm]            = "Qualcomm SDM",
+	[chipset_signature_samsung_exynos] = "Samsung Exynos",
+	[chipset_signature_exynos]         = "exynosXXXX (Samsung Exynos)",
+	[chipset_signature_universal]      = "UNIVERSAL (Samsung Exynos)",
+	[chipset_signature_smdk]           = "SMDK (Samsung Exynos)",
+	[chipset_signature_mt]             = "MediaTek MT",
+	[chipset_signature_kirin]          = "HiSilicon Kirin",
+	[chipset_signature_rk]             = "Rockchip RK",
+	[chipset_signature_sc]             = "Spreadtrum SC",
+	[chipset_signature_lc]             = "Leadcore LC",
+	[chipset_signature_pxa]            = "Marvell PXA",
+	[chipset_signature_omap]           = "Texas Instruments OMAP",
+	[chipset_signature_broadcom]       = "Broadcom",
+	[chipset_signature_sunxi]          = "sunxi (Allwinner Ax)",
+	[chipset_signature_wmt]            = "WonderMedia WMT",
+	[chipset_signature_huawei]         = "Huawei",
+	[chipset_signature_tcc]            = "Telechips TCC",
+};
+
+/*
+ * Prefix map of chipset signatures: maps the first character of a platform identifier to the set of signatures which
+ * can start with this character. No two signatures share a prefix, so at most one signature matches any identifier,
+ * and decoders only try the signatures in the set of the first character rather than every signature in sequence.
+ * Case-insensitive signatures are listed under both the lowercase and the uppercase letter.
+ */
+static const uint32_t chipset_signature_prefix_map[128] = {
+	/* "APQ", "apq"; Huawei "ALP" */
+	['A'] = CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(huawei),
+	['a'] = CHIPSET_SIGNATURE(msm_apq),
+	/* Huawei "BAC", "BKL", "BLA" */
+	['B'] = CHIPSET_SIGNATURE(huawei),
+	/* Broadcom "capri" */
+	['c'] = CHIPSET_SIGNATURE(broadcom),
+	/* Huawei "DUK" */
+	['D'] = CHIPSET_SIGNATURE(huawei),
+	/* Huawei "EVA" */
+	['E'] = CHIPSET_SIGNATURE(huawei),
+	/* "exynos" */
+	['e'] = CHIPSET_SIGNATURE(exynos),
+	/* Huawei "FRD" */
+	['F'] = CHIPSET_SIGNATURE(huawei),
+	/* Broadcom "hawaii" */
+	['h'] = CHIPSET_SIGNATURE(broadcom),
+	/* Broadcom "java" */
+	['j'] = CHIPSET_SIGNATURE(broadcom),
+	/* "Kirin", "kirin"; Huawei "KNT" */
+	['K'] = CHIPSET_SIGNATURE(kirin) | CHIPSET_SIGNATURE(huawei),
+	['k'] = CHIPSET_SIGNATURE(kirin),
+	/* Huawei "LON" */
+	['L'] = CHIPSET_SIGNATURE(huawei),
+	/* "lc" */
+	['l'] = CHIPSET_SIGNATURE(lc),
+	/* "MSM", "msm", "MT", "mt"; Huawei "MHA" */
+	['M'] = CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(mt) | CHIPSET_SIGNATURE(huawei),
+	['m'] = CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(mt),
+	/* Huawei "NXT" */
+	['N'] = CHIPSET_SIGNATURE(huawei),
+	/* "OMAP" */
+	['O'] = CHIPSET_SIGNATURE(omap),
+	/* "PXA" */
+	['P'] = CHIPSET_SIGNATURE(pxa),
+	/* "RK", "rk"; Broadcom "rhea" */
+	['R'] = CHIPSET_SIGNATURE(rk),
+	['r'] = CHIPSET_SIGNATURE(rk) | CHIPSET_SIGNATURE(broadcom),
+	/* "SDM", "Samsung Exynos", "SMDK", "smdk", "SC", "sc", "sun"; Huawei "STF" */
+	['S'] = CHIPSET_SIGNATURE(sdm) | CHIPSET_SIGNATURE(samsung_exynos) | CHIPSET_SIGNATURE(smdk) |
+		CHIPSET_SIGNATURE(sc) | CHIPSET_SIGNATURE(huawei),
+	['s'] = CHIPSET_SIGNATURE(smdk) | CHIPSET_SIGNATURE(sc) | CHIPSET_SIGNATURE(sunxi),
+	/* "tcc" */
+	['t'] = CHIPSET_SIGNATURE(tcc),
+	/* "UNIVERSAL", "universal" */
+	['U'] = CHIPSET_SIGNATURE(universal),
+	['u'] = CHIPSET_SIGNATURE(universal),
+	/* Huawei "VIE", "VKY", "VTR" */
+	['V'] = CHIPSET_SIGNATURE(huawei),
+	/* "WMT" */
+	['W'] = CHIPSET_SIGNATURE(wmt),
+};
+
+/**
+ * Tries to match a platform identifier to chipset signatures.
+ * Only the signatures which can start with the first character of the identifier are tried.
+ *
+ * @param start - start of the platform identifier to match.
+ * @param end - end of the platform identifier to match.
+ * @param signatures - mask of chipset signatures (CHIPSET_SIGNATURE bits) to try.
+ * @param cores - number of cores in the chipset.
+ * @param max_cpu_freq_max - maximum of /sys/devices/system/cpu/cpu<number>/cpofreq/cpu_freq_max values.
+ * @param[out] chipset - location where chipset information will be stored upon a successful match.
+ *
+ * @returns the matched signature, or chipset_signature_max if no signature matched.
+ */
+static enum chipset_signature match_chipset_signatures(
+	const char* start, const char* end, uint32_t signatures,
+	uint32_t cores, uint32_t max_cpu_freq_max,
+	struct cpuinfo_arm_chipset chipset[restrict static 1])
+{
+	if (start == end) {
+		return chipset_signature_max;
+	}
+
+	const uint8_t first_char = (uint8_t) *start;
+	if (first_char >= CPUINFO_COUNT_OF(chipset_signature_prefix_map)) {
+		return chipset_signature_max;
+	}
+
+	const uint32_t candidates = chipset_signature_prefix_map[first_char] & signatures;
+	if (candidates == 0) {
+		return chipset_signature_max;
+	}
+
+	if ((candidates & CHIPSET_SIGNATURE(msm_apq)) && match_msm_apq(start, end, chipset)) {
+		return chipset_signature_msm_apq;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(sdm)) && match_sdm(start, end, chipset)) {
+		return chipset_signature_sdm;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(samsung_exynos)) && match_samsung_exynos(start, end, chipset)) {
+		return chipset_signature_samsung_exynos;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(exynos)) && match_exynos(start, end, chipset)) {
+		return chipset_signature_exynos;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(universal)) && match_universal(start, end, chipset)) {
+		return chipset_signature_universal;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(smdk)) && match_and_parse_smdk(start, end, cores, chipset)) {
+		return chipset_signature_smdk;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(mt)) && match_mt(start, end, true, chipset)) {
+		return chipset_signature_mt;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(kirin)) && match_kirin(start, end, chipset)) {
+		return chipset_signature_kirin;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(rk)) && match_rk(start, end, chipset)) {
+		return chipset_signature_rk;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(sc)) && match_sc(start, end, chipset)) {
+		return chipset_signature_sc;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(lc)) && match_lc(start, end, chipset)) {
+		return chipset_signature_lc;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(pxa)) && match_pxa(start, end, chipset)) {
+		return chipset_signature_pxa;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(omap)) && match_omap(start, end, chipset)) {
+		return chipset_signature_omap;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(broadcom)) &&
+		match_and_parse_broadcom(start, end, cores, max_cpu_freq_max, chipset))
+	{
+		return chipset_signature_broadcom;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(sunxi)) && match_and_parse_sunxi(start, end, cores, chipset)) {
+		return chipset_signature_sunxi;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(wmt)) && match_and_parse_wmt(start, end, cores, max_cpu_freq_max, chipset)) {
+		return chipset_signature_wmt;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(huawei)) && match_and_parse_huawei(start, end, chipset)) {
+		return chipset_signature_huawei;
+	}
+	if ((candidates & CHIPSET_SIGNATURE(tcc)) && match_tcc(start, end, chipset)) {
+		return chipset_signature_tcc;
+	}
+	return chipset_signature_max;
+}
+
 struct special_map_entry {
 	const char* platform;
 	uint16_t model;
@@ -1601,6 +1800,36 @@ struct special_map_entry {
 	char suffix;
 };
 
+/**
+ * Looks up a platform identifier in a table of chipsets for identifiers which can't be otherwise decoded.
+ * Entries are compared only if their first character matches the identifier, which rejects most entries without a
+ * string comparison.
+ *
+ * @param entries - table of chipsets to search.
+ * @param count - number of entries in the table.
+ * @param platform - platform identifier to look up.
+ * @param length - length of the platform identifier.
+ *
+ * @returns pointer to the matching table entry, or NULL if the identifier is not in the table.
+ */
+static const struct special_map_entry* find_special_map_entry(
+	const struct special_map_entry* entries, size_t count,
+	const char* platform, size_t length)
+{
+	if (length == 0) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (entries[i].platform[0] == platform[0] &&
+			strncmp(entries[i].platform, platform, length) == 0 && entries[i].platform[length] == 0)
+		{
+			return &entries[i];
+		}
+	}
+	return NULL;
+}
+
 static const struct special_map_entry special_hardware_map_entries[] = {
 	{
 		/* "k3v2oem1" -> HiSilicon K3V2 */
@@ -2046,6 +2275,17 @@ static const struct special_map_entry tegra_hardware_map_entries[] = {
 	},
 };
 
+/* Chipset signatures which may start at any word of the /proc/cpuinfo Hardware string */
+static const uint32_t hardware_word_signatures =
+	CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(sdm) | CHIPSET_SIGNATURE(mt) | CHIPSET_SIGNATURE(kirin) |
+	CHIPSET_SIGNATURE(rk);
+
+/* Chipset signatures which must span the whole /proc/cpuinfo Hardware string */
+static const uint32_t hardware_signatures =
+	CHIPSET_SIGNATURE(samsung_exynos) | CHIPSET_SIGNATURE(universal) | CHIPSET_SIGNATURE(smdk) |
+	CHIPSET_SIGNATURE(sc) | CHIPSET_SIGNATURE(pxa) | CHIPSET_SIGNATURE(sunxi) | CHIPSET_SIGNATURE(omap) |
+	CHIPSET_SIGNATURE(wmt) | CHIPSET_SIGNATURE(tcc);
+
 /*
  * Decodes chipset name from /proc/cpuinfo Hardware string.
  * For some chipsets, the function relies frequency and on number of cores for chipset detection.
@@ -2072,27 +2312,26 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 		 * This path is only used when ro.board.platform indicates a Tegra chipset
 		 * (albeit does not indicate which exactly Tegra chipset).
 		 */
-		for (size_t i = 0; i < CPUINFO_COUNT_OF(tegra_hardware_map_entries); i++) {
-			if (strncmp(tegra_hardware_map_entries[i].platform, hardware, hardware_length) == 0 &&
-					tegra_hardware_map_entries[i].platform[hardware_length] == 0)
-			{
-				cpuinfo_log_debug(
-					"found /proc/cpuinfo Hardware string \"%.*s\" in Nvidia Tegra chipset table",
-					(int) hardware_length, hardware);
-				/* Create chipset name from entry */
-				return (struct cpuinfo_arm_chipset) {
-					.vendor = chipset_series_vendor[tegra_hardware_map_entries[i].series],
-					.series = (enum cpuinfo_arm_chipset_series) tegra_hardware_map_entries[i].series,
-					.model = tegra_hardware_map_entries[i].model,
-					.suffix = {
-						[0] = tegra_hardware_map_entries[i].suffix,
-					},
-				};
-			}
+		const struct special_map_entry* entry = find_special_map_entry(
+			tegra_hardware_map_entries, CPUINFO_COUNT_OF(tegra_hardware_map_entries), hardware, hardware_length);
+		if (entry != NULL) {
+			cpuinfo_log_debug(
+				"found /proc/cpuinfo Hardware string \"%.*s\" in Nvidia Tegra chipset table",
+				(int) hardware_length, hardware);
+			/* Create chipset name from entry */
+			return (struct cpuinfo_arm_chipset) {
+				.vendor = chipset_series_vendor[entry->series],
+				.series = (enum cpuinfo_arm_chipset_series) entry->series,
+				.model = entry->model,
+				.suffix = {
+					[0] = entry->suffix,
+				},
+			};
 		}
 	} else {
 		/* Generic path: consider all other vendors */
 
+		/* Check signatures which may start at any word of the Hardware string */
 		bool word_start = true;
 		for (const char* pos = hardware; pos != hardware_end; pos++) {
 			const char c = *pos;
@@ -2103,44 +2342,13 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 					word_start = true;
 					break;
 				default:
-					if (word_start && is_ascii_alphabetic(c)) {
-						/* Check Qualcomm MSM/APQ signature */
-						if (match_msm_apq(pos, hardware_end, &chipset)) {
-							cpuinfo_log_debug(
-								"matched Qualcomm MSM/APQ signature in /proc/cpuinfo Hardware string \"%.*s\"",
-								(int) hardware_length, hardware);
-							return chipset;
-						}
-
-						/* Check SDMxxx (Qualcomm Snapdragon) signature */
-						if (match_sdm(pos, hardware_end, &chipset)) {
-							cpuinfo_log_debug(
-								"matched Qualcomm SDM signature in /proc/cpuinfo Hardware string \"%.*s\"",
-								(int) hardware_length, hardware);
-							return chipset;
-						}
-
-						/* Check MediaTek MT signature */
-						if (match_mt(pos, hardware_end, true, &chipset)) {
+					if (word_start) {
+						const enum chipset_signature signature = match_chipset_signatures(
+							pos, hardware_end, hardware_word_signatures, cores, max_cpu_freq_max, &chipset);
+						if (signature != chipset_signature_max) {
 							cpuinfo_log_debug(
-								"matched MediaTek MT signature in /proc/cpuinfo Hardware string \"%.*s\"",
-								(int) hardware_length, hardware);
-							return chipset;
-						}
-
-						/* Check HiSilicon Kirin signature */
-						if (match_kirin(pos, hardware_end, &chipset)) {
-							cpuinfo_log_debug(
-								"matched HiSilicon Kirin signature in /proc/cpuinfo Hardware string \"%.*s\"",
-								(int) hardware_length, hardware);
-							return chipset;
-						}
-
-						/* Check Rockchip RK signature */
-						if (match_rk(pos, hardware_end, &chipset)) {
-							cpuinfo_log_debug(
-								"matched Rockchip RK signature in /proc/cpuinfo Hardware string \"%.*s\"",
-								(int) hardware_length, hardware);
+								"matched %s signature in /proc/cpuinfo Hardware string \"%.*s\"",
+								chipset_signature_description[signature], (int) hardware_length, hardware);
 							return chipset;
 						}
 					}
@@ -2149,96 +2357,32 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 			}
 		}
 
-		/* Check Samsung Exynos signature */
-		if (match_samsung_exynos(hardware, hardware_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Samsung Exynos signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Check universalXXXX (Samsung Exynos) signature */
-		if (match_universal(hardware, hardware_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched UNIVERSAL (Samsung Exynos) signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Match /SMDK(4410|4x12)$/ */
-		if (match_and_parse_smdk(hardware, hardware_end, cores, &chipset)) {
-			cpuinfo_log_debug(
-				"matched SMDK (Samsung Exynos) signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Check Spreadtrum SC signature */
-		if (match_sc(hardware, hardware_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Spreadtrum SC signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Check Marvell PXA signature */
-		if (match_pxa(hardware, hardware_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Marvell PXA signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Match /sun\d+i/ signature and map to Allwinner chipset name */
-		if (match_and_parse_sunxi(hardware, hardware_end, cores, &chipset)) {
-			cpuinfo_log_debug(
-				"matched sunxi (Allwinner Ax) signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Check Texas Instruments OMAP signature */
-		if (match_omap(hardware, hardware_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Texas Instruments OMAP signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Check WonderMedia WMT signature and decode chipset from frequency and number of cores  */
-		if (match_and_parse_wmt(hardware, hardware_end, cores, max_cpu_freq_max, &chipset)) {
+		/* Check signatures which must span the whole Hardware string */
+		const enum chipset_signature signature = match_chipset_signatures(
+			hardware, hardware_end, hardware_signatures, cores, max_cpu_freq_max, &chipset);
+		if (signature != chipset_signature_max) {
 			cpuinfo_log_debug(
-				"matched WonderMedia WMT signature in /proc/cpuinfo Hardware string \"%.*s\"",
-				(int) hardware_length, hardware);
+				"matched %s signature in /proc/cpuinfo Hardware string \"%.*s\"",
+				chipset_signature_description[signature], (int) hardware_length, hardware);
 			return chipset;
 		}
 
-		/* Check Telechips TCC signature */
-		if (match_tcc(hardware, hardware_end, &chipset)) {
+		/* Compare to tabulated Hardware values for popular chipsets/devices which can't be otherwise detected */
+		const struct special_map_entry* entry = find_special_map_entry(
+			special_hardware_map_entries, CPUINFO_COUNT_OF(special_hardware_map_entries), hardware, hardware_length);
+		if (entry != NULL) {
 			cpuinfo_log_debug(
-				"matched Telechips TCC signature in /proc/cpuinfo Hardware string \"%.*s\"",
+				"found /proc/cpuinfo Hardware string \"%.*s\" in special chipset table",
 				(int) hardware_length, hardware);
-			return chipset;
-		}
-
-		/* Compare to tabulated Hardware values for popular chipsets/devices which can't be otherwise detected */
-		for (size_t i = 0; i < CPUINFO_COUNT_OF(special_hardware_map_entries); i++) {
-			if (strncmp(special_hardware_map_entries[i].platform, hardware, hardware_length) == 0 &&
-					special_hardware_map_entries[i].platform[hardware_length] == 0)
-			{
-				cpuinfo_log_debug(
-					"found /proc/cpuinfo Hardware string \"%.*s\" in special chipset table",
-					(int) hardware_length, hardware);
-				/* Create chipset name from entry */
-				return (struct cpuinfo_arm_chipset) {
-					.vendor = chipset_series_vendor[special_hardware_map_entries[i].series],
-					.series = (enum cpuinfo_arm_chipset_series) special_hardware_map_entries[i].series,
-					.model = special_hardware_map_entries[i].model,
-					.suffix = {
-						[0] = special_hardware_map_entries[i].suffix,
-					},
-				};
-			}
+			/* Create chipset name from entry */
+			return (struct cpuinfo_arm_chipset) {
+				.vendor = chipset_series_vendor[entry->series],
+				.series = (enum cpuinfo_arm_chipset_series) entry->series,
+				.model = entry->model,
+				.suffix = {
+					[0] = entry->suffix,
+				},
+			};
 		}
 	}
 
@@ -2249,6 +2393,23 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 }
 
 #ifdef __ANDROID__
+	/* Chipset signatures which may span the ro.product.board string */
+	static const uint32_t board_signatures =
+		CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(universal) | CHIPSET_SIGNATURE(smdk) | CHIPSET_SIGNATURE(mt) |
+		CHIPSET_SIGNATURE(sc) | CHIPSET_SIGNATURE(pxa) | CHIPSET_SIGNATURE(lc) | CHIPSET_SIGNATURE(broadcom) |
+		CHIPSET_SIGNATURE(huawei);
+
+	/* Chipset signatures which may span the ro.board.platform string */
+	static const uint32_t platform_signatures =
+		CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(exynos) | CHIPSET_SIGNATURE(mt) | CHIPSET_SIGNATURE(kirin) |
+		CHIPSET_SIGNATURE(sc) | CHIPSET_SIGNATURE(rk) | CHIPSET_SIGNATURE(lc) | CHIPSET_SIGNATURE(huawei) |
+		CHIPSET_SIGNATURE(broadcom);
+
+	/* Chipset signatures which may span the ro.chipname string */
+	static const uint32_t chipname_signatures =
+		CHIPSET_SIGNATURE(msm_apq) | CHIPSET_SIGNATURE(exynos) | CHIPSET_SIGNATURE(universal) | CHIPSET_SIGNATURE(mt) |
+		CHIPSET_SIGNATURE(sc) | CHIPSET_SIGNATURE(pxa);
+
 	static const struct special_map_entry special_board_map_entries[] = {
 		{
 			/* "hi6250" -> HiSilicon Kirin 650 */
@@ -2384,101 +2545,38 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 		const size_t board_length = strnlen(ro_product_board, CPUINFO_BUILD_PROP_VALUE_MAX);
 		const char* board_end = ro_product_board + board_length;
 
-		/* Check Qualcomm MSM/APQ signature */
-		if (match_msm_apq(board, board_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Qualcomm MSM/APQ signature in ro.product.board string \"%.*s\"", (int) board_length, board);
-			return chipset;
-		}
-
-		/* Check universaXXXX (Samsung Exynos) signature */
-		if (match_universal(board, board_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched UNIVERSAL (Samsung Exynos) signature in ro.product.board string \"%.*s\"",
-				(int) board_length, board);
-			return chipset;
-		}
-
-		/* Check SMDK (Samsung Exynos) signature */
-		if (match_and_parse_smdk(board, board_end, cores, &chipset)) {
-			cpuinfo_log_debug(
-				"matched SMDK (Samsung Exynos) signature in ro.product.board string \"%.*s\"",
-				(int) board_length, board);
-			return chipset;
-		}
-
-		/* Check MediaTek MT signature */
-		if (match_mt(board, board_end, true, &chipset)) {
-			cpuinfo_log_debug(
-				"matched MediaTek MT signature in ro.product.board string \"%.*s\"",
-				(int) board_length, board);
-			return chipset;
-		}
-
-		/* Check Spreadtrum SC signature */
-		if (match_sc(board, board_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Spreadtrum SC signature in ro.product.board string \"%.*s\"",
-				(int) board_length, board);
-			return chipset;
-		}
-
-		/* Check Marvell PXA signature */
-		if (match_pxa(board, board_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Marvell PXA signature in ro.product.board string \"%.*s\"",
-				(int) board_length, board);
-			return chipset;
-		}
-
-		/* Check Leadcore LCxxxx signature */
-		if (match_lc(board, board_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Leadcore LC signature in ro.product.board string \"%.*s\"",
-				(int) board_length, board);
-			return chipset;
-		}
-
 		/*
-		 * Compare to tabulated ro.product.board values for Broadcom chipsets and decode chipset from frequency and
-		 * number of cores.
+		 * Check chipset signatures, including tabulated ro.product.board values for Broadcom chipsets (decoded from
+		 * frequency and number of cores) and for Huawei devices which don't report chipset elsewhere.
 		 */
-		if (match_and_parse_broadcom(board, board_end, cores, max_cpu_freq_max, &chipset)) {
+		const enum chipset_signature signature = match_chipset_signatures(
+			board, board_end, board_signatures, cores, max_cpu_freq_max, &chipset);
+		if (signature != chipset_signature_max) {
 			cpuinfo_log_debug(
-				"found ro.product.board string \"%.*s\" in Broadcom chipset table",
-				(int) board_length, board);
+				"matched %s signature in ro.product.board string \"%.*s\"",
+				chipset_signature_description[signature], (int) board_length, board);
 			return chipset;
 		}
 
-		/* Compare to tabulated ro.product.board values for Huawei devices which don't report chipset elsewhere */
-		if (match_and_parse_huawei(board, board_end, &chipset)) {
+		/* Compare to tabulated ro.product.board values for popular chipsets/devices which can't be otherwise detected */
+		const struct special_map_entry* entry = find_special_map_entry(
+			special_board_map_entries, CPUINFO_COUNT_OF(special_board_map_entries), board, board_length);
+		if (entry != NULL) {
 			cpuinfo_log_debug(
-				"found ro.product.board string \"%.*s\" in Huawei chipset table",
+				"found ro.product.board string \"%.*s\" in special chipset table",
 				(int) board_length, board);
-			return chipset;
-		}
-
-		/* Compare to tabulated ro.product.board values for popular chipsets/devices which can't be otherwise detected */
-		for (size_t i = 0; i < CPUINFO_COUNT_OF(special_board_map_entries); i++) {
-			if (strncmp(special_board_map_entries[i].platform, board, board_length) == 0 &&
-					special_board_map_entries[i].platform[board_length] == 0)
-			{
-				cpuinfo_log_debug(
-					"found ro.product.board string \"%.*s\" in special chipset table",
-					(int) board_length, board);
-				/* Create chipset name from entry */
-				return (struct cpuinfo_arm_chipset) {
-					.vendor = chipset_series_vendor[special_board_map_entries[i].series],
-					.series = (enum cpuinfo_arm_chipset_series) special_board_map_entries[i].series,
-					.model = special_board_map_entries[i].model,
-					.suffix = {
-						[0] = special_board_map_entries[i].suffix,
-						/* The suffix of MSM8996PRO is truncated at the first letter, reconstruct it here. */
-						[1] = special_board_map_entries[i].suffix == 'P' ? 'R' : 0,
-						[2] = special_board_map_entries[i].suffix == 'P' ? 'O' : 0,
-					},
-				};
-			}
+			/* Create chipset name from entry */
+			return (struct cpuinfo_arm_chipset) {
+				.vendor = chipset_series_vendor[entry->series],
+				.series = (enum cpuinfo_arm_chipset_series) entry->series,
+				.model = entry->model,
+				.suffix = {
+					[0] = entry->suffix,
+					/* The suffix of MSM8996PRO is truncated at the first letter, reconstruct it here. */
+					[1] = entry->suffix == 'P' ? 'R' : 0,
+					[2] = entry->suffix == 'P' ? 'O' : 0,
+				},
+			};
 		}
 
 		return (struct cpuinfo_arm_chipset) {
@@ -2655,73 +2753,16 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 		const size_t platform_length = strnlen(platform, CPUINFO_BUILD_PROP_VALUE_MAX);
 		const char* platform_end = platform + platform_length;
 
-		/* Check Qualcomm MSM/APQ signature */
-		if (match_msm_apq(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Qualcomm MSM/APQ signature in ro.board.platform string \"%.*s\"",
-				(int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Check exynosXXXX (Samsung Exynos) signature */
-		if (match_exynos(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched exynosXXXX (Samsung Exynos) signature in ro.board.platform string \"%.*s\"",
-				(int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Check MediaTek MT signature */
-		if (match_mt(platform, platform_end, true, &chipset)) {
-			cpuinfo_log_debug(
-				"matched MediaTek MT signature in ro.board.platform string \"%.*s\"", (int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Check HiSilicon Kirin signature */
-		if (match_kirin(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched HiSilicon Kirin signature in ro.board.platform string \"%.*s\"", (int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Check Spreadtrum SC signature */
-		if (match_sc(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Spreadtrum SC signature in ro.board.platform string \"%.*s\"", (int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Check Rockchip RK signature */
-		if (match_rk(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Rockchip RK signature in ro.board.platform string \"%.*s\"", (int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Check Leadcore LCxxxx signature */
-		if (match_lc(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Leadcore LC signature in ro.board.platform string \"%.*s\"", (int) platform_length, platform);
-			return chipset;
-		}
-
-		/* Compare to tabulated ro.board.platform values for Huawei devices which don't report chipset elsewhere */
-		if (match_and_parse_huawei(platform, platform_end, &chipset)) {
-			cpuinfo_log_debug(
-				"found ro.board.platform string \"%.*s\" in Huawei chipset table",
-				(int) platform_length, platform);
-			return chipset;
-		}
-
 		/*
-		 * Compare to known ro.board.platform values for Broadcom devices and
-		 * detect chipset from frequency and number of cores
+		 * Check chipset signatures, including tabulated ro.board.platform values for Huawei devices which don't report
+		 * chipset elsewhere, and for Broadcom devices (decoded from frequency and number of cores).
 		 */
-		if (match_and_parse_broadcom(platform, platform_end, cores, max_cpu_freq_max, &chipset)) {
+		const enum chipset_signature signature = match_chipset_signatures(
+			platform, platform_end, platform_signatures, cores, max_cpu_freq_max, &chipset);
+		if (signature != chipset_signature_max) {
 			cpuinfo_log_debug(
-				"found ro.board.platform string \"%.*s\" in Broadcom chipset table",
-				(int) platform_length, platform);
+				"matched %s signature in ro.board.platform string \"%.*s\"",
+				chipset_signature_description[signature], (int) platform_length, platform);
 			return chipset;
 		}
 
@@ -2767,22 +2808,20 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 		}
 
 		/* Compare to tabulated ro.board.platform values for popular chipsets/devices which can't be otherwise detected */
-		for (size_t i = 0; i < CPUINFO_COUNT_OF(special_platform_map_entries); i++) {
-			if (strncmp(special_platform_map_entries[i].platform, platform, platform_length) == 0 &&
-					special_platform_map_entries[i].platform[platform_length] == 0)
-			{
-				/* Create chipset name from entry */
-				cpuinfo_log_debug(
-					"found ro.board.platform string \"%.*s\" in special chipset table", (int) platform_length, platform);
-				return (struct cpuinfo_arm_chipset) {
-					.vendor = chipset_series_vendor[special_platform_map_entries[i].series],
-					.series = (enum cpuinfo_arm_chipset_series) special_platform_map_entries[i].series,
-					.model = special_platform_map_entries[i].model,
-					.suffix = {
-						[0] = special_platform_map_entries[i].suffix,
-					},
-				};
-			}
+		const struct special_map_entry* entry = find_special_map_entry(
+			special_platform_map_entries, CPUINFO_COUNT_OF(special_platform_map_entries), platform, platform_length);
+		if (entry != NULL) {
+			/* Create chipset name from entry */
+			cpuinfo_log_debug(
+				"found ro.board.platform string \"%.*s\" in special chipset table", (int) platform_length, platform);
+			return (struct cpuinfo_arm_chipset) {
+				.vendor = chipset_series_vendor[entry->series],
+				.series = (enum cpuinfo_arm_chipset_series) entry->series,
+				.model = entry->model,
+				.suffix = {
+					[0] = entry->suffix,
+				},
+			};
 		}
 
 		/* None of the ro.board.platform signatures matched, indicate unknown chipset */
@@ -2862,51 +2901,13 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 		const size_t chipname_length = strnlen(chipname, CPUINFO_BUILD_PROP_VALUE_MAX);
 		const char* chipname_end = chipname + chipname_length;
 
-		/* Check Qualcomm MSM/APQ signatures */
-		if (match_msm_apq(chipname, chipname_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Qualcomm MSM/APQ signature in ro.chipname string \"%.*s\"",
-				(int) chipname_length, chipname);
-			return chipset;
-		}
-
-		/* Check exynosXXXX (Samsung Exynos) signature */
-		if (match_exynos(chipname, chipname_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched exynosXXXX (Samsung Exynos) signature in ro.chipname string \"%.*s\"",
-				(int) chipname_length, chipname);
-			return chipset;
-		}
-
-		/* Check universalXXXX (Samsung Exynos) signature */
-		if (match_universal(chipname, chipname_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched UNIVERSAL (Samsung Exynos) signature in ro.chipname Hardware string \"%.*s\"",
-				(int) chipname_length, chipname);
-			return chipset;
-		}
-
-		/* Check MediaTek MT signature */
-		if (match_mt(chipname, chipname_end, true, &chipset)) {
-			cpuinfo_log_debug(
-				"matched MediaTek MT signature in ro.chipname string \"%.*s\"",
-				(int) chipname_length, chipname);
-			return chipset;
-		}
-
-		/* Check Spreadtrum SC signature */
-		if (match_sc(chipname, chipname_end, &chipset)) {
+		/* Check chipset signatures */
+		const enum chipset_signature signature = match_chipset_signatures(
+			chipname, chipname_end, chipname_signatures, 0, 0, &chipset);
+		if (signature != chipset_signature_max) {
 			cpuinfo_log_debug(
-				"matched Spreadtrum SC signature in ro.chipname string \"%.*s\"",
-				(int) chipname_length, chipname);
-			return chipset;
-		}
-
-		/* Check Marvell PXA signature */
-		if (match_pxa(chipname, chipname_end, &chipset)) {
-			cpuinfo_log_debug(
-				"matched Marvell PXA signature in ro.chipname string \"%.*s\"",
-				(int) chipname_length, chipname);
+				"matched %s signature in ro.chipname string \"%.*s\"",
+				chipset_signature_description[signature], (int) chipname_length, chipname);
 			return chipset;
 		}
 
@@ -2930,6 +2931,229 @@ struct cpuinfo_arm_chipset cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_ha
 	}
 #endif /* __ANDROID__ */
 
+/* Map from ARM chipset vendor ID to its string representation */
+static const char* chipset_vendor_string[cpuinfo_arm_chipset_vendor_max] = {
+	[cpuinfo_arm_chipset_vendor_unknown]           = "Unknown",
+	[cpuinfo_arm_chipset_vendor_qualcomm]          = "Qualcomm",
+	[cpuinfo_arm_chipset_vendor_mediatek]          = "MediaTek",
+	[cpuinfo_arm_chipset_vendor_samsung]           = "Samsung",
+	[cpuinfo_arm_chipset_vendor_hisilicon]         = "HiSilicon",
+	[cpuinfo_arm_chipset_vendor_actions]           = "Actions",
+	[cpuinfo_arm_chipset_vendor_allwinner]         = "Allwinner",
+	[cpuinfo_arm_chipset_vendor_amlogic]           = "Amlogic",
+	[cpuinfo_arm_chipset_vendor_broadcom]          = "Broadcom",
+	[cpuinfo_arm_chipset_vendor_lg]                = "LG",
+	[cpuinfo_arm_chipset_vendor_leadcore]          = "Leadcore",
+	[cpuinfo_arm_chipset_vendor_marvell]           = "Marvell",
+	[cpuinfo_arm_chipset_vendor_mstar]             = "MStar",
+	[cpuinfo_arm_chipset_vendor_novathor]          = "NovaThor",
+	[cpuinfo_arm_chipset_vendor_nvidia]            = "Nvidia",
+	[cpuinfo_arm_chipset_vendor_pinecone]          = "Pinecone",
+	[cpuinfo_arm_chipset_vendor_renesas]           = "Renesas",
+	[cpuinfo_arm_chipset_vendor_rockchip]          = "Rockchip",
+	[cpuinfo_arm_chipset_vendor_spreadtrum]        = "Spreadtrum",
+	[cpuinfo_arm_chipset_vendor_telechips]         = "Telechips",
+	[cpuinfo_arm_chipset_vendor_texas_instruments] = "Texas Instruments",
+	[cpuinfo_arm_chipset_vendor_wondermedia]       = "WonderMedia",
+};
+
+/* Map from ARM chipset series ID to its string representation */
+static const char* chipset_series_string[cpuinfo_arm_chipset_series_max] = {
+	[cpuinfo_arm_chipset_series_unknown]                = NULL,
+	[cpuinfo_arm_chipset_series_qualcomm_qsd]           = "QSD",
+	[cpuinfo_arm_chipset_series_qualcomm_msm]           = "MSM",
+	[cpuinfo_arm_chipset_series_qualcomm_apq]           = "APQ",
+	[cpuinfo_arm_chipset_series_qualcomm_snapdragon]    = "Snapdragon ",
+	[cpuinfo_arm_chipset_series_mediatek_mt]            = "MT",
+	[cpuinfo_arm_chipset_series_samsung_exynos]         = "Exynos ",
+	[cpuinfo_arm_chipset_series_hisilicon_k3v]          = "K3V",
+	[cpuinfo_arm_chipset_series_hisilicon_hi]           = "Hi",
+	[cpuinfo_arm_chipset_series_hisilicon_kirin]        = "Kirin ",
+	[cpuinfo_arm_chipset_series_actions_atm]            = "ATM",
+	[cpuinfo_arm_chipset_series_allwinner_a]            = "A",
+	[cpuinfo_arm_chipset_series_amlogic_aml]            = "AML",
+	[cpuinfo_arm_chipset_series_amlogic_s]              = "S",
+	[cpuinfo_arm_chipset_series_broadcom_bcm]           = "BCM",
+	[cpuinfo_arm_chipset_series_lg_nuclun]              = "Nuclun ",
+	[cpuinfo_arm_chipset_series_leadcore_lc]            = "LC",
+	[cpuinfo_arm_chipset_series_marvell_pxa]            = "PXA",
+	[cpuinfo_arm_chipset_series_mstar_6a]               = "6A",
+	[cpuinfo_arm_chipset_series_novathor_u]             = "U",
+	[cpuinfo_arm_chipset_series_nvidia_tegra_t]         = "Tegra T",
+	[cpuinfo_arm_chipset_series_nvidia_tegra_ap]        = "Tegra AP",
+	[cpuinfo_arm_chipset_series_nvidia_tegra_sl]        = "Tegra SL",
+	[cpuinfo_arm_chipset_series_pinecone_surge_s]       = "Surge S",
+	[cpuinfo_arm_chipset_series_renesas_mp]             = "MP",
+	[cpuinfo_arm_chipset_series_rockchip_rk]            = "RK",
+	[cpuinfo_arm_chipset_series_spreadtrum_sc]          = "SC",
+	[cpuinfo_arm_chipset_series_telechips_tcc]          = "TCC",
+	[cpuinfo_arm_chipset_series_texas_instruments_omap] = "OMAP",
+	[cpuinfo_arm_chipset_series_wondermedia_wm]         = "WM",
+};
+
+/*
+ * Chipset which the system reports under a different name. A renamed chipset is always replaced with the actual
+ * chipset. Otherwise, the reported chipset is replaced only if the number of cores matches the actual chipset, and is
+ * invalidated if the number of cores matches neither chipset.
+ */
+struct chipset_fixup_entry {
+	/* Reported chipset model */
+	uint16_t model;
+	/* Actual chipset model */
+	uint16_t fixed_model;
+	/* Actual chipset series */
+	uint8_t fixed_series;
+	/* Number of cores in the reported chipset, or 0 if the reported chipset was renamed */
+	uint8_t cores;
+	/* Number of cores in the actual chipset, or 0 if the reported chipset was renamed */
+	uint8_t fixed_cores;
+};
+
+/* Qualcomm MSM chipsets which the system reports under a different name */
+static const struct chipset_fixup_entry qualcomm_msm_fixups[] = {
+	{
+		/* MSM8216 was renamed to MSM8916 */
+		.model = 8216,
+		.fixed_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.fixed_model = 8916,
+	},
+	{
+		/* Common bug: MSM8939 (Octa-core) reported as MSM8916 (Quad-core) */
+		.model = 8916,
+		.cores = 4,
+		.fixed_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.fixed_model = 8939,
+		.fixed_cores = 8,
+	},
+	{
+		/* Common bug: MSM8917 (Quad-core) reported as MSM8937 (Octa-core) */
+		.model = 8937,
+		.cores = 8,
+		.fixed_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.fixed_model = 8917,
+		.fixed_cores = 4,
+	},
+	{
+		/* Common bug: APQ8064 (Quad-core) reported as MSM8960 (Dual-core) */
+		.model = 8960,
+		.cores = 2,
+		.fixed_series = cpuinfo_arm_chipset_series_qualcomm_apq,
+		.fixed_model = 8064,
+		.fixed_cores = 4,
+	},
+	{
+		/* Common bug: MSM8994 (Octa-core) reported as MSM8996 (Quad-core) */
+		.model = 8996,
+		.cores = 4,
+		.fixed_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.fixed_model = 8994,
+		.fixed_cores = 8,
+	},
+	{
+		/* Common bug: MSM8612 (Quad-core) reported as MSM8610 (Dual-core) */
+		.model = 8610,
+		.cores = 2,
+		.fixed_series = cpuinfo_arm_chipset_series_qualcomm_msm,
+		.fixed_model = 8612,
+		.fixed_cores = 4,
+	},
+};
+
+/* Samsung Exynos chipsets which the system reports under a different name */
+static const struct chipset_fixup_entry samsung_exynos_fixups[] = {
+	{
+		/* Exynos 4410 was renamed to Exynos 4412 */
+		.model = 4410,
+		.fixed_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.fixed_model = 4412,
+	},
+	{
+		/* Common bug: Exynos 5260 (Hexa-core) reported as Exynos 5420 (Quad-core) */
+		.model = 5420,
+		.cores = 4,
+		.fixed_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.fixed_model = 5260,
+		.fixed_cores = 6,
+	},
+	{
+		/* Common bug: Exynos 7578 (Quad-core) reported as Exynos 7580 (Octa-core) */
+		.model = 7580,
+		.cores = 8,
+		.fixed_series = cpuinfo_arm_chipset_series_samsung_exynos,
+		.fixed_model = 7578,
+		.fixed_cores = 4,
+	},
+};
+
+/* MediaTek MT chipsets which the system reports under a different name */
+static const struct chipset_fixup_entry mediatek_mt_fixups[] = {
+	{
+		/* Common bug: MT6732 (Quad-core) reported as MT6752 (Octa-core) */
+		.model = 6752,
+		.cores = 8,
+		.fixed_series = cpuinfo_arm_chipset_series_mediatek_mt,
+		.fixed_model = 6732,
+		.fixed_cores = 4,
+	},
+};
+
+/* Rockchip RK chipsets which the system reports under a different name */
+static const struct chipset_fixup_entry rockchip_rk_fixups[] = {
+	{
+		/* Common bug: Rockchip RK3399 (Hexa-core) always reported as RK3288 (Quad-core) */
+		.model = 3288,
+		.cores = 4,
+		.fixed_series = cpuinfo_arm_chipset_series_rockchip_rk,
+		.fixed_model = 3399,
+		.fixed_cores = 6,
+	},
+};
+
+/*
+ * Replaces chipset model according to a table of chipsets which the system reports under a different name.
+ *
+ * @param[in,out] chipset - chipset name to fix.
+ * @param cores - number of cores in the chipset.
+ * @param entries - table of misreported chipsets in the series of the chipset.
+ * @param count - number of entries in the table.
+ */
+static void fixup_chipset_model(
+	struct cpuinfo_arm_chipset chipset[restrict static 1], uint32_t cores,
+	const struct chipset_fixup_entry entries[restrict static 1], size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		const struct chipset_fixup_entry* entry = &entries[i];
+		if (chipset->model != entry->model) {
+			continue;
+		}
+
+		if (entry->cores != 0 && cores == entry->cores) {
+			/* Reported chipset is consistent with the number of cores */
+			return;
+		}
+
+		const char* series_string = chipset_series_string[chipset->series];
+		if (entry->cores == 0 || cores == entry->fixed_cores) {
+			const char* fixed_series_string = chipset_series_string[entry->fixed_series];
+			if (entry->cores == 0) {
+				cpuinfo_log_info("reinterpreted %s%"PRIu32" chipset as %s%"PRIu32,
+					series_string, chipset->model, fixed_series_string, (uint32_t) entry->fixed_model);
+			} else {
+				cpuinfo_log_info("reinterpreted %s%"PRIu32" chipset with %"PRIu32" cores as %s%"PRIu32,
+					series_string, chipset->model, cores, fixed_series_string, (uint32_t) entry->fixed_model);
+			}
+			chipset->vendor = chipset_series_vendor[entry->fixed_series];
+			chipset->series = (enum cpuinfo_arm_chipset_series) entry->fixed_series;
+			chipset->model = entry->fixed_model;
+		} else {
+			cpuinfo_log_warning("system reported invalid %"PRIu32"-core %s%"PRIu32" chipset",
+				cores, series_string, chipset->model);
+			chipset->model = 0;
+		}
+		return;
+	}
+}
+
 /*
  * Fix common bugs, typos, and renames in chipset name.
  *
@@ -2945,89 +3169,7 @@ void cpuinfo_arm_fixup_chipset(
 			/* Check if there is suffix */
 			if (chipset->suffix[0] == 0) {
 				/* No suffix, but the model may be misreported */
-				switch (chipset->model) {
-					case 8216:
-						/* MSM8216 was renamed to MSM8916 */
-						cpuinfo_log_info("reinterpreted MSM8216 chipset as MSM8916");
-						chipset->model = 8916;
-						break;
-					case 8916:
-						/* Common bug: MSM8939 (Octa-core) reported as MSM8916 (Quad-core) */
-						switch (cores) {
-							case 4:
-								break;
-							case 8:
-								cpuinfo_log_info("reinterpreted MSM8916 chipset with 8 cores as MSM8939");
-								chipset->model = 8939;
-								break;
-							default:
-								cpuinfo_log_warning("system reported invalid %"PRIu32"-core MSM%"PRIu32" chipset",
-									cores, chipset->model);
-								chipset->model = 0;
-						}
-						break;
-					case 8937:
-						/* Common bug: MSM8917 (Quad-core) reported as MSM8937 (Octa-core) */
-						switch (cores) {
-							case 4:
-								cpuinfo_log_info("reinterpreted MSM8937 chipset with 4 cores as MSM8917");
-								chipset->model = 8917;
-								break;
-							case 8:
-								break;
-							default:
-								cpuinfo_log_warning("system reported invalid %"PRIu32"-core MSM%"PRIu32" chipset",
-									cores, chipset->model);
-								chipset->model = 0;
-						}
-						break;
-					case 8960:
-						/* Common bug: APQ8064 (Quad-core) reported as MSM8960 (Dual-core) */
-						switch (cores) {
-							case 2:
-								break;
-							case 4:
-								cpuinfo_log_info("reinterpreted MSM8960 chipset with 4 cores as APQ8064");
-								chipset->series = cpuinfo_arm_chipset_series_qualcomm_apq;
-								chipset->model = 8064;
-								break;
-							default:
-								cpuinfo_log_warning("system reported invalid %"PRIu32"-core MSM%"PRIu32" chipset",
-									cores, chipset->model);
-								chipset->model = 0;
-						}
-						break;
-					case 8996:
-						/* Common bug: MSM8994 (Octa-core) reported as MSM8996 (Quad-core) */
-						switch (cores) {
-							case 4:
-								break;
-							case 8:
-								cpuinfo_log_info("reinterpreted MSM8996 chipset with 8 cores as MSM8994");
-								chipset->model = 8994;
-								break;
-							default:
-								cpuinfo_log_warning("system reported invalid %"PRIu32"-core MSM%"PRIu32" chipset",
-									cores, chipset->model);
-								chipset->model = 0;
-						}
-						break;
-					case 8610:
-						/* Common bug: MSM8612 (Quad-core) reported as MSM8610 (Dual-core) */
-						switch (cores) {
-							case 2:
-								break;
-							case 4:
-								cpuinfo_log_info("reinterpreted MSM8610 chipset with 4 cores as MSM8612");
-								chipset->model = 8612;
-								break;
-							default:
-								cpuinfo_log_warning("system reported invalid %"PRIu32"-core MSM%"PRIu32" chipset",
-									cores, chipset->model);
-								chipset->model = 0;
-						}
-						break;
-				}
+				fixup_chipset_model(chipset, cores, qualcomm_msm_fixups, CPUINFO_COUNT_OF(qualcomm_msm_fixups));
 			} else {
 				/* Suffix may need correction */
 				const uint32_t suffix_word = load_u32le(chipset->suffix);
@@ -3077,56 +3219,10 @@ void cpuinfo_arm_fixup_chipset(
 			break;
 		}
 		case cpuinfo_arm_chipset_series_samsung_exynos:
-			switch (chipset->model) {
-				case 4410:
-					/* Exynos 4410 was renamed to Exynos 4412 */
-					chipset->model = 4412;
-					break;
-				case 5420:
-					/* Common bug: Exynos 5260 (Hexa-core) reported as Exynos 5420 (Quad-core) */
-					switch (cores) {
-						case 4:
-							break;
-						case 6:
-							cpuinfo_log_info("reinterpreted Exynos 5420 chipset with 6 cores as Exynos 5260");
-							chipset->model = 5260;
-							break;
-						default:
-							cpuinfo_log_warning("system reported invalid %"PRIu32"-core Exynos 5420 chipset", cores);
-							chipset->model = 0;
-					}
-					break;
-				case 7580:
-					/* Common bug: Exynos 7578 (Quad-core) reported as Exynos 7580 (Octa-core) */
-					switch (cores) {
-						case 4:
-							cpuinfo_log_info("reinterpreted Exynos 7580 chipset with 4 cores as Exynos 7578");
-							chipset->model = 7578;
-							break;
-						case 8:
-							break;
-						default:
-							cpuinfo_log_warning("system reported invalid %"PRIu32"-core Exynos 7580 chipset", cores);
-							chipset->model = 0;
-					}
-					break;
-			}
+			fixup_chipset_model(chipset, cores, samsung_exynos_fixups, CPUINFO_COUNT_OF(samsung_exynos_fixups));
 			break;
 		case cpuinfo_arm_chipset_series_mediatek_mt:
-			if (chipset->model == 6752) {
-				/* Common bug: MT6732 (Quad-core) reported as MT6752 (Octa-core) */
-				switch (cores) {
-					case 4:
-						cpuinfo_log_info("reinterpreted MT6752 chipset with 4 cores as MT6732");
-						chipset->model = 6732;
-						break;
-					case 8:
-						break;
-					default:
-						cpuinfo_log_warning("system reported invalid %"PRIu32"-core MT6752 chipset", cores);
-						chipset->model = 0;
-				}
-			}
+			fixup_chipset_model(chipset, cores, mediatek_mt_fixups, CPUINFO_COUNT_OF(mediatek_mt_fixups));
 			if (chipset->suffix[0] == 'T') {
 				/* Normalization: "TURBO" and "TRUBO" (apparently a typo) -> "T" */
 				const uint32_t suffix_word = load_u32le(chipset->suffix + 1);
@@ -3144,86 +3240,13 @@ void cpuinfo_arm_fixup_chipset(
 			}
 			break;
 		case cpuinfo_arm_chipset_series_rockchip_rk:
-			if (chipset->model == 3288) {
-				/* Common bug: Rockchip RK3399 (Hexa-core) always reported as RK3288 (Quad-core) */
-				switch (cores) {
-					case 4:
-						break;
-					case 6:
-						cpuinfo_log_info("reinterpreted RK3288 chipset with 6 cores as RK3399");
-						chipset->model = 3399;
-						break;
-					default:
-						cpuinfo_log_warning("system reported invalid %"PRIu32"-core RK3288 chipset", cores);
-						chipset->model = 0;
-				}
-			}
+			fixup_chipset_model(chipset, cores, rockchip_rk_fixups, CPUINFO_COUNT_OF(rockchip_rk_fixups));
 			break;
 		default:
 			break;
 	}
 }
 
-/* Map from ARM chipset vendor ID to its string representation */
-static const char* chipset_vendor_string[cpuinfo_arm_chipset_vendor_max] = {
-	[cpuinfo_arm_chipset_vendor_unknown]           = "Unknown",
-	[cpuinfo_arm_chipset_vendor_qualcomm]          = "Qualcomm",
-	[cpuinfo_arm_chipset_vendor_mediatek]          = "MediaTek",
-	[cpuinfo_arm_chipset_vendor_samsung]           = "Samsung",
-	[cpuinfo_arm_chipset_vendor_hisilicon]         = "HiSilicon",
-	[cpuinfo_arm_chipset_vendor_actions]           = "Actions",
-	[cpuinfo_arm_chipset_vendor_allwinner]         = "Allwinner",
-	[cpuinfo_arm_chipset_vendor_amlogic]           = "Amlogic",
-	[cpuinfo_arm_chipset_vendor_broadcom]          = "Broadcom",
-	[cpuinfo_arm_chipset_vendor_lg]                = "LG",
-	[cpuinfo_arm_chipset_vendor_leadcore]          = "Leadcore",
-	[cpuinfo_arm_chipset_vendor_marvell]           = "Marvell",
-	[cpuinfo_arm_chipset_vendor_mstar]             = "MStar",
-	[cpuinfo_arm_chipset_vendor_novathor]          = "NovaThor",
-	[cpuinfo_arm_chipset_vendor_nvidia]            = "Nvidia",
-	[cpuinfo_arm_chipset_vendor_pinecone]          = "Pinecone",
-	[cpuinfo_arm_chipset_vendor_renesas]           = "Renesas",
-	[cpuinfo_arm_chipset_vendor_rockchip]          = "Rockchip",
-	[cpuinfo_arm_chipset_vendor_spreadtrum]        = "Spreadtrum",
-	[cpuinfo_arm_chipset_vendor_telechips]         = "Telechips",
-	[cpuinfo_arm_chipset_vendor_texas_instruments] = "Texas Instruments",
-	[cpuinfo_arm_chipset_vendor_wondermedia]       = "WonderMedia",
-};
-
-/* Map from ARM chipset series ID to its string representation */
-static const char* chipset_series_string[cpuinfo_arm_chipset_series_max] = {
-	[cpuinfo_arm_chipset_series_unknown]                = NULL,
-	[cpuinfo_arm_chipset_series_qualcomm_qsd]           = "QSD",
-	[cpuinfo_arm_chipset_series_qualcomm_msm]           = "MSM",
-	[cpuinfo_arm_chipset_series_qualcomm_apq]           = "APQ",
-	[cpuinfo_arm_chipset_series_qualcomm_snapdragon]    = "Snapdragon ",
-	[cpuinfo_arm_chipset_series_mediatek_mt]            = "MT",
-	[cpuinfo_arm_chipset_series_samsung_exynos]         = "Exynos ",
-	[cpuinfo_arm_chipset_series_hisilicon_k3v]          = "K3V",
-	[cpuinfo_arm_chipset_series_hisilicon_hi]           = "Hi",
-	[cpuinfo_arm_chipset_series_hisilicon_kirin]        = "Kirin ",
-	[cpuinfo_arm_chipset_series_actions_atm]            = "ATM",
-	[cpuinfo_arm_chipset_series_allwinner_a]            = "A",
-	[cpuinfo_arm_chipset_series_amlogic_aml]            = "AML",
-	[cpuinfo_arm_chipset_series_amlogic_s]              = "S",
-	[cpuinfo_arm_chipset_series_broadcom_bcm]           = "BCM",
-	[cpuinfo_arm_chipset_series_lg_nuclun]              = "Nuclun ",
-	[cpuinfo_arm_chipset_series_leadcore_lc]            = "LC",
-	[cpuinfo_arm_chipset_series_marvell_pxa]            = "PXA",
-	[cpuinfo_arm_chipset_series_mstar_6a]               = "6A",
-	[cpuinfo_arm_chipset_series_novathor_u]             = "U",
-	[cpuinfo_arm_chipset_series_nvidia_tegra_t]         = "Tegra T",
-	[cpuinfo_arm_chipset_series_nvidia_tegra_ap]        = "Tegra AP",
-	[cpuinfo_arm_chipset_series_nvidia_tegra_sl]        = "Tegra SL",
-	[cpuinfo_arm_chipset_series_pinecone_surge_s]       = "Surge S",
-	[cpuinfo_arm_chipset_series_renesas_mp]             = "MP",
-	[cpuinfo_arm_chipset_series_rockchip_rk]            = "RK",
-	[cpuinfo_arm_chipset_series_spreadtrum_sc]          = "SC",
-	[cpuinfo_arm_chipset_series_telechips_tcc]          = "TCC",
-	[cpuinfo_arm_chipset_series_texas_instruments_omap] = "OMAP",
-	[cpuinfo_arm_chipset_series_wondermedia_wm]         = "WM",
-};
-
 /* Convert chipset name represented by cpuinfo_arm_chipset structure to a string representation */
 void cpuinfo_arm_chipset_to_string(
 	const struct cpuinfo_arm_chipset chipset[restrict static 1],
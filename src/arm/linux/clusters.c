@@ -18,6 +18,115 @@ static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
 	return (bitfield & mask) == mask;
 }
 
+/* Processor with the keys which group it into a cluster by capacity */
+struct capacity_cluster_key {
+	/* Cluster leader from siblings lists, or UINT32_MAX if the processor has no siblings information */
+	uint32_t siblings_leader;
+	uint32_t capacity;
+	uint32_t processor;
+};
+
+static int compare_capacity_cluster_keys(const void* a, const void* b) {
+	const struct capacity_cluster_key* key_a = (const struct capacity_cluster_key*) a;
+	const struct capacity_cluster_key* key_b = (const struct capacity_cluster_key*) b;
+	if (key_a->siblings_leader != key_b->siblings_leader) {
+		return key_a->siblings_leader < key_b->siblings_leader ? -1 : 1;
+	}
+	if (key_a->capacity != key_b->capacity) {
+		return key_a->capacity < key_b->capacity ? -1 : 1;
+	}
+	return (key_a->processor > key_b->processor) - (key_a->processor < key_b->processor);
+}
+
+/*
+ * Assigns logical processors to clusters of cores using the capacity reported by the kernel in
+ * /sys/devices/system/cpu/cpu<N>/cpu_capacity. The kernel derives capacity from the performance of the core type
+ * (capacity-dmips-mhz property in the device tree) and its maximum frequency, and normalizes it to 1024 for the
+ * highest-performance cores in the system.
+ *
+ * Siblings lists do not describe clusters of cores on SoCs with DynamIQ Shared Unit (e.g. 1+3+4 and 2+6
+ * configurations): core_siblings_list includes all cores in the DynamIQ cluster, regardless of their type, and
+ * L2 caches are private to each core. Capacity distinguishes these clusters.
+ *
+ * Processors are assigned to the same cluster if they have the same capacity and either belong to the same cluster
+ * parsed from system siblings lists (CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER flag), or both have no cluster siblings
+ * information. The cluster leader is the minimum processor ID in the cluster.
+ *
+ * Capacity-based assignment is not done, and all processors' clusters are unchanged, if any usable processor does
+ * not report capacity, or if all processors report the same capacity, which carries no information about clusters.
+ *
+ * Processors are grouped by sorting, in O(N log N) time for N processors.
+ *
+ * @param max_processors - number of elements in the @p processors array.
+ * @param[in,out] processors - processor descriptors with pre-parsed POSSIBLE and PRESENT flags, capacity, and core
+ *                             cluster (package siblings list) information.
+ *
+ * @retval true if all usable processors were assigned to clusters of cores based on capacity.
+ * @retval false if capacity information is missing or uniform, or memory allocation failed.
+ */
+bool cpuinfo_arm_linux_detect_core_clusters_by_capacity(
+	uint32_t max_processors,
+	struct cpuinfo_arm_linux_processor processors[restrict static max_processors])
+{
+	uint32_t first_capacity = 0;
+	bool uniform_capacity = true;
+	for (uint32_t i = 0; i < max_processors; i++) {
+		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
+			if (!(processors[i].flags & CPUINFO_LINUX_FLAG_CAPACITY)) {
+				cpuinfo_log_debug("capacity-based detection of core clusters skipped: "
+					"capacity of processor %"PRIu32" is unknown", i);
+				return false;
+			}
+			if (first_capacity == 0) {
+				first_capacity = processors[i].capacity;
+			} else if (processors[i].capacity != first_capacity) {
+				uniform_capacity = false;
+			}
+		}
+	}
+	if (uniform_capacity) {
+		return false;
+	}
+
+	/*
+	 * The cluster leader of a processor is the minimum processor with the same capacity and the same cluster from
+	 * siblings lists. Sorted keys put each such group in a contiguous range, which starts with the leader.
+	 */
+	struct capacity_cluster_key* keys = calloc(max_processors, sizeof(struct capacity_cluster_key));
+	if (keys == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for capacity-based detection of core clusters of %"PRIu32" processors",
+			max_processors * sizeof(struct capacity_cluster_key), max_processors);
+		return false;
+	}
+	uint32_t keys_count = 0;
+	for (uint32_t i = 0; i < max_processors; i++) {
+		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
+			keys[keys_count++] = (struct capacity_cluster_key) {
+				.siblings_leader = (processors[i].flags & CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER) ?
+					processors[i].package_leader_id : UINT32_MAX,
+				.capacity = processors[i].capacity,
+				.processor = i,
+			};
+		}
+	}
+	qsort(keys, keys_count, sizeof(struct capacity_cluster_key), compare_capacity_cluster_keys);
+
+	uint32_t cluster_leader = 0;
+	for (uint32_t k = 0; k < keys_count; k++) {
+		if (k == 0 || keys[k].siblings_leader != keys[k - 1].siblings_leader || keys[k].capacity != keys[k - 1].capacity) {
+			cluster_leader = keys[k].processor;
+		}
+		if (keys[k].siblings_leader != UINT32_MAX && cluster_leader != keys[k].siblings_leader) {
+			cpuinfo_log_debug("processor %"PRIu32" with capacity %"PRIu32" moved from cluster of processor %"PRIu32" "
+				"to cluster of processor %"PRIu32, keys[k].processor, keys[k].capacity, keys[k].siblings_leader, cluster_leader);
+		}
+		processors[keys[k].processor].package_leader_id = cluster_leader;
+		processors[keys[k].processor].flags |= CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER;
+	}
+	free(keys);
+	return true;
+}
+
 /*
  * Assigns logical processors to clusters of cores using heuristic based on the typical configuration of clusters for
  * 5, 6, 8, and 10 cores:
@@ -41,6 +150,8 @@ static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
  * - Processors in a heuristic cluster have no OS-provided cluster siblings information, but have known and different
  *   minimum/maximum frequency.
  * - Processors in a heuristic cluster have no OS-provided cluster siblings information, but have known and different
+ *   capacity.
+ * - Processors in a heuristic cluster have no OS-provided cluster siblings information, but have known and different
  *   MIDR components.
  *
  * If the heuristic assignment of processors to clusters of cores fails, all processors' clusters are unchanged.
@@ -95,7 +206,7 @@ bool cpuinfo_arm_linux_detect_core_clusters_by_heuristic(
 
 	uint32_t cluster = 0;
 	uint32_t expected_cluster_processors = 0;
-	uint32_t cluster_start, cluster_flags, cluster_midr, cluster_max_frequency, cluster_min_frequency;
+	uint32_t cluster_start, cluster_flags, cluster_midr, cluster_max_frequency, cluster_min_frequency, cluster_capacity;
 	bool expected_cluster_exists;
 	for (uint32_t i = 0; i < max_processors; i++) {
 		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
@@ -194,6 +305,21 @@ bool cpuinfo_arm_linux_detect_core_clusters_by_heuristic(
 						}
 					}
 
+					if (processors[i].flags & CPUINFO_LINUX_FLAG_CAPACITY) {
+						if (cluster_flags & CPUINFO_LINUX_FLAG_CAPACITY) {
+							if (cluster_capacity != processors[i].capacity) {
+								cpuinfo_log_debug(
+									"heuristic detection of core clusters failed: "
+									"capacity of processor %"PRIu32" (%"PRIu32") is different than of its expected cluster (%"PRIu32")",
+									i, processors[i].capacity, cluster_capacity);
+								return false;
+							}
+						} else {
+							cluster_capacity = processors[i].capacity;
+							cluster_flags |= CPUINFO_LINUX_FLAG_CAPACITY;
+						}
+					}
+
 					if (processors[i].flags & CPUINFO_ARM_LINUX_VALID_IMPLEMENTER) {
 						if (cluster_flags & CPUINFO_ARM_LINUX_VALID_IMPLEMENTER) {
 							if ((cluster_midr & CPUINFO_ARM_MIDR_IMPLEMENTER_MASK) != (processors[i].midr & CPUINFO_ARM_MIDR_IMPLEMENTER_MASK)) {
@@ -292,9 +418,9 @@ bool cpuinfo_arm_linux_detect_core_clusters_by_heuristic(
  *   - Processors assigned to these clusters stay assigned to the same clusters
  *   - No new processors are added to these clusters
  * - Processors without pre-assigned cluster are clustered in one sequential scan:
- *   - If known details (min/max frequency, MIDR components) of a processor are compatible with a preceeding
+ *   - If known details (min/max frequency, capacity, MIDR components) of a processor are compatible with a preceeding
  *     processor, without pre-assigned cluster, the processor is assigned to the cluster of the preceeding processor.
- *   - If known details (min/max frequency, MIDR components) of a processor are not compatible with a preceeding
+ *   - If known details (min/max frequency, capacity, MIDR components) of a processor are not compatible with a preceeding
  *     processor, the processor is assigned to a newly created cluster.
  *
  * The function must be called after parsing OS-provided information on core clusters, and usually is called only
@@ -320,7 +446,7 @@ void cpuinfo_arm_linux_detect_core_clusters_by_sequential_scan(
 {
 	uint32_t cluster_flags = 0;
 	uint32_t cluster_processors = 0;
-	uint32_t cluster_start, cluster_midr, cluster_max_frequency, cluster_min_frequency;
+	uint32_t cluster_start, cluster_midr, cluster_max_frequency, cluster_min_frequency, cluster_capacity;
 	for (uint32_t i = 0; i < max_processors; i++) {
 		if ((processors[i].flags & (CPUINFO_LINUX_MASK_USABLE | CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER)) == CPUINFO_LINUX_MASK_USABLE) {
 			if (cluster_processors == 0) {
@@ -357,6 +483,21 @@ void cpuinfo_arm_linux_detect_core_clusters_by_sequential_scan(
 				}
 			}
 
+			if (processors[i].flags & CPUINFO_LINUX_FLAG_CAPACITY) {
+				if (cluster_flags & CPUINFO_LINUX_FLAG_CAPACITY) {
+					if (cluster_capacity != processors[i].capacity) {
+						cpuinfo_log_debug(
+							"capacity of processor %"PRIu32" (%"PRIu32") is different than of preceeding cluster (%"PRIu32"); "
+							"processor %"PRIu32" starts a new cluster",
+							i, processors[i].capacity, cluster_capacity, i);
+						goto new_cluster;
+					}
+				} else {
+					cluster_capacity = processors[i].capacity;
+					cluster_flags |= CPUINFO_LINUX_FLAG_CAPACITY;
+				}
+			}
+
 			if (processors[i].flags & CPUINFO_ARM_LINUX_VALID_IMPLEMENTER) {
 				if (cluster_flags & CPUINFO_ARM_LINUX_VALID_IMPLEMENTER) {
 					if ((cluster_midr & CPUINFO_ARM_MIDR_IMPLEMENTER_MASK) != (processors[i].midr & CPUINFO_ARM_MIDR_IMPLEMENTER_MASK)) {
@@ -441,6 +582,10 @@ new_cluster:
 				cluster_max_frequency = processors[i].max_frequency;
 				cluster_flags |= CPUINFO_LINUX_FLAG_MAX_FREQUENCY;
 			}
+			if (processors[i].flags & CPUINFO_LINUX_FLAG_CAPACITY) {
+				cluster_capacity = processors[i].capacity;
+				cluster_flags |= CPUINFO_LINUX_FLAG_CAPACITY;
+			}
 			if (processors[i].flags & CPUINFO_ARM_LINUX_VALID_IMPLEMENTER) {
 				cluster_midr = midr_copy_implementer(cluster_midr, processors[i].midr);
 				cluster_flags |= CPUINFO_ARM_LINUX_VALID_IMPLEMENTER;
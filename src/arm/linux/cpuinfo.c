@@ -93,6 +93,14 @@ static uint32_t parse_processor_number(
  *  * sha2 - SHA2 instructions.
  *  * crc32 - CRC32 instructions.
  *
+ *	AArch64 kernels additionally report features from AT_HWCAP and AT_HWCAP2, including:
+ *
+ *  * asimddp - SDOT/UDOT dot product instructions.
+ *  * asimdfhm - FMLAL/FMLSL half-precision multiply-accumulate instructions.
+ *  * sve, sve2 - Scalable Vector Extension and its second version.
+ *  * i8mm, svei8mm - Int8 matrix multiplication instructions (SMMLA, UMMLA, USMMLA) in NEON and SVE.
+ *  * bf16, svebf16 - BFloat16 instructions (BFDOT, BFMMLA, BFCVT) in NEON and SVE.
+ *
  *	/proc/cpuinfo on ARM is populated in file arch/arm/kernel/setup.c in Linux kernel
  *	Note that some devices may use patched Linux kernels with different feature names.
  *	However, the names above were checked on a large number of /proc/cpuinfo listings.
@@ -123,6 +131,10 @@ static void parse_features(
 #if CPUINFO_ARCH_ARM64
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_FP;
 #endif
+#if CPUINFO_ARCH_ARM64
+				} else if (memcmp(feature_start, "sb", feature_length) == 0) {
+					processor->features |= CPUINFO_ARM_LINUX_FEATURE_SB;
+#endif
 #if CPUINFO_ARCH_ARM
 				} else if (memcmp(feature_start, "wp", feature_length) == 0) {
 					/*
@@ -142,6 +154,34 @@ static void parse_features(
 					#elif CPUINFO_ARCH_ARM64
 						processor->features |= CPUINFO_ARM_LINUX_FEATURE_AES;
 					#endif
+				} else if (memcmp(feature_start, "sm3", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_SM3;
+					#endif
+				} else if (memcmp(feature_start, "sm4", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_SM4;
+					#endif
+				} else if (memcmp(feature_start, "sve", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_SVE;
+					#endif
+				} else if (memcmp(feature_start, "dit", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_DIT;
+					#endif
+				} else if (memcmp(feature_start, "dgh", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_DGH;
+					#endif
+				} else if (memcmp(feature_start, "rng", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_RNG;
+					#endif
+				} else if (memcmp(feature_start, "bti", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_BTI;
+					#endif
 #if CPUINFO_ARCH_ARM
 				} else if (memcmp(feature_start, "swp", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_SWP;
@@ -177,6 +217,34 @@ static void parse_features(
 					#if CPUINFO_ARCH_ARM64
 						processor->features |= CPUINFO_ARM_LINUX_FEATURE_FCMA;
 					#endif
+				} else if (memcmp(feature_start, "sha3", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_SHA3;
+					#endif
+				} else if (memcmp(feature_start, "ssbs", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_SSBS;
+					#endif
+				} else if (memcmp(feature_start, "paca", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_PACA;
+					#endif
+				} else if (memcmp(feature_start, "pacg", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_PACG;
+					#endif
+				} else if (memcmp(feature_start, "sve2", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVE2;
+					#endif
+				} else if (memcmp(feature_start, "i8mm", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_I8MM;
+					#endif
+				} else if (memcmp(feature_start, "bf16", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_BF16;
+					#endif
 #if CPUINFO_ARCH_ARM
 				} else if (memcmp(feature_start, "half", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_HALF;
@@ -228,6 +296,22 @@ static void parse_features(
 					#if CPUINFO_ARCH_ARM64
 						processor->features |= CPUINFO_ARM_LINUX_FEATURE_LRCPC;
 					#endif
+				} else if (memcmp(feature_start, "dcpop", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_DCPOP;
+					#endif
+				} else if (memcmp(feature_start, "uscat", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_USCAT;
+					#endif
+				} else if (memcmp(feature_start, "flagm", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_FLAGM;
+					#endif
+				} else if (memcmp(feature_start, "frint", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_FRINT;
+					#endif
 #if CPUINFO_ARCH_ARM
 				} else if (memcmp(feature_start, "thumb", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_THUMB;
@@ -246,19 +330,32 @@ static void parse_features(
 					goto unexpected;
 				}
  				break;
-#if CPUINFO_ARCH_ARM
 			case 6:
+#if CPUINFO_ARCH_ARM
 				if (memcmp(feature_start, "iwmmxt", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_IWMMXT;
 				} else if (memcmp(feature_start, "crunch", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_CRUNCH;
 				} else if (memcmp(feature_start, "vfpd32", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_VFPD32;
+#elif CPUINFO_ARCH_ARM64
+				if (memcmp(feature_start, "sha512", feature_length) == 0) {
+					processor->features |= CPUINFO_ARM_LINUX_FEATURE_SHA512;
+				} else if (memcmp(feature_start, "ilrcpc", feature_length) == 0) {
+					processor->features |= CPUINFO_ARM_LINUX_FEATURE_ILRCPC;
+				} else if (memcmp(feature_start, "dcpodp", feature_length) == 0) {
+					processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_DCPODP;
+				} else if (memcmp(feature_start, "sveaes", feature_length) == 0) {
+					processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEAES;
+				} else if (memcmp(feature_start, "svesm4", feature_length) == 0) {
+					processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVESM4;
+				} else if (memcmp(feature_start, "flagm2", feature_length) == 0) {
+					processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_FLAGM2;
+#endif
 				} else {
 					goto unexpected;
 				}
 				break;
-#endif /* CPUINFO_ARCH_ARM */
 			case 7:
 				if (memcmp(feature_start, "evtstrm", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_EVTSTRM;
@@ -270,6 +367,22 @@ static void parse_features(
 					#if CPUINFO_ARCH_ARM64
 						processor->features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDHP;
 					#endif
+				} else if (memcmp(feature_start, "asimddp", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDDP;
+					#endif
+				} else if (memcmp(feature_start, "svesha3", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVESHA3;
+					#endif
+				} else if (memcmp(feature_start, "svei8mm", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM;
+					#endif
+				} else if (memcmp(feature_start, "svebf16", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEBF16;
+					#endif
 #if CPUINFO_ARCH_ARM
 				} else if (memcmp(feature_start, "thumbee", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_THUMBEE;
@@ -283,6 +396,22 @@ static void parse_features(
 					#if CPUINFO_ARCH_ARM64
 						processor->features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDRDM;
 					#endif
+				} else if (memcmp(feature_start, "asimdfhm", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDFHM;
+					#endif
+				} else if (memcmp(feature_start, "svepmull", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEPMULL;
+					#endif
+				} else if (memcmp(feature_start, "svef32mm", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEF32MM;
+					#endif
+				} else if (memcmp(feature_start, "svef64mm", feature_length) == 0) {
+					#if CPUINFO_ARCH_ARM64
+						processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEF64MM;
+					#endif
 #if CPUINFO_ARCH_ARM
 				} else if (memcmp(feature_start, "fastmult", feature_length) == 0) {
 					processor->features |= CPUINFO_ARM_LINUX_FEATURE_FASTMULT;
@@ -293,6 +422,15 @@ static void parse_features(
 					goto unexpected;
 				}
 				break;
+#if CPUINFO_ARCH_ARM64
+			case 10:
+				if (memcmp(feature_start, "svebitperm", feature_length) == 0) {
+					processor->features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEBITPERM;
+				} else {
+					goto unexpected;
+				}
+				break;
+#endif /* CPUINFO_ARCH_ARM64 */
 			default:
 			unexpected:
 				cpuinfo_log_warning("unexpected /proc/cpuinfo feature \"%.*s\" is ignored",
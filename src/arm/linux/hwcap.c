@@ -21,19 +21,33 @@
 	#define AT_HWCAP 16
 	#define AT_HWCAP2 26
 #endif
+#ifndef AT_HWCAP2
+	/* Old versions of <sys/auxv.h> do not define AT_HWCAP2 */
+	#define AT_HWCAP2 26
+#endif
 
 
 #if CPUINFO_MOCK
-	static uint32_t mock_hwcap = 0;
-	void cpuinfo_set_hwcap(uint32_t hwcap) {
-		mock_hwcap = hwcap;
-	}
-
 	#if CPUINFO_ARCH_ARM
+		static uint32_t mock_hwcap = 0;
+		void cpuinfo_set_hwcap(uint32_t hwcap) {
+			mock_hwcap = hwcap;
+		}
+
 		static uint32_t mock_hwcap2 = 0;
 		void cpuinfo_set_hwcap2(uint32_t hwcap2) {
 			mock_hwcap2 = hwcap2;
 		}
+	#elif CPUINFO_ARCH_ARM64
+		static uint64_t mock_hwcap = 0;
+		void cpuinfo_set_hwcap(uint64_t hwcap) {
+			mock_hwcap = hwcap;
+		}
+
+		static uint64_t mock_hwcap2 = 0;
+		void cpuinfo_set_hwcap2(uint64_t hwcap2) {
+			mock_hwcap2 = hwcap2;
+		}
 	#endif
 #endif
 
@@ -145,11 +159,17 @@
 		}
 	#endif /* __ANDROID__ */
 #elif CPUINFO_ARCH_ARM64
-	uint32_t cpuinfo_arm_linux_hwcap_from_getauxval(void) {
+	void cpuinfo_arm_linux_hwcap_from_getauxval(
+		uint64_t hwcap[restrict static 1],
+		uint64_t hwcap2[restrict static 1])
+	{
 		#if CPUINFO_MOCK
-			return mock_hwcap;
+			*hwcap  = mock_hwcap;
+			*hwcap2 = mock_hwcap2;
 		#else
-			return (uint32_t) getauxval(AT_HWCAP);
+			/* On AArch64 unsigned long is 64-bit: keep the high bits of HWCAP, used by recent kernels */
+			*hwcap  = (uint64_t) getauxval(AT_HWCAP);
+			*hwcap2 = (uint64_t) getauxval(AT_HWCAP2);
 		#endif
 	}
 #endif
@@ -18,7 +18,16 @@
 
 struct cpuinfo_arm_isa cpuinfo_isa = { 0 };
 
-static struct cpuinfo_package package = { { 0 } };
+/* Cache hierarchy of a core, as reported by the kernel in /sys/devices/system/cpu/cpu<N>/cache */
+struct sysfs_core_caches {
+	struct cpuinfo_cache l1i;
+	struct cpuinfo_cache l1d;
+	struct cpuinfo_cache l2;
+	struct cpuinfo_cache l3;
+	/* Minimum Linux processor ID among processors sharing the L2/L3 cache */
+	uint32_t l2_leader_id;
+	uint32_t l3_leader_id;
+};
 
 static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
 	return (bitfield & mask) == mask;
@@ -32,12 +41,35 @@ static inline int cmp(uint32_t a, uint32_t b) {
 	return (a > b) - (a < b);
 }
 
+/*
+ * Topology groups (cores and clusters) are tracked with union-find: package_leader_id and core_leader_id link each
+ * processor to another processor in the same group, and the root of a group is its minimum processor ID.
+ */
+static uint32_t find_package_leader(struct cpuinfo_arm_linux_processor* processors, uint32_t processor) {
+	while (processors[processor].package_leader_id != processor) {
+		/* Path halving */
+		const uint32_t parent = processors[processor].package_leader_id;
+		processors[processor].package_leader_id = processors[parent].package_leader_id;
+		processor = parent;
+	}
+	return processor;
+}
+
+static uint32_t find_core_leader(struct cpuinfo_arm_linux_processor* processors, uint32_t processor) {
+	while (processors[processor].core_leader_id != processor) {
+		const uint32_t parent = processors[processor].core_leader_id;
+		processors[processor].core_leader_id = processors[parent].core_leader_id;
+		processor = parent;
+	}
+	return processor;
+}
+
 static bool cluster_siblings_parser(
 	uint32_t processor, uint32_t siblings_start, uint32_t siblings_end,
 	struct cpuinfo_arm_linux_processor* processors)
 {
 	processors[processor].flags |= CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER;
-	uint32_t package_leader_id = processors[processor].package_leader_id;
+	uint32_t package_leader_id = find_package_leader(processors, processor);
 
 	for (uint32_t sibling = siblings_start; sibling < siblings_end; sibling++) {
 		if (!bitmask_all(processors[sibling].flags, CPUINFO_LINUX_MASK_USABLE)) {
@@ -46,20 +78,211 @@ static bool cluster_siblings_parser(
 			continue;
 		}
 
-		const uint32_t sibling_package_leader_id = processors[sibling].package_leader_id;
+		const uint32_t sibling_package_leader_id = find_package_leader(processors, sibling);
 		if (sibling_package_leader_id < package_leader_id) {
+			processors[package_leader_id].package_leader_id = sibling_package_leader_id;
 			package_leader_id = sibling_package_leader_id;
+		} else {
+			processors[sibling_package_leader_id].package_leader_id = package_leader_id;
 		}
-
-		processors[sibling].package_leader_id = package_leader_id;
 		processors[sibling].flags |= CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER;
 	}
 
-	processors[processor].package_leader_id = package_leader_id;
+	return true;
+}
+
+static bool core_siblings_parser(
+	uint32_t processor, uint32_t siblings_start, uint32_t siblings_end,
+	struct cpuinfo_arm_linux_processor* processors)
+{
+	processors[processor].flags |= CPUINFO_LINUX_FLAG_SMT_CLUSTER;
+	uint32_t core_leader_id = find_core_leader(processors, processor);
+
+	for (uint32_t sibling = siblings_start; sibling < siblings_end; sibling++) {
+		if (!bitmask_all(processors[sibling].flags, CPUINFO_LINUX_MASK_USABLE)) {
+			cpuinfo_log_info("invalid processor %"PRIu32" reported as a thread sibling for processor %"PRIu32,
+				sibling, processor);
+			continue;
+		}
+
+		const uint32_t sibling_core_leader_id = find_core_leader(processors, sibling);
+		if (sibling_core_leader_id < core_leader_id) {
+			processors[core_leader_id].core_leader_id = sibling_core_leader_id;
+			core_leader_id = sibling_core_leader_id;
+		} else {
+			processors[sibling_core_leader_id].core_leader_id = core_leader_id;
+		}
+		processors[sibling].flags |= CPUINFO_LINUX_FLAG_SMT_CLUSTER;
+	}
 
 	return true;
 }
 
+struct l2_siblings_context {
+	struct cpuinfo_arm_linux_processor* processors;
+	uint32_t core_leader_id;
+	bool shared_between_cores;
+};
+
+static bool l2_siblings_parser(
+	uint32_t processor, uint32_t siblings_start, uint32_t siblings_end,
+	struct l2_siblings_context* context)
+{
+	for (uint32_t sibling = siblings_start; sibling < siblings_end; sibling++) {
+		if (find_core_leader(context->processors, sibling) != context->core_leader_id) {
+			context->shared_between_cores = true;
+		}
+	}
+	return true;
+}
+
+/*
+ * Detects cluster siblings of a processor from the list of processors sharing its L2 cache, as in big.LITTLE SoCs where
+ * each cluster has a shared L2 cache. L2 caches private to a core (e.g. in DynamIQ clusters) do not describe clusters,
+ * and are ignored.
+ */
+static bool detect_l2_cluster_siblings(
+	uint32_t max_processors_count,
+	uint32_t processor,
+	struct cpuinfo_arm_linux_processor* processors)
+{
+	struct cpuinfo_cache l2;
+	uint32_t l2_index;
+	if (!cpuinfo_linux_get_processor_cache(processor, 2, cpuinfo_linux_cache_type_unified, &l2, &l2_index)) {
+		return false;
+	}
+
+	struct l2_siblings_context context = {
+		.processors = processors,
+		.core_leader_id = find_core_leader(processors, processor),
+	};
+	if (!cpuinfo_linux_detect_cache_siblings(max_processors_count, processor, l2_index,
+		(cpuinfo_siblings_callback) l2_siblings_parser, &context))
+	{
+		return false;
+	}
+	if (!context.shared_between_cores) {
+		return false;
+	}
+
+	return cpuinfo_linux_detect_cache_siblings(max_processors_count, processor, l2_index,
+		(cpuinfo_siblings_callback) cluster_siblings_parser, processors);
+}
+
+static inline bool same_package(
+	const struct cpuinfo_arm_linux_processor a[restrict static 1],
+	const struct cpuinfo_arm_linux_processor b[restrict static 1])
+{
+	return a->package_id == b->package_id;
+}
+
+static inline bool same_cluster(
+	const struct cpuinfo_arm_linux_processor a[restrict static 1],
+	const struct cpuinfo_arm_linux_processor b[restrict static 1])
+{
+	return same_package(a, b) && a->package_leader_id == b->package_leader_id;
+}
+
+static inline bool same_core(
+	const struct cpuinfo_arm_linux_processor a[restrict static 1],
+	const struct cpuinfo_arm_linux_processor b[restrict static 1])
+{
+	return same_cluster(a, b) && a->core_leader_id == b->core_leader_id;
+}
+
+#if !defined(__ANDROID__)
+static bool cache_leader_parser(
+	uint32_t processor, uint32_t siblings_start, uint32_t siblings_end,
+	uint32_t leader_id[restrict static 1])
+{
+	if (siblings_start < siblings_end) {
+		*leader_id = min(*leader_id, siblings_start);
+	}
+	return true;
+}
+
+/*
+ * Reads cache hierarchy of every core from sysfs.
+ *
+ * @param max_processors_count - number of elements in the @p processors array.
+ * @param usable_processors - number of usable processors at the start of the sorted @p processors array.
+ * @param[in] processors - sorted logical processor descriptions.
+ * @param[out] core_caches - cache descriptions for every core, in the order of cores in the @p processors array.
+ * @param[out] l2_count_ptr - number of distinct L2 cache instances.
+ * @param[out] l3_count_ptr - number of distinct L3 cache instances, or 0 if L3 is not reported for all cores.
+ *
+ * @returns true if L1I, L1D, and L2 caches, and their sharing, are reported for all cores, and processors sharing
+ *          each cache are adjacent in the @p processors array; false otherwise.
+ */
+static bool detect_sysfs_caches(
+	uint32_t max_processors_count,
+	uint32_t usable_processors,
+	const struct cpuinfo_arm_linux_processor processors[restrict static max_processors_count],
+	struct sysfs_core_caches core_caches[restrict static 1],
+	uint32_t l2_count_ptr[restrict static 1],
+	uint32_t l3_count_ptr[restrict static 1])
+{
+	uint32_t core_id = 0, l2_count = 0, l3_count = 0;
+	bool l3_reported = true, l2_leader_found = true, l3_leader_found = true;
+	for (uint32_t i = 0; i < usable_processors; i++) {
+		if (i != 0 && same_core(&processors[i], &processors[i - 1])) {
+			continue;
+		}
+
+		struct sysfs_core_caches* caches = &core_caches[core_id];
+		const uint32_t processor = processors[i].system_processor_id;
+		uint32_t l1i_index, l1d_index, l2_index, l3_index;
+		if (!cpuinfo_linux_get_processor_cache(processor, 1, cpuinfo_linux_cache_type_instruction, &caches->l1i, &l1i_index) ||
+			!cpuinfo_linux_get_processor_cache(processor, 1, cpuinfo_linux_cache_type_data, &caches->l1d, &l1d_index) ||
+			!cpuinfo_linux_get_processor_cache(processor, 2, cpuinfo_linux_cache_type_unified, &caches->l2, &l2_index))
+		{
+			return false;
+		}
+
+		caches->l2_leader_id = processor;
+		if (!cpuinfo_linux_detect_cache_siblings(max_processors_count, processor, l2_index,
+			(cpuinfo_siblings_callback) cache_leader_parser, &caches->l2_leader_id))
+		{
+			return false;
+		}
+		/* A cache instance starts at the core which follows a core with a different cache */
+		if (core_id == 0 || caches->l2_leader_id != core_caches[core_id - 1].l2_leader_id) {
+			if (!l2_leader_found) {
+				cpuinfo_log_info("processors sharing L2 cache with processor %"PRIu32" are not adjacent",
+					core_caches[core_id - 1].l2_leader_id);
+				return false;
+			}
+			l2_leader_found = false;
+			l2_count += 1;
+		}
+		l2_leader_found |= caches->l2_leader_id == processor;
+
+		if (l3_reported) {
+			caches->l3_leader_id = processor;
+			l3_reported =
+				cpuinfo_linux_get_processor_cache(processor, 3, cpuinfo_linux_cache_type_unified, &caches->l3, &l3_index) &&
+				cpuinfo_linux_detect_cache_siblings(max_processors_count, processor, l3_index,
+					(cpuinfo_siblings_callback) cache_leader_parser, &caches->l3_leader_id);
+			if (core_id == 0 || caches->l3_leader_id != core_caches[core_id - 1].l3_leader_id) {
+				l3_reported &= l3_leader_found;
+				l3_leader_found = false;
+				l3_count += 1;
+			}
+			l3_leader_found |= caches->l3_leader_id == processor;
+		}
+		core_id += 1;
+	}
+
+	/* The leader of the last cache instance must be found among its processors */
+	if (!l2_leader_found) {
+		return false;
+	}
+	*l2_count_ptr = l2_count;
+	*l3_count_ptr = l3_reported && l3_leader_found ? l3_count : 0;
+	return true;
+}
+#endif
+
 static int cmp_arm_linux_processor(const void* ptr_a, const void* ptr_b) {
 	const struct cpuinfo_arm_linux_processor* processor_a = (const struct cpuinfo_arm_linux_processor*) ptr_a;
 	const struct cpuinfo_arm_linux_processor* processor_b = (const struct cpuinfo_arm_linux_processor*) ptr_b;
@@ -71,6 +294,22 @@ static int cmp_arm_linux_processor(const void* ptr_a, const void* ptr_b) {
 		return (int) usable_b - (int) usable_a;
 	}
 
+	/* Compare based on physical package (i.e. package 0 < package 1) */
+	const uint32_t package_a = processor_a->package_id;
+	const uint32_t package_b = processor_b->package_id;
+	if (package_a != package_b) {
+		return cmp(package_a, package_b);
+	}
+
+	/* Compare based on capacity reported by the kernel (e.g. 1024 < 448) */
+	if (bitmask_all(processor_a->flags & processor_b->flags, CPUINFO_LINUX_FLAG_CAPACITY)) {
+		const uint32_t capacity_a = processor_a->capacity;
+		const uint32_t capacity_b = processor_b->capacity;
+		if (capacity_a != capacity_b) {
+			return capacity_a > capacity_b ? -1 : 1;
+		}
+	}
+
 	/* Compare based on core type (e.g. Cortex-A57 < Cortex-A53) */
 	const uint32_t midr_a = processor_a->midr;
 	const uint32_t midr_b = processor_b->midr;
@@ -89,13 +328,27 @@ static int cmp_arm_linux_processor(const void* ptr_a, const void* ptr_b) {
 		return frequency_a > frequency_b ? -1 : 1;
 	}
 
-	/* Compare based on cluster leader id (i.e. cluster 1 < cluster 0) */
+	/*
+	 * Compare based on cluster leader id:
+	 * - clusters reported in topology/cluster_id by the firmware follow the system order (i.e. cluster 0 < cluster 1)
+	 * - clusters inferred from package siblings on mobile SoCs list the big cluster last (i.e. cluster 1 < cluster 0)
+	 */
 	const uint32_t cluster_a = processor_a->package_leader_id;
 	const uint32_t cluster_b = processor_b->package_leader_id;
 	if (cluster_a != cluster_b) {
+		if (bitmask_all(processor_a->flags & processor_b->flags, CPUINFO_LINUX_FLAG_CLUSTER_ID)) {
+			return cmp(cluster_a, cluster_b);
+		}
 		return cluster_a > cluster_b ? -1 : 1;
 	}
 
+	/* Compare based on core leader id (i.e. hardware threads of the same core are adjacent) */
+	const uint32_t core_a = processor_a->core_leader_id;
+	const uint32_t core_b = processor_b->core_leader_id;
+	if (core_a != core_b) {
+		return cmp(core_a, core_b);
+	}
+
 	/* Compare based on system processor id (i.e. processor 0 < processor 1) */
 	const uint32_t id_a = processor_a->system_processor_id;
 	const uint32_t id_b = processor_b->system_processor_id;
@@ -107,11 +360,15 @@ void cpuinfo_arm_linux_init(void) {
 	struct cpuinfo_processor* processors = NULL;
 	struct cpuinfo_core* cores = NULL;
 	struct cpuinfo_cluster* clusters = NULL;
+	struct cpuinfo_package* packages = NULL;
 	const struct cpuinfo_processor** linux_cpu_to_processor_map = NULL;
 	const struct cpuinfo_core** linux_cpu_to_core_map = NULL;
 	struct cpuinfo_cache* l1i = NULL;
 	struct cpuinfo_cache* l1d = NULL;
 	struct cpuinfo_cache* l2 = NULL;
+	struct cpuinfo_cache* l3 = NULL;
+	struct cpuinfo_arm_isa* cluster_isa = NULL;
+	struct sysfs_core_caches* core_caches = NULL;
 
 	const uint32_t max_processors_count = cpuinfo_linux_get_max_processors_count();
 	cpuinfo_log_debug("system maximum processors count: %"PRIu32, max_processors_count);
@@ -251,11 +508,12 @@ void cpuinfo_arm_linux_init(void) {
 			&cpuinfo_isa);
 	#elif CPUINFO_ARCH_ARM64
 		/* getauxval is always available on ARM64 Android */
-		const uint32_t isa_features = cpuinfo_arm_linux_hwcap_from_getauxval();
-		cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(isa_features, &cpuinfo_isa);
+		uint64_t isa_features = 0, isa_features2 = 0;
+		cpuinfo_arm_linux_hwcap_from_getauxval(&isa_features, &isa_features2);
+		cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(isa_features, isa_features2, &cpuinfo_isa);
 	#endif
 
-	/* Detect min/max frequency and package ID */
+	/* Detect min/max frequency, package ID, cluster ID, and capacity */
 	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
 		if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
 			const uint32_t max_frequency = cpuinfo_linux_get_processor_max_frequency(i);
@@ -273,25 +531,90 @@ void cpuinfo_arm_linux_init(void) {
 			if (cpuinfo_linux_get_processor_package_id(i, &arm_linux_processors[i].package_id)) {
 				arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_PACKAGE_ID;
 			}
+
+			if (cpuinfo_linux_get_processor_cluster_id(i, &arm_linux_processors[i].cluster_id)) {
+				arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_CLUSTER_ID;
+			}
+
+			const uint32_t capacity = cpuinfo_linux_get_processor_capacity(i);
+			if (capacity != 0) {
+				arm_linux_processors[i].capacity = capacity;
+				arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_CAPACITY;
+			}
 		}
 	}
 
 	/* Initialize topology group IDs */
 	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
 		arm_linux_processors[i].package_leader_id = i;
+		arm_linux_processors[i].core_leader_id = i;
 	}
 
-	/* Propagate topology group IDs among siblings */
+	/*
+	 * Propagate topology group IDs among siblings:
+	 * - Hardware threads of a core are listed in thread_siblings_list.
+	 * - Core clusters are listed in cluster_cpus_list if the firmware describes clusters (Linux 5.16+),
+	 *   otherwise in core_siblings_list, which on device-tree based kernels reports the cluster.
+	 * - If neither list is available, processors sharing an L2 cache between cores form a cluster.
+	 * All processors of a group report the same list, so each distinct list is parsed only once.
+	 */
+	struct cpuinfo_linux_cpulist_cache thread_siblings_cache, cluster_siblings_cache, core_siblings_cache;
+	bool siblings_caches_initialized =
+		cpuinfo_linux_cpulist_cache_init(&thread_siblings_cache, arm_linux_processors_count);
+	siblings_caches_initialized &=
+		cpuinfo_linux_cpulist_cache_init(&cluster_siblings_cache, arm_linux_processors_count);
+	siblings_caches_initialized &=
+		cpuinfo_linux_cpulist_cache_init(&core_siblings_cache, arm_linux_processors_count);
+	if (!siblings_caches_initialized) {
+		/* Without the caches, every processor would parse the full list of its group: quadratic time */
+		cpuinfo_linux_cpulist_cache_release(&thread_siblings_cache);
+		cpuinfo_linux_cpulist_cache_release(&cluster_siblings_cache);
+		cpuinfo_linux_cpulist_cache_release(&core_siblings_cache);
+		goto cleanup;
+	}
 	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
 		if (!bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
 			continue;
 		}
 
+		cpuinfo_linux_detect_thread_siblings(
+			arm_linux_processors_count, i, &thread_siblings_cache,
+			(cpuinfo_siblings_callback) core_siblings_parser,
+			arm_linux_processors);
+
+		if (arm_linux_processors[i].flags & CPUINFO_LINUX_FLAG_CLUSTER_ID) {
+			if (cpuinfo_linux_detect_cluster_siblings(
+				arm_linux_processors_count, i, &cluster_siblings_cache,
+				(cpuinfo_siblings_callback) cluster_siblings_parser,
+				arm_linux_processors))
+			{
+				continue;
+			}
+			arm_linux_processors[i].flags &= ~CPUINFO_LINUX_FLAG_CLUSTER_ID;
+		}
+
 		if (arm_linux_processors[i].flags & CPUINFO_LINUX_FLAG_PACKAGE_ID) {
-			cpuinfo_linux_detect_core_siblings(
-				arm_linux_processors_count, i,
+			if (cpuinfo_linux_detect_core_siblings(
+				arm_linux_processors_count, i, &core_siblings_cache,
 				(cpuinfo_siblings_callback) cluster_siblings_parser,
-				arm_linux_processors);
+				arm_linux_processors))
+			{
+				continue;
+			}
+		}
+
+		if (!(arm_linux_processors[i].flags & CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER)) {
+			detect_l2_cluster_siblings(arm_linux_processors_count, i, arm_linux_processors);
+		}
+	}
+	cpuinfo_linux_cpulist_cache_release(&thread_siblings_cache);
+	cpuinfo_linux_cpulist_cache_release(&cluster_siblings_cache);
+	cpuinfo_linux_cpulist_cache_release(&core_siblings_cache);
+
+	/* Propagate all core IDs */
+	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
+		if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE | CPUINFO_LINUX_FLAG_SMT_CLUSTER)) {
+			arm_linux_processors[i].core_leader_id = find_core_leader(arm_linux_processors, i);
 		}
 	}
 
@@ -301,16 +624,21 @@ void cpuinfo_arm_linux_init(void) {
 		if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE | CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER)) {
 			clustered_processors += 1;
 
-			const uint32_t package_leader_id = arm_linux_processors[i].package_leader_id;
-			if (package_leader_id < i) {
-				arm_linux_processors[i].package_leader_id = arm_linux_processors[package_leader_id].package_leader_id;
-			}
+			arm_linux_processors[i].package_leader_id = find_package_leader(arm_linux_processors, i);
 
 			cpuinfo_log_debug("processor %"PRIu32" clustered with processor %"PRIu32" as inferred from system siblings lists",
 				i, arm_linux_processors[i].package_leader_id);
 		}
 	}
 
+	/*
+	 * Split clusters of cores with different capacity, e.g. cores of different types in one DynamIQ cluster.
+	 * If all processors report capacity, this also assigns processors without siblings information to clusters.
+	 */
+	if (cpuinfo_arm_linux_detect_core_clusters_by_capacity(arm_linux_processors_count, arm_linux_processors)) {
+		clustered_processors = usable_processors;
+	}
+
 	if (clustered_processors != usable_processors) {
 		/*
 		 * Topology information about some or all logical processors may be unavailable, for the following reasons:
@@ -338,7 +666,7 @@ void cpuinfo_arm_linux_init(void) {
 	};
 #endif
 
-	const uint32_t cluster_count = cpuinfo_arm_linux_detect_cluster_midr(
+	cpuinfo_arm_linux_detect_cluster_midr(
 		&chipset,
 		arm_linux_processors_count, usable_processors, arm_linux_processors);
 
@@ -374,6 +702,47 @@ void cpuinfo_arm_linux_init(void) {
 		}
 	}
 
+	/*
+	 * Detect physical packages.
+	 * Device-tree based kernels before Linux 5.x report cluster ID as physical_package_id, and mobile SoCs always
+	 * consist of a single package. Thus, different package IDs are considered to denote different sockets only if
+	 * all processors report package ID, and all processors have the same MIDR and maximum frequency, as processors
+	 * in multi-socket servers do. Otherwise, all processors are assigned to a single package.
+	 */
+	bool multiple_packages = false;
+	#if !defined(__ANDROID__)
+		bool valid_package_ids = true;
+		uint32_t first_processor = arm_linux_processors_count;
+		for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
+			if (!bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
+				continue;
+			}
+			if (!(arm_linux_processors[i].flags & CPUINFO_LINUX_FLAG_PACKAGE_ID)) {
+				valid_package_ids = false;
+				break;
+			}
+			if (first_processor == arm_linux_processors_count) {
+				first_processor = i;
+				continue;
+			}
+			if (arm_linux_processors[i].midr != arm_linux_processors[first_processor].midr ||
+				arm_linux_processors[i].max_frequency != arm_linux_processors[first_processor].max_frequency)
+			{
+				valid_package_ids = false;
+				break;
+			}
+			if (arm_linux_processors[i].package_id != arm_linux_processors[first_processor].package_id) {
+				multiple_packages = true;
+			}
+		}
+		multiple_packages &= valid_package_ids;
+	#endif
+	if (!multiple_packages) {
+		for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
+			arm_linux_processors[i].package_id = 0;
+		}
+	}
+
 	qsort(arm_linux_processors, arm_linux_processors_count,
 		sizeof(struct cpuinfo_arm_linux_processor), cmp_arm_linux_processor);
 
@@ -384,16 +753,47 @@ void cpuinfo_arm_linux_init(void) {
 		}
 	}
 
-	/*
-	 * Assumptions:
-	 * - No SMP (i.e. each core supports only one hardware thread).
-	 * - Level 1 instruction and data caches are private to the core clusters.
-	 * - Level 2 cache is shared between cores in the same cluster.
-	 */
-	cpuinfo_arm_chipset_to_string(&chipset, package.name);
-	package.processor_count = usable_processors;
-	package.core_count = usable_processors;
-	package.cluster_count = cluster_count;
+	/* Count packages, clusters, and cores: after sorting, logical processors of each of them are adjacent */
+	uint32_t package_count = 0, cluster_count = 0, core_count = 0;
+	for (uint32_t i = 0; i < usable_processors; i++) {
+		const struct cpuinfo_arm_linux_processor* processor = &arm_linux_processors[i];
+		const struct cpuinfo_arm_linux_processor* previous = &arm_linux_processors[i == 0 ? 0 : i - 1];
+		if (i == 0 || !same_package(processor, previous)) {
+			package_count += 1;
+		}
+		if (i == 0 || !same_cluster(processor, previous)) {
+			cluster_count += 1;
+		}
+		if (i == 0 || !same_core(processor, previous)) {
+			core_count += 1;
+		}
+	}
+	cpuinfo_log_debug("detected %"PRIu32" packages, %"PRIu32" clusters, and %"PRIu32" cores",
+		package_count, cluster_count, core_count);
+
+	uint32_t l2_count = cluster_count, l3_count = 0;
+	#if !defined(__ANDROID__)
+		/*
+		 * Android kernels often report incomplete or placeholder cache descriptions in sysfs, and the tabulated
+		 * cache parameters of mobile SoCs are more reliable. On other Linux systems, the cache hierarchy in sysfs
+		 * (as described by ACPI PPTT or device tree) is authoritative when it is complete for all cores.
+		 */
+		core_caches = calloc(core_count, sizeof(struct sysfs_core_caches));
+		if (core_caches == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for cache descriptions of %"PRIu32" cores",
+				core_count * sizeof(struct sysfs_core_caches), core_count);
+			goto cleanup;
+		}
+		if (!detect_sysfs_caches(arm_linux_processors_count, usable_processors, arm_linux_processors,
+			core_caches, &l2_count, &l3_count))
+		{
+			cpuinfo_log_info("cache hierarchy is not fully reported in sysfs: using tabulated cache parameters");
+			free(core_caches);
+			core_caches = NULL;
+			l2_count = cluster_count;
+			l3_count = 0;
+		}
+	#endif
 
 	processors = calloc(usable_processors, sizeof(struct cpuinfo_processor));
 	if (processors == NULL) {
@@ -402,10 +802,10 @@ void cpuinfo_arm_linux_init(void) {
 		goto cleanup;
 	}
 
-	cores = calloc(usable_processors, sizeof(struct cpuinfo_core));
+	cores = calloc(core_count, sizeof(struct cpuinfo_core));
 	if (cores == NULL) {
 		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" cores",
-			usable_processors * sizeof(struct cpuinfo_core), usable_processors);
+			core_count * sizeof(struct cpuinfo_core), core_count);
 		goto cleanup;
 	}
 
@@ -416,6 +816,13 @@ void cpuinfo_arm_linux_init(void) {
 		goto cleanup;
 	}
 
+	packages = calloc(package_count, sizeof(struct cpuinfo_package));
+	if (packages == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" physical packages",
+			package_count * sizeof(struct cpuinfo_package), package_count);
+		goto cleanup;
+	}
+
 	linux_cpu_to_processor_map = calloc(arm_linux_processors_count, sizeof(struct cpuinfo_processor*));
 	if (linux_cpu_to_processor_map == NULL) {
 		cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" logical processor mapping entries",
@@ -430,21 +837,20 @@ void cpuinfo_arm_linux_init(void) {
 		goto cleanup;
 	}
 
-	l1i = calloc(usable_processors, sizeof(struct cpuinfo_cache));
+	l1i = calloc(core_count, sizeof(struct cpuinfo_cache));
 	if (l1i == NULL) {
 		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1I caches",
-			usable_processors * sizeof(struct cpuinfo_cache), usable_processors);
+			core_count * sizeof(struct cpuinfo_cache), core_count);
 		goto cleanup;
 	}
 
-	l1d = calloc(usable_processors, sizeof(struct cpuinfo_cache));
+	l1d = calloc(core_count, sizeof(struct cpuinfo_cache));
 	if (l1d == NULL) {
 		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1D caches",
-			usable_processors * sizeof(struct cpuinfo_cache), usable_processors);
+			core_count * sizeof(struct cpuinfo_cache), core_count);
 		goto cleanup;
 	}
 
-	uint32_t l2_count = cluster_count;
 	l2 = calloc(l2_count, sizeof(struct cpuinfo_cache));
 	if (l2 == NULL) {
 		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L2 caches",
@@ -452,131 +858,255 @@ void cpuinfo_arm_linux_init(void) {
 		goto cleanup;
 	}
 
-	/* Populate cache infromation structures in l1i, l1d, and l2 */
-	uint32_t cluster_id = UINT32_MAX;
+	if (l3_count != 0) {
+		l3 = calloc(l3_count, sizeof(struct cpuinfo_cache));
+		if (l3 == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L3 caches",
+				l3_count * sizeof(struct cpuinfo_cache), l3_count);
+			goto cleanup;
+		}
+	}
+
+	/*
+	 * Populate processor, core, cluster, package, and cache information structures.
+	 * Without cache descriptions in sysfs, the following is assumed:
+	 * - Level 1 instruction and data caches are private to the core.
+	 * - Level 2 cache is shared between cores in the same cluster.
+	 */
+	uint32_t package_id = UINT32_MAX, cluster_id = UINT32_MAX, core_id = UINT32_MAX;
+	uint32_t l2_index = UINT32_MAX, l3_index = UINT32_MAX;
 	for (uint32_t i = 0; i < usable_processors; i++) {
-		if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
+		const struct cpuinfo_arm_linux_processor* processor = &arm_linux_processors[i];
+		const struct cpuinfo_arm_linux_processor* previous = &arm_linux_processors[i == 0 ? 0 : i - 1];
+		const bool new_package = i == 0 || !same_package(processor, previous);
+		const bool new_cluster = i == 0 || !same_cluster(processor, previous);
+		const bool new_core = i == 0 || !same_core(processor, previous);
+
+		if (new_package) {
+			package_id++;
+			cpuinfo_arm_chipset_to_string(&chipset, packages[package_id].name);
+			packages[package_id].processor_start = i;
+			packages[package_id].core_start = core_id + 1;
+			packages[package_id].cluster_start = cluster_id + 1;
+		}
+		struct cpuinfo_package* package = &packages[package_id];
+
+		if (new_cluster) {
 			cluster_id++;
+			clusters[cluster_id] = (struct cpuinfo_cluster) {
+				.processor_start = i,
+				.core_start = core_id + 1,
+				.cluster_id = cluster_id - package->cluster_start,
+				.package = package,
+				.vendor = processor->vendor,
+				.uarch = processor->uarch,
+				.midr = processor->midr,
+				.frequency = (uint64_t) processor->max_frequency * UINT64_C(1000),
+				.capacity = processor->capacity,
+			};
+			package->cluster_count += 1;
 		}
 
-		processors[i].smt_id = 0;
-		processors[i].core = cores + i;
+		if (new_core) {
+			core_id++;
+			cores[core_id] = (struct cpuinfo_core) {
+				.processor_start = i,
+				.core_id = core_id - package->core_start,
+				.cluster = clusters + cluster_id,
+				.package = package,
+				.vendor = processor->vendor,
+				.uarch = processor->uarch,
+				.midr = processor->midr,
+				.frequency = (uint64_t) processor->max_frequency * UINT64_C(1000),
+			};
+			clusters[cluster_id].core_count += 1;
+			package->core_count += 1;
+
+			if (core_caches != NULL) {
+				l1i[core_id] = core_caches[core_id].l1i;
+				l1d[core_id] = core_caches[core_id].l1d;
+				if (core_id == 0 || core_caches[core_id].l2_leader_id != core_caches[core_id - 1].l2_leader_id) {
+					l2[++l2_index] = core_caches[core_id].l2;
+					l2[l2_index].processor_start = i;
+				}
+				if (l3 != NULL &&
+					(core_id == 0 || core_caches[core_id].l3_leader_id != core_caches[core_id - 1].l3_leader_id))
+				{
+					l3[++l3_index] = core_caches[core_id].l3;
+					l3[l3_index].processor_start = i;
+				}
+			} else {
+				struct cpuinfo_cache shared_l2 = { 0 };
+				cpuinfo_arm_decode_cache(
+					processor->uarch,
+					processor->package_processor_count,
+					processor->midr,
+					&chipset,
+					cluster_id,
+					processor->architecture_version,
+					&l1i[core_id], &l1d[core_id], &shared_l2);
+				#if CPUINFO_ARCH_ARM
+					/* L1I reported in /proc/cpuinfo overrides defaults */
+					if (bitmask_all(processor->flags, CPUINFO_ARM_LINUX_VALID_ICACHE)) {
+						l1i[core_id] = (struct cpuinfo_cache) {
+							.size = processor->proc_cpuinfo_cache.i_size,
+							.associativity = processor->proc_cpuinfo_cache.i_assoc,
+							.sets = processor->proc_cpuinfo_cache.i_sets,
+							.partitions = 1,
+							.line_size = processor->proc_cpuinfo_cache.i_line_length
+						};
+					}
+					/* L1D reported in /proc/cpuinfo overrides defaults */
+					if (bitmask_all(processor->flags, CPUINFO_ARM_LINUX_VALID_DCACHE)) {
+						l1d[core_id] = (struct cpuinfo_cache) {
+							.size = processor->proc_cpuinfo_cache.d_size,
+							.associativity = processor->proc_cpuinfo_cache.d_assoc,
+							.sets = processor->proc_cpuinfo_cache.d_sets,
+							.partitions = 1,
+							.line_size = processor->proc_cpuinfo_cache.d_line_length
+						};
+					}
+				#endif
+				if (new_cluster) {
+					l2[++l2_index] = shared_l2;
+					l2[l2_index].processor_start = i;
+				}
+			}
+			l1i[core_id].processor_start = l1d[core_id].processor_start = i;
+		}
+
+		processors[i].smt_id = i - cores[core_id].processor_start;
+		processors[i].core = cores + core_id;
 		processors[i].cluster = clusters + cluster_id;
-		processors[i].package = &package;
-		processors[i].linux_id = (int) arm_linux_processors[i].system_processor_id;
-		processors[i].cache.l1i = l1i + i;
-		processors[i].cache.l1d = l1d + i;
-		processors[i].cache.l2 = l2 + cluster_id;
-		linux_cpu_to_processor_map[arm_linux_processors[i].system_processor_id] = &processors[i];
-
-		cores[i].processor_start = i;
-		cores[i].processor_count = 1;
-		cores[i].core_id = i;
-		cores[i].cluster = clusters + cluster_id;
-		cores[i].package = &package;
-		cores[i].vendor = arm_linux_processors[i].vendor;
-		cores[i].uarch = arm_linux_processors[i].uarch;
-		cores[i].midr = arm_linux_processors[i].midr;
-		linux_cpu_to_core_map[arm_linux_processors[i].system_processor_id] = &cores[i];
-
-		struct cpuinfo_cache shared_l2 = { 0 };
-		cpuinfo_arm_decode_cache(
-			arm_linux_processors[i].uarch,
-			arm_linux_processors[i].package_processor_count,
-			arm_linux_processors[i].midr,
-			&chipset,
-			cluster_id,
-			arm_linux_processors[i].architecture_version,
-			&l1i[i], &l1d[i], &shared_l2);
-		l1i[i].processor_start = l1d[i].processor_start = i;
-		l1i[i].processor_count = l1d[i].processor_count = 1;
+		processors[i].package = package;
+		processors[i].linux_id = (int) processor->system_processor_id;
+		processors[i].cache.l1i = l1i + core_id;
+		processors[i].cache.l1d = l1d + core_id;
+		processors[i].cache.l2 = l2 + l2_index;
+		if (l3 != NULL) {
+			processors[i].cache.l3 = l3 + l3_index;
+			l3[l3_index].processor_count += 1;
+		}
+		linux_cpu_to_processor_map[processor->system_processor_id] = &processors[i];
+		linux_cpu_to_core_map[processor->system_processor_id] = &cores[core_id];
+
+		cores[core_id].processor_count += 1;
+		clusters[cluster_id].processor_count += 1;
+		package->processor_count += 1;
+		l1i[core_id].processor_count += 1;
+		l1d[core_id].processor_count += 1;
+		l2[l2_index].processor_count += 1;
+	}
+
+	cluster_isa = calloc(cluster_count, sizeof(struct cpuinfo_arm_isa));
+	if (cluster_isa == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for ISA descriptions of %"PRIu32" core clusters",
+			cluster_count * sizeof(struct cpuinfo_arm_isa), cluster_count);
+		goto cleanup;
+	}
+
+	/*
+	 * Detect ISA features of each cluster from Features lines of its processors in /proc/cpuinfo.
+	 * HWCAP reports only features supported by all processors, and some kernels report per-processor features
+	 * in /proc/cpuinfo, e.g. dot product and FP16 arithmetics only on big cores of a big.LITTLE processor.
+	 * The global ISA description is restricted to features supported by all clusters.
+	 */
+	for (uint32_t i = 0; i < cluster_count; i++) {
+		const uint32_t processor_start = clusters[i].processor_start;
+		const uint32_t processor_end = processor_start + clusters[i].processor_count;
+		uint32_t cluster_features = 0, cluster_features2 = 0;
+		uint32_t processors_with_features = 0;
+		for (uint32_t j = processor_start; j < processor_end; j++) {
+			if (arm_linux_processors[j].flags & CPUINFO_ARM_LINUX_VALID_FEATURES) {
+				if (processors_with_features == 0) {
+					cluster_features = arm_linux_processors[j].features;
+					cluster_features2 = arm_linux_processors[j].features2;
+				} else {
+					cluster_features &= arm_linux_processors[j].features;
+					cluster_features2 &= arm_linux_processors[j].features2;
+				}
+				processors_with_features += 1;
+			}
+		}
+
 		#if CPUINFO_ARCH_ARM
-			/* L1I reported in /proc/cpuinfo overrides defaults */
-			if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_ARM_LINUX_VALID_ICACHE)) {
-				l1i[i] = (struct cpuinfo_cache) {
-					.size = arm_linux_processors[i].proc_cpuinfo_cache.i_size,
-					.associativity = arm_linux_processors[i].proc_cpuinfo_cache.i_assoc,
-					.sets = arm_linux_processors[i].proc_cpuinfo_cache.i_sets,
-					.partitions = 1,
-					.line_size = arm_linux_processors[i].proc_cpuinfo_cache.i_line_length
-				};
+			uint32_t cluster_midr = last_midr;
+			uint32_t cluster_architecture_version = last_architecture_version;
+			uint32_t cluster_architecture_flags = last_architecture_flags;
+			if (bitmask_all(arm_linux_processors[processor_start].flags, CPUINFO_ARM_LINUX_VALID_MIDR)) {
+				cluster_midr = arm_linux_processors[processor_start].midr;
 			}
-			/* L1D reported in /proc/cpuinfo overrides defaults */
-			if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_ARM_LINUX_VALID_DCACHE)) {
-				l1d[i] = (struct cpuinfo_cache) {
-					.size = arm_linux_processors[i].proc_cpuinfo_cache.d_size,
-					.associativity = arm_linux_processors[i].proc_cpuinfo_cache.d_assoc,
-					.sets = arm_linux_processors[i].proc_cpuinfo_cache.d_sets,
-					.partitions = 1,
-					.line_size = arm_linux_processors[i].proc_cpuinfo_cache.d_line_length
-				};
+			if (bitmask_all(arm_linux_processors[processor_start].flags, CPUINFO_ARM_LINUX_VALID_ARCHITECTURE)) {
+				cluster_architecture_version = arm_linux_processors[processor_start].architecture_version;
+				cluster_architecture_flags = arm_linux_processors[processor_start].architecture_flags;
 			}
+			cpuinfo_arm_linux_decode_isa_from_proc_cpuinfo(
+				isa_features | cluster_features, isa_features2 | cluster_features2,
+				cluster_midr, cluster_architecture_version, cluster_architecture_flags,
+				&cluster_isa[i]);
+		#elif CPUINFO_ARCH_ARM64
+			cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
+				isa_features | cluster_features, isa_features2 | cluster_features2,
+				&cluster_isa[i]);
 		#endif
-		if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
-			shared_l2.processor_start = i;
-			shared_l2.processor_count = arm_linux_processors[i].package_processor_count;
-			l2[cluster_id] = shared_l2;
-
-			clusters[cluster_id] = (struct cpuinfo_cluster) {
-				.processor_start = i,
-				.processor_count = arm_linux_processors[i].package_processor_count,
-				.core_start = i,
-				.core_count = arm_linux_processors[i].package_processor_count,
-				.cluster_id = cluster_id,
-				.package = &package,
-				.vendor = arm_linux_processors[i].vendor,
-				.uarch = arm_linux_processors[i].uarch,
-				.midr = arm_linux_processors[i].midr,
-			};
-		}
+		cpuinfo_intersect_isa(&cpuinfo_isa, &cluster_isa[i]);
 	}
 
-	if (cluster_count == 1 && l2[0].size == 0) {
+	if (l2_count == 1 && l2[0].size == 0) {
 		/* CPU without L2 cache */
+		for (uint32_t i = 0; i < usable_processors; i++) {
+			processors[i].cache.l2 = NULL;
+		}
 		free(l2);
 		l2 = NULL;
 		l2_count = 0;
 	}
 
+	#ifdef __ANDROID__
+		struct cpuinfo_android_gpu gpu;
+		if (cpuinfo_arm_android_lookup_gpu(&chipset, &gpu))	{
+			cpuinfo_android_gpu_to_string(&gpu, packages[0].gpu_name);
+		} else {
+			cpuinfo_log_info("GPU name needs to be queried from OpenGL ES");
+			cpuinfo_gpu_query_gles2(packages[0].gpu_name);
+			gpu = cpuinfo_android_decode_gpu(packages[0].gpu_name);
+			if (gpu.series != cpuinfo_android_gpu_series_unknown) {
+				cpuinfo_android_gpu_to_string(&gpu, packages[0].gpu_name);
+			}
+		}
+	#endif
+
 	/* Commit */
 	cpuinfo_linux_cpu_to_processor_map = linux_cpu_to_processor_map;
 	cpuinfo_linux_cpu_to_core_map = linux_cpu_to_core_map;
+	cpuinfo_linux_cpu_max = arm_linux_processors_count;
 	cpuinfo_processors = processors;
 	cpuinfo_cores = cores;
 	cpuinfo_clusters = clusters;
-	cpuinfo_packages = &package;
+	cpuinfo_packages = packages;
 	cpuinfo_cache[cpuinfo_cache_level_1i] = l1i;
 	cpuinfo_cache[cpuinfo_cache_level_1d] = l1d;
 	cpuinfo_cache[cpuinfo_cache_level_2]  = l2;
+	cpuinfo_cache[cpuinfo_cache_level_3]  = l3;
+	cpuinfo_cluster_isa = cluster_isa;
 
 	cpuinfo_processors_count = usable_processors;
-	cpuinfo_cores_count = usable_processors;
+	cpuinfo_cores_count = core_count;
 	cpuinfo_clusters_count = cluster_count;
-	cpuinfo_packages_count = 1;
-	cpuinfo_cache_count[cpuinfo_cache_level_1i] = usable_processors;
-	cpuinfo_cache_count[cpuinfo_cache_level_1d] = usable_processors;
+	cpuinfo_packages_count = package_count;
+	cpuinfo_cache_count[cpuinfo_cache_level_1i] = core_count;
+	cpuinfo_cache_count[cpuinfo_cache_level_1d] = core_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_2]  = l2_count;
+	cpuinfo_cache_count[cpuinfo_cache_level_3]  = l3_count;
 
 	linux_cpu_to_processor_map = NULL;
 	linux_cpu_to_core_map = NULL;
 	processors = NULL;
 	cores = NULL;
 	clusters = NULL;
-	l1i = l1d = l2 = NULL;
-
-	#ifdef __ANDROID__
-		struct cpuinfo_android_gpu gpu;
-		if (cpuinfo_arm_android_lookup_gpu(&chipset, &gpu))	{
-			cpuinfo_android_gpu_to_string(&gpu, package.gpu_name);
-		} else {
-			cpuinfo_log_info("GPU name needs to be queried from OpenGL ES");
-			cpuinfo_gpu_query_gles2(package.gpu_name);
-			gpu = cpuinfo_android_decode_gpu(package.gpu_name);
-			if (gpu.series != cpuinfo_android_gpu_series_unknown) {
-				cpuinfo_android_gpu_to_string(&gpu, package.gpu_name);
-			}
-		}
-	#endif
+	packages = NULL;
+	l1i = l1d = l2 = l3 = NULL;
+	cluster_isa = NULL;
 
 cleanup:
 	free(arm_linux_processors);
@@ -585,7 +1115,11 @@ cleanup:
 	free(processors);
 	free(cores);
 	free(clusters);
+	free(packages);
 	free(l1i);
 	free(l1d);
 	free(l2);
+	free(l3);
+	free(cluster_isa);
+	free(core_caches);
 }
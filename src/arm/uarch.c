@@ -72,6 +72,12 @@ void cpuinfo_arm_decode_vendor_uarch(
 				case 0xD0A:
 					*uarch = cpuinfo_uarch_cortex_a75;
 					break;
+				case 0xD0C:
+					*uarch = cpuinfo_uarch_neoverse_n1;
+					break;
+				case 0xD40:
+					*uarch = cpuinfo_uarch_neoverse_v1;
+					break;
 				default:
 					switch (midr_get_part(midr) >> 8) {
 #if CPUINFO_ARCH_ARM
@@ -97,6 +103,9 @@ void cpuinfo_arm_decode_vendor_uarch(
 				case 0x0A1:
 					*uarch = cpuinfo_uarch_thunderx;
 					break;
+				case 0x0AF:
+					*uarch = cpuinfo_uarch_thunderx2;
+					break;
 				default:
 					cpuinfo_log_warning("unknown Cavium CPU part 0x%03"PRIx32" ignored", midr_get_part(midr));
 			}
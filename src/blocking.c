@@ -0,0 +1,253 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+#if CPUINFO_MOCK
+	#include <cpuinfo-mock.h>
+#endif
+
+
+/* Cache parameters relevant to blocking, normalized so that missing caches have zero size */
+struct cache_geometry {
+	uint32_t size;
+	uint32_t associativity;
+	uint32_t sets;
+	uint32_t line_size;
+	/* Number of logical processors sharing the cache */
+	uint32_t sharing;
+	uint32_t flags;
+};
+
+struct cluster_geometry {
+	struct cache_geometry l1d;
+	struct cache_geometry l2;
+	struct cache_geometry l3;
+};
+
+/* Memoized cache geometry for each cluster. Blocking parameters depend on a few arithmetic operations on top of it. */
+static struct cluster_geometry* cluster_geometry = NULL;
+static uint32_t cluster_geometry_count = 0;
+
+/* Guards lazy computation of the geometry; a flag rather than a once object, as deinitialization resets it */
+#ifdef _WIN32
+	static SRWLOCK cluster_geometry_lock = SRWLOCK_INIT;
+#else
+	static pthread_mutex_t cluster_geometry_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static bool cluster_geometry_initialized = false;
+
+#if CPUINFO_MOCK
+	static uint32_t cluster_geometry_computations = 0;
+#endif
+
+/* Assumed when the OS or the processor does not report associativity */
+#define DEFAULT_ASSOCIATIVITY 4
+/* Assumed when the OS or the processor does not report line size */
+#define DEFAULT_LINE_SIZE 64
+/* Width of the panel of B when there is no cache to hold it: the panel is streamed from memory */
+#define DEFAULT_NC 4096
+
+static void init_cache_geometry(
+	const struct cpuinfo_cache* cache,
+	struct cache_geometry geometry[restrict static 1])
+{
+	*geometry = (struct cache_geometry) { 0 };
+	if (cache == NULL || cache->size == 0) {
+		return;
+	}
+
+	geometry->size = cache->size;
+	geometry->associativity = cache->associativity != 0 ? cache->associativity : DEFAULT_ASSOCIATIVITY;
+	geometry->line_size = cache->line_size != 0 ? cache->line_size : DEFAULT_LINE_SIZE;
+	geometry->sets = cache->size / (geometry->associativity * geometry->line_size);
+	if (geometry->sets == 0) {
+		/* Fully-associative cache, or inconsistent parameters */
+		geometry->sets = 1;
+		geometry->associativity = cache->size / geometry->line_size;
+	}
+	geometry->sharing = cache->processor_count != 0 ? cache->processor_count : 1;
+	geometry->flags = cache->flags;
+}
+
+static void lock_cluster_geometry(void) {
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&cluster_geometry_lock);
+#else
+	pthread_mutex_lock(&cluster_geometry_lock);
+#endif
+}
+
+static void unlock_cluster_geometry(void) {
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&cluster_geometry_lock);
+#else
+	pthread_mutex_unlock(&cluster_geometry_lock);
+#endif
+}
+
+static void init_cluster_geometry(void) {
+#if CPUINFO_MOCK
+	cluster_geometry_computations += 1;
+#endif
+	cluster_geometry = calloc(cpuinfo_clusters_count, sizeof(struct cluster_geometry));
+	if (cluster_geometry == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for cache geometry of %"PRIu32" clusters",
+			cpuinfo_clusters_count * sizeof(struct cluster_geometry), cpuinfo_clusters_count);
+		return;
+	}
+
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		/* All processors in a cluster have caches of the same geometry: use the first one */
+		const struct cpuinfo_processor* processor = &cpuinfo_processors[cpuinfo_clusters[i].processor_start];
+		init_cache_geometry(processor->cache.l1d, &cluster_geometry[i].l1d);
+		init_cache_geometry(processor->cache.l2, &cluster_geometry[i].l2);
+		init_cache_geometry(processor->cache.l3, &cluster_geometry[i].l3);
+	}
+	cluster_geometry_count = cpuinfo_clusters_count;
+}
+
+void cpuinfo_deinit_cluster_geometry(void) {
+	lock_cluster_geometry();
+	free(cluster_geometry);
+	cluster_geometry = NULL;
+	cluster_geometry_count = 0;
+#if CPUINFO_MOCK
+	cluster_geometry_computations = 0;
+#endif
+	cluster_geometry_initialized = false;
+	unlock_cluster_geometry();
+}
+
+#if CPUINFO_MOCK
+	uint32_t CPUINFO_ABI cpuinfo_mock_get_cluster_geometry_computations(void) {
+		return cluster_geometry_computations;
+	}
+#endif
+
+static inline uint32_t min(uint32_t a, uint32_t b) {
+	return a < b ? a : b;
+}
+
+static inline uint32_t max(uint32_t a, uint32_t b) {
+	return a > b ? a : b;
+}
+
+static inline uint32_t divide_round_up(uint32_t n, uint32_t q) {
+	return n % q == 0 ? n / q : n / q + 1;
+}
+
+static inline uint32_t round_down(uint32_t n, uint32_t q) {
+	return n - n % q;
+}
+
+/* Number of threads competing for the cache */
+static inline uint32_t get_sharers(const struct cache_geometry geometry[restrict static 1], uint32_t threads) {
+	return max(min(geometry->sharing, threads), 1);
+}
+
+/*
+ * Bytes of the cache available to one thread for the block it keeps resident. One way is left for the data
+ * streamed through the cache (C tiles in GEMM, outputs in convolution), and the rest is split between threads.
+ */
+static uint32_t get_tile_bytes(const struct cache_geometry geometry[restrict static 1], uint32_t threads) {
+	if (geometry->size == 0) {
+		return 0;
+	}
+	const uint32_t way_size = geometry->sets * geometry->line_size;
+	const uint32_t ways = max(geometry->associativity, 2) - 1;
+	return (uint32_t) ((uint64_t) ways * way_size / get_sharers(geometry, threads));
+}
+
+bool CPUINFO_ABI cpuinfo_get_cluster_blocking(
+	const struct cpuinfo_cluster* cluster,
+	uint32_t element_size,
+	uint32_t mr,
+	uint32_t nr,
+	uint32_t threads,
+	struct cpuinfo_blocking* blocking)
+{
+	if (cluster == NULL || blocking == NULL || cpuinfo_clusters == NULL) {
+		return false;
+	}
+	if (element_size == 0 || mr == 0 || nr == 0) {
+		return false;
+	}
+	const uint32_t cluster_index = (uint32_t) (cluster - cpuinfo_clusters);
+	if (cluster_index >= cpuinfo_clusters_count) {
+		return false;
+	}
+
+	lock_cluster_geometry();
+	if (!cluster_geometry_initialized) {
+		init_cluster_geometry();
+		cluster_geometry_initialized = true;
+	}
+	unlock_cluster_geometry();
+	if (cluster_index >= cluster_geometry_count) {
+		return false;
+	}
+	const struct cluster_geometry* geometry = &cluster_geometry[cluster_index];
+	threads = max(threads, 1);
+
+	*blocking = (struct cpuinfo_blocking) {
+		.mr = mr,
+		.nr = nr,
+		.l1_tile_bytes = get_tile_bytes(&geometry->l1d, threads),
+		.l2_tile_bytes = get_tile_bytes(&geometry->l2, threads),
+		.l3_tile_bytes = get_tile_bytes(&geometry->l3, threads),
+	};
+
+	/*
+	 * kc: mr x kc micro-panel of A and kc x nr micro-panel of B stay in L1 while the micro-kernel runs.
+	 * The micro-panel of B is reused across mc / mr micro-kernel calls, and gets the ways not taken by A.
+	 * See T. M. Low et al, "Analytical modeling is enough for high-performance BLIS", ACM TOMS 43(2), 2016.
+	 */
+	const struct cache_geometry* l1d = &geometry->l1d;
+	if (l1d->size != 0) {
+		const uint32_t l1d_ways = l1d->associativity / get_sharers(l1d, threads);
+		if (l1d_ways >= 2) {
+			const uint32_t a_ways = max((l1d_ways - 1) * mr / (mr + nr), 1);
+			blocking->kc = a_ways * l1d->sets * l1d->line_size / (mr * element_size);
+		} else {
+			blocking->kc = blocking->l1_tile_bytes / ((mr + nr) * element_size);
+		}
+	} else {
+		blocking->kc = 256;
+	}
+	blocking->kc = max(blocking->kc, 1);
+	const uint32_t kc_bytes = blocking->kc * element_size;
+
+	/* mc: mc x kc block of A stays in L2, next to the micro-panel of B */
+	const uint32_t b_micropanel_bytes = kc_bytes * nr;
+	uint32_t a_block_bytes = blocking->l2_tile_bytes;
+	if (a_block_bytes == 0) {
+		/* No L2 cache: the block of A has to share L1 with micro-panels */
+		a_block_bytes = blocking->l1_tile_bytes / 2;
+	}
+	a_block_bytes = a_block_bytes > b_micropanel_bytes ? a_block_bytes - b_micropanel_bytes : 0;
+	blocking->mc = max(round_down(a_block_bytes / kc_bytes, mr), mr);
+
+	/* nc: kc x nc panel of B stays in L3, next to the block of A if L3 is inclusive of L2 */
+	if (blocking->l3_tile_bytes != 0) {
+		uint32_t b_panel_bytes = blocking->l3_tile_bytes;
+		if (geometry->l3.flags & CPUINFO_CACHE_INCLUSIVE) {
+			const uint32_t a_block_lines = divide_round_up(blocking->mc * kc_bytes, geometry->l3.line_size);
+			const uint32_t a_block_l3_bytes = a_block_lines * geometry->l3.line_size;
+			b_panel_bytes = b_panel_bytes > a_block_l3_bytes ? b_panel_bytes - a_block_l3_bytes : 0;
+		}
+		blocking->nc = max(round_down(b_panel_bytes / kc_bytes, nr), nr);
+	} else {
+		blocking->nc = max(round_down(DEFAULT_NC, nr), nr);
+	}
+	return true;
+}
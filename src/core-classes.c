@@ -0,0 +1,212 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+
+
+static struct cpuinfo_core_class* core_classes = NULL;
+static uint32_t core_classes_count = 0;
+static const struct cpuinfo_cluster** clusters_by_performance = NULL;
+static const struct cpuinfo_processor** core_class_processors = NULL;
+
+struct cluster_score {
+	uint64_t score;
+	uint32_t cluster;
+};
+
+/* Orders clusters by decreasing score, and clusters with the same score by index */
+static int compare_cluster_scores(const void* a, const void* b) {
+	const struct cluster_score* score_a = (const struct cluster_score*) a;
+	const struct cluster_score* score_b = (const struct cluster_score*) b;
+	if (score_a->score != score_b->score) {
+		return score_a->score > score_b->score ? -1 : 1;
+	}
+	return score_a->cluster < score_b->cluster ? -1 : 1;
+}
+
+/*
+ * Estimates per-core performance of every cluster. Capacity reported by the OS is used as-is when all clusters have
+ * it. Otherwise, the estimate is a product of the IPC proxy from uarch throughput data (issue width, doubled for
+ * out-of-order cores) and the maximum frequency in MHz; each factor is used only if it is known for all clusters,
+ * so that clusters are never ranked by data available for some of them.
+ */
+static void score_clusters(struct cluster_score scores[restrict static 1]) {
+	bool all_capacities = true, all_uarch_info = true, all_frequencies = true;
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		all_capacities &= cpuinfo_clusters[i].capacity != 0;
+		all_uarch_info &= cpuinfo_get_uarch_info(cpuinfo_clusters[i].uarch) != NULL;
+		all_frequencies &= cpuinfo_clusters[i].frequency >= UINT64_C(1000000);
+	}
+
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		uint64_t score = 1;
+		if (all_capacities) {
+			score = cpuinfo_clusters[i].capacity;
+		} else {
+			if (all_uarch_info) {
+				const struct cpuinfo_uarch_info* uarch_info = cpuinfo_get_uarch_info(cpuinfo_clusters[i].uarch);
+				score = (uint64_t) uarch_info->issue_width * (uarch_info->rob_size != 0 ? 2 : 1);
+			}
+			if (all_frequencies) {
+				score *= cpuinfo_clusters[i].frequency / UINT64_C(1000000);
+			}
+		}
+		scores[i] = (struct cluster_score) {
+			.score = score,
+			.cluster = i,
+		};
+	}
+}
+
+/* Describes all cores as one class, for platforms which do not report clusters */
+static bool init_single_class(void) {
+	core_class_processors = calloc(cpuinfo_processors_count, sizeof(const struct cpuinfo_processor*));
+	core_classes = calloc(1, sizeof(struct cpuinfo_core_class));
+	if (core_class_processors == NULL || core_classes == NULL) {
+		cpuinfo_log_error("failed to allocate descriptions of core classes for %"PRIu32" logical processors",
+			cpuinfo_processors_count);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+		core_class_processors[i] = &cpuinfo_processors[i];
+	}
+	core_classes[0] = (struct cpuinfo_core_class) {
+		.core_count = cpuinfo_cores_count,
+		.processor_count = cpuinfo_processors_count,
+		.processors = core_class_processors,
+		.performance = 1024,
+	};
+	core_classes_count = 1;
+	return true;
+}
+
+static bool init_ranked_classes(void) {
+	bool status = false;
+	uint32_t* cluster_classes = NULL;
+	uint32_t* class_processor_offsets = NULL;
+	struct cluster_score* scores = calloc(cpuinfo_clusters_count, sizeof(struct cluster_score));
+	if (scores == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for performance estimates of %"PRIu32" clusters",
+			cpuinfo_clusters_count * sizeof(struct cluster_score), cpuinfo_clusters_count);
+		goto cleanup;
+	}
+	score_clusters(scores);
+	qsort(scores, cpuinfo_clusters_count, sizeof(struct cluster_score), compare_cluster_scores);
+
+	uint32_t classes_count = 1;
+	for (uint32_t i = 1; i < cpuinfo_clusters_count; i++) {
+		if (scores[i].score != scores[i - 1].score) {
+			classes_count += 1;
+		}
+	}
+
+	cluster_classes = calloc(cpuinfo_clusters_count, sizeof(uint32_t));
+	class_processor_offsets = calloc(classes_count, sizeof(uint32_t));
+	clusters_by_performance = calloc(cpuinfo_clusters_count, sizeof(const struct cpuinfo_cluster*));
+	core_class_processors = calloc(cpuinfo_processors_count, sizeof(const struct cpuinfo_processor*));
+	core_classes = calloc(classes_count, sizeof(struct cpuinfo_core_class));
+	if (cluster_classes == NULL || class_processor_offsets == NULL || clusters_by_performance == NULL ||
+		core_class_processors == NULL || core_classes == NULL)
+	{
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" core classes for %"PRIu32" clusters",
+			classes_count, cpuinfo_clusters_count);
+		goto cleanup;
+	}
+
+	uint32_t class_id = 0;
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		if (i != 0 && scores[i].score != scores[i - 1].score) {
+			class_id += 1;
+		}
+		const struct cpuinfo_cluster* cluster = &cpuinfo_clusters[scores[i].cluster];
+		struct cpuinfo_core_class* core_class = &core_classes[class_id];
+		if (core_class->cluster_count == 0) {
+			core_class->cluster_start = i;
+			core_class->performance = scores[0].score == 0 ? 1024 :
+				(uint32_t) ((scores[i].score * UINT64_C(1024) + scores[0].score / 2) / scores[0].score);
+		}
+		core_class->cluster_count += 1;
+		core_class->core_count += cluster->core_count;
+		core_class->processor_count += cluster->processor_count;
+		clusters_by_performance[i] = cluster;
+		cluster_classes[scores[i].cluster] = class_id;
+	}
+
+	uint32_t processor_offset = 0;
+	for (uint32_t i = 0; i < classes_count; i++) {
+		class_processor_offsets[i] = processor_offset;
+		core_classes[i].processors = core_class_processors + processor_offset;
+		processor_offset += core_classes[i].processor_count;
+	}
+	for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+		const uint32_t cluster_id = (uint32_t) (cpuinfo_processors[i].cluster - cpuinfo_clusters);
+		const uint32_t processor_class = cluster_classes[cluster_id];
+		if (class_processor_offsets[processor_class] < processor_offset) {
+			core_class_processors[class_processor_offsets[processor_class]++] = &cpuinfo_processors[i];
+		}
+	}
+	for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+		const uint32_t cluster_id = (uint32_t) (cpuinfo_cores[i].cluster - cpuinfo_clusters);
+		cpuinfo_cores[i].core_class = cluster_classes[cluster_id];
+	}
+
+	core_classes_count = classes_count;
+	status = true;
+
+cleanup:
+	free(scores);
+	free(cluster_classes);
+	free(class_processor_offsets);
+	return status;
+}
+
+void cpuinfo_init_core_classes(void) {
+	const bool initialized = cpuinfo_clusters_count == 0 ? init_single_class() : init_ranked_classes();
+	if (!initialized) {
+		free(core_classes);
+		free(clusters_by_performance);
+		free(core_class_processors);
+		core_classes = NULL;
+		clusters_by_performance = NULL;
+		core_class_processors = NULL;
+	}
+}
+
+void cpuinfo_deinit_core_classes(void) {
+	free(core_classes);
+	free(clusters_by_performance);
+	free(core_class_processors);
+	core_classes = NULL;
+	core_classes_count = 0;
+	clusters_by_performance = NULL;
+	core_class_processors = NULL;
+}
+
+const struct cpuinfo_core_class* CPUINFO_ABI cpuinfo_get_core_classes(void) {
+	return core_classes;
+}
+
+const struct cpuinfo_core_class* CPUINFO_ABI cpuinfo_get_core_class(uint32_t index) {
+	if (index < core_classes_count) {
+		return core_classes + index;
+	} else {
+		return NULL;
+	}
+}
+
+uint32_t CPUINFO_ABI cpuinfo_get_core_classes_count(void) {
+	return core_classes_count;
+}
+
+const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_cluster_by_performance(uint32_t index) {
+	if (clusters_by_performance != NULL && index < cpuinfo_clusters_count) {
+		return clusters_by_performance[index];
+	} else {
+		return NULL;
+	}
+}
@@ -0,0 +1,115 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+
+
+static bool is_tuned_for(const struct cpuinfo_dispatch_candidate* candidate, enum cpuinfo_uarch uarch) {
+	for (uint32_t i = 0; i < candidate->uarchs_count; i++) {
+		if (candidate->uarchs[i] == uarch) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Checks if a candidate is eligible on a cluster: the cluster supports its ISA, and passes its cluster filter */
+static bool is_eligible_for(const struct cpuinfo_dispatch_candidate* candidate, uint32_t cluster_index) {
+	const struct cpuinfo_isa_bits* cluster_isa = cpuinfo_get_cluster_isa_bits(cluster_index);
+	if (cluster_isa == NULL || !cpuinfo_isa_bits_has_all(cluster_isa, &candidate->isa)) {
+		return false;
+	}
+	return candidate->cluster_filter == NULL || candidate->cluster_filter(&cpuinfo_clusters[cluster_index]);
+}
+
+/*
+ * Selects the best candidate for a range of clusters: a candidate eligible on all clusters in the range and tuned for
+ * all of them, or else the first candidate eligible on all of them. Candidates with CPUINFO_DISPATCH_UARCH_REQUIRED
+ * are eligible only if tuned.
+ */
+static cpuinfo_dispatch_function resolve_clusters(
+	const struct cpuinfo_dispatch_table* table,
+	uint32_t cluster_start,
+	uint32_t cluster_count)
+{
+	cpuinfo_dispatch_function fallback = NULL;
+	for (uint32_t i = 0; i < table->candidates_count; i++) {
+		const struct cpuinfo_dispatch_candidate* candidate = &table->candidates[i];
+		if (candidate->function == NULL) {
+			continue;
+		}
+
+		bool eligible = true;
+		for (uint32_t j = 0; eligible && j < cluster_count; j++) {
+			eligible = is_eligible_for(candidate, cluster_start + j);
+		}
+		if (!eligible) {
+			continue;
+		}
+
+		bool tuned = candidate->uarchs_count != 0;
+		for (uint32_t j = 0; tuned && j < cluster_count; j++) {
+			tuned = is_tuned_for(candidate, cpuinfo_clusters[cluster_start + j].uarch);
+		}
+
+		if (tuned) {
+			return candidate->function;
+		}
+		if (fallback == NULL && !(candidate->flags & CPUINFO_DISPATCH_UARCH_REQUIRED)) {
+			fallback = candidate->function;
+		}
+	}
+	return fallback;
+}
+
+bool CPUINFO_ABI cpuinfo_dispatch_table_resolve(struct cpuinfo_dispatch_table* table) {
+	if (table == NULL || cpuinfo_clusters == NULL) {
+		return false;
+	}
+
+	/* The previous resolution, if any, is released by the caller: fields are not read to avoid freeing garbage */
+	cpuinfo_dispatch_function* cluster_functions =
+		calloc(cpuinfo_clusters_count, sizeof(cpuinfo_dispatch_function));
+	if (cluster_functions == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for dispatch functions of %"PRIu32" clusters",
+			cpuinfo_clusters_count * sizeof(cpuinfo_dispatch_function), cpuinfo_clusters_count);
+		return false;
+	}
+
+	bool resolved = true;
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		cluster_functions[i] = resolve_clusters(table, i, 1);
+		resolved &= cluster_functions[i] != NULL;
+	}
+	table->function = resolve_clusters(table, 0, cpuinfo_clusters_count);
+	table->cluster_functions = cluster_functions;
+	table->clusters_count = cpuinfo_clusters_count;
+	return resolved && table->function != NULL;
+}
+
+void CPUINFO_ABI cpuinfo_dispatch_table_release(struct cpuinfo_dispatch_table* table) {
+	if (table != NULL) {
+		free(table->cluster_functions);
+		table->cluster_functions = NULL;
+		table->clusters_count = 0;
+		table->function = NULL;
+	}
+}
+
+cpuinfo_dispatch_function CPUINFO_ABI cpuinfo_dispatch_get_for_cluster(
+	const struct cpuinfo_dispatch_table* table,
+	const struct cpuinfo_cluster* cluster)
+{
+	if (table == NULL || cluster == NULL || cpuinfo_clusters == NULL) {
+		return NULL;
+	}
+	const uint32_t cluster_index = (uint32_t) (cluster - cpuinfo_clusters);
+	if (cluster_index >= table->clusters_count) {
+		return table->function;
+	}
+	return table->cluster_functions[cluster_index];
+}
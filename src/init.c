@@ -1,3 +1,6 @@
+#include <stdlib.h>
+#include <string.h>
+
 #ifdef _WIN32
 	#include <windows.h>
 #else
@@ -7,42 +10,168 @@
 #include <cpuinfo.h>
 #include <api.h>
 #include <log.h>
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#include <x86/api.h>
+#endif
+#ifdef __linux__
+	#include <linux/api.h>
+#endif
 
 #ifdef __APPLE__
 	#include "TargetConditionals.h"
 #endif
 
 
+/*
+ * Serializes initialization and deinitialization. A lock with a flag rather than a once object: POSIX leaves reuse of
+ * a pthread_once_t after its routine ran undefined, and cpuinfo_deinitialize() must allow initialization again.
+ */
 #ifdef _WIN32
-	static INIT_ONCE init_guard = INIT_ONCE_STATIC_INIT;
+	static SRWLOCK init_lock = SRWLOCK_INIT;
 #else
-	static pthread_once_t init_guard = PTHREAD_ONCE_INIT;
+	static pthread_mutex_t init_lock = PTHREAD_MUTEX_INITIALIZER;
 #endif
+static bool initialized = false;
 
-bool CPUINFO_ABI cpuinfo_initialize(void) {
+static void lock_init(void) {
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&init_lock);
+#else
+	pthread_mutex_lock(&init_lock);
+#endif
+}
+
+static void unlock_init(void) {
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&init_lock);
+#else
+	pthread_mutex_unlock(&init_lock);
+#endif
+}
+
+/* Whether the host supports the features assumed by the compilation target, computed once per initialization */
+static bool baseline_supported = false;
+
+#define CHECK_BASELINE_FEATURE(name, value) \
+	if ((value) && !cpuinfo_isa_bits_has(&cpuinfo_isa_bits_supported, cpuinfo_isa_##name)) { \
+		cpuinfo_log_error("host processor does not support " #name ", assumed by the compilation target"); \
+		supported = false; \
+	}
+
+/*
+ * Verifies that the host supports instruction set features assumed by the compilation target of the library.
+ * cpuinfo_isa_bits_supported is computed without baseline folding, so it reflects the host.
+ */
+static bool check_baseline(void) {
+	bool supported = true;
+	CPUINFO_BASELINE_FEATURES(CHECK_BASELINE_FEATURE)
+	return supported;
+}
+
+/*
+ * Detects the topology, then builds the state derived from it and checks the baseline. Runs once per initialization,
+ * under init_lock, so the baseline check logs unsupported features only once.
+ */
+static void init(void) {
 #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 	#if defined(__MACH__) && defined(__APPLE__)
-		pthread_once(&init_guard, &cpuinfo_x86_mach_init);
+		cpuinfo_x86_mach_init();
 	#elif defined(__linux__)
-		pthread_once(&init_guard, &cpuinfo_x86_linux_init);
+		cpuinfo_x86_linux_init();
 	#elif defined(_WIN32)
-		InitOnceExecuteOnce(&init_guard, &cpuinfo_x86_windows_init, NULL, NULL);
+		cpuinfo_x86_windows_init(NULL, NULL, NULL);
 	#else
 		cpuinfo_log_error("operating system is not supported in cpuinfo");
 	#endif
 #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 	#if defined(__linux__)
-		pthread_once(&init_guard, &cpuinfo_arm_linux_init);
+		cpuinfo_arm_linux_init();
 	#elif defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE
-		pthread_once(&init_guard, &cpuinfo_arm_mach_init);
+		cpuinfo_arm_mach_init();
 	#else
 		cpuinfo_log_error("operating system is not supported in cpuinfo");
 	#endif
 #else
 	cpuinfo_log_error("processor architecture is not supported in cpuinfo");
 #endif
-	return (cpuinfo_processors != NULL) && (cpuinfo_cores != NULL) && (cpuinfo_packages != NULL);
+	if (cpuinfo_processors != NULL && cpuinfo_cores != NULL && cpuinfo_packages != NULL) {
+		cpuinfo_init_isa_bits();
+		cpuinfo_init_core_classes();
+		baseline_supported = check_baseline();
+	}
+}
+
+bool CPUINFO_ABI cpuinfo_initialize(void) {
+	lock_init();
+	if (!initialized) {
+		init();
+		initialized = true;
+	}
+	const bool supported = cpuinfo_processors != NULL && cpuinfo_cores != NULL && cpuinfo_packages != NULL &&
+		baseline_supported;
+	unlock_init();
+	return supported;
+}
+
+/* Releases an array of the topology, allocated by the initialization code of the operating system */
+static void free_topology_array(void* array) {
+#ifdef _WIN32
+	if (array != NULL) {
+		HeapFree(GetProcessHeap(), 0, array);
+	}
+#else
+	free(array);
+#endif
 }
 
 void CPUINFO_ABI cpuinfo_deinitialize(void) {
+	lock_init();
+	/* State derived from the topology goes first: it was built on top of it */
+	cpuinfo_deinit_core_classes();
+	cpuinfo_deinit_isa_bits();
+	cpuinfo_deinit_cluster_geometry();
+#ifdef __linux__
+	cpuinfo_linux_deinit_frequency_cache();
+	cpuinfo_linux_deinit_latency_matrix();
+
+	free((void*) cpuinfo_linux_cpu_to_processor_map);
+	free((void*) cpuinfo_linux_cpu_to_core_map);
+	cpuinfo_linux_cpu_to_processor_map = NULL;
+	cpuinfo_linux_cpu_to_core_map = NULL;
+	cpuinfo_linux_cpu_max = 0;
+#endif
+
+	free_topology_array(cpuinfo_processors);
+	free_topology_array(cpuinfo_cores);
+	free_topology_array(cpuinfo_clusters);
+	free_topology_array(cpuinfo_packages);
+	for (uint32_t i = 0; i < cpuinfo_cache_level_max; i++) {
+		free_topology_array(cpuinfo_cache[i]);
+		cpuinfo_cache[i] = NULL;
+		cpuinfo_cache_count[i] = 0;
+	}
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	free(cpuinfo_cluster_isa);
+	cpuinfo_cluster_isa = NULL;
+#endif
+	cpuinfo_processors = NULL;
+	cpuinfo_cores = NULL;
+	cpuinfo_clusters = NULL;
+	cpuinfo_packages = NULL;
+	cpuinfo_processors_count = 0;
+	cpuinfo_cores_count = 0;
+	cpuinfo_clusters_count = 0;
+	cpuinfo_packages_count = 0;
+
+	/* Instruction sets are detected from scratch on re-initialization, except on Apple ARM with static defaults */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	memset(&cpuinfo_isa, 0, sizeof(cpuinfo_isa));
+	memset(&cpuinfo_x86_xsave, 0, sizeof(cpuinfo_x86_xsave));
+#elif (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && defined(__linux__)
+	memset(&cpuinfo_isa, 0, sizeof(cpuinfo_isa));
+#endif
+
+	baseline_supported = false;
+	initialized = false;
+	unlock_init();
 }
@@ -0,0 +1,263 @@
+/* Host features are reported as detected: cpuinfo_has_* must not fold baseline features of the library build */
+#define CPUINFO_BASELINE_DETECT 0
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+
+
+/*
+ * Features of each architecture, as X(name, condition): name is the suffix of the cpuinfo_isa_<arch>_* and
+ * cpuinfo_has_<arch>_* identifiers, and condition tests the feature in a raw ISA description isa. Fields missing in
+ * the description on some architectures are checked only where they exist: elsewhere the feature is either implied by
+ * the architecture, and cpuinfo_has_* reports it, or not supported.
+ */
+#if CPUINFO_ARCH_X86
+	#define X86_32_ONLY(condition) (condition)
+	#define X86_64_ONLY(condition) false
+#else
+	#define X86_32_ONLY(condition) false
+	#define X86_64_ONLY(condition) (condition)
+#endif
+
+#define X86_FEATURES(X) \
+	X(rdtsc, X86_32_ONLY(isa->rdtsc)) \
+	X(rdtscp, isa->rdtscp) \
+	X(rdpid, isa->rdpid) \
+	X(clzero, isa->clzero) \
+	X(mwait, isa->mwait) \
+	X(mwaitx, isa->mwaitx) \
+	X(fxsave, isa->fxsave) \
+	X(xsave, isa->xsave) \
+	X(fpu, X86_32_ONLY(isa->fpu)) \
+	X(mmx, X86_32_ONLY(isa->mmx)) \
+	X(mmx_plus, X86_32_ONLY(isa->mmx_plus)) \
+	X(3dnow, isa->three_d_now) \
+	X(3dnow_plus, isa->three_d_now_plus) \
+	X(3dnow_geode, X86_32_ONLY(isa->three_d_now_geode)) \
+	X(prefetch, isa->prefetch) \
+	X(prefetchw, isa->prefetchw) \
+	X(prefetchwt1, isa->prefetchwt1) \
+	X(daz, X86_32_ONLY(isa->daz)) \
+	X(sse, X86_32_ONLY(isa->sse)) \
+	X(sse2, X86_32_ONLY(isa->sse2)) \
+	X(sse3, isa->sse3) \
+	X(ssse3, isa->ssse3) \
+	X(sse4_1, isa->sse4_1) \
+	X(sse4_2, isa->sse4_2) \
+	X(sse4a, isa->sse4a) \
+	X(misaligned_sse, isa->misaligned_sse) \
+	X(avx, isa->avx) \
+	X(fma3, isa->fma3) \
+	X(fma4, isa->fma4) \
+	X(xop, isa->xop) \
+	X(f16c, isa->f16c) \
+	X(avx2, isa->avx2) \
+	X(avx512f, isa->avx512f) \
+	X(avx512pf, isa->avx512pf) \
+	X(avx512er, isa->avx512er) \
+	X(avx512cd, isa->avx512cd) \
+	X(avx512dq, isa->avx512dq) \
+	X(avx512bw, isa->avx512bw) \
+	X(avx512vl, isa->avx512vl) \
+	X(avx512ifma, isa->avx512ifma) \
+	X(avx512vbmi, isa->avx512vbmi) \
+	X(avx512vbmi2, isa->avx512vbmi2) \
+	X(avx512bitalg, isa->avx512bitalg) \
+	X(avx512vpopcntdq, isa->avx512vpopcntdq) \
+	X(avx512vnni, isa->avx512vnni) \
+	X(avx512_4vnniw, isa->avx512_4vnniw) \
+	X(avx512_4fmaps, isa->avx512_4fmaps) \
+	X(avx512vp2intersect, isa->avx512vp2intersect) \
+	X(avx512bf16, isa->avx512bf16) \
+	X(avx512fp16, isa->avx512fp16) \
+	X(avxvnni, isa->avxvnni) \
+	X(amx_tile, isa->amx_tile) \
+	X(amx_int8, isa->amx_int8) \
+	X(amx_bf16, isa->amx_bf16) \
+	X(hle, isa->hle) \
+	X(rtm, isa->rtm) \
+	X(xtest, isa->xtest) \
+	X(mpx, isa->mpx) \
+	X(cmov, X86_32_ONLY(isa->cmov)) \
+	X(cmpxchg8b, X86_32_ONLY(isa->cmpxchg8b)) \
+	X(cmpxchg16b, isa->cmpxchg16b) \
+	X(clwb, isa->clwb) \
+	X(movbe, isa->movbe) \
+	X(lahf_sahf, X86_64_ONLY(isa->lahf_sahf)) \
+	X(lzcnt, isa->lzcnt) \
+	X(popcnt, isa->popcnt) \
+	X(tbm, isa->tbm) \
+	X(bmi, isa->bmi) \
+	X(bmi2, isa->bmi2) \
+	X(adx, isa->adx) \
+	X(aes, isa->aes) \
+	X(vaes, isa->vaes) \
+	X(pclmulqdq, isa->pclmulqdq) \
+	X(vpclmulqdq, isa->vpclmulqdq) \
+	X(gfni, isa->gfni) \
+	X(rdrand, isa->rdrand) \
+	X(rdseed, isa->rdseed) \
+	X(sha, isa->sha)
+
+#define ARM32_FEATURES(X) \
+	X(thumb, isa->thumb) \
+	X(thumb2, isa->thumb2) \
+	X(v5e, isa->armv5e) \
+	X(v6, isa->armv6) \
+	X(v6k, isa->armv6k) \
+	X(v7, isa->armv7) \
+	X(v7mp, isa->armv7mp) \
+	X(idiv, isa->idiv) \
+	X(vfpv2, isa->vfpv2) \
+	X(vfpv3, isa->vfpv3) \
+	X(vfpv3_d32, isa->vfpv3 && isa->d32) \
+	X(vfpv3_fp16, isa->vfpv3 && isa->fp16) \
+	X(vfpv3_fp16_d32, isa->vfpv3 && isa->fp16 && isa->d32) \
+	X(vfpv4, isa->vfpv3 && isa->fma) \
+	X(vfpv4_d32, isa->vfpv3 && isa->fma && isa->d32) \
+	X(wmmx, isa->wmmx) \
+	X(wmmx2, isa->wmmx2) \
+	X(neon, isa->neon) \
+	X(neon_fp16, isa->neon && isa->fp16) \
+	X(neon_fma, isa->neon && isa->fma)
+
+#define ARM64_FEATURES(X) \
+	X(atomics, isa->atomics) \
+	X(neon_rdm, isa->rdm) \
+	X(fp16_arith, isa->fp16arith) \
+	X(jscvt, isa->jscvt) \
+	X(fcma, isa->fcma) \
+	X(neon_dot, isa->dot) \
+	X(fhm, isa->fhm) \
+	X(i8mm, isa->i8mm) \
+	X(bf16, isa->bf16) \
+	X(sve, isa->sve) \
+	X(sve2, isa->sve2) \
+	X(sve_bf16, isa->svebf16) \
+	X(sve_i8mm, isa->svei8mm)
+
+#define ARM_FEATURES(X) \
+	X(aes, isa->aes) \
+	X(sha1, isa->sha1) \
+	X(sha2, isa->sha2) \
+	X(pmull, isa->pmull) \
+	X(crc32, isa->crc32)
+
+struct cpuinfo_isa_bits cpuinfo_isa_bits_supported = { { 0 } };
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	/* Features of each cluster, or NULL if the platform does not report per-cluster features */
+	static struct cpuinfo_isa_bits* cluster_isa_bits = NULL;
+#endif
+
+static inline void add_if(struct cpuinfo_isa_bits* bits, enum cpuinfo_isa_feature feature, bool supported) {
+	if (supported) {
+		cpuinfo_isa_bits_add(bits, feature);
+	}
+}
+
+#define ADD_SUPPORTED_X86(name, condition) add_if(&bits, cpuinfo_isa_x86_##name, cpuinfo_has_x86_##name());
+#define ADD_SUPPORTED_ARM(name, condition) add_if(&bits, cpuinfo_isa_arm_##name, cpuinfo_has_arm_##name());
+#define ADD_CLUSTER_X86(name, condition) add_if(bits, cpuinfo_isa_x86_##name, condition);
+#define ADD_CLUSTER_ARM(name, condition) add_if(bits, cpuinfo_isa_arm_##name, condition);
+
+/*
+ * Adds features of a cluster to the features supported by the host. Features implied by the architecture or the
+ * compilation target are already in the host set, so only the raw ISA description of the cluster is checked.
+ */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+static void add_cluster_isa_bits(struct cpuinfo_isa_bits* bits, const struct cpuinfo_x86_isa* isa) {
+	X86_FEATURES(ADD_CLUSTER_X86)
+}
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+static void add_cluster_isa_bits(struct cpuinfo_isa_bits* bits, const struct cpuinfo_arm_isa* isa) {
+	#if CPUINFO_ARCH_ARM
+		ARM32_FEATURES(ADD_CLUSTER_ARM)
+	#endif
+	#if CPUINFO_ARCH_ARM64
+		ARM64_FEATURES(ADD_CLUSTER_ARM)
+	#endif
+	ARM_FEATURES(ADD_CLUSTER_ARM)
+}
+#endif
+
+void cpuinfo_init_isa_bits(void) {
+	struct cpuinfo_isa_bits bits = { { 0 } };
+	X86_FEATURES(ADD_SUPPORTED_X86)
+	ARM32_FEATURES(ADD_SUPPORTED_ARM)
+	ARM64_FEATURES(ADD_SUPPORTED_ARM)
+	ARM_FEATURES(ADD_SUPPORTED_ARM)
+	cpuinfo_isa_bits_add(&bits, cpuinfo_isa_initialized);
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	if (cpuinfo_cluster_isa != NULL) {
+		cluster_isa_bits = malloc(cpuinfo_clusters_count * sizeof(struct cpuinfo_isa_bits));
+		if (cluster_isa_bits == NULL) {
+			/* Host features are a safe subset of features of every cluster */
+			cpuinfo_log_warning("failed to allocate %zu bytes for ISA features of %"PRIu32" clusters",
+				cpuinfo_clusters_count * sizeof(struct cpuinfo_isa_bits), cpuinfo_clusters_count);
+		} else {
+			for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+				cluster_isa_bits[i] = bits;
+				add_cluster_isa_bits(&cluster_isa_bits[i], &cpuinfo_cluster_isa[i]);
+			}
+		}
+	}
+#endif
+
+	cpuinfo_isa_bits_supported = bits;
+}
+
+void cpuinfo_deinit_isa_bits(void) {
+	cpuinfo_isa_bits_supported = (struct cpuinfo_isa_bits) { { 0 } };
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	free(cluster_isa_bits);
+	cluster_isa_bits = NULL;
+#endif
+}
+
+const struct cpuinfo_isa_bits* cpuinfo_get_cluster_isa_bits(uint32_t cluster_index) {
+	if (cluster_index >= cpuinfo_clusters_count) {
+		return NULL;
+	}
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	if (cluster_isa_bits != NULL) {
+		return &cluster_isa_bits[cluster_index];
+	}
+#endif
+	return &cpuinfo_isa_bits_supported;
+}
+
+/*
+ * struct cpuinfo_x86_isa and struct cpuinfo_arm_isa consist only of bool flags, each stored as a byte of 0 or 1, so a
+ * bytewise AND of the object representations intersects the flags. Access through unsigned char is valid for objects
+ * of any type.
+ */
+static inline void intersect_flags(void* flags, const void* other_flags, size_t size) {
+	unsigned char* bytes = (unsigned char*) flags;
+	const unsigned char* other_bytes = (const unsigned char*) other_flags;
+	for (size_t i = 0; i < size; i++) {
+		bytes[i] &= other_bytes[i];
+	}
+}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	void cpuinfo_intersect_isa(
+		struct cpuinfo_x86_isa isa[restrict static 1],
+		const struct cpuinfo_x86_isa other[restrict static 1])
+	{
+		intersect_flags(isa, other, sizeof(struct cpuinfo_x86_isa));
+	}
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	void cpuinfo_intersect_isa(
+		struct cpuinfo_arm_isa isa[restrict static 1],
+		const struct cpuinfo_arm_isa other[restrict static 1])
+	{
+		intersect_flags(isa, other, sizeof(struct cpuinfo_arm_isa));
+	}
+#endif
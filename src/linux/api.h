@@ -19,10 +19,40 @@
 #define CPUINFO_LINUX_FLAG_SMT_CLUSTER        UINT32_C(0x00000100)
 #define CPUINFO_LINUX_FLAG_CORE_CLUSTER       UINT32_C(0x00000200)
 #define CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER    UINT32_C(0x00000400)
+#define CPUINFO_LINUX_FLAG_CLUSTER_ID         UINT32_C(0x00000800)
+#define CPUINFO_LINUX_FLAG_CAPACITY           UINT32_C(0x00001000)
 
 
 typedef bool (*cpuinfo_cpulist_callback)(uint32_t, uint32_t, void*);
 bool cpuinfo_linux_parse_cpulist(const char* filename, cpuinfo_cpulist_callback callback, void* context);
+
+/* Distinct cpu lists parsed from sysfs files, keyed by the text of the list */
+struct cpuinfo_linux_cpulist_cache_entry {
+	char* text;
+	size_t length;
+	uint32_t hash;
+	/* Processor whose file first contained the list */
+	uint32_t owner;
+	bool status;
+};
+
+struct cpuinfo_linux_cpulist_cache {
+	struct cpuinfo_linux_cpulist_cache_entry* entries;
+	uint32_t entries_mask;
+	uint32_t entries_count;
+	/* Scratch buffer for the text of the file being parsed */
+	char* buffer;
+	size_t buffer_size;
+};
+
+bool cpuinfo_linux_cpulist_cache_init(struct cpuinfo_linux_cpulist_cache cache[restrict static 1], uint32_t max_lists);
+void cpuinfo_linux_cpulist_cache_release(struct cpuinfo_linux_cpulist_cache cache[restrict static 1]);
+bool cpuinfo_linux_parse_cached_cpulist(
+	const char* filename,
+	uint32_t owner,
+	struct cpuinfo_linux_cpulist_cache* cache,
+	cpuinfo_cpulist_callback callback,
+	void* context);
 typedef bool (*cpuinfo_smallfile_callback)(const char*, const char*, void*);
 bool cpuinfo_linux_parse_small_file(const char* filename, size_t buffer_size, cpuinfo_smallfile_callback, void* context);
 typedef bool (*cpuinfo_line_callback)(const char*, const char*, void*, uint64_t);
@@ -33,8 +63,11 @@ uint32_t cpuinfo_linux_get_max_possible_processor(uint32_t max_processors_count)
 uint32_t cpuinfo_linux_get_max_present_processor(uint32_t max_processors_count);
 uint32_t cpuinfo_linux_get_processor_min_frequency(uint32_t processor);
 uint32_t cpuinfo_linux_get_processor_max_frequency(uint32_t processor);
+uint32_t cpuinfo_linux_get_processor_capacity(uint32_t processor);
+uint32_t cpuinfo_linux_get_max_sve_vector_length(void);
 bool cpuinfo_linux_get_processor_package_id(uint32_t processor, uint32_t package_id[restrict static 1]);
 bool cpuinfo_linux_get_processor_core_id(uint32_t processor, uint32_t core_id[restrict static 1]);
+bool cpuinfo_linux_get_processor_cluster_id(uint32_t processor, uint32_t cluster_id[restrict static 1]);
 
 bool cpuinfo_linux_detect_possible_processors(uint32_t max_processors_count,
 	uint32_t* processor0_flags, uint32_t processor_struct_size, uint32_t possible_flag);
@@ -45,11 +78,39 @@ typedef bool (*cpuinfo_siblings_callback)(uint32_t, uint32_t, uint32_t, void*);
 bool cpuinfo_linux_detect_core_siblings(
 	uint32_t max_processors_count,
 	uint32_t processor,
+	struct cpuinfo_linux_cpulist_cache* cache,
 	cpuinfo_siblings_callback callback,
 	void* context);
 bool cpuinfo_linux_detect_thread_siblings(
 	uint32_t max_processors_count,
 	uint32_t processor,
+	struct cpuinfo_linux_cpulist_cache* cache,
+	cpuinfo_siblings_callback callback,
+	void* context);
+bool cpuinfo_linux_detect_cluster_siblings(
+	uint32_t max_processors_count,
+	uint32_t processor,
+	struct cpuinfo_linux_cpulist_cache* cache,
+	cpuinfo_siblings_callback callback,
+	void* context);
+
+enum cpuinfo_linux_cache_type {
+	cpuinfo_linux_cache_type_unknown = 0,
+	cpuinfo_linux_cache_type_data,
+	cpuinfo_linux_cache_type_instruction,
+	cpuinfo_linux_cache_type_unified,
+};
+
+bool cpuinfo_linux_get_processor_cache(
+	uint32_t processor,
+	uint32_t level,
+	enum cpuinfo_linux_cache_type type,
+	struct cpuinfo_cache cache[restrict static 1],
+	uint32_t index[restrict static 1]);
+bool cpuinfo_linux_detect_cache_siblings(
+	uint32_t max_processors_count,
+	uint32_t processor,
+	uint32_t index,
 	cpuinfo_siblings_callback callback,
 	void* context);
 
@@ -97,9 +158,18 @@ struct cpuinfo_android_gpu {
 };
 
 struct cpuinfo_android_gpu cpuinfo_android_decode_gpu(const char* renderer);
+/*
+ * Reads the entry of the table of exactly matched GL_RENDERER strings at the index, in table order. Returns the
+ * GL_RENDERER string of the entry, or NULL if the index is past the end of the table.
+ */
+const char* cpuinfo_android_get_gpu_renderer_entry(size_t index, struct cpuinfo_android_gpu gpu[restrict static 1]);
 void cpuinfo_android_gpu_to_string(
 	const struct cpuinfo_android_gpu gpu[restrict static 1],
 	char name[restrict static CPUINFO_GPU_NAME_MAX]);
 
 extern const struct cpuinfo_processor** cpuinfo_linux_cpu_to_processor_map;
 extern const struct cpuinfo_core** cpuinfo_linux_cpu_to_core_map;
+extern uint32_t cpuinfo_linux_cpu_max;
+
+void cpuinfo_linux_deinit_frequency_cache(void);
+void cpuinfo_linux_deinit_latency_matrix(void);
@@ -0,0 +1,200 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cpuinfo.h>
+#include <linux/api.h>
+#include <log.h>
+
+
+#define STRINGIFY(token) #token
+
+/* Linux creates at most a few cache index directories per processor; scan a fixed number of them */
+#define CACHE_INDEX_MAX 8
+#define CACHE_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/cache/index" STRINGIFY(UINT32_MAX) "/ways_of_associativity"))
+#define CACHE_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/cache/index%" PRIu32 "/%s"
+#define CACHE_FILESIZE 32
+
+
+inline static const char* parse_number(const char* start, const char* end, uint32_t number_ptr[restrict static 1]) {
+	uint32_t number = 0;
+	const char* parsed = start;
+	for (; parsed != end; parsed++) {
+		const uint32_t digit = (uint32_t) (uint8_t) (*parsed) - (uint32_t) '0';
+		if (digit >= 10) {
+			break;
+		}
+		number = number * UINT32_C(10) + digit;
+	}
+	*number_ptr = number;
+	return parsed;
+}
+
+/* Parses a number with an optional K (KiB) or M (MiB) suffix, as in "size" files of cache descriptions */
+static bool size_parser(const char* text_start, const char* text_end, void* context) {
+	uint32_t number = 0;
+	const char* parsed_end = parse_number(text_start, text_end, &number);
+	if (parsed_end == text_start) {
+		return false;
+	}
+
+	if (parsed_end != text_end) {
+		switch (*parsed_end) {
+			case 'K':
+				number *= UINT32_C(1024);
+				break;
+			case 'M':
+				number *= UINT32_C(1048576);
+				break;
+			default:
+				break;
+		}
+	}
+
+	*((uint32_t*) context) = number;
+	return true;
+}
+
+static bool type_parser(const char* text_start, const char* text_end, void* context) {
+	enum cpuinfo_linux_cache_type* type_ptr = (enum cpuinfo_linux_cache_type*) context;
+	const size_t length = (size_t) (text_end - text_start);
+	if (length >= 4 && memcmp(text_start, "Data", 4) == 0) {
+		*type_ptr = cpuinfo_linux_cache_type_data;
+	} else if (length >= 11 && memcmp(text_start, "Instruction", 11) == 0) {
+		*type_ptr = cpuinfo_linux_cache_type_instruction;
+	} else if (length >= 7 && memcmp(text_start, "Unified", 7) == 0) {
+		*type_ptr = cpuinfo_linux_cache_type_unified;
+	} else {
+		*type_ptr = cpuinfo_linux_cache_type_unknown;
+	}
+	return true;
+}
+
+static bool parse_cache_file(
+	uint32_t processor, uint32_t index, const char* name,
+	cpuinfo_smallfile_callback parser, void* context)
+{
+	char filename[CACHE_FILENAME_SIZE];
+	const int chars_formatted = snprintf(filename, CACHE_FILENAME_SIZE, CACHE_FILENAME_FORMAT, processor, index, name);
+	if ((unsigned int) chars_formatted >= CACHE_FILENAME_SIZE) {
+		cpuinfo_log_warning("failed to format filename for cache %s of processor %"PRIu32, name, processor);
+		return false;
+	}
+	return cpuinfo_linux_parse_small_file(filename, CACHE_FILESIZE, parser, context);
+}
+
+/*
+ * Reads the description of a processor's cache from /sys/devices/system/cpu/cpu<N>/cache/index<M>/.
+ *
+ * @param processor - Linux ID of the logical processor.
+ * @param level - cache level (1, 2, 3, ...).
+ * @param type - type of the cache: data, instruction, or unified.
+ * @param[out] cache - cache description. Only size, associativity, sets, partitions, and line_size are set.
+ * @param[out] index - index of the cache directory, to be passed to cpuinfo_linux_detect_cache_siblings.
+ *
+ * @returns true if the kernel reports a cache of the specified level and type, with all its parameters,
+ *          and false otherwise.
+ */
+bool cpuinfo_linux_get_processor_cache(
+	uint32_t processor,
+	uint32_t level,
+	enum cpuinfo_linux_cache_type type,
+	struct cpuinfo_cache cache[restrict static 1],
+	uint32_t index_ptr[restrict static 1])
+{
+	for (uint32_t index = 0; index < CACHE_INDEX_MAX; index++) {
+		uint32_t index_level = 0;
+		if (!parse_cache_file(processor, index, "level", size_parser, &index_level)) {
+			/* Cache directories are numbered consecutively */
+			break;
+		}
+		if (index_level != level) {
+			continue;
+		}
+
+		enum cpuinfo_linux_cache_type index_type = cpuinfo_linux_cache_type_unknown;
+		if (!parse_cache_file(processor, index, "type", type_parser, &index_type) || index_type != type) {
+			continue;
+		}
+
+		uint32_t size = 0, associativity = 0, sets = 0, line_size = 0;
+		if (!parse_cache_file(processor, index, "size", size_parser, &size) ||
+			!parse_cache_file(processor, index, "ways_of_associativity", size_parser, &associativity) ||
+			!parse_cache_file(processor, index, "coherency_line_size", size_parser, &line_size))
+		{
+			cpuinfo_log_info("incomplete description of L%"PRIu32" cache %"PRIu32" of processor %"PRIu32,
+				level, index, processor);
+			return false;
+		}
+		if (size == 0 || associativity == 0 || line_size == 0) {
+			cpuinfo_log_info("invalid description of L%"PRIu32" cache %"PRIu32" of processor %"PRIu32": "
+				"size %"PRIu32", associativity %"PRIu32", line size %"PRIu32,
+				level, index, processor, size, associativity, line_size);
+			return false;
+		}
+		if (!parse_cache_file(processor, index, "number_of_sets", size_parser, &sets) || sets == 0) {
+			sets = size / (associativity * line_size);
+		}
+
+		*cache = (struct cpuinfo_cache) {
+			.size = size,
+			.associativity = associativity,
+			.sets = sets,
+			.partitions = 1,
+			.line_size = line_size,
+		};
+		*index_ptr = index;
+		return true;
+	}
+	return false;
+}
+
+struct cache_siblings_context {
+	uint32_t max_processors_count;
+	uint32_t processor;
+	cpuinfo_siblings_callback callback;
+	void* callback_context;
+};
+
+static bool cache_siblings_parser(uint32_t sibling_list_start, uint32_t sibling_list_end, struct cache_siblings_context* context) {
+	if (sibling_list_end > context->max_processors_count) {
+		cpuinfo_log_warning("ignore cache siblings %"PRIu32"-%"PRIu32" of processor %"PRIu32,
+			context->max_processors_count, sibling_list_end - 1, context->processor);
+		sibling_list_end = context->max_processors_count;
+	}
+
+	return context->callback(context->processor, sibling_list_start, sibling_list_end, context->callback_context);
+}
+
+bool cpuinfo_linux_detect_cache_siblings(
+	uint32_t max_processors_count,
+	uint32_t processor,
+	uint32_t index,
+	cpuinfo_siblings_callback callback,
+	void* context)
+{
+	char shared_cpu_list_filename[CACHE_FILENAME_SIZE];
+	const int chars_formatted = snprintf(
+		shared_cpu_list_filename, CACHE_FILENAME_SIZE, CACHE_FILENAME_FORMAT, processor, index, "shared_cpu_list");
+	if ((unsigned int) chars_formatted >= CACHE_FILENAME_SIZE) {
+		cpuinfo_log_warning("failed to format filename for cache siblings of processor %"PRIu32, processor);
+		return false;
+	}
+
+	struct cache_siblings_context siblings_context = {
+		.max_processors_count = max_processors_count,
+		.processor = processor,
+		.callback = callback,
+		.callback_context = context,
+	};
+	if (cpuinfo_linux_parse_cpulist(shared_cpu_list_filename,
+		(cpuinfo_cpulist_callback) cache_siblings_parser, &siblings_context))
+	{
+		return true;
+	} else {
+		cpuinfo_log_info("failed to parse the list of cache siblings for processor %"PRIu32" from %s",
+			processor, shared_cpu_list_filename);
+		return false;
+	}
+}
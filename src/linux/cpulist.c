@@ -212,3 +212,165 @@ cleanup:
 	}
 	return status;
 }
+
+/* Parses a complete cpu list, e.g. "0-3,8-11\n" */
+static bool parse_cpulist_text(const char* text_start, const char* text_end, cpuinfo_cpulist_callback callback, void* context) {
+	bool status = true;
+	const char* entry_start = text_start;
+	for (const char* entry_end = text_start; ; entry_end++) {
+		if (entry_end == text_end || *entry_end == ',') {
+			status &= parse_entry(entry_start, entry_end, callback, context);
+			if (entry_end == text_end) {
+				break;
+			}
+			entry_start = entry_end + 1;
+		}
+	}
+	return status;
+}
+
+/* FNV-1a hash of the list text */
+static uint32_t hash_text(const char* text, size_t length) {
+	uint32_t hash = UINT32_C(0x811C9DC5);
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ (uint32_t) (uint8_t) text[i]) * UINT32_C(0x01000193);
+	}
+	return hash;
+}
+
+/*
+ * Reads the complete text of a cpu list file into the scratch buffer of the cache.
+ *
+ * @returns Length of the text, or SIZE_MAX if the file could not be read.
+ */
+static size_t read_cpulist_text(const char* filename, struct cpuinfo_linux_cpulist_cache cache[restrict static 1]) {
+	size_t length = SIZE_MAX;
+	int file = -1;
+
+#if CPUINFO_MOCK
+	file = cpuinfo_mock_open(filename, O_RDONLY);
+#else
+	file = open(filename, O_RDONLY);
+#endif
+	if (file == -1) {
+		cpuinfo_log_info("failed to open %s: %s", filename, strerror(errno));
+		goto cleanup;
+	}
+
+	size_t position = 0;
+	ssize_t bytes_read;
+	do {
+		if (position == cache->buffer_size) {
+			const size_t buffer_size = cache->buffer_size == 0 ? BUFFER_SIZE : cache->buffer_size * 2;
+			char* buffer = realloc(cache->buffer, buffer_size);
+			if (buffer == NULL) {
+				cpuinfo_log_error("failed to allocate %zu bytes for the text of %s", buffer_size, filename);
+				goto cleanup;
+			}
+			cache->buffer = buffer;
+			cache->buffer_size = buffer_size;
+		}
+#if CPUINFO_MOCK
+		bytes_read = cpuinfo_mock_read(file, &cache->buffer[position], cache->buffer_size - position);
+#else
+		bytes_read = read(file, &cache->buffer[position], cache->buffer_size - position);
+#endif
+		if (bytes_read < 0) {
+			cpuinfo_log_info("failed to read file %s at position %zu: %s", filename, position, strerror(errno));
+			goto cleanup;
+		}
+		position += (size_t) bytes_read;
+	} while (bytes_read != 0);
+	length = position;
+
+cleanup:
+	if (file != -1) {
+#if CPUINFO_MOCK
+		cpuinfo_mock_close(file);
+#else
+		close(file);
+#endif
+		file = -1;
+	}
+	return length;
+}
+
+bool cpuinfo_linux_cpulist_cache_init(struct cpuinfo_linux_cpulist_cache cache[restrict static 1], uint32_t max_lists) {
+	/* Keep the open-addressing table at most half full */
+	uint32_t entries_count = 2;
+	while (entries_count < max_lists * 2) {
+		entries_count *= 2;
+	}
+
+	*cache = (struct cpuinfo_linux_cpulist_cache) { 0 };
+	cache->entries = calloc(entries_count, sizeof(struct cpuinfo_linux_cpulist_cache_entry));
+	if (cache->entries == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for the cache of %"PRIu32" cpu lists",
+			entries_count * sizeof(struct cpuinfo_linux_cpulist_cache_entry), max_lists);
+		return false;
+	}
+	cache->entries_mask = entries_count - 1;
+	return true;
+}
+
+void cpuinfo_linux_cpulist_cache_release(struct cpuinfo_linux_cpulist_cache cache[restrict static 1]) {
+	if (cache->entries != NULL) {
+		for (uint32_t i = 0; i <= cache->entries_mask; i++) {
+			free(cache->entries[i].text);
+		}
+		free(cache->entries);
+	}
+	free(cache->buffer);
+	*cache = (struct cpuinfo_linux_cpulist_cache) { 0 };
+}
+
+/*
+ * Parses a cpu list file, and invokes the callback for each range in the list only the first time the list is seen.
+ * Sysfs reports the same list (e.g. "0-63") for every processor in a group; for subsequent processors with the same
+ * list, the callback is invoked only once, with the single-processor range of the processor which first reported it.
+ *
+ * @param owner - processor described by the file, recorded for the list if it is seen for the first time.
+ * @param cache - cache of previously parsed lists. If NULL, the list is always parsed.
+ */
+bool cpuinfo_linux_parse_cached_cpulist(
+	const char* filename,
+	uint32_t owner,
+	struct cpuinfo_linux_cpulist_cache* cache,
+	cpuinfo_cpulist_callback callback,
+	void* context)
+{
+	if (cache == NULL || cache->entries == NULL) {
+		return cpuinfo_linux_parse_cpulist(filename, callback, context);
+	}
+
+	const size_t length = read_cpulist_text(filename, cache);
+	if (length == SIZE_MAX) {
+		return false;
+	}
+
+	const uint32_t hash = hash_text(cache->buffer, length);
+	uint32_t slot = hash & cache->entries_mask;
+	for (; cache->entries[slot].text != NULL; slot = (slot + 1) & cache->entries_mask) {
+		const struct cpuinfo_linux_cpulist_cache_entry* entry = &cache->entries[slot];
+		if (entry->hash == hash && entry->length == length && memcmp(entry->text, cache->buffer, length) == 0) {
+			return callback(entry->owner, entry->owner + 1, context) && entry->status;
+		}
+	}
+
+	const bool status = parse_cpulist_text(cache->buffer, cache->buffer + length, callback, context);
+	if (cache->entries_count * 2 < cache->entries_mask + 1) {
+		char* text = malloc(length == 0 ? 1 : length);
+		if (text != NULL) {
+			memcpy(text, cache->buffer, length);
+			cache->entries[slot] = (struct cpuinfo_linux_cpulist_cache_entry) {
+				.text = text,
+				.length = length,
+				.hash = hash,
+				.owner = owner,
+				.status = status,
+			};
+			cache->entries_count += 1;
+		}
+	}
+	return status;
+}
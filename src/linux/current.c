@@ -14,11 +14,13 @@
 
 const struct cpuinfo_processor** cpuinfo_linux_cpu_to_processor_map;
 const struct cpuinfo_core** cpuinfo_linux_cpu_to_core_map;
+/* Number of entries in cpuinfo_linux_cpu_to_processor_map and cpuinfo_linux_cpu_to_core_map */
+uint32_t cpuinfo_linux_cpu_max = 0;
 
 
 const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_current_processor(void) {
 	const int cpu = sched_getcpu();
-	if (cpu >= 0) {
+	if (cpu >= 0 && (uint32_t) cpu < cpuinfo_linux_cpu_max) {
 		return cpuinfo_linux_cpu_to_processor_map[cpu];
 	} else {
 		return &cpuinfo_processors[0];
@@ -27,7 +29,7 @@ const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_current_processor(void)
 
 const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_current_core(void) {
 	const int cpu = sched_getcpu();
-	if (cpu >= 0) {
+	if (cpu >= 0 && (uint32_t) cpu < cpuinfo_linux_cpu_max) {
 		return cpuinfo_linux_cpu_to_core_map[cpu];
 	} else {
 		return &cpuinfo_cores[0];
@@ -0,0 +1,324 @@
+#define _GNU_SOURCE 1
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <linux/api.h>
+#include <log.h>
+
+
+#define STRINGIFY(token) #token
+
+#define MSR_FILENAME_SIZE (sizeof("/dev/cpu/" STRINGIFY(UINT32_MAX) "/msr"))
+#define MSR_FILENAME_FORMAT "/dev/cpu/%" PRIu32 "/msr"
+
+/* Architectural MSRs counting actual (APERF) and maximum non-Turbo (MPERF) clock cycles in C0 state */
+#define MSR_IA32_MPERF 0xE7
+#define MSR_IA32_APERF 0xE8
+
+/* Duration of the busy loop while the core ramps up from idle to its operating frequency */
+#define WARMUP_NANOSECONDS    UINT64_C(20000000)
+/* Duration of a single measurement */
+#define MEASURE_NANOSECONDS   UINT64_C(10000000)
+/* Number of measurements with the dependent-add loop: the fastest one is used */
+#define MEASURE_REPETITIONS   3
+/* Number of dependent additions in one iteration of the calibration loop */
+#define ADDS_PER_ITERATION    8
+
+
+static pthread_mutex_t frequency_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+/* Cached results of measurements, indexed by cluster. Allocated on the first measurement. */
+static uint64_t* cluster_frequency_cache = NULL;
+
+static inline uint64_t get_nanoseconds(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+/*
+ * Runs a chain of (iterations * ADDS_PER_ITERATION) dependent integer additions.
+ * Integer addition has latency of 1 cycle on all supported microarchitectures, and loop control instructions do not
+ * depend on the chain and execute in parallel with it, so the loop takes one clock cycle per addition. The loop is
+ * written in assembly to make its timing independent of compiler and optimization options. The increment is kept in a
+ * register because some microarchitectures (e.g. Intel Golden Cove) fold chains of additions of immediate operands
+ * at register renaming.
+ */
+static uint64_t run_dependent_adds(uint64_t iterations) {
+	if (iterations == 0) {
+		return 0;
+	}
+	uintptr_t accumulator = 0;
+	uintptr_t counter = (uintptr_t) iterations;
+	const uintptr_t increment = 1;
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	__asm__ __volatile__ (
+		"1:\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"add %[increment], %[accumulator]\n"
+		"sub $1, %[counter]\n"
+		"jnz 1b\n"
+		: [accumulator] "+r" (accumulator), [counter] "+r" (counter)
+		: [increment] "r" (increment)
+		: "cc");
+#elif CPUINFO_ARCH_ARM64
+	__asm__ __volatile__ (
+		"1:\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"add %x[accumulator], %x[accumulator], %x[increment]\n"
+		"subs %x[counter], %x[counter], #1\n"
+		"b.ne 1b\n"
+		: [accumulator] "+r" (accumulator), [counter] "+r" (counter)
+		: [increment] "r" (increment)
+		: "cc");
+#elif CPUINFO_ARCH_ARM
+	__asm__ __volatile__ (
+		"1:\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"add %[accumulator], %[accumulator], %[increment]\n"
+		"subs %[counter], %[counter], #1\n"
+		"bne 1b\n"
+		: [accumulator] "+r" (accumulator), [counter] "+r" (counter)
+		: [increment] "r" (increment)
+		: "cc");
+#else
+	/* Empty asm statements prevent the compiler from folding the additions together */
+	do {
+		for (uint32_t i = 0; i < ADDS_PER_ITERATION; i++) {
+			accumulator += increment;
+			__asm__ __volatile__ ("" : "+r" (accumulator));
+		}
+	} while (--counter != 0);
+#endif
+	return (uint64_t) accumulator;
+}
+
+static void busy_wait(uint64_t nanoseconds) {
+	const uint64_t start = get_nanoseconds();
+	while (get_nanoseconds() - start < nanoseconds) {
+		run_dependent_adds(1024);
+	}
+}
+
+/*
+ * Measures frequency of the current core by timing a calibrated chain of dependent additions.
+ * This method works on any processor and in virtual machines, but is sensitive to preemption: to minimize its
+ * effect, the function repeats the measurement and reports the fastest run.
+ *
+ * @returns Clock frequency, in Hz, or 0 if the measurement failed.
+ */
+static uint64_t measure_frequency_by_dependent_adds(void) {
+	/* Calibrate the number of iterations to take approximately MEASURE_NANOSECONDS */
+	uint64_t iterations = 1024;
+	uint64_t elapsed = 0;
+	do {
+		iterations *= 2;
+		const uint64_t start = get_nanoseconds();
+		run_dependent_adds(iterations);
+		elapsed = get_nanoseconds() - start;
+	} while (elapsed < MEASURE_NANOSECONDS / 16 && iterations < UINT64_C(0x0000400000000000));
+	if (elapsed == 0) {
+		return 0;
+	}
+	iterations = iterations * MEASURE_NANOSECONDS / elapsed;
+
+	uint64_t min_elapsed = UINT64_MAX;
+	for (uint32_t r = 0; r < MEASURE_REPETITIONS; r++) {
+		const uint64_t start = get_nanoseconds();
+		run_dependent_adds(iterations);
+		elapsed = get_nanoseconds() - start;
+		if (elapsed < min_elapsed) {
+			min_elapsed = elapsed;
+		}
+	}
+	if (min_elapsed == 0) {
+		return 0;
+	}
+	return (uint64_t) ((double) (iterations * ADDS_PER_ITERATION) * 1.0e+9 / (double) min_elapsed);
+}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	static bool read_msr(int file, uint32_t msr, uint64_t value[restrict static 1]) {
+		return pread(file, value, sizeof(uint64_t), (off_t) msr) == sizeof(uint64_t);
+	}
+
+	/*
+	 * Measures effective frequency of the specified core from the APERF/MPERF counters while the core is busy.
+	 * Reading the counters requires the msr kernel module and read access to /dev/cpu/<N>/msr, which usually means
+	 * root privileges, and the counters are often not virtualized by hypervisors.
+	 *
+	 * @param cpu - Linux ID of the logical processor. The calling thread must be pinned to this processor.
+	 *
+	 * @returns Effective clock frequency, in Hz, or 0 if the counters are not accessible.
+	 */
+	static uint64_t measure_frequency_by_aperf_mperf(uint32_t cpu) {
+		uint64_t frequency = 0;
+		char msr_filename[MSR_FILENAME_SIZE];
+		const int chars_formatted = snprintf(msr_filename, MSR_FILENAME_SIZE, MSR_FILENAME_FORMAT, cpu);
+		if ((unsigned int) chars_formatted >= MSR_FILENAME_SIZE) {
+			cpuinfo_log_warning("failed to format filename for MSRs of processor %"PRIu32, cpu);
+			return 0;
+		}
+
+		int file = open(msr_filename, O_RDONLY);
+		if (file == -1) {
+			cpuinfo_log_debug("failed to open %s: %s", msr_filename, strerror(errno));
+			goto cleanup;
+		}
+
+		uint64_t aperf_start, mperf_start, aperf_end, mperf_end;
+		const uint64_t start = get_nanoseconds();
+		if (!read_msr(file, MSR_IA32_APERF, &aperf_start) || !read_msr(file, MSR_IA32_MPERF, &mperf_start)) {
+			cpuinfo_log_debug("failed to read APERF/MPERF MSRs from %s: %s", msr_filename, strerror(errno));
+			goto cleanup;
+		}
+		busy_wait(MEASURE_NANOSECONDS);
+		if (!read_msr(file, MSR_IA32_APERF, &aperf_end) || !read_msr(file, MSR_IA32_MPERF, &mperf_end)) {
+			cpuinfo_log_debug("failed to read APERF/MPERF MSRs from %s: %s", msr_filename, strerror(errno));
+			goto cleanup;
+		}
+		const uint64_t elapsed = get_nanoseconds() - start;
+
+		const uint64_t aperf_delta = aperf_end - aperf_start;
+		const uint64_t mperf_delta = mperf_end - mperf_start;
+		if (aperf_delta == 0 || mperf_delta == 0 || elapsed == 0) {
+			cpuinfo_log_debug("APERF/MPERF MSRs on processor %"PRIu32" do not count", cpu);
+			goto cleanup;
+		}
+
+		/*
+		 * MPERF ticks at the maximum non-Turbo frequency while the core is in C0 state, and APERF ticks at the actual
+		 * frequency. As the core is busy for the whole interval, effective frequency = APERF rate = MPERF rate * ratio.
+		 */
+		const double mperf_rate = (double) mperf_delta * 1.0e+9 / (double) elapsed;
+		frequency = (uint64_t) (mperf_rate * (double) aperf_delta / (double) mperf_delta);
+		cpuinfo_log_debug("processor %"PRIu32": APERF/MPERF ratio %.3lf, effective frequency %"PRIu64" Hz",
+			cpu, (double) aperf_delta / (double) mperf_delta, frequency);
+
+	cleanup:
+		if (file != -1) {
+			close(file);
+			file = -1;
+		}
+		return frequency;
+	}
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+
+/*
+ * Stores the measured frequency of the cluster in cache. Topology arrays are immutable after initialization and are
+ * read without locks, so the measurement is only available through cpuinfo_get_current_core_frequency().
+ */
+static void update_cluster_frequency(uint32_t cluster_index, uint64_t frequency) {
+	pthread_mutex_lock(&frequency_cache_mutex);
+	if (cluster_frequency_cache == NULL) {
+		cluster_frequency_cache = calloc(cpuinfo_clusters_count, sizeof(uint64_t));
+		if (cluster_frequency_cache == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for frequencies of %"PRIu32" clusters",
+				cpuinfo_clusters_count * sizeof(uint64_t), cpuinfo_clusters_count);
+			goto cleanup;
+		}
+	}
+	cluster_frequency_cache[cluster_index] = frequency;
+
+cleanup:
+	pthread_mutex_unlock(&frequency_cache_mutex);
+}
+
+uint64_t CPUINFO_ABI cpuinfo_measure_current_core_frequency(void) {
+	const int cpu = sched_getcpu();
+	if (cpu < 0 || (uint32_t) cpu >= cpuinfo_linux_cpu_max || cpuinfo_linux_cpu_to_processor_map == NULL) {
+		cpuinfo_log_warning("failed to detect the current processor");
+		return 0;
+	}
+	const struct cpuinfo_processor* processor = cpuinfo_linux_cpu_to_processor_map[cpu];
+	if (processor == NULL || processor->cluster == NULL) {
+		/* Processors which were offline or hot-plugged after initialization are not in the topology */
+		cpuinfo_log_warning("processor %d is not in the detected topology", cpu);
+		return 0;
+	}
+
+	/* Pin the thread to the current processor for the duration of the measurement */
+	cpu_set_t old_affinity, new_affinity;
+	const bool restore_affinity = sched_getaffinity(0, sizeof(cpu_set_t), &old_affinity) == 0;
+	CPU_ZERO(&new_affinity);
+	CPU_SET(cpu, &new_affinity);
+	if (sched_setaffinity(0, sizeof(cpu_set_t), &new_affinity) != 0) {
+		cpuinfo_log_info("failed to pin thread to processor %d: %s", cpu, strerror(errno));
+	}
+
+	busy_wait(WARMUP_NANOSECONDS);
+
+	uint64_t frequency = 0;
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		frequency = measure_frequency_by_aperf_mperf((uint32_t) cpu);
+	#endif
+	if (frequency == 0) {
+		frequency = measure_frequency_by_dependent_adds();
+		cpuinfo_log_debug("processor %d: effective frequency %"PRIu64" Hz measured by calibrated loop", cpu, frequency);
+	}
+
+	if (restore_affinity) {
+		sched_setaffinity(0, sizeof(cpu_set_t), &old_affinity);
+	}
+
+	if (frequency != 0) {
+		update_cluster_frequency((uint32_t) (processor->cluster - cpuinfo_clusters), frequency);
+	}
+	return frequency;
+}
+
+void cpuinfo_linux_deinit_frequency_cache(void) {
+	pthread_mutex_lock(&frequency_cache_mutex);
+	free(cluster_frequency_cache);
+	cluster_frequency_cache = NULL;
+	pthread_mutex_unlock(&frequency_cache_mutex);
+}
+
+uint64_t CPUINFO_ABI cpuinfo_get_current_core_frequency(void) {
+	const struct cpuinfo_core* core = cpuinfo_get_current_core();
+	if (core == NULL) {
+		return 0;
+	}
+
+	const uint32_t cluster_index = (uint32_t) (core->cluster - cpuinfo_clusters);
+	uint64_t frequency = 0;
+	pthread_mutex_lock(&frequency_cache_mutex);
+	if (cluster_frequency_cache != NULL) {
+		frequency = cluster_frequency_cache[cluster_index];
+	}
+	pthread_mutex_unlock(&frequency_cache_mutex);
+
+	if (frequency == 0) {
+		frequency = cpuinfo_measure_current_core_frequency();
+	}
+	return frequency;
+}
@@ -7,6 +7,9 @@
 #include <log.h>
 
 
+#define CPUINFO_COUNT_OF(x) (sizeof(x) / sizeof(0[x]))
+
+
 /*
  * Map from Android GPU series ID to Android GPU vendor ID.
  * This map is used to avoid storing vendor IDs in tables.
@@ -96,6 +99,117 @@ void cpuinfo_android_gpu_to_string(
 	}
 }
 
+/* GL_RENDERER string which does not follow the naming pattern of its GPU series */
+struct gpu_renderer_entry {
+	const char* renderer;
+	uint16_t model;
+	uint8_t series;
+	char suffix;
+};
+
+/*
+ * Table of GL_RENDERER strings which are decoded only by exact match.
+ * Entries are sorted by GL_RENDERER string (in strcmp order) for binary search.
+ */
+static const struct gpu_renderer_entry gpu_renderer_entries[] = {
+	{
+		/* Vivante GC4000 in early HiSilicon chipsets */
+		.renderer = "Immersion.16",
+		.series = cpuinfo_android_gpu_series_vivante_gc,
+		.model = 4000,
+	},
+	{
+		.renderer = "Intel(R) HD Graphics for Atom(TM) x5/x7",
+		.series = cpuinfo_android_gpu_series_intel_gen,
+		.model = 8,
+	},
+	{
+		.renderer = "Intel(R) HD Graphics for BayTrail",
+		.series = cpuinfo_android_gpu_series_intel_gen,
+		.model = 7,
+	},
+	{
+		.renderer = "Mesa DRI Intel(R) Sandybridge Mobile x86/MMX/SSE2",
+		.series = cpuinfo_android_gpu_series_intel_gen,
+		.model = 6,
+	},
+	{
+		.renderer = "NVIDIA Tegra",
+		.series = cpuinfo_android_gpu_series_nvidia_tegra,
+	},
+	{
+		.renderer = "NVIDIA Tegra 3",
+		.series = cpuinfo_android_gpu_series_nvidia_tegra,
+		.model = 3,
+	},
+	{
+		/* Vivante GC5000 in PXA1928 chipset */
+		.renderer = "PXA1928 GPU",
+		.series = cpuinfo_android_gpu_series_vivante_gc,
+		.model = 5000,
+	},
+	{
+		.renderer = "PowerVR Rogue Han",
+		.series = cpuinfo_android_gpu_series_powervr_rogue_g,
+		.model = 6200,
+	},
+	{
+		.renderer = "PowerVR Rogue Hood",
+		.series = cpuinfo_android_gpu_series_powervr_rogue_g,
+		.model = 6430,
+	},
+	{
+		.renderer = "PowerVR Rogue Marlowe",
+		.series = cpuinfo_android_gpu_series_powervr_rogue_gt,
+		.model = 7400,
+		.suffix = '+',
+	},
+	{
+		/* ARM Mali-T720 in some MT8163 chipsets */
+		.renderer = "Sapphire 650",
+		.series = cpuinfo_android_gpu_series_arm_mali_t,
+		.model = 720,
+	},
+	{
+		.renderer = "VideoCore IV HW",
+		.series = cpuinfo_android_gpu_series_broadcom_videocore,
+		.model = 4,
+	},
+};
+
+/*
+ * Looks up a GL_RENDERER string in the table of exactly matched GL_RENDERER strings with binary search.
+ *
+ * @param[in] renderer - the GL_RENDERER string.
+ *
+ * @returns pointer to the matching table entry, or NULL if the GL_RENDERER string is not in the table.
+ */
+static const struct gpu_renderer_entry* find_gpu_renderer_entry(const char* renderer) {
+	size_t first = 0, last = CPUINFO_COUNT_OF(gpu_renderer_entries);
+	while (first != last) {
+		const size_t middle = first + (last - first) / 2;
+		const int comparison = strcmp(renderer, gpu_renderer_entries[middle].renderer);
+		if (comparison == 0) {
+			return &gpu_renderer_entries[middle];
+		} else if (comparison < 0) {
+			last = middle;
+		} else {
+			first = middle + 1;
+		}
+	}
+	return NULL;
+}
+
+static struct cpuinfo_android_gpu entry_gpu(const struct gpu_renderer_entry entry[restrict static 1]) {
+	struct cpuinfo_android_gpu gpu;
+	memset(&gpu, 0, sizeof(gpu));
+	gpu.series = (enum cpuinfo_android_gpu_series) entry->series;
+	gpu.model = entry->model;
+	gpu.suffix[0] = entry->suffix;
+	gpu.vendor = gpu_series_vendor[gpu.series];
+	return gpu;
+}
+
 /*
  * Decodes GPU name from OpenGL (ES) GL_RENDERER string.
  *
@@ -109,6 +223,11 @@ struct cpuinfo_android_gpu cpuinfo_android_decode_gpu(const char* renderer) {
 	memset(&gpu, 0, sizeof(gpu));
 
 	if (renderer != NULL) {
+		const struct gpu_renderer_entry* entry = find_gpu_renderer_entry(renderer);
+		if (entry != NULL) {
+			return entry_gpu(entry);
+		}
+
 		switch (renderer[0]) {
 			case 'A':
 				if (sscanf(renderer, "Adreno (TM) %"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
@@ -120,19 +239,6 @@ struct cpuinfo_android_gpu cpuinfo_android_decode_gpu(const char* renderer) {
 					gpu.series = cpuinfo_android_gpu_series_vivante_gc;
 				}
 				break;
-			case 'I':
-				if (strcmp(renderer, "Immersion.16") == 0) {
-					/* Vivante GC4000 in early HiSilicon chipsets */
-					gpu.series = cpuinfo_android_gpu_series_vivante_gc;
-					gpu.model = 4000;
-				} else if (strcmp(renderer, "Intel(R) HD Graphics for BayTrail") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_intel_gen;
-					gpu.model = 7;
-				} else if (strcmp(renderer, "Intel(R) HD Graphics for Atom(TM) x5/x7") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_intel_gen;
-					gpu.model = 8;
-				}
-				break;
 			case 'M':
 				if (sscanf(renderer, "Mali-%"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
 					gpu.series = cpuinfo_android_gpu_series_arm_mali;
@@ -146,26 +252,10 @@ struct cpuinfo_android_gpu cpuinfo_android_decode_gpu(const char* renderer) {
 					gpu.series = cpuinfo_android_gpu_series_arm_mali_g;
 				} else if (sscanf(renderer, "Mesa DRI Intel(R) HD Graphics %"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
 					gpu.series = cpuinfo_android_gpu_series_intel_hd_graphics;
-				} else if (strcmp(renderer, "Mesa DRI Intel(R) Sandybridge Mobile x86/MMX/SSE2") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_intel_gen;
-					gpu.model = 6;
-				}
-				break;
-			case 'N':
-				if (strcmp(renderer, "NVIDIA Tegra 3") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_nvidia_tegra;
-					gpu.model = 3;
-				} else if (strcmp(renderer, "NVIDIA Tegra") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_nvidia_tegra;
-					gpu.model = 0;
 				}
 				break;
 			case 'P':
-				if (strcmp(renderer, "PXA1928 GPU") == 0) {
-					/* Vivante GC5000 in PXA1928 chipset */
-					gpu.series = cpuinfo_android_gpu_series_vivante_gc;
-					gpu.model = 5000;
-				} else if (sscanf(renderer, "PowerVR SGX %"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
+				if (sscanf(renderer, "PowerVR SGX %"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
 					gpu.series = cpuinfo_android_gpu_series_powervr_sgx;
 				} else if (sscanf(renderer, "PowerVR Rogue G%"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
 					gpu.series = cpuinfo_android_gpu_series_powervr_rogue_g;
@@ -177,30 +267,10 @@ struct cpuinfo_android_gpu cpuinfo_android_decode_gpu(const char* renderer) {
 					gpu.series = cpuinfo_android_gpu_series_powervr_rogue_gt;
 				} else if (sscanf(renderer, "PowerVR Rogue GX%"SCNu32, &gpu.model) == 1 && gpu.model != 0) {
 					gpu.series = cpuinfo_android_gpu_series_powervr_rogue_gx;
-				} else if (strcmp(renderer, "PowerVR Rogue Han") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_powervr_rogue_g;
-					gpu.model = 6200;
-				} else if (strcmp(renderer, "PowerVR Rogue Hood") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_powervr_rogue_g;
-					gpu.model = 6430;
-				} else if (strcmp(renderer, "PowerVR Rogue Marlowe") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_powervr_rogue_gt;
-					gpu.model = 7400;
-					gpu.suffix[0] = '+';
-				}
-				break;
-			case 'S':
-				if (strcmp(renderer, "Sapphire 650") == 0) {
-					/* ARM Mali-T720 in some MT8163 chipsets */
-					gpu.series = cpuinfo_android_gpu_series_arm_mali_t;
-					gpu.model = 720;
 				}
 				break;
 			case 'V':
-				if (strcmp(renderer, "VideoCore IV HW") == 0) {
-					gpu.series = cpuinfo_android_gpu_series_broadcom_videocore;
-					gpu.model = 4;
-				} else if (sscanf(renderer, "Vivante GC%"SCNu32"%3s", &gpu.model, gpu.suffix) == 2 && gpu.model != 0) {
+				if (sscanf(renderer, "Vivante GC%"SCNu32"%3s", &gpu.model, gpu.suffix) == 2 && gpu.model != 0) {
 					gpu.series = cpuinfo_android_gpu_series_vivante_gc;
 				}
 				break;
@@ -210,3 +280,12 @@ struct cpuinfo_android_gpu cpuinfo_android_decode_gpu(const char* renderer) {
 
 	return gpu;
 }
+
+const char* cpuinfo_android_get_gpu_renderer_entry(size_t index, struct cpuinfo_android_gpu gpu[restrict static 1]) {
+	if (index >= CPUINFO_COUNT_OF(gpu_renderer_entries)) {
+		return NULL;
+	}
+
+	*gpu = entry_gpu(&gpu_renderer_entries[index]);
+	return gpu_renderer_entries[index].renderer;
+}
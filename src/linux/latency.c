@@ -0,0 +1,281 @@
+#define _GNU_SOURCE 1
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include <sched.h>
+#include <pthread.h>
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+
+
+/* Number of round trips in one timed measurement */
+#define ROUND_TRIPS           1000
+/* Number of timed measurements for each pair of processors: the fastest one is used */
+#define MEASURE_REPETITIONS   5
+/* Alignment of the cache line bounced between the threads. Covers adjacent-line prefetch on x86. */
+#define PING_PONG_ALIGNMENT   128
+
+
+/*
+ * State of one pair of threads. The structure is aligned, and thus padded, to PING_PONG_ALIGNMENT, so that in an
+ * array of pairs the counter of a pair does not share cache lines with the fields of the previous pair.
+ */
+struct __attribute__((__aligned__(PING_PONG_ALIGNMENT))) ping_pong {
+	/* Cache line bounced between the threads: odd values are written by ping thread, even values by pong thread */
+	uint32_t counter;
+	uint32_t padding[PING_PONG_ALIGNMENT / sizeof(uint32_t) - 1];
+	/* Number of threads pinned to their processors (or failed to pin) */
+	uint32_t ready;
+	/* Set if any of the threads failed to pin itself */
+	uint32_t failed;
+	int ping_linux_id;
+	int pong_linux_id;
+	/* Minimum measured round-trip latency in nanoseconds */
+	uint64_t round_trip_nanoseconds;
+};
+
+static pthread_mutex_t latency_matrix_mutex = PTHREAD_MUTEX_INITIALIZER;
+/*
+ * Round-trip latencies, in nanoseconds, between pairs of logical processors. The matrix is symmetric with zero
+ * diagonal, and only the strictly lower triangle is stored: entry for processors i > j is at i * (i - 1) / 2 + j.
+ */
+static uint32_t* latency_matrix = NULL;
+static uint32_t latency_matrix_processors = 0;
+
+static inline uint64_t get_nanoseconds(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+static inline size_t get_pair_index(uint32_t i, uint32_t j) {
+	if (i < j) {
+		const uint32_t t = i;
+		i = j;
+		j = t;
+	}
+	return (size_t) i * (size_t) (i - 1) / 2 + (size_t) j;
+}
+
+/* Pins the calling thread and waits until the peer thread is pinned too. Returns false if any of them failed. */
+static bool pin_and_synchronize(struct ping_pong ping_pong[restrict static 1], int linux_id) {
+	cpu_set_t affinity;
+	CPU_ZERO(&affinity);
+	CPU_SET(linux_id, &affinity);
+	if (sched_setaffinity(0, sizeof(cpu_set_t), &affinity) != 0) {
+		cpuinfo_log_warning("failed to pin thread to processor %d: %s", linux_id, strerror(errno));
+		__atomic_store_n(&ping_pong->failed, 1, __ATOMIC_RELAXED);
+	}
+	__atomic_add_fetch(&ping_pong->ready, 1, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(&ping_pong->ready, __ATOMIC_SEQ_CST) != 2);
+	return __atomic_load_n(&ping_pong->failed, __ATOMIC_RELAXED) == 0;
+}
+
+static void* ping_thread(void* argument) {
+	struct ping_pong* ping_pong = (struct ping_pong*) argument;
+	if (!pin_and_synchronize(ping_pong, ping_pong->ping_linux_id)) {
+		return NULL;
+	}
+
+	uint64_t best_nanoseconds = UINT64_MAX;
+	uint32_t counter = 0;
+	for (uint32_t repetition = 0; repetition < MEASURE_REPETITIONS; repetition++) {
+		const uint64_t start = get_nanoseconds();
+		for (uint32_t i = 0; i < ROUND_TRIPS; i++) {
+			__atomic_store_n(&ping_pong->counter, ++counter, __ATOMIC_RELEASE);
+			counter++;
+			while (__atomic_load_n(&ping_pong->counter, __ATOMIC_ACQUIRE) != counter);
+		}
+		const uint64_t nanoseconds = get_nanoseconds() - start;
+		if (nanoseconds < best_nanoseconds) {
+			best_nanoseconds = nanoseconds;
+		}
+	}
+	ping_pong->round_trip_nanoseconds = (best_nanoseconds + ROUND_TRIPS / 2) / ROUND_TRIPS;
+	return NULL;
+}
+
+static void* pong_thread(void* argument) {
+	struct ping_pong* ping_pong = (struct ping_pong*) argument;
+	if (!pin_and_synchronize(ping_pong, ping_pong->pong_linux_id)) {
+		return NULL;
+	}
+
+	uint32_t counter = 0;
+	for (uint32_t i = 0; i < MEASURE_REPETITIONS * ROUND_TRIPS; i++) {
+		counter++;
+		while (__atomic_load_n(&ping_pong->counter, __ATOMIC_ACQUIRE) != counter);
+		__atomic_store_n(&ping_pong->counter, ++counter, __ATOMIC_RELEASE);
+	}
+	return NULL;
+}
+
+/* Measures latencies of pairs in parallel. Returns the number of pairs measured. */
+static uint32_t measure_round(struct ping_pong* ping_pongs, uint32_t pairs, pthread_t* threads) {
+	uint32_t started_pairs = 0;
+	for (; started_pairs < pairs; started_pairs++) {
+		int error = pthread_create(&threads[started_pairs * 2], NULL, ping_thread, &ping_pongs[started_pairs]);
+		if (error != 0) {
+			cpuinfo_log_error("failed to create thread: %s", strerror(error));
+			break;
+		}
+		error = pthread_create(&threads[started_pairs * 2 + 1], NULL, pong_thread, &ping_pongs[started_pairs]);
+		if (error != 0) {
+			cpuinfo_log_error("failed to create thread: %s", strerror(error));
+			/* Release the ping thread: it waits for its peer to become ready */
+			__atomic_store_n(&ping_pongs[started_pairs].failed, 1, __ATOMIC_RELAXED);
+			__atomic_add_fetch(&ping_pongs[started_pairs].ready, 1, __ATOMIC_SEQ_CST);
+			pthread_join(threads[started_pairs * 2], NULL);
+			break;
+		}
+	}
+	for (uint32_t i = 0; i < started_pairs; i++) {
+		pthread_join(threads[i * 2], NULL);
+		pthread_join(threads[i * 2 + 1], NULL);
+	}
+	return started_pairs;
+}
+
+bool CPUINFO_ABI cpuinfo_measure_processor_latencies(void) {
+	const uint32_t processors_count = cpuinfo_processors_count;
+	const size_t matrix_entries = (size_t) processors_count * (size_t) (processors_count - 1) / 2;
+	uint32_t* matrix = NULL;
+	bool* core_busy = NULL;
+	struct ping_pong* ping_pongs = NULL;
+	pthread_t* threads = NULL;
+	uint32_t* pair_processors = NULL;
+	bool success = false;
+
+	if (cpuinfo_processors == NULL || processors_count == 0) {
+		cpuinfo_log_error("cpuinfo is not initialized");
+		return false;
+	}
+
+	matrix = calloc(matrix_entries + 1, sizeof(uint32_t));
+	if (matrix == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for latency matrix of %"PRIu32" processors",
+			(matrix_entries + 1) * sizeof(uint32_t), processors_count);
+		goto cleanup;
+	}
+
+	core_busy = calloc(cpuinfo_cores_count, sizeof(bool));
+	if (core_busy == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for core occupancy", cpuinfo_cores_count * sizeof(bool));
+		goto cleanup;
+	}
+
+	/* At most one pair per core can run in a round (pairs of SMT siblings occupy a single core) */
+	const uint32_t max_pairs = cpuinfo_cores_count;
+	if (posix_memalign((void**) &ping_pongs, PING_PONG_ALIGNMENT, max_pairs * sizeof(struct ping_pong)) != 0) {
+		ping_pongs = NULL;
+		cpuinfo_log_error("failed to allocate %zu bytes for ping-pong state", max_pairs * sizeof(struct ping_pong));
+		goto cleanup;
+	}
+
+	threads = calloc(max_pairs * 2, sizeof(pthread_t));
+	if (threads == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for thread handles", max_pairs * 2 * sizeof(pthread_t));
+		goto cleanup;
+	}
+
+	pair_processors = calloc(max_pairs * 2, sizeof(uint32_t));
+	if (pair_processors == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for processor pairs", max_pairs * 2 * sizeof(uint32_t));
+		goto cleanup;
+	}
+
+	/*
+	 * Greedily group unmeasured pairs into rounds so that no two pairs in a round use the same core. Pairs of SMT
+	 * siblings occupy one core. Pairs in a round are measured in parallel.
+	 */
+	size_t remaining_pairs = matrix_entries;
+	while (remaining_pairs != 0) {
+		memset(core_busy, 0, cpuinfo_cores_count * sizeof(bool));
+		uint32_t pairs = 0;
+		for (uint32_t i = 1; i < processors_count; i++) {
+			const uint32_t core_i = (uint32_t) (cpuinfo_processors[i].core - cpuinfo_cores);
+			if (core_busy[core_i]) {
+				continue;
+			}
+			for (uint32_t j = 0; j < i; j++) {
+				const uint32_t core_j = (uint32_t) (cpuinfo_processors[j].core - cpuinfo_cores);
+				if (matrix[get_pair_index(i, j)] != 0 || core_busy[core_j]) {
+					continue;
+				}
+
+				core_busy[core_i] = core_busy[core_j] = true;
+				ping_pongs[pairs] = (struct ping_pong) {
+					.ping_linux_id = cpuinfo_processors[i].linux_id,
+					.pong_linux_id = cpuinfo_processors[j].linux_id,
+				};
+				pair_processors[pairs * 2] = i;
+				pair_processors[pairs * 2 + 1] = j;
+				pairs++;
+				break;
+			}
+		}
+
+		if (measure_round(ping_pongs, pairs, threads) != pairs) {
+			goto cleanup;
+		}
+		for (uint32_t p = 0; p < pairs; p++) {
+			if (ping_pongs[p].failed) {
+				goto cleanup;
+			}
+			const uint64_t nanoseconds = ping_pongs[p].round_trip_nanoseconds;
+			/* Zero marks unmeasured pairs: report sub-nanosecond latencies as 1 ns */
+			matrix[get_pair_index(pair_processors[p * 2], pair_processors[p * 2 + 1])] =
+				nanoseconds == 0 ? 1 : nanoseconds > UINT32_MAX ? UINT32_MAX : (uint32_t) nanoseconds;
+		}
+		remaining_pairs -= pairs;
+	}
+
+	pthread_mutex_lock(&latency_matrix_mutex);
+	free(latency_matrix);
+	latency_matrix = matrix;
+	latency_matrix_processors = processors_count;
+	pthread_mutex_unlock(&latency_matrix_mutex);
+	matrix = NULL;
+	success = true;
+
+cleanup:
+	free(matrix);
+	free(core_busy);
+	free(ping_pongs);
+	free(threads);
+	free(pair_processors);
+	return success;
+}
+
+void cpuinfo_linux_deinit_latency_matrix(void) {
+	pthread_mutex_lock(&latency_matrix_mutex);
+	free(latency_matrix);
+	latency_matrix = NULL;
+	latency_matrix_processors = 0;
+	pthread_mutex_unlock(&latency_matrix_mutex);
+}
+
+uint32_t CPUINFO_ABI cpuinfo_get_processor_latency(
+	const struct cpuinfo_processor* first,
+	const struct cpuinfo_processor* second)
+{
+	if (first == NULL || second == NULL || cpuinfo_processors == NULL) {
+		return 0;
+	}
+	const uint32_t i = (uint32_t) (first - cpuinfo_processors);
+	const uint32_t j = (uint32_t) (second - cpuinfo_processors);
+
+	uint32_t latency = 0;
+	pthread_mutex_lock(&latency_matrix_mutex);
+	if (latency_matrix != NULL && i < latency_matrix_processors && j < latency_matrix_processors && i != j) {
+		latency = latency_matrix[get_pair_index(i, j)];
+	}
+	pthread_mutex_unlock(&latency_matrix_mutex);
+	return latency;
+}
@@ -0,0 +1,712 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+
+#if !CPUINFO_MOCK
+	#error This file should be built only in mock mode
+#endif
+
+#include <cpuinfo-mock.h>
+#include <log.h>
+
+
+/* Maximum number of nested directories in a dump, e.g. /sys/devices/system/cpu/cpu0/cache/index0/level */
+#define CPUINFO_MOCK_MAX_DIRECTORY_DEPTH 16
+#define CPUINFO_MOCK_MAX_PATH_LENGTH 4096
+/* Maximum number of designated initializers in an entry of an array in the archive */
+#define CPUINFO_MOCK_MAX_ARCHIVE_FIELDS 8
+
+/* Reads the whole file into a NUL-terminated buffer, which the caller must free */
+static char* read_file(const char* filename, size_t size_ptr[restrict static 1]) {
+	FILE* file = fopen(filename, "rb");
+	if (file == NULL) {
+		cpuinfo_log_warning("failed to open %s: %s", filename, strerror(errno));
+		return NULL;
+	}
+
+	/* Files in sysfs report a size of one page regardless of the content: read until the end of file */
+	size_t size = 0, capacity = 4096;
+	char* buffer = malloc(capacity + 1);
+	while (buffer != NULL) {
+		if (size == capacity) {
+			capacity *= 2;
+			char* new_buffer = realloc(buffer, capacity + 1);
+			if (new_buffer == NULL) {
+				free(buffer);
+				buffer = NULL;
+				break;
+			}
+			buffer = new_buffer;
+		}
+		const size_t bytes_read = fread(buffer + size, 1, capacity - size, file);
+		if (bytes_read == 0) {
+			break;
+		}
+		size += bytes_read;
+	}
+	if (buffer == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for content of %s", capacity + 1, filename);
+	} else if (ferror(file)) {
+		cpuinfo_log_warning("failed to read %s", filename);
+		free(buffer);
+		buffer = NULL;
+	} else {
+		buffer[size] = '\0';
+		*size_ptr = size;
+		/* Dumps have thousands of small files: do not keep a page for each of them */
+		char* fitted_buffer = realloc(buffer, size + 1);
+		if (fitted_buffer != NULL) {
+			buffer = fitted_buffer;
+		}
+	}
+	fclose(file);
+	return buffer;
+}
+
+/* Growable array of mock files, with space reserved for the terminating entry */
+struct mock_files {
+	struct cpuinfo_mock_file* files;
+	size_t count;
+	size_t capacity;
+};
+
+/* Takes ownership of path and content, and frees them on failure */
+static bool append_file(struct mock_files files[restrict static 1], char* path, char* content, size_t size) {
+	if (files->count + 1 >= files->capacity) {
+		const size_t capacity = files->capacity == 0 ? 64 : files->capacity * 2;
+		struct cpuinfo_mock_file* new_files = realloc(files->files, capacity * sizeof(struct cpuinfo_mock_file));
+		if (new_files == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %zu mock files",
+				capacity * sizeof(struct cpuinfo_mock_file), capacity);
+			free(path);
+			free(content);
+			return false;
+		}
+		files->files = new_files;
+		files->capacity = capacity;
+	}
+	files->files[files->count++] = (struct cpuinfo_mock_file) {
+		.path = path,
+		.size = size,
+		.content = content,
+	};
+	return true;
+}
+
+/* Terminates the array of mock files; on failure, releases it instead */
+static struct cpuinfo_mock_file* finish_files(struct mock_files files[restrict static 1], bool status) {
+	if (status && append_file(files, NULL, NULL, 0)) {
+		return files->files;
+	}
+	if (files->files != NULL) {
+		files->files[files->count] = (struct cpuinfo_mock_file) { 0 };
+		cpuinfo_mock_free_filesystem(files->files);
+	}
+	return NULL;
+}
+
+void CPUINFO_ABI cpuinfo_mock_free_filesystem(struct cpuinfo_mock_file* files) {
+	if (files != NULL) {
+		for (struct cpuinfo_mock_file* file = files; file->path != NULL; file++) {
+			free((void*) file->path);
+			free((void*) file->content);
+		}
+		free(files);
+	}
+}
+
+static int compare_mock_file_paths(const void* a, const void* b) {
+	return strcmp(((const struct cpuinfo_mock_file*) a)->path, ((const struct cpuinfo_mock_file*) b)->path);
+}
+
+/*
+ * Appends regular files in the directory, and recursively in its subdirectories. path holds the path of the directory,
+ * and the first root_length characters of it are the root of the dump, which mock paths do not include.
+ */
+static bool load_directory(struct mock_files files[restrict static 1], char path[restrict static CPUINFO_MOCK_MAX_PATH_LENGTH],
+	size_t root_length, size_t path_length, uint32_t depth)
+{
+	if (depth > CPUINFO_MOCK_MAX_DIRECTORY_DEPTH) {
+		cpuinfo_log_warning("skipped directory %s: exceeds %d levels of nesting", path, CPUINFO_MOCK_MAX_DIRECTORY_DEPTH);
+		return true;
+	}
+
+	DIR* directory = opendir(path);
+	if (directory == NULL) {
+		cpuinfo_log_error("failed to open directory %s: %s", path, strerror(errno));
+		return false;
+	}
+
+	bool status = true;
+	struct dirent* entry;
+	while (status && (entry = readdir(directory)) != NULL) {
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+			continue;
+		}
+		const size_t name_length = strlen(entry->d_name);
+		if (path_length + 1 + name_length >= CPUINFO_MOCK_MAX_PATH_LENGTH) {
+			cpuinfo_log_warning("skipped %s/%s: path is too long", path, entry->d_name);
+			continue;
+		}
+		path[path_length] = '/';
+		memcpy(path + path_length + 1, entry->d_name, name_length + 1);
+
+		/* Symbolic links in sysfs lead outside of the dumped subtree, and may form cycles */
+		struct stat entry_stat;
+		if (lstat(path, &entry_stat) != 0) {
+			cpuinfo_log_warning("failed to query %s: %s", path, strerror(errno));
+		} else if (S_ISDIR(entry_stat.st_mode)) {
+			status = load_directory(files, path, root_length, path_length + 1 + name_length, depth + 1);
+		} else if (S_ISREG(entry_stat.st_mode)) {
+			size_t size = 0;
+			char* content = read_file(path, &size);
+			if (content != NULL) {
+				char* mock_path = strdup(path + root_length);
+				if (mock_path == NULL) {
+					cpuinfo_log_error("failed to allocate path of mock file %s", path + root_length);
+					free(content);
+					status = false;
+				} else {
+					status = append_file(files, mock_path, content, size);
+				}
+			}
+		}
+		path[path_length] = '\0';
+	}
+	closedir(directory);
+	return status;
+}
+
+struct cpuinfo_mock_file* CPUINFO_ABI cpuinfo_mock_filesystem_from_directory(const char* root) {
+	char path[CPUINFO_MOCK_MAX_PATH_LENGTH];
+	size_t root_length = strlen(root);
+	while (root_length > 1 && root[root_length - 1] == '/') {
+		root_length -= 1;
+	}
+	if (root_length >= CPUINFO_MOCK_MAX_PATH_LENGTH) {
+		cpuinfo_log_error("failed to load mock filesystem from %s: path is too long", root);
+		return NULL;
+	}
+	memcpy(path, root, root_length);
+	path[root_length] = '\0';
+
+	struct mock_files files = { 0 };
+	const bool status = load_directory(&files, path, root_length, root_length, 0);
+	if (status && files.count == 0) {
+		cpuinfo_log_error("failed to load mock filesystem from %s: no files found", root);
+		return finish_files(&files, false);
+	}
+	if (status) {
+		/* Directory order is arbitrary: sort files for reproducible mock filesystems */
+		qsort(files.files, files.count, sizeof(struct cpuinfo_mock_file), compare_mock_file_paths);
+	}
+	return finish_files(&files, status);
+}
+
+/*
+ * Parser of archives, i.e. C headers which the filesystem dump scripts generate. An archive defines arrays of
+ * structures in the form
+ *     struct <type> <name>[] = {
+ *         { .<field> = <string literals or integer>, ... },
+ *         { NULL },
+ *     };
+ * Preprocessor directives (e.g. #ifdef __ANDROID__ around Android properties) are ignored.
+ */
+struct archive_field {
+	const char* name;
+	size_t name_length;
+	bool is_string;
+	uint64_t integer;
+	/* Position of the string value in the string buffer of the parser */
+	size_t string_offset;
+	size_t string_length;
+};
+
+struct archive_entry {
+	const char* type;
+	size_t type_length;
+	const char* array;
+	size_t array_length;
+	uint32_t fields_count;
+	struct archive_field fields[CPUINFO_MOCK_MAX_ARCHIVE_FIELDS];
+	/* String buffer of the parser, which holds string values of the fields */
+	const char* strings;
+};
+
+struct archive_parser {
+	const char* filename;
+	const char* start;
+	const char* position;
+	const char* end;
+	/* Decoded string values of the current entry */
+	char* strings;
+	size_t strings_length;
+	size_t strings_capacity;
+};
+
+typedef bool (*archive_entry_callback)(const struct archive_entry*, void*);
+
+static bool matches(const char* token, size_t token_length, const char* string) {
+	return strlen(string) == token_length && memcmp(token, string, token_length) == 0;
+}
+
+static void report_parse_error(const struct archive_parser parser[restrict static 1], const char* message) {
+	uint32_t line = 1;
+	for (const char* c = parser->start; c != parser->position; c++) {
+		line += (uint32_t) (*c == '\n');
+	}
+	cpuinfo_log_error("failed to parse archive %s at line %"PRIu32": %s", parser->filename, line, message);
+}
+
+/* Skips whitespace, comments, and preprocessor directives */
+static void skip_space(struct archive_parser parser[restrict static 1]) {
+	while (parser->position != parser->end) {
+		const char c = *parser->position;
+		if (isspace((unsigned char) c)) {
+			parser->position++;
+		} else if (c == '#' || (c == '/' && parser->end - parser->position >= 2 && parser->position[1] == '/')) {
+			while (parser->position != parser->end && *parser->position != '\n') {
+				parser->position++;
+			}
+		} else if (c == '/' && parser->end - parser->position >= 2 && parser->position[1] == '*') {
+			const char* comment_end = strstr(parser->position + 2, "*/");
+			parser->position = comment_end == NULL ? parser->end : comment_end + 2;
+		} else {
+			break;
+		}
+	}
+}
+
+static bool parse_char(struct archive_parser parser[restrict static 1], char expected) {
+	skip_space(parser);
+	if (parser->position != parser->end && *parser->position == expected) {
+		parser->position++;
+		return true;
+	}
+	return false;
+}
+
+static bool parse_identifier(struct archive_parser parser[restrict static 1], const char** identifier, size_t length[restrict static 1]) {
+	skip_space(parser);
+	const char* start = parser->position;
+	while (parser->position != parser->end &&
+		(isalnum((unsigned char) *parser->position) || *parser->position == '_'))
+	{
+		parser->position++;
+	}
+	if (parser->position == start || isdigit((unsigned char) *start)) {
+		parser->position = start;
+		return false;
+	}
+	*identifier = start;
+	*length = (size_t) (parser->position - start);
+	return true;
+}
+
+static bool append_string_char(struct archive_parser parser[restrict static 1], char c) {
+	if (parser->strings_length == parser->strings_capacity) {
+		const size_t capacity = parser->strings_capacity == 0 ? 4096 : parser->strings_capacity * 2;
+		char* strings = realloc(parser->strings, capacity);
+		if (strings == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for string values in archive %s", capacity, parser->filename);
+			return false;
+		}
+		parser->strings = strings;
+		parser->strings_capacity = capacity;
+	}
+	parser->strings[parser->strings_length++] = c;
+	return true;
+}
+
+/* Decodes a sequence of adjacent string literals, which the compiler would concatenate */
+static bool parse_string(struct archive_parser parser[restrict static 1], struct archive_field field[restrict static 1]) {
+	field->is_string = true;
+	field->string_offset = parser->strings_length;
+	while (parse_char(parser, '"')) {
+		while (parser->position != parser->end && *parser->position != '"') {
+			char c = *parser->position++;
+			if (c == '\\' && parser->position != parser->end) {
+				c = *parser->position++;
+				switch (c) {
+					case 'n': c = '\n'; break;
+					case 't': c = '\t'; break;
+					case 'r': c = '\r'; break;
+					case 'a': c = '\a'; break;
+					case 'b': c = '\b'; break;
+					case 'f': c = '\f'; break;
+					case 'v': c = '\v'; break;
+					case 'x':
+					{
+						uint32_t value = 0;
+						while (parser->position != parser->end && isxdigit((unsigned char) *parser->position)) {
+							const char digit = *parser->position++;
+							value = value * 16 + (uint32_t) (isdigit((unsigned char) digit) ?
+								digit - '0' : tolower((unsigned char) digit) - 'a' + 10);
+						}
+						c = (char) value;
+						break;
+					}
+					default:
+						if (c >= '0' && c <= '7') {
+							uint32_t value = (uint32_t) (c - '0');
+							for (uint32_t i = 1; i < 3 && parser->position != parser->end &&
+								*parser->position >= '0' && *parser->position <= '7'; i++)
+							{
+								value = value * 8 + (uint32_t) (*parser->position++ - '0');
+							}
+							c = (char) value;
+						}
+						/* Other escaped characters, e.g. \\ or \", stand for themselves */
+						break;
+				}
+			}
+			if (!append_string_char(parser, c)) {
+				return false;
+			}
+		}
+		if (parser->position == parser->end) {
+			report_parse_error(parser, "unterminated string literal");
+			return false;
+		}
+		parser->position++;
+	}
+	field->string_length = parser->strings_length - field->string_offset;
+	return true;
+}
+
+static bool parse_value(struct archive_parser parser[restrict static 1], struct archive_field field[restrict static 1]) {
+	skip_space(parser);
+	if (parser->position == parser->end) {
+		report_parse_error(parser, "unexpected end of file");
+		return false;
+	}
+	if (*parser->position == '"') {
+		return parse_string(parser, field);
+	}
+
+	const char* identifier;
+	size_t identifier_length;
+	if (parse_identifier(parser, &identifier, &identifier_length)) {
+		if (!matches(identifier, identifier_length, "NULL")) {
+			report_parse_error(parser, "unexpected identifier");
+			return false;
+		}
+		field->integer = 0;
+		return true;
+	}
+
+	/* The archive content is NUL-terminated, so strtoull stops at the end of file */
+	char* number_end = NULL;
+	errno = 0;
+	field->integer = strtoull(parser->position, &number_end, 0);
+	if (number_end == parser->position || errno != 0) {
+		report_parse_error(parser, "expected a string or an integer");
+		return false;
+	}
+	parser->position = number_end;
+	while (parser->position != parser->end && (*parser->position == 'u' || *parser->position == 'U' ||
+		*parser->position == 'l' || *parser->position == 'L'))
+	{
+		parser->position++;
+	}
+	return true;
+}
+
+/* Parses an entry of an array after the opening brace; positional initializers (e.g. { NULL }) terminate arrays */
+static bool parse_entry(struct archive_parser parser[restrict static 1], struct archive_entry entry[restrict static 1], bool terminator[restrict static 1]) {
+	entry->fields_count = 0;
+	parser->strings_length = 0;
+	*terminator = false;
+	while (!parse_char(parser, '}')) {
+		struct archive_field field = { 0 };
+		if (parse_char(parser, '.')) {
+			if (!parse_identifier(parser, &field.name, &field.name_length) || !parse_char(parser, '=')) {
+				report_parse_error(parser, "expected a designated initializer");
+				return false;
+			}
+		} else {
+			*terminator = true;
+		}
+		if (!parse_value(parser, &field)) {
+			return false;
+		}
+		if (field.name != NULL) {
+			if (entry->fields_count == CPUINFO_MOCK_MAX_ARCHIVE_FIELDS) {
+				report_parse_error(parser, "too many fields");
+				return false;
+			}
+			entry->fields[entry->fields_count++] = field;
+		}
+		if (!parse_char(parser, ',')) {
+			if (!parse_char(parser, '}')) {
+				report_parse_error(parser, "expected ',' or '}'");
+				return false;
+			}
+			break;
+		}
+	}
+	entry->strings = parser->strings;
+	return true;
+}
+
+/* Parses all arrays in the archive, and calls the callback for every non-terminating entry */
+static bool parse_archive(const char* filename, archive_entry_callback callback, void* context) {
+	size_t size = 0;
+	char* content = read_file(filename, &size);
+	if (content == NULL) {
+		return false;
+	}
+
+	bool status = false;
+	struct archive_parser parser = {
+		.filename = filename,
+		.start = content,
+		.position = content,
+		.end = content + size,
+	};
+	struct archive_entry entry;
+	for (;;) {
+		skip_space(&parser);
+		if (parser.position == parser.end) {
+			status = true;
+			break;
+		}
+
+		const char* keyword;
+		size_t keyword_length;
+		if (!parse_identifier(&parser, &keyword, &keyword_length) || !matches(keyword, keyword_length, "struct") ||
+			!parse_identifier(&parser, &entry.type, &entry.type_length) ||
+			!parse_identifier(&parser, &entry.array, &entry.array_length) ||
+			!parse_char(&parser, '[') || !parse_char(&parser, ']') ||
+			!parse_char(&parser, '=') || !parse_char(&parser, '{'))
+		{
+			report_parse_error(&parser, "expected an array definition");
+			break;
+		}
+
+		bool entries_status = true;
+		while (entries_status && !parse_char(&parser, '}')) {
+			bool terminator;
+			if (!parse_char(&parser, '{')) {
+				report_parse_error(&parser, "expected an array entry");
+				entries_status = false;
+			} else if (!parse_entry(&parser, &entry, &terminator)) {
+				entries_status = false;
+			} else if (!terminator && !callback(&entry, context)) {
+				entries_status = false;
+			} else {
+				parse_char(&parser, ',');
+			}
+		}
+		if (!entries_status) {
+			break;
+		}
+		if (!parse_char(&parser, ';')) {
+			report_parse_error(&parser, "expected ';' after an array definition");
+			break;
+		}
+	}
+
+	free(parser.strings);
+	free(content);
+	return status;
+}
+
+static const struct archive_field* find_field(const struct archive_entry entry[restrict static 1], const char* name) {
+	for (uint32_t i = 0; i < entry->fields_count; i++) {
+		if (matches(entry->fields[i].name, entry->fields[i].name_length, name)) {
+			return &entry->fields[i];
+		}
+	}
+	return NULL;
+}
+
+/* Copies a string value into a NUL-terminated buffer of at least min_size bytes, padded with zeroes */
+static char* copy_string(const struct archive_entry entry[restrict static 1], const struct archive_field* field, size_t min_size) {
+	const size_t length = field != NULL && field->is_string ? field->string_length : 0;
+	char* string = calloc((length > min_size ? length : min_size) + 1, 1);
+	if (string != NULL && length != 0) {
+		memcpy(string, entry->strings + field->string_offset, length);
+	}
+	return string;
+}
+
+static bool filesystem_entry_callback(const struct archive_entry entry[restrict static 1], void* context) {
+	if (!matches(entry->type, entry->type_length, "cpuinfo_mock_file")) {
+		return true;
+	}
+
+	const struct archive_field* path_field = find_field(entry, "path");
+	const struct archive_field* size_field = find_field(entry, "size");
+	const struct archive_field* content_field = find_field(entry, "content");
+	if (path_field == NULL || !path_field->is_string) {
+		/* Arrays may also end with a designated terminator, { .path = NULL, ... } */
+		if (path_field == NULL || path_field->integer != 0) {
+			cpuinfo_log_warning("skipped a mock file without path");
+		}
+		return true;
+	}
+	/* Dumps spell bytes outside of printable ASCII as text, and the explicit size is the length of the content */
+	const size_t content_length = content_field != NULL && content_field->is_string ? content_field->string_length : 0;
+	const size_t size = size_field != NULL && !size_field->is_string ? (size_t) size_field->integer : content_length;
+
+	char* path = copy_string(entry, path_field, 0);
+	char* content = copy_string(entry, content_field, size);
+	if (path == NULL || content == NULL) {
+		cpuinfo_log_error("failed to allocate mock file of %zu bytes", size);
+		free(path);
+		free(content);
+		return false;
+	}
+	return append_file((struct mock_files*) context, path, content, size);
+}
+
+struct cpuinfo_mock_file* CPUINFO_ABI cpuinfo_mock_filesystem_from_archive(const char* filename) {
+	struct mock_files files = { 0 };
+	const bool status = parse_archive(filename, filesystem_entry_callback, &files);
+	if (status && files.count == 0) {
+		cpuinfo_log_error("failed to load mock filesystem from %s: no files found", filename);
+		return finish_files(&files, false);
+	}
+	return finish_files(&files, status);
+}
+
+struct mock_properties {
+	struct cpuinfo_mock_property* properties;
+	size_t count;
+	size_t capacity;
+};
+
+static bool properties_entry_callback(const struct archive_entry entry[restrict static 1], void* context) {
+	if (!matches(entry->type, entry->type_length, "cpuinfo_mock_property")) {
+		return true;
+	}
+
+	struct mock_properties* properties = (struct mock_properties*) context;
+	if (properties->count + 1 >= properties->capacity) {
+		const size_t capacity = properties->capacity * 2;
+		struct cpuinfo_mock_property* new_properties =
+			realloc(properties->properties, capacity * sizeof(struct cpuinfo_mock_property));
+		if (new_properties == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for %zu mock properties",
+				capacity * sizeof(struct cpuinfo_mock_property), capacity);
+			return false;
+		}
+		properties->properties = new_properties;
+		properties->capacity = capacity;
+	}
+
+	char* key = copy_string(entry, find_field(entry, "key"), 0);
+	char* value = copy_string(entry, find_field(entry, "value"), 0);
+	if (key == NULL || value == NULL) {
+		cpuinfo_log_error("failed to allocate mock property");
+		free(key);
+		free(value);
+		return false;
+	}
+	properties->properties[properties->count++] = (struct cpuinfo_mock_property) {
+		.key = key,
+		.value = value,
+	};
+	return true;
+}
+
+struct cpuinfo_mock_property* CPUINFO_ABI cpuinfo_mock_properties_from_archive(const char* filename) {
+	struct mock_properties properties = {
+		.properties = malloc(64 * sizeof(struct cpuinfo_mock_property)),
+		.capacity = 64,
+	};
+	if (properties.properties == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for mock properties",
+			properties.capacity * sizeof(struct cpuinfo_mock_property));
+		return NULL;
+	}
+
+	const bool status = parse_archive(filename, properties_entry_callback, &properties);
+	/* Archives of non-Android systems have no properties, and produce an empty list */
+	properties.properties[properties.count] = (struct cpuinfo_mock_property) { 0 };
+	if (!status) {
+		cpuinfo_mock_free_properties(properties.properties);
+		return NULL;
+	}
+	return properties.properties;
+}
+
+void CPUINFO_ABI cpuinfo_mock_free_properties(struct cpuinfo_mock_property* properties) {
+	if (properties != NULL) {
+		for (struct cpuinfo_mock_property* property = properties; property->key != NULL; property++) {
+			free((void*) property->key);
+			free((void*) property->value);
+		}
+		free(properties);
+	}
+}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	struct mock_cpuid {
+		const char* name;
+		struct cpuinfo_mock_cpuid* entries;
+		size_t count;
+		size_t capacity;
+	};
+
+	static uint32_t integer_field(const struct archive_entry entry[restrict static 1], const char* name) {
+		const struct archive_field* field = find_field(entry, name);
+		return field != NULL && !field->is_string ? (uint32_t) field->integer : 0;
+	}
+
+	static bool cpuid_entry_callback(const struct archive_entry entry[restrict static 1], void* context) {
+		struct mock_cpuid* cpuid = (struct mock_cpuid*) context;
+		if (!matches(entry->type, entry->type_length, "cpuinfo_mock_cpuid") ||
+			!matches(entry->array, entry->array_length, cpuid->name))
+		{
+			return true;
+		}
+
+		if (cpuid->count == cpuid->capacity) {
+			const size_t capacity = cpuid->capacity == 0 ? 64 : cpuid->capacity * 2;
+			struct cpuinfo_mock_cpuid* entries = realloc(cpuid->entries, capacity * sizeof(struct cpuinfo_mock_cpuid));
+			if (entries == NULL) {
+				cpuinfo_log_error("failed to allocate %zu bytes for %zu CPUID dump entries",
+					capacity * sizeof(struct cpuinfo_mock_cpuid), capacity);
+				return false;
+			}
+			cpuid->entries = entries;
+			cpuid->capacity = capacity;
+		}
+		cpuid->entries[cpuid->count++] = (struct cpuinfo_mock_cpuid) {
+			.input_eax = integer_field(entry, "input_eax"),
+			.input_ecx = integer_field(entry, "input_ecx"),
+			.eax = integer_field(entry, "eax"),
+			.ebx = integer_field(entry, "ebx"),
+			.ecx = integer_field(entry, "ecx"),
+			.edx = integer_field(entry, "edx"),
+		};
+		return true;
+	}
+
+	struct cpuinfo_mock_cpuid* CPUINFO_ABI cpuinfo_mock_cpuid_from_archive(const char* filename, const char* name, size_t* entries) {
+		struct mock_cpuid cpuid = { .name = name };
+		*entries = 0;
+		if (!parse_archive(filename, cpuid_entry_callback, &cpuid)) {
+			free(cpuid.entries);
+			return NULL;
+		}
+		if (cpuid.count == 0) {
+			cpuinfo_log_info("archive %s contains no CPUID dump %s", filename, name);
+			return NULL;
+		}
+		*entries = cpuid.count;
+		return cpuid.entries;
+	}
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
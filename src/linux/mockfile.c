@@ -23,7 +23,20 @@
 
 static struct cpuinfo_mock_file* cpuinfo_mock_files = NULL;
 static uint32_t cpuinfo_mock_file_count = 0;
+/* Indices of mock files sorted by path, so that large synthetic filesystems do not make lookups quadratic */
+static uint32_t* cpuinfo_mock_file_index = NULL;
+static struct cpuinfo_mock_filesystem_stats cpuinfo_mock_stats = { 0 };
 
+/* Orders files by path, and files with the same path by position in the mock filesystem */
+static int compare_mock_files(const void* a, const void* b) {
+	const uint32_t index_a = *((const uint32_t*) a);
+	const uint32_t index_b = *((const uint32_t*) b);
+	const int order = strcmp(cpuinfo_mock_files[index_a].path, cpuinfo_mock_files[index_b].path);
+	if (order != 0) {
+		return order;
+	}
+	return (index_a > index_b) - (index_a < index_b);
+}
 
 void CPUINFO_ABI cpuinfo_mock_filesystem(struct cpuinfo_mock_file* files) {
 	cpuinfo_log_info("filesystem mocking enabled");
@@ -34,7 +47,44 @@ void CPUINFO_ABI cpuinfo_mock_filesystem(struct cpuinfo_mock_file* files) {
 		file_count += 1;
 	}
 	cpuinfo_mock_files = files;
-	cpuinfo_mock_file_count = file_count;	
+	cpuinfo_mock_file_count = file_count;
+	cpuinfo_mock_stats = (struct cpuinfo_mock_filesystem_stats) { 0 };
+
+	free(cpuinfo_mock_file_index);
+	cpuinfo_mock_file_index = malloc(file_count * sizeof(uint32_t));
+	if (cpuinfo_mock_file_index != NULL) {
+		for (uint32_t i = 0; i < file_count; i++) {
+			cpuinfo_mock_file_index[i] = i;
+		}
+		qsort(cpuinfo_mock_file_index, file_count, sizeof(uint32_t), compare_mock_files);
+	}
+}
+
+/* Returns the index of the first mock file with the specified path, or UINT32_MAX if there is no such file */
+static uint32_t find_mock_file(const char* path) {
+	if (cpuinfo_mock_file_index == NULL) {
+		for (uint32_t i = 0; i < cpuinfo_mock_file_count; i++) {
+			if (strcmp(cpuinfo_mock_files[i].path, path) == 0) {
+				return i;
+			}
+		}
+		return UINT32_MAX;
+	}
+
+	/* Binary search for the first path not less than the specified path */
+	uint32_t low = 0, high = cpuinfo_mock_file_count;
+	while (low < high) {
+		const uint32_t middle = low + (high - low) / 2;
+		if (strcmp(cpuinfo_mock_files[cpuinfo_mock_file_index[middle]].path, path) < 0) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	if (low != cpuinfo_mock_file_count && strcmp(cpuinfo_mock_files[cpuinfo_mock_file_index[low]].path, path) == 0) {
+		return cpuinfo_mock_file_index[low];
+	}
+	return UINT32_MAX;
 }
 
 int CPUINFO_ABI cpuinfo_mock_open(const char* path, int oflag) {
@@ -43,22 +93,23 @@ int CPUINFO_ABI cpuinfo_mock_open(const char* path, int oflag) {
 		return open(path, oflag);
 	}
 
-	for (uint32_t i = 0; i < cpuinfo_mock_file_count; i++) {
-		if (strcmp(cpuinfo_mock_files[i].path, path) == 0) {
-			if (oflag != O_RDONLY) {
-				errno = EACCES;
-				return -1;
-			}
-			if (cpuinfo_mock_files[i].offset != SIZE_MAX) {
-				errno = ENFILE;
-				return -1;
-			}
-			cpuinfo_mock_files[i].offset = 0;
-			return (int) i;
-		}
+	const uint32_t i = find_mock_file(path);
+	if (i == UINT32_MAX) {
+		cpuinfo_mock_stats.files_missing += 1;
+		errno = ENOENT;
+		return -1;
 	}
-	errno = ENOENT;
-	return -1;
+	if (oflag != O_RDONLY) {
+		errno = EACCES;
+		return -1;
+	}
+	if (cpuinfo_mock_files[i].offset != SIZE_MAX) {
+		errno = ENFILE;
+		return -1;
+	}
+	cpuinfo_mock_files[i].offset = 0;
+	cpuinfo_mock_stats.files_opened += 1;
+	return (int) i;
 }
 
 int CPUINFO_ABI cpuinfo_mock_close(int fd) {
@@ -101,5 +152,10 @@ ssize_t CPUINFO_ABI cpuinfo_mock_read(int fd, void* buffer, size_t capacity) {
 	}
 	memcpy(buffer, (void*) cpuinfo_mock_files[fd].content + offset, count);
 	cpuinfo_mock_files[fd].offset += count;
+	cpuinfo_mock_stats.bytes_read += count;
 	return (ssize_t) count;
 }
+
+void CPUINFO_ABI cpuinfo_mock_get_filesystem_stats(struct cpuinfo_mock_filesystem_stats* stats) {
+	*stats = cpuinfo_mock_stats;
+}
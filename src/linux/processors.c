@@ -25,17 +25,25 @@
 #define MAX_FREQUENCY_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/cpufreq/cpuinfo_max_freq"
 #define MIN_FREQUENCY_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/cpufreq/cpuinfo_min_freq"
 #define FREQUENCY_FILESIZE 32
+#define CAPACITY_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/cpu_capacity"))
+#define CAPACITY_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/cpu_capacity"
+#define CAPACITY_FILESIZE 32
 #define PACKAGE_ID_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/physical_package_id"))
 #define PACKAGE_ID_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/physical_package_id"
 #define PACKAGE_ID_FILESIZE 32
 #define CORE_ID_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/core_id"))
 #define CORE_ID_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/core_id"
 #define CORE_ID_FILESIZE 32
+#define CLUSTER_ID_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/cluster_id"))
+#define CLUSTER_ID_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/cluster_id"
+#define CLUSTER_ID_FILESIZE 32
 
 #define CORE_SIBLINGS_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/core_siblings_list"))
 #define CORE_SIBLINGS_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/core_siblings_list"
 #define THREAD_SIBLINGS_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/thread_siblings_list"))
 #define THREAD_SIBLINGS_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/thread_siblings_list"
+#define CLUSTER_SIBLINGS_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/cluster_cpus_list"))
+#define CLUSTER_SIBLINGS_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/cluster_cpus_list"
 
 #define POSSIBLE_CPULIST_FILENAME "/sys/devices/system/cpu/possible"
 #define PRESENT_CPULIST_FILENAME "/sys/devices/system/cpu/present"
@@ -172,6 +180,28 @@ uint32_t cpuinfo_linux_get_processor_min_frequency(uint32_t processor) {
 	}
 }
 
+uint32_t cpuinfo_linux_get_processor_capacity(uint32_t processor) {
+	char capacity_filename[CAPACITY_FILENAME_SIZE];
+	const int chars_formatted = snprintf(
+		capacity_filename, CAPACITY_FILENAME_SIZE, CAPACITY_FILENAME_FORMAT, processor);
+	if ((unsigned int) chars_formatted >= CAPACITY_FILENAME_SIZE) {
+		cpuinfo_log_warning("failed to format filename for capacity of processor %"PRIu32, processor);
+		return 0;
+	}
+
+	/* Only kernels with asymmetric CPU capacity support (arch_topology driver) expose cpu_capacity */
+	uint32_t capacity;
+	if (cpuinfo_linux_parse_small_file(capacity_filename, CAPACITY_FILESIZE, uint32_parser, &capacity)) {
+		cpuinfo_log_debug("parsed capacity value of %"PRIu32" for logical processor %"PRIu32" from %s",
+			capacity, processor, capacity_filename);
+		return capacity;
+	} else {
+		cpuinfo_log_info("failed to parse capacity for processor %"PRIu32" from %s",
+			processor, capacity_filename);
+		return 0;
+	}
+}
+
 bool cpuinfo_linux_get_processor_core_id(uint32_t processor, uint32_t core_id_ptr[restrict static 1]) {
 	char core_id_filename[PACKAGE_ID_FILENAME_SIZE];
 	const int chars_formatted = snprintf(
@@ -216,6 +246,29 @@ bool cpuinfo_linux_get_processor_package_id(uint32_t processor, uint32_t package
 	}
 }
 
+bool cpuinfo_linux_get_processor_cluster_id(uint32_t processor, uint32_t cluster_id_ptr[restrict static 1]) {
+	char cluster_id_filename[CLUSTER_ID_FILENAME_SIZE];
+	const int chars_formatted = snprintf(
+		cluster_id_filename, CLUSTER_ID_FILENAME_SIZE, CLUSTER_ID_FILENAME_FORMAT, processor);
+	if ((unsigned int) chars_formatted >= CLUSTER_ID_FILENAME_SIZE) {
+		cpuinfo_log_warning("failed to format filename for cluster id of processor %"PRIu32, processor);
+		return false;
+	}
+
+	/* Kernels without cluster information in firmware tables report -1, which fails to parse as an unsigned number */
+	uint32_t cluster_id;
+	if (cpuinfo_linux_parse_small_file(cluster_id_filename, CLUSTER_ID_FILESIZE, uint32_parser, &cluster_id)) {
+		cpuinfo_log_debug("parsed cluster id value of %"PRIu32" for logical processor %"PRIu32" from %s",
+			cluster_id, processor, cluster_id_filename);
+		*cluster_id_ptr = cluster_id;
+		return true;
+	} else {
+		cpuinfo_log_info("failed to parse cluster id for processor %"PRIu32" from %s",
+			processor, cluster_id_filename);
+		return false;
+	}
+}
+
 static bool max_processor_number_parser(uint32_t processor_list_start, uint32_t processor_list_end, void* context) {
 	uint32_t* processor_number_ptr = (uint32_t*) context;
 	const uint32_t processor_list_last = processor_list_end - 1;
@@ -336,6 +389,7 @@ static bool siblings_parser(uint32_t sibling_list_start, uint32_t sibling_list_e
 bool cpuinfo_linux_detect_core_siblings(
 	uint32_t max_processors_count,
 	uint32_t processor,
+	struct cpuinfo_linux_cpulist_cache* cache,
 	cpuinfo_siblings_callback callback,
 	void* context)
 {
@@ -354,7 +408,7 @@ bool cpuinfo_linux_detect_core_siblings(
 		.callback = callback,
 		.callback_context = context,
 	};
-	if (cpuinfo_linux_parse_cpulist(core_siblings_filename,
+	if (cpuinfo_linux_parse_cached_cpulist(core_siblings_filename, processor, cache,
 		(cpuinfo_cpulist_callback) siblings_parser, &siblings_context))
 	{
 		return true;
@@ -368,6 +422,7 @@ bool cpuinfo_linux_detect_core_siblings(
 bool cpuinfo_linux_detect_thread_siblings(
 	uint32_t max_processors_count,
 	uint32_t processor,
+	struct cpuinfo_linux_cpulist_cache* cache,
 	cpuinfo_siblings_callback callback,
 	void* context)
 {
@@ -386,7 +441,7 @@ bool cpuinfo_linux_detect_thread_siblings(
 		.callback = callback,
 		.callback_context = context,
 	};
-	if (cpuinfo_linux_parse_cpulist(thread_siblings_filename,
+	if (cpuinfo_linux_parse_cached_cpulist(thread_siblings_filename, processor, cache,
 		(cpuinfo_cpulist_callback) siblings_parser, &siblings_context))
 	{
 		return true;
@@ -397,3 +452,35 @@ bool cpuinfo_linux_detect_thread_siblings(
 	}
 }
 
+bool cpuinfo_linux_detect_cluster_siblings(
+	uint32_t max_processors_count,
+	uint32_t processor,
+	struct cpuinfo_linux_cpulist_cache* cache,
+	cpuinfo_siblings_callback callback,
+	void* context)
+{
+	char cluster_siblings_filename[CLUSTER_SIBLINGS_FILENAME_SIZE];
+	const int chars_formatted = snprintf(
+		cluster_siblings_filename, CLUSTER_SIBLINGS_FILENAME_SIZE, CLUSTER_SIBLINGS_FILENAME_FORMAT, processor);
+	if ((unsigned int) chars_formatted >= CLUSTER_SIBLINGS_FILENAME_SIZE) {
+		cpuinfo_log_warning("failed to format filename for cluster siblings of processor %"PRIu32, processor);
+		return false;
+	}
+
+	struct siblings_context siblings_context = {
+		.group_name = "cluster",
+		.max_processors_count = max_processors_count,
+		.processor = processor,
+		.callback = callback,
+		.callback_context = context,
+	};
+	if (cpuinfo_linux_parse_cached_cpulist(cluster_siblings_filename, processor, cache,
+		(cpuinfo_cpulist_callback) siblings_parser, &siblings_context))
+	{
+		return true;
+	} else {
+		cpuinfo_log_info("failed to parse the list of cluster siblings for processor %"PRIu32" from %s",
+			processor, cluster_siblings_filename);
+		return false;
+	}
+}
@@ -0,0 +1,90 @@
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include <pthread.h>
+#include <sys/prctl.h>
+
+#if CPUINFO_MOCK
+	#include <cpuinfo-mock.h>
+#endif
+#include <cpuinfo.h>
+#include <linux/api.h>
+#include <log.h>
+
+
+/* include/uapi/linux/prctl.h in Linux 4.15+ */
+#ifndef PR_SVE_SET_VL
+	#define PR_SVE_SET_VL 50
+#endif
+#ifndef PR_SVE_GET_VL
+	#define PR_SVE_GET_VL 51
+#endif
+#ifndef PR_SVE_VL_LEN_MASK
+	#define PR_SVE_VL_LEN_MASK 0xFFFF
+#endif
+/* Largest vector length, in bytes, permitted by the architecture: SVE_VL_MAX in arch/arm64/include/uapi/asm/sigcontext.h */
+#define SVE_ARCH_VL_MAX 0x2000
+
+
+#if CPUINFO_MOCK
+	static int mock_sve_vl = -1;
+	void CPUINFO_ABI cpuinfo_set_sve_vl(int vl) {
+		mock_sve_vl = vl;
+	}
+#elif CPUINFO_ARCH_ARM64
+	struct sve_vl_query {
+		int vl;
+		int error;
+	};
+
+	/*
+	 * PR_SVE_GET_VL reports the vector length of the calling thread, which may have been reduced with PR_SVE_SET_VL.
+	 * To find the maximum, a scratch thread requests the largest architectural length: the kernel rounds the request
+	 * down to the largest length supported by all cores. The change does not outlive the scratch thread.
+	 */
+	static void* query_max_sve_vl(void* arg) {
+		struct sve_vl_query* query = (struct sve_vl_query*) arg;
+		query->vl = prctl(PR_SVE_SET_VL, SVE_ARCH_VL_MAX, 0, 0, 0);
+		query->error = query->vl < 0 ? errno : 0;
+		return NULL;
+	}
+
+	static pthread_once_t max_sve_vl_once = PTHREAD_ONCE_INIT;
+	static int max_sve_vl = -1;
+
+	static void init_max_sve_vl(void) {
+		struct sve_vl_query query = { .vl = -1, .error = 0 };
+		pthread_t thread;
+		int error = pthread_create(&thread, NULL, query_max_sve_vl, &query);
+		if (error == 0) {
+			error = pthread_join(thread, NULL);
+		}
+		if (error != 0) {
+			/* Without a scratch thread, the length of the calling thread is the best available approximation */
+			cpuinfo_log_warning("failed to query maximum SVE vector length in a scratch thread: %s", strerror(error));
+			query.vl = prctl(PR_SVE_GET_VL, 0, 0, 0, 0);
+			query.error = query.vl < 0 ? errno : 0;
+		}
+		if (query.vl < 0) {
+			/* EINVAL if the processor or the kernel does not support SVE */
+			cpuinfo_log_debug("SVE vector length query failed: %s", strerror(query.error));
+		}
+		max_sve_vl = query.vl;
+	}
+#endif
+
+uint32_t cpuinfo_linux_get_max_sve_vector_length(void) {
+	#if CPUINFO_MOCK
+		const int vl = mock_sve_vl;
+	#elif CPUINFO_ARCH_ARM64
+		pthread_once(&max_sve_vl_once, init_max_sve_vl);
+		const int vl = max_sve_vl;
+	#else
+		const int vl = -1;
+	#endif
+	if (vl < 0) {
+		return 0;
+	}
+	return (uint32_t) (vl & PR_SVE_VL_LEN_MASK);
+}
@@ -0,0 +1,213 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+
+
+/*
+ * Characteristics assumed for microarchitectures missing in the database: newer cores are wider than older ones.
+ * The numbers are used only to estimate throughput, and are not exposed through cpuinfo_get_uarch_info().
+ */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	static const struct cpuinfo_uarch_info default_uarch_info = {
+		.uarch = cpuinfo_uarch_unknown,
+		.vector_bits = 512,
+		.fma_units = 2,
+		.int_vector_units = 2,
+		.load_units = 2,
+		.store_units = 1,
+		.load_store_bits = 512,
+	};
+#else
+	static const struct cpuinfo_uarch_info default_uarch_info = {
+		.uarch = cpuinfo_uarch_unknown,
+		.vector_bits = 128,
+		.fma_units = 2,
+		.int_vector_units = 2,
+		.load_units = 2,
+		.store_units = 1,
+		.load_store_bits = 128,
+	};
+#endif
+
+static const struct cpuinfo_uarch_info* get_uarch_info(enum cpuinfo_uarch uarch) {
+	const struct cpuinfo_uarch_info* uarch_info = cpuinfo_get_uarch_info(uarch);
+	if (uarch_info == NULL) {
+		cpuinfo_log_debug("no characteristics for uarch 0x%08"PRIx32", using defaults", (uint32_t) uarch);
+		uarch_info = &default_uarch_info;
+	}
+	return uarch_info;
+}
+
+/*
+ * Width, in bits, of the widest SIMD registers supported by the ISA of a cluster and the OS, or 0 if SIMD is not
+ * supported
+ */
+static uint32_t get_isa_simd_bits(const struct cpuinfo_isa_bits isa[restrict static 1]) {
+	if (cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_avx512f)) {
+		return 512;
+	} else if (cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_avx)) {
+		return 256;
+	} else if (cpuinfo_isa_bits_has(isa, cpuinfo_isa_arm_sve) && cpuinfo_get_max_arm_sve_length() != 0) {
+		return cpuinfo_get_max_arm_sve_length();
+	} else if (cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_sse) || cpuinfo_isa_bits_has(isa, cpuinfo_isa_arm_neon)) {
+		return 128;
+	} else if (cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_mmx) || cpuinfo_isa_bits_has(isa, cpuinfo_isa_arm_wmmx)) {
+		return 64;
+	} else {
+		return 0;
+	}
+}
+
+static bool isa_has_fma(const struct cpuinfo_isa_bits isa[restrict static 1]) {
+	return cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_fma3) || cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_fma4) ||
+		cpuinfo_isa_bits_has(isa, cpuinfo_isa_arm_vfpv4);
+}
+
+static bool isa_has_int8_dot_product(const struct cpuinfo_isa_bits isa[restrict static 1]) {
+	return cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_avx512vnni) || cpuinfo_isa_bits_has(isa, cpuinfo_isa_x86_avxvnni) ||
+		cpuinfo_isa_bits_has(isa, cpuinfo_isa_arm_neon_dot);
+}
+
+static bool isa_has_int8_matrix_multiply(const struct cpuinfo_isa_bits isa[restrict static 1]) {
+	return cpuinfo_isa_bits_has(isa, cpuinfo_isa_arm_i8mm);
+}
+
+static inline uint32_t min(uint32_t a, uint32_t b) {
+	return a < b ? a : b;
+}
+
+static inline uint32_t max(uint32_t a, uint32_t b) {
+	return a > b ? a : b;
+}
+
+/* Number of elements of the specified size processed by one instruction in one pipe */
+static inline uint32_t get_lanes(uint32_t simd_bits, uint32_t element_bits) {
+	return max(simd_bits / element_bits, 1);
+}
+
+static inline uint64_t per_second(uint32_t per_cycle, uint64_t frequency) {
+	return (uint64_t) per_cycle * frequency;
+}
+
+static void compute_core_throughput(
+	const struct cpuinfo_core core[restrict static 1],
+	struct cpuinfo_throughput throughput[restrict static 1])
+{
+	const struct cpuinfo_uarch_info* uarch_info = get_uarch_info(core->uarch);
+	/* Clusters of hybrid processors may differ in ISA: each core uses the features of its own cluster */
+	const struct cpuinfo_isa_bits* isa = cpuinfo_get_cluster_isa_bits((uint32_t) (core->cluster - cpuinfo_clusters));
+	if (isa == NULL) {
+		isa = &cpuinfo_isa_bits_supported;
+	}
+	const uint32_t isa_bits = get_isa_simd_bits(isa);
+	const uint32_t simd_bits = min(uarch_info->vector_bits, isa_bits);
+	const uint32_t load_store_bits = max(min(uarch_info->load_store_bits, isa_bits), 64);
+
+	/* FMA counts as two operations */
+	const uint32_t fp_ops_per_instruction = isa_has_fma(isa) ? 2 : 1;
+	throughput->fp32_ops_per_cycle = uarch_info->fma_units * get_lanes(simd_bits, 32) * fp_ops_per_instruction;
+	throughput->fp64_ops_per_cycle = uarch_info->fma_units * get_lanes(simd_bits, 64) * fp_ops_per_instruction;
+	if (isa_has_int8_matrix_multiply(isa)) {
+		/* 2x8 by 8x2 matrix product: 8 8-bit multiply-accumulate operations in each 32-bit lane */
+		throughput->int8_ops_per_cycle = uarch_info->int_vector_units * get_lanes(simd_bits, 32) * 16;
+	} else if (isa_has_int8_dot_product(isa)) {
+		/* 4 8-bit multiply-accumulate operations in each 32-bit lane */
+		throughput->int8_ops_per_cycle = uarch_info->int_vector_units * get_lanes(simd_bits, 32) * 8;
+	} else {
+		/* Widening to 16 bits, 1 multiply-accumulate operation in each 16-bit lane */
+		throughput->int8_ops_per_cycle = uarch_info->int_vector_units * get_lanes(simd_bits, 16) * 2;
+	}
+	throughput->load_bytes_per_cycle = uarch_info->load_units * load_store_bits / 8;
+	throughput->store_bytes_per_cycle = uarch_info->store_units * load_store_bits / 8;
+
+	throughput->frequency = core->frequency;
+	throughput->fp32_ops_per_second = per_second(throughput->fp32_ops_per_cycle, core->frequency);
+	throughput->fp64_ops_per_second = per_second(throughput->fp64_ops_per_cycle, core->frequency);
+	throughput->int8_ops_per_second = per_second(throughput->int8_ops_per_cycle, core->frequency);
+	throughput->load_bytes_per_second = per_second(throughput->load_bytes_per_cycle, core->frequency);
+	throughput->store_bytes_per_second = per_second(throughput->store_bytes_per_cycle, core->frequency);
+}
+
+/* Sums throughput of cores in [core_start, core_start + core_count) range */
+static bool compute_cores_throughput(
+	uint32_t core_start,
+	uint32_t core_count,
+	struct cpuinfo_throughput throughput[restrict static 1])
+{
+	*throughput = (struct cpuinfo_throughput) { 0 };
+	if (core_count == 0 || core_start + core_count > cpuinfo_cores_count) {
+		return false;
+	}
+
+	bool known_frequency = true;
+	for (uint32_t i = core_start; i < core_start + core_count; i++) {
+		struct cpuinfo_throughput core_throughput;
+		compute_core_throughput(&cpuinfo_cores[i], &core_throughput);
+
+		throughput->fp32_ops_per_cycle += core_throughput.fp32_ops_per_cycle;
+		throughput->fp64_ops_per_cycle += core_throughput.fp64_ops_per_cycle;
+		throughput->int8_ops_per_cycle += core_throughput.int8_ops_per_cycle;
+		throughput->load_bytes_per_cycle += core_throughput.load_bytes_per_cycle;
+		throughput->store_bytes_per_cycle += core_throughput.store_bytes_per_cycle;
+
+		throughput->fp32_ops_per_second += core_throughput.fp32_ops_per_second;
+		throughput->fp64_ops_per_second += core_throughput.fp64_ops_per_second;
+		throughput->int8_ops_per_second += core_throughput.int8_ops_per_second;
+		throughput->load_bytes_per_second += core_throughput.load_bytes_per_second;
+		throughput->store_bytes_per_second += core_throughput.store_bytes_per_second;
+
+		if (core_throughput.frequency == 0) {
+			known_frequency = false;
+		} else if (i == core_start) {
+			throughput->frequency = core_throughput.frequency;
+		} else if (throughput->frequency != core_throughput.frequency) {
+			/* Cores run at different frequencies: a single value would be misleading */
+			throughput->frequency = 0;
+		}
+	}
+
+	if (!known_frequency) {
+		/* Peak rates would be underestimated without some of the cores */
+		throughput->frequency = 0;
+		throughput->fp32_ops_per_second = 0;
+		throughput->fp64_ops_per_second = 0;
+		throughput->int8_ops_per_second = 0;
+		throughput->load_bytes_per_second = 0;
+		throughput->store_bytes_per_second = 0;
+	}
+	return true;
+}
+
+bool CPUINFO_ABI cpuinfo_get_core_throughput(
+	const struct cpuinfo_core* core,
+	struct cpuinfo_throughput* throughput)
+{
+	if (core == NULL || throughput == NULL || cpuinfo_cores == NULL) {
+		return false;
+	}
+	return compute_cores_throughput((uint32_t) (core - cpuinfo_cores), 1, throughput);
+}
+
+bool CPUINFO_ABI cpuinfo_get_cluster_throughput(
+	const struct cpuinfo_cluster* cluster,
+	struct cpuinfo_throughput* throughput)
+{
+	if (cluster == NULL || throughput == NULL || cpuinfo_cores == NULL) {
+		return false;
+	}
+	return compute_cores_throughput(cluster->core_start, cluster->core_count, throughput);
+}
+
+bool CPUINFO_ABI cpuinfo_get_package_throughput(
+	const struct cpuinfo_package* package,
+	struct cpuinfo_throughput* throughput)
+{
+	if (package == NULL || throughput == NULL || cpuinfo_cores == NULL) {
+		return false;
+	}
+	return compute_cores_throughput(package->core_start, package->core_count, throughput);
+}
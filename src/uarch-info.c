@@ -0,0 +1,35 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include <cpuinfo.h>
+
+
+static const struct cpuinfo_uarch_info uarch_info_table[] = {
+#define CPUINFO_UARCH_INFO(name, decode, issue, vector, fma, ivec, loads, stores, ldst, l1lat, rob, avx512) \
+	{ \
+		.uarch = cpuinfo_uarch_##name, \
+		.decode_width = decode, \
+		.issue_width = issue, \
+		.vector_bits = vector, \
+		.fma_units = fma, \
+		.int_vector_units = ivec, \
+		.load_units = loads, \
+		.store_units = stores, \
+		.load_store_bits = ldst, \
+		.l1d_latency = l1lat, \
+		.rob_size = rob, \
+		.avx512_frequency_drop = avx512, \
+	},
+#include <uarch-info.h>
+#undef CPUINFO_UARCH_INFO
+};
+
+const struct cpuinfo_uarch_info* CPUINFO_ABI cpuinfo_get_uarch_info(enum cpuinfo_uarch uarch) {
+	for (size_t i = 0; i < sizeof(uarch_info_table) / sizeof(uarch_info_table[0]); i++) {
+		if (uarch_info_table[i].uarch == uarch) {
+			return &uarch_info_table[i];
+		}
+	}
+	return NULL;
+}
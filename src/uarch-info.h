@@ -0,0 +1,126 @@
+/*
+ * Performance characteristics of processor microarchitectures.
+ *
+ * This file is the single source of the data: it is included by src/uarch-info.c with a definition of the
+ * CPUINFO_UARCH_INFO macro to generate the constant table returned by cpuinfo_get_uarch_info().
+ *
+ * Columns:
+ * - uarch: name of the microarchitecture, without cpuinfo_uarch_ prefix.
+ * - decode: maximum number of instructions decoded per cycle.
+ * - issue: maximum number of micro-operations issued to execution units per cycle.
+ * - vector: width, in bits, of the SIMD datapath of execution units (0 if the core has no SIMD unit).
+ * - fma: number of SIMD (or scalar, if vector is 0) units executing floating-point multiply-add. On cores without
+ *   FMA instructions, the number of units executing floating-point multiplication or addition.
+ * - ivec: number of SIMD units executing integer multiplication.
+ * - loads: maximum number of loads per cycle.
+ * - stores: maximum number of stores per cycle.
+ * - ldst: width, in bits, of each load and store port.
+ * - l1lat: load-to-use latency of L1 data cache, in cycles.
+ * - rob: size of the out-of-order window (reorder buffer), in micro-operations, or 0 for in-order cores.
+ * - avx512: 1 if heavy AVX-512 instructions reduce clock frequency (frequency licenses), 0 otherwise.
+ *
+ * The numbers are approximate: they are taken from vendor optimization manuals and public microbenchmark data, and
+ * describe peak rates of a single core.
+ */
+
+/*                 uarch             decode issue vector fma ivec loads stores ldst l1lat rob avx512 */
+
+/* Intel */
+CPUINFO_UARCH_INFO(p5,                   2,    2,    64,  1,   1,    2,     1,  64,    1,   0,    0)
+CPUINFO_UARCH_INFO(quark,                1,    1,     0,  1,   1,    1,     1,  32,    1,   0,    0)
+CPUINFO_UARCH_INFO(p6,                   3,    5,    64,  2,   1,    1,     1,  64,    3,  40,    0)
+CPUINFO_UARCH_INFO(dothan,               3,    5,    64,  2,   1,    1,     1,  64,    3,  40,    0)
+CPUINFO_UARCH_INFO(yonah,                3,    5,    64,  2,   1,    1,     1,  64,    3,  40,    0)
+CPUINFO_UARCH_INFO(conroe,               4,    6,   128,  2,   1,    1,     1, 128,    3,  96,    0)
+CPUINFO_UARCH_INFO(penryn,               4,    6,   128,  2,   1,    1,     1, 128,    3,  96,    0)
+CPUINFO_UARCH_INFO(nehalem,              4,    6,   128,  2,   2,    1,     1, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(sandy_bridge,         4,    6,   256,  2,   2,    2,     1, 128,    4, 168,    0)
+CPUINFO_UARCH_INFO(ivy_bridge,           4,    6,   256,  2,   2,    2,     1, 128,    4, 168,    0)
+CPUINFO_UARCH_INFO(haswell,              4,    8,   256,  2,   2,    2,     1, 256,    4, 192,    0)
+CPUINFO_UARCH_INFO(broadwell,            4,    8,   256,  2,   2,    2,     1, 256,    4, 192,    0)
+CPUINFO_UARCH_INFO(sky_lake,             5,    8,   512,  2,   2,    2,     1, 512,    5, 224,    1)
+CPUINFO_UARCH_INFO(kaby_lake,            5,    8,   256,  2,   2,    2,     1, 256,    5, 224,    0)
+CPUINFO_UARCH_INFO(sunny_cove,           5,   10,   512,  2,   2,    2,     2, 512,    5, 352,    1)
+CPUINFO_UARCH_INFO(golden_cove,          6,   12,   512,  2,   2,    3,     2, 512,    5, 512,    1)
+CPUINFO_UARCH_INFO(willamette,           1,    3,   128,  1,   1,    1,     1, 128,    2, 126,    0)
+CPUINFO_UARCH_INFO(prescott,             1,    3,   128,  1,   1,    1,     1, 128,    4, 126,    0)
+CPUINFO_UARCH_INFO(bonnell,              2,    2,   128,  2,   1,    1,     1, 128,    3,   0,    0)
+CPUINFO_UARCH_INFO(saltwell,             2,    2,   128,  2,   1,    1,     1, 128,    3,   0,    0)
+CPUINFO_UARCH_INFO(silvermont,           2,    5,   128,  2,   1,    1,     1, 128,    3,  32,    0)
+CPUINFO_UARCH_INFO(airmont,              2,    5,   128,  2,   1,    1,     1, 128,    3,  32,    0)
+CPUINFO_UARCH_INFO(gracemont,            6,    5,   128,  2,   2,    2,     2, 128,    5, 256,    0)
+CPUINFO_UARCH_INFO(knights_ferry,        2,    2,   512,  1,   1,    1,     1, 512,    4,   0,    0)
+CPUINFO_UARCH_INFO(knights_corner,       2,    2,   512,  1,   1,    1,     1, 512,    4,   0,    0)
+CPUINFO_UARCH_INFO(knights_landing,      2,    6,   512,  2,   1,    2,     1, 512,    5,  72,    0)
+CPUINFO_UARCH_INFO(knights_hill,         2,    6,   512,  2,   1,    2,     1, 512,    5,  72,    0)
+CPUINFO_UARCH_INFO(knights_mill,         2,    6,   512,  2,   2,    2,     1, 512,    5,  72,    0)
+
+/* AMD */
+CPUINFO_UARCH_INFO(k5,                   4,    4,     0,  1,   1,    2,     1,  32,    1,  16,    0)
+CPUINFO_UARCH_INFO(k6,                   2,    6,    64,  1,   1,    1,     1,  64,    2,  24,    0)
+CPUINFO_UARCH_INFO(k7,                   3,    9,    64,  2,   1,    2,     2,  64,    3,  72,    0)
+CPUINFO_UARCH_INFO(k8,                   3,    9,    64,  2,   1,    2,     2,  64,    3,  72,    0)
+CPUINFO_UARCH_INFO(k10,                  3,    9,   128,  2,   1,    2,     1, 128,    3,  72,    0)
+/* Bulldozer-family cores share a floating-point unit with two 128-bit FMA pipes and a decoder in each module */
+CPUINFO_UARCH_INFO(bulldozer,            2,    4,   128,  1,   1,    2,     1, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(piledriver,           2,    4,   128,  1,   1,    2,     1, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(steamroller,          4,    4,   128,  1,   1,    2,     1, 128,    4, 192,    0)
+CPUINFO_UARCH_INFO(excavator,            4,    4,   128,  1,   1,    2,     1, 128,    4, 192,    0)
+/* Zen executes 256-bit AVX instructions as two 128-bit micro-operations */
+CPUINFO_UARCH_INFO(zen,                  4,   10,   128,  2,   2,    2,     1, 128,    4, 192,    0)
+CPUINFO_UARCH_INFO(geode,                1,    1,    64,  1,   1,    1,     1,  32,    1,   0,    0)
+CPUINFO_UARCH_INFO(bobcat,               2,    6,    64,  2,   1,    1,     1,  64,    3,  56,    0)
+CPUINFO_UARCH_INFO(jaguar,               2,    6,   128,  2,   1,    1,     1, 128,    3,  64,    0)
+CPUINFO_UARCH_INFO(puma,                 2,    6,   128,  2,   1,    1,     1, 128,    3,  64,    0)
+
+/* ARM */
+CPUINFO_UARCH_INFO(xscale,               1,    1,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(arm7,                 1,    1,     0,  1,   1,    1,     1,  32,    1,   0,    0)
+CPUINFO_UARCH_INFO(arm9,                 1,    1,     0,  1,   1,    1,     1,  32,    1,   0,    0)
+CPUINFO_UARCH_INFO(arm11,                1,    1,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a5,            1,    1,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a7,            2,    2,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a8,            2,    2,    64,  1,   1,    1,     1, 128,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a9,            2,    4,    64,  1,   1,    1,     1,  64,    4,  32,    0)
+CPUINFO_UARCH_INFO(cortex_a12,           2,    8,    64,  2,   1,    1,     1, 128,    4,  64,    0)
+CPUINFO_UARCH_INFO(cortex_a15,           3,    8,    64,  2,   2,    1,     1, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(cortex_a17,           2,    8,    64,  2,   1,    1,     1, 128,    4,  64,    0)
+CPUINFO_UARCH_INFO(cortex_a32,           2,    2,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a35,           2,    2,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a53,           2,    2,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a55,           2,    2,    64,  2,   2,    1,     1,  64,    4,   0,    0)
+CPUINFO_UARCH_INFO(cortex_a57,           3,    8,    64,  2,   2,    1,     1, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(cortex_a72,           3,    8,    64,  2,   2,    1,     1, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(cortex_a73,           2,    7,    64,  2,   2,    1,     1, 128,    4,  64,    0)
+CPUINFO_UARCH_INFO(cortex_a75,           3,    8,    64,  2,   2,    1,     1, 128,    4, 116,    0)
+CPUINFO_UARCH_INFO(neoverse_n1,          4,    8,   128,  2,   2,    2,     2, 128,    4, 128,    0)
+CPUINFO_UARCH_INFO(neoverse_v1,          5,   15,   256,  2,   2,    3,     2, 128,    4, 256,    0)
+
+/* Qualcomm */
+CPUINFO_UARCH_INFO(scorpion,             2,    2,   128,  1,   1,    1,     1, 128,    3,   0,    0)
+CPUINFO_UARCH_INFO(krait,                3,    7,   128,  1,   1,    1,     1, 128,    3,  40,    0)
+CPUINFO_UARCH_INFO(kryo,                 4,    8,   128,  2,   2,    2,     1, 128,    3, 128,    0)
+
+/* Nvidia */
+CPUINFO_UARCH_INFO(denver,               2,    7,   128,  2,   2,    2,     1, 128,    3,   0,    0)
+
+/* Samsung */
+CPUINFO_UARCH_INFO(mongoose_m1,          4,    9,   128,  2,   2,    2,     1, 128,    4,  96,    0)
+CPUINFO_UARCH_INFO(mongoose_m2,          4,    9,   128,  2,   2,    2,     1, 128,    4,  96,    0)
+CPUINFO_UARCH_INFO(mongoose_m3,          6,   12,   128,  3,   3,    2,     1, 128,    4, 228,    0)
+
+/* Apple */
+CPUINFO_UARCH_INFO(swift,                3,    5,   128,  1,   1,    1,     1, 128,    4,  45,    0)
+CPUINFO_UARCH_INFO(cyclone,              6,    9,   128,  3,   3,    2,     1, 128,    4, 192,    0)
+CPUINFO_UARCH_INFO(typhoon,              6,    9,   128,  3,   3,    2,     1, 128,    4, 192,    0)
+CPUINFO_UARCH_INFO(twister,              6,    9,   128,  3,   3,    2,     1, 128,    4, 192,    0)
+CPUINFO_UARCH_INFO(hurricane,            6,    9,   128,  3,   3,    2,     1, 128,    4, 224,    0)
+CPUINFO_UARCH_INFO(monsoon,              7,   11,   128,  3,   3,    2,     2, 128,    4, 224,    0)
+CPUINFO_UARCH_INFO(mistral,              3,    5,   128,  2,   2,    1,     1, 128,    4,  64,    0)
+
+/* Cavium */
+CPUINFO_UARCH_INFO(thunderx,             2,    2,    64,  1,   1,    1,     1,  64,    3,   0,    0)
+CPUINFO_UARCH_INFO(thunderx2,            4,    6,   128,  2,   2,    2,     1, 128,    4, 180,    0)
+
+/* Marvell */
+CPUINFO_UARCH_INFO(pj4,                  2,    2,    64,  1,   1,    1,     1,  64,    3,   0,    0)
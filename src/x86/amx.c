@@ -0,0 +1,44 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+	#include <unistd.h>
+	#include <sys/syscall.h>
+#endif
+
+#include <cpuinfo.h>
+#include <api.h>
+#include <log.h>
+
+
+/* arch/x86/include/uapi/asm/prctl.h in Linux 5.16+ */
+#ifndef ARCH_REQ_XCOMP_PERM
+	#define ARCH_REQ_XCOMP_PERM 0x1023
+#endif
+/* XTILEDATA state component in XSAVE area */
+#define XFEATURE_XTILEDATA 18
+
+
+bool CPUINFO_ABI cpuinfo_request_x86_amx(void) {
+	if (cpuinfo_processors == NULL) {
+		cpuinfo_log_warning("cpuinfo_request_x86_amx called before cpuinfo_initialize");
+		return false;
+	}
+	if (!cpuinfo_has_x86_amx_tile()) {
+		return false;
+	}
+
+	#if defined(__linux__) && CPUINFO_ARCH_X86_64 && !CPUINFO_MOCK
+		/*
+		 * The kernel keeps the request in the process state, and repeated requests succeed,
+		 * so there is no need to remember the result of the first call.
+		 */
+		if (syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) != 0) {
+			cpuinfo_log_warning("failed to request AMX tile data permission: %s", strerror(errno));
+			return false;
+		}
+	#endif
+	return true;
+}
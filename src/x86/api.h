@@ -6,6 +6,10 @@
 #include <cpuinfo.h>
 
 
+/* Core types reported in CPUID leaf 0x1A on hybrid processors */
+#define CPUINFO_X86_CORE_TYPE_ATOM UINT32_C(0x20)
+#define CPUINFO_X86_CORE_TYPE_CORE UINT32_C(0x40)
+
 struct cpuid_regs {
 	uint32_t eax;
 	uint32_t ebx;
@@ -57,6 +61,8 @@ struct cpuinfo_x86_processor {
 	uint32_t cpuid;
 	enum cpuinfo_vendor vendor;
 	enum cpuinfo_uarch uarch;
+	/* Type of the core in CPUID leaf 0x1A, or 0 if the processor is not hybrid */
+	uint32_t core_type;
 #ifdef __linux__
 	int linux_id;
 #endif
@@ -87,6 +93,7 @@ struct cpuinfo_x86_model_info cpuinfo_x86_decode_model_info(uint32_t eax);
 enum cpuinfo_uarch cpuinfo_x86_decode_uarch(
 	enum cpuinfo_vendor vendor,
 	const struct cpuinfo_x86_model_info* model_info);
+enum cpuinfo_uarch cpuinfo_x86_decode_hybrid_uarch(enum cpuinfo_uarch uarch, uint32_t core_type);
 
 struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	const struct cpuid_regs basic_info, const struct cpuid_regs extended_info,
@@ -94,6 +101,13 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	enum cpuinfo_vendor vendor, enum cpuinfo_uarch uarch);
 struct cpuinfo_x86_isa cpuinfo_x86_nacl_detect_isa(void);
 
+extern struct cpuinfo_x86_xsave cpuinfo_x86_xsave;
+
+void cpuinfo_x86_detect_xsave(
+	const struct cpuid_regs basic_info,
+	uint32_t max_base_index,
+	struct cpuinfo_x86_xsave xsave[restrict static 1]);
+
 void cpuinfo_x86_detect_topology(
 	uint32_t max_base_index,
 	uint32_t max_extended_index,
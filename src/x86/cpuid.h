@@ -73,7 +73,9 @@
  */
 #ifndef __native_client__
 	static inline uint64_t xgetbv(uint32_t ext_ctrl_reg) {
-		#ifdef _MSC_VER
+		#if CPUINFO_MOCK
+			return cpuinfo_mock_xgetbv(ext_ctrl_reg);
+		#elif defined(_MSC_VER)
 			return (uint64_t)_xgetbv((unsigned int)ext_ctrl_reg);
 		#else
 			uint32_t lo, hi;
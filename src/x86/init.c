@@ -29,8 +29,17 @@ void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor) {
 		processor->cpuid = leaf1.eax;
 
 		const struct cpuinfo_x86_model_info model_info = cpuinfo_x86_decode_model_info(leaf1.eax);
-		const enum cpuinfo_uarch uarch = processor->uarch =
-			cpuinfo_x86_decode_uarch(vendor, &model_info);
+		enum cpuinfo_uarch uarch = cpuinfo_x86_decode_uarch(vendor, &model_info);
+
+		/*
+		 * Hybrid processors report the type of the current core in leaf 0x1A.
+		 * - Intel: edx[bit 15] in structured feature info.
+		 */
+		if (max_base_index >= UINT32_C(0x1A) && (cpuidex(7, 0).edx & UINT32_C(0x00008000))) {
+			processor->core_type = cpuid(UINT32_C(0x1A)).eax >> 24;
+			uarch = cpuinfo_x86_decode_hybrid_uarch(uarch, processor->core_type);
+		}
+		processor->uarch = uarch;
 
 		cpuinfo_x86_clflush_size = ((leaf1.ebx >> 8) & UINT32_C(0x000000FF)) * 8;
 
@@ -65,6 +74,7 @@ void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor) {
 		#else
 			cpuinfo_isa = cpuinfo_x86_detect_isa(leaf1, leaf0x80000001,
 				max_base_index, max_extended_index, vendor, uarch);
+			cpuinfo_x86_detect_xsave(leaf1, max_base_index, &cpuinfo_x86_xsave);
 		#endif
 	}
 	if (max_extended_index >= UINT32_C(0x80000004)) {
@@ -45,12 +45,17 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	const struct cpuid_regs structured_feature_info =
 		(max_base_index >= 7) ? cpuidex(7, 0) : (struct cpuid_regs) { 0, 0, 0, 0};
 
+	/* eax in subleaf 0 of structured feature info reports the maximum supported subleaf */
+	const struct cpuid_regs structured_feature_info1 =
+		(max_base_index >= 7 && structured_feature_info.eax >= 1) ?
+			cpuidex(7, 1) : (struct cpuid_regs) { 0, 0, 0, 0};
+
 	const uint32_t processor_capacity_info_index = UINT32_C(0x80000008);
 	const struct cpuid_regs processor_capacity_info =
 		(max_extended_index >= processor_capacity_info_index) ?
 			cpuid(processor_capacity_info_index) : (struct cpuid_regs) { 0, 0, 0, 0 };
 
-	bool avx_regs = false, avx512_regs = false, mpx_regs = false;
+	bool avx_regs = false, avx512_regs = false, mpx_regs = false, amx_regs = false;
 	/*
 	 * OSXSAVE: Operating system enabled XSAVE instructions for application use:
 	 * - Intel, AMD: ecx[bit 26] in basic info = XSAVE/XRSTOR instructions supported by a chip.
@@ -98,7 +103,42 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 		if ((xcr0_valid_bits & mpx_regs_mask) == mpx_regs_mask) {
 			mpx_regs = (xfeature_enabled_mask & mpx_regs_mask) == mpx_regs_mask;
 		}
+
+		/*
+		 * AMX registers:
+		 * - Intel: XFEATURE_ENABLED_MASK[bit 17] for XTILECFG tile configuration register
+		 * - Intel: XFEATURE_ENABLED_MASK[bit 18] for XTILEDATA tile data registers tmm0-tmm7
+		 *
+		 * Linux sets both bits, but additionally requires a per-process permission to use XTILEDATA,
+		 * see cpuinfo_request_x86_amx().
+		 */
+		const uint64_t amx_regs_mask = UINT64_C(0x0000000000060000);
+		if ((xcr0_valid_bits & amx_regs_mask) == amx_regs_mask) {
+			amx_regs = (xfeature_enabled_mask & amx_regs_mask) == amx_regs_mask;
+		}
+	}
+
+#if CPUINFO_ARCH_X86_64
+	/*
+	 * AMX tile palette and TMUL parameters:
+	 * - Intel: eax in subleaf 0 of tile information leaf 0x1D = maximum supported palette.
+	 * - Intel: ebx[bits 16-31] in subleaf 1 of tile information leaf 0x1D = number of tile registers in palette 1.
+	 * - Intel: ebx[bits 0-7] in TMUL information leaf 0x1E = maximum number of rows (K) in TMUL instructions.
+	 * Tile instructions need palette 1, and matrix multiplication instructions need a non-zero TMUL K dimension.
+	 */
+	bool amx_palette = false, amx_tmul = false;
+	if (amx_regs && max_base_index >= UINT32_C(0x1D)) {
+		const struct cpuid_regs tile_info = cpuidex(UINT32_C(0x1D), 0);
+		if (tile_info.eax >= 1) {
+			const struct cpuid_regs tile_palette1_info = cpuidex(UINT32_C(0x1D), 1);
+			amx_palette = (tile_palette1_info.ebx >> 16) != 0;
+		}
+		if (max_base_index >= UINT32_C(0x1E)) {
+			const struct cpuid_regs tmul_info = cpuidex(UINT32_C(0x1E), 0);
+			amx_tmul = (tmul_info.ebx & UINT32_C(0x000000FF)) != 0;
+		}
 	}
+#endif
 
 #if CPUINFO_ARCH_X86
 	/*
@@ -480,6 +520,50 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 */
 	isa.avx512_4fmaps = avx512_regs && !!(structured_feature_info.edx & UINT32_C(0x00000008));
 
+	/*
+	 * AVX512_VP2INTERSECT instructions:
+	 * - Intel: edx[bit 8] in structured feature info.
+	 */
+	isa.avx512vp2intersect = avx512_regs && !!(structured_feature_info.edx & UINT32_C(0x00000100));
+
+	/*
+	 * AVX512_BF16 instructions:
+	 * - Intel: eax[bit 5] in subleaf 1 of structured feature info.
+	 */
+	isa.avx512bf16 = avx512_regs && !!(structured_feature_info1.eax & UINT32_C(0x00000020));
+
+	/*
+	 * AVX512_FP16 instructions:
+	 * - Intel: edx[bit 23] in structured feature info.
+	 */
+	isa.avx512fp16 = avx512_regs && !!(structured_feature_info.edx & UINT32_C(0x00800000));
+
+	/*
+	 * AVX-VNNI instructions (VEX-encoded VNNI):
+	 * - Intel: eax[bit 4] in subleaf 1 of structured feature info.
+	 */
+	isa.avxvnni = avx_regs && !!(structured_feature_info1.eax & UINT32_C(0x00000010));
+
+#if CPUINFO_ARCH_X86_64
+	/*
+	 * AMX-TILE instructions (only in 64-bit mode):
+	 * - Intel: edx[bit 24] in structured feature info.
+	 */
+	isa.amx_tile = amx_palette && !!(structured_feature_info.edx & UINT32_C(0x01000000));
+
+	/*
+	 * AMX-INT8 instructions:
+	 * - Intel: edx[bit 25] in structured feature info.
+	 */
+	isa.amx_int8 = isa.amx_tile && amx_tmul && !!(structured_feature_info.edx & UINT32_C(0x02000000));
+
+	/*
+	 * AMX-BF16 instructions:
+	 * - Intel: edx[bit 22] in structured feature info.
+	 */
+	isa.amx_bf16 = isa.amx_tile && amx_tmul && !!(structured_feature_info.edx & UINT32_C(0x00400000));
+#endif
+
 	/*
 	 * HLE instructions:
 	 * - Intel: ebx[bit 4] in structured feature info.
@@ -8,8 +8,15 @@
 #include <linux/api.h>
 
 
+/* Maximum number of core types in a hybrid processor */
+#define CPUINFO_X86_LINUX_MAX_CORE_TYPES 4
+
 struct cpuinfo_x86_linux_processor {
 	uint32_t apic_id;
+	/* APIC ID bits of the physical package */
+	uint32_t apic_package_id;
+	/* Type of the core in CPUID leaf 0x1A, or 0 if the processor is not hybrid */
+	uint32_t core_type;
 	uint32_t linux_id;
 	uint32_t flags;
 };
@@ -17,3 +24,10 @@ struct cpuinfo_x86_linux_processor {
 bool cpuinfo_x86_linux_parse_proc_cpuinfo(
 	uint32_t max_processors_count,
 	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count]);
+
+uint32_t cpuinfo_x86_linux_detect_core_types(
+	uint32_t max_processors_count,
+	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count],
+	const struct cpuinfo_x86_processor current_processor[restrict static 1],
+	struct cpuinfo_x86_processor core_types[restrict static CPUINFO_X86_LINUX_MAX_CORE_TYPES],
+	struct cpuinfo_x86_isa core_types_isa[restrict static CPUINFO_X86_LINUX_MAX_CORE_TYPES]);
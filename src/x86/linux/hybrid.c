@@ -0,0 +1,180 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+
+#include <sched.h>
+
+#if CPUINFO_MOCK
+	#include <cpuinfo-mock.h>
+#endif
+#include <cpuinfo.h>
+#include <x86/api.h>
+#include <x86/cpuid.h>
+#include <x86/linux/api.h>
+#include <linux/api.h>
+#include <api.h>
+#include <log.h>
+
+
+#define CORE_CPULIST_FILENAME "/sys/devices/cpu_core/cpus"
+#define ATOM_CPULIST_FILENAME "/sys/devices/cpu_atom/cpus"
+
+static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
+	return (bitfield & mask) == mask;
+}
+
+/* Migrates the calling thread to the logical processor, so that CPUID reports values of this processor */
+static bool migrate_to_processor(uint32_t processor) {
+	#if CPUINFO_MOCK
+		cpuinfo_mock_select_processor_cpuid(processor);
+		return true;
+	#else
+		if (processor >= CPU_SETSIZE) {
+			cpuinfo_log_info("processor %"PRIu32" is outside of CPU_SETSIZE affinity mask", processor);
+			return false;
+		}
+		cpu_set_t affinity;
+		CPU_ZERO(&affinity);
+		CPU_SET(processor, &affinity);
+		if (sched_setaffinity(0, sizeof(cpu_set_t), &affinity) != 0) {
+			cpuinfo_log_info("failed to migrate to processor %"PRIu32": %s", processor, strerror(errno));
+			return false;
+		}
+		return true;
+	#endif
+}
+
+struct core_type_context {
+	uint32_t max_processors_count;
+	struct cpuinfo_x86_linux_processor* processors;
+	uint32_t core_type;
+};
+
+static bool core_type_parser(uint32_t processor_list_start, uint32_t processor_list_end, struct core_type_context* context) {
+	for (uint32_t processor = processor_list_start; processor < processor_list_end; processor++) {
+		if (processor >= context->max_processors_count) {
+			break;
+		}
+		if (context->processors[processor].core_type == 0) {
+			context->processors[processor].core_type = context->core_type;
+		}
+	}
+	return true;
+}
+
+uint32_t cpuinfo_x86_linux_detect_core_types(
+	uint32_t max_processors_count,
+	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count],
+	const struct cpuinfo_x86_processor current_processor[restrict static 1],
+	struct cpuinfo_x86_processor core_types[restrict static CPUINFO_X86_LINUX_MAX_CORE_TYPES],
+	struct cpuinfo_x86_isa core_types_isa[restrict static CPUINFO_X86_LINUX_MAX_CORE_TYPES])
+{
+	if (current_processor->core_type == 0) {
+		/* Not a hybrid processor: all cores are of the same type as the current core */
+		core_types[0] = *current_processor;
+		core_types_isa[0] = cpuinfo_isa;
+		return 1;
+	}
+
+	/* ISA of the current core, overwritten by cpuinfo_x86_init_processor */
+	const struct cpuinfo_x86_isa current_isa = cpuinfo_isa;
+
+	#if !CPUINFO_MOCK
+		cpu_set_t old_affinity;
+		const bool restore_affinity = sched_getaffinity(0, sizeof(cpu_set_t), &old_affinity) == 0;
+	#endif
+
+	/* Read core type in leaf 0x1A on every logical processor */
+	uint32_t usable_processors = 0, sampled_processors = 0;
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
+			usable_processors += 1;
+			if (migrate_to_processor(i)) {
+				processors[i].core_type = cpuid(UINT32_C(0x1A)).eax >> 24;
+				cpuinfo_log_debug("processor %"PRIu32": core type 0x%02"PRIx32, i, processors[i].core_type);
+				sampled_processors += 1;
+			}
+		}
+	}
+
+	if (sampled_processors != usable_processors) {
+		/* Some processors are outside of the affinity mask: use processor lists of hybrid PMUs (Linux 5.13+) */
+		struct core_type_context core_context = { max_processors_count, processors, CPUINFO_X86_CORE_TYPE_CORE };
+		cpuinfo_linux_parse_cpulist(CORE_CPULIST_FILENAME,
+			(cpuinfo_cpulist_callback) core_type_parser, &core_context);
+		struct core_type_context atom_context = { max_processors_count, processors, CPUINFO_X86_CORE_TYPE_ATOM };
+		cpuinfo_linux_parse_cpulist(ATOM_CPULIST_FILENAME,
+			(cpuinfo_cpulist_callback) core_type_parser, &atom_context);
+	}
+
+	/* Detect caches, microarchitecture, and ISA on the first processor of every core type */
+	uint32_t core_types_count = 0;
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		if (!bitmask_all(processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
+			continue;
+		}
+		if (processors[i].core_type == 0) {
+			cpuinfo_log_warning("failed to detect core type of processor %"PRIu32": assume core type 0x%02"PRIx32,
+				i, current_processor->core_type);
+			processors[i].core_type = current_processor->core_type;
+		}
+
+		bool known_core_type = false;
+		for (uint32_t j = 0; j < core_types_count; j++) {
+			known_core_type |= core_types[j].core_type == processors[i].core_type;
+		}
+		if (known_core_type) {
+			continue;
+		}
+		if (core_types_count == CPUINFO_X86_LINUX_MAX_CORE_TYPES) {
+			cpuinfo_log_warning("core type 0x%02"PRIx32" of processor %"PRIu32" ignored: too many core types",
+				processors[i].core_type, i);
+			processors[i].core_type = core_types[0].core_type;
+			continue;
+		}
+
+		struct cpuinfo_x86_processor* core_type = &core_types[core_types_count];
+		if (migrate_to_processor(i)) {
+			memset(core_type, 0, sizeof(struct cpuinfo_x86_processor));
+			cpuinfo_x86_init_processor(core_type);
+			core_types_isa[core_types_count] = cpuinfo_isa;
+		} else {
+			cpuinfo_log_warning("caches of core type 0x%02"PRIx32" are assumed to match the current core",
+				processors[i].core_type);
+			*core_type = *current_processor;
+			core_type->core_type = processors[i].core_type;
+			core_type->uarch = cpuinfo_x86_decode_hybrid_uarch(current_processor->uarch, processors[i].core_type);
+			core_types_isa[core_types_count] = current_isa;
+		}
+		core_types_count += 1;
+	}
+
+	#if CPUINFO_MOCK
+		cpuinfo_mock_select_processor_cpuid(UINT32_MAX);
+	#else
+		if (restore_affinity) {
+			sched_setaffinity(0, sizeof(cpu_set_t), &old_affinity);
+		}
+	#endif
+
+	/* Order core types by decreasing performance: Core before Atom */
+	for (uint32_t i = 1; i < core_types_count; i++) {
+		for (uint32_t j = i; j != 0 && core_types[j - 1].core_type < core_types[j].core_type; j--) {
+			const struct cpuinfo_x86_processor core_type = core_types[j];
+			const struct cpuinfo_x86_isa core_type_isa = core_types_isa[j];
+			core_types[j] = core_types[j - 1];
+			core_types_isa[j] = core_types_isa[j - 1];
+			core_types[j - 1] = core_type;
+			core_types_isa[j - 1] = core_type_isa;
+		}
+	}
+
+	/* Global ISA includes only features supported by all core types */
+	cpuinfo_isa = core_types_isa[0];
+	for (uint32_t i = 1; i < core_types_count; i++) {
+		cpuinfo_intersect_isa(&cpuinfo_isa, &core_types_isa[i]);
+	}
+	return core_types_count;
+}
@@ -39,17 +39,46 @@ static int cmp_x86_linux_processor(const void* ptr_a, const void* ptr_b) {
 		return (int) usable_b - (int) usable_a;
 	}
 
+	/* Group processors by physical package */
+	const uint32_t package_a = processor_a->apic_package_id;
+	const uint32_t package_b = processor_b->apic_package_id;
+	if (package_a != package_b) {
+		return cmp(package_a, package_b);
+	}
+
+	/* Group processors of the same core type in a package, with higher (Core) types first */
+	const uint32_t core_type_a = processor_a->core_type;
+	const uint32_t core_type_b = processor_b->core_type;
+	if (core_type_a != core_type_b) {
+		return cmp(core_type_b, core_type_a);
+	}
+
 	/* Compare based on APIC ID (i.e. processor 0 < processor 1) */
 	const uint32_t id_a = processor_a->apic_id;
 	const uint32_t id_b = processor_b->apic_id;
 	return cmp(id_a, id_b);
 }
 
+static const struct cpuinfo_x86_processor* find_core_type(
+	uint32_t core_types_count,
+	const struct cpuinfo_x86_processor core_types[restrict static core_types_count],
+	uint32_t core_type)
+{
+	for (uint32_t i = 1; i < core_types_count; i++) {
+		if (core_types[i].core_type == core_type) {
+			return &core_types[i];
+		}
+	}
+	return &core_types[0];
+}
+
 static void cpuinfo_x86_count_objects(
 	uint32_t linux_processors_count,
 	const struct cpuinfo_x86_linux_processor linux_processors[restrict static linux_processors_count],
-	const struct cpuinfo_x86_processor processor[restrict static 1],
+	uint32_t core_types_count,
+	const struct cpuinfo_x86_processor core_types[restrict static core_types_count],
 	uint32_t cores_count_ptr[restrict static 1],
+	uint32_t clusters_count_ptr[restrict static 1],
 	uint32_t packages_count_ptr[restrict static 1],
 	uint32_t l1i_count_ptr[restrict static 1],
 	uint32_t l1d_count_ptr[restrict static 1],
@@ -57,15 +86,17 @@ static void cpuinfo_x86_count_objects(
 	uint32_t l3_count_ptr[restrict static 1],
 	uint32_t l4_count_ptr[restrict static 1])
 {
-	uint32_t cores_count = 0, packages_count = 0;
+	uint32_t cores_count = 0, clusters_count = 0, packages_count = 0;
 	uint32_t l1i_count = 0, l1d_count = 0, l2_count = 0, l3_count = 0, l4_count = 0;
-	uint32_t last_core_id = UINT32_MAX, last_package_id = UINT32_MAX;
+	uint32_t last_core_id = UINT32_MAX, last_package_id = UINT32_MAX, last_core_type = UINT32_MAX;
 	uint32_t last_l1i_id = UINT32_MAX, last_l1d_id = UINT32_MAX;
 	uint32_t last_l2_id = UINT32_MAX, last_l3_id = UINT32_MAX, last_l4_id = UINT32_MAX;
 	for (uint32_t i = 0; i < linux_processors_count; i++) {
 		if (bitmask_all(linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
 			const uint32_t apic_id = linux_processors[i].apic_id;
 			cpuinfo_log_debug("APID ID %"PRIu32": system processor %"PRIu32, apic_id, linux_processors[i].linux_id);
+			const struct cpuinfo_x86_processor* processor =
+				find_core_type(core_types_count, core_types, linux_processors[i].core_type);
 
 			/* All bits of APIC ID except thread ID mask */
 			const uint32_t core_id = apic_id &
@@ -75,8 +106,11 @@ static void cpuinfo_x86_count_objects(
 				cores_count++;
 			}
 			/* All bits of APIC ID except thread ID and core ID masks */
-			const uint32_t package_id = core_id &
-				~(bit_mask(processor->topology.core_bits_length) << processor->topology.core_bits_offset);
+			const uint32_t package_id = linux_processors[i].apic_package_id;
+			if (package_id != last_package_id || linux_processors[i].core_type != last_core_type) {
+				last_core_type = linux_processors[i].core_type;
+				clusters_count++;
+			}
 			if (package_id != last_package_id) {
 				last_package_id = package_id;
 				packages_count++;
@@ -119,6 +153,7 @@ static void cpuinfo_x86_count_objects(
 		}
 	}
 	*cores_count_ptr = cores_count;
+	*clusters_count_ptr = clusters_count;
 	*packages_count_ptr = packages_count;
 	*l1i_count_ptr = l1i_count;
 	*l1d_count_ptr = l1d_count;
@@ -140,6 +175,7 @@ void cpuinfo_x86_linux_init(void) {
 	struct cpuinfo_cache* l2 = NULL;
 	struct cpuinfo_cache* l3 = NULL;
 	struct cpuinfo_cache* l4 = NULL;
+	struct cpuinfo_x86_isa* cluster_isa = NULL;
 
 	const uint32_t max_processors_count = cpuinfo_linux_get_max_processors_count();
 	cpuinfo_log_debug("system maximum processors count: %"PRIu32, max_processors_count);
@@ -186,10 +222,25 @@ void cpuinfo_x86_linux_init(void) {
 	for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
 		if (bitmask_all(x86_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
 			x86_linux_processors[i].linux_id = i;
+			/* All bits of APIC ID except thread ID and core ID masks */
+			x86_linux_processors[i].apic_package_id = x86_linux_processors[i].apic_id &
+				~(bit_mask(x86_processor.topology.thread_bits_length) << x86_processor.topology.thread_bits_offset) &
+				~(bit_mask(x86_processor.topology.core_bits_length) << x86_processor.topology.core_bits_offset);
 			processors_count++;
 		}
 	}
 
+	/*
+	 * Hybrid processors combine cores of different types (e.g. Golden Cove and Gracemont cores in Alder Lake), which
+	 * differ in microarchitecture, caches, and frequency. CPUID reports only the characteristics of the current core,
+	 * thus the types of all cores are detected by running CPUID on every logical processor.
+	 */
+	struct cpuinfo_x86_processor core_types[CPUINFO_X86_LINUX_MAX_CORE_TYPES];
+	struct cpuinfo_x86_isa core_types_isa[CPUINFO_X86_LINUX_MAX_CORE_TYPES];
+	const uint32_t core_types_count = cpuinfo_x86_linux_detect_core_types(
+		x86_linux_processors_count, x86_linux_processors, &x86_processor, core_types, core_types_isa);
+	cpuinfo_log_debug("detected %"PRIu32" core types", core_types_count);
+
 	qsort(x86_linux_processors, x86_linux_processors_count, sizeof(struct cpuinfo_x86_linux_processor),
 		cmp_x86_linux_processor);
 
@@ -200,12 +251,13 @@ void cpuinfo_x86_linux_init(void) {
 		goto cleanup;
 	}
 
-	uint32_t packages_count = 0, cores_count = 0;
+	uint32_t packages_count = 0, clusters_count = 0, cores_count = 0;
 	uint32_t l1i_count = 0, l1d_count = 0, l2_count = 0, l3_count = 0, l4_count = 0;
-	cpuinfo_x86_count_objects(x86_linux_processors_count, x86_linux_processors, &x86_processor,
-		&cores_count, &packages_count, &l1i_count, &l1d_count, &l2_count, &l3_count, &l4_count);
+	cpuinfo_x86_count_objects(x86_linux_processors_count, x86_linux_processors, core_types_count, core_types,
+		&cores_count, &clusters_count, &packages_count, &l1i_count, &l1d_count, &l2_count, &l3_count, &l4_count);
 
 	cpuinfo_log_debug("detected %"PRIu32" cores", cores_count);
+	cpuinfo_log_debug("detected %"PRIu32" core clusters", clusters_count);
 	cpuinfo_log_debug("detected %"PRIu32" packages", packages_count);
 	cpuinfo_log_debug("detected %"PRIu32" L1I caches", l1i_count);
 	cpuinfo_log_debug("detected %"PRIu32" L1D caches", l1d_count);
@@ -236,11 +288,18 @@ void cpuinfo_x86_linux_init(void) {
 		goto cleanup;
 	}
 
-	/* On x86 cluster of cores is a physical package */
-	clusters = calloc(packages_count, sizeof(struct cpuinfo_cluster));
+	/* On x86 cluster of cores is a physical package, or cores of the same type in a package of a hybrid processor */
+	clusters = calloc(clusters_count, sizeof(struct cpuinfo_cluster));
 	if (clusters == NULL) {
 		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" core clusters",
-			packages_count * sizeof(struct cpuinfo_cluster), packages_count);
+			clusters_count * sizeof(struct cpuinfo_cluster), clusters_count);
+		goto cleanup;
+	}
+
+	cluster_isa = calloc(clusters_count, sizeof(struct cpuinfo_x86_isa));
+	if (cluster_isa == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for ISA descriptions of %"PRIu32" core clusters",
+			clusters_count * sizeof(struct cpuinfo_x86_isa), clusters_count);
 		goto cleanup;
 	}
 
@@ -292,55 +351,100 @@ void cpuinfo_x86_linux_init(void) {
 		}
 	}
 
-	uint32_t processor_index = UINT32_MAX, core_index = UINT32_MAX, package_index = UINT32_MAX;
+	uint32_t processor_index = UINT32_MAX, core_index = UINT32_MAX, cluster_index = UINT32_MAX, package_index = UINT32_MAX;
 	uint32_t l1i_index = UINT32_MAX, l1d_index = UINT32_MAX, l2_index = UINT32_MAX, l3_index = UINT32_MAX, l4_index = UINT32_MAX;
 	uint32_t core_id = 0, smt_id = 0;
-	uint32_t last_apic_core_id = UINT32_MAX, last_apic_package_id = UINT32_MAX;
+	uint32_t last_apic_core_id = UINT32_MAX, last_apic_package_id = UINT32_MAX, last_core_type = UINT32_MAX;
 	uint32_t last_l1i_id = UINT32_MAX, last_l1d_id = UINT32_MAX;
 	uint32_t last_l2_id = UINT32_MAX, last_l3_id = UINT32_MAX, last_l4_id = UINT32_MAX;
 	for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
 		if (bitmask_all(x86_linux_processors[i].flags, CPUINFO_LINUX_MASK_USABLE)) {
 			const uint32_t apic_id = x86_linux_processors[i].apic_id;
+			const struct cpuinfo_x86_processor* core_type =
+				find_core_type(core_types_count, core_types, x86_linux_processors[i].core_type);
 			processor_index++;
 			smt_id++;
 
 			/* All bits of APIC ID except thread ID mask */
 			const uint32_t apid_core_id = apic_id &
-				~(bit_mask(x86_processor.topology.thread_bits_length) << x86_processor.topology.thread_bits_offset);
+				~(bit_mask(core_type->topology.thread_bits_length) << core_type->topology.thread_bits_offset);
 			if (apid_core_id != last_apic_core_id) {
 				core_index++;
 				core_id++;
 				smt_id = 0;
 			}
 			/* All bits of APIC ID except thread ID and core ID masks */
-			const uint32_t apic_package_id = apid_core_id &
-				~(bit_mask(x86_processor.topology.core_bits_length) << x86_processor.topology.core_bits_offset);
-			if (apic_package_id != last_apic_package_id) {
+			const uint32_t apic_package_id = x86_linux_processors[i].apic_package_id;
+			const bool new_package = apic_package_id != last_apic_package_id;
+			const bool new_cluster = new_package || core_type->core_type != last_core_type;
+			if (new_package) {
 				package_index++;
 				core_id = 0;
 			}
+			if (new_cluster) {
+				cluster_index++;
+			}
 
 			/* Initialize logical processor object */
 			processors[processor_index].smt_id   = smt_id;
 			processors[processor_index].core     = cores + core_index;
-			processors[processor_index].cluster  = clusters + package_index;
+			processors[processor_index].cluster  = clusters + cluster_index;
 			processors[processor_index].package  = packages + package_index;
 			processors[processor_index].linux_id = x86_linux_processors[i].linux_id;
 			processors[processor_index].apic_id  = x86_linux_processors[i].apic_id;
 
+			if (new_package) {
+				/* new package */
+				packages[package_index].processor_start = processor_index;
+				packages[package_index].processor_count = 1;
+				packages[package_index].core_start = core_index;
+				packages[package_index].cluster_start = cluster_index;
+				packages[package_index].cluster_count = 1;
+				cpuinfo_x86_format_package_name(x86_processor.vendor, brand_string, packages[package_index].name);
+				last_apic_package_id = apic_package_id;
+			} else {
+				/* another logical processor on the same package */
+				packages[package_index].processor_count++;
+				if (new_cluster) {
+					packages[package_index].cluster_count++;
+				}
+			}
+
+			if (new_cluster) {
+				/* new cluster: all its cores are of the same type, and report maximum frequency of the first one */
+				const uint64_t frequency =
+					(uint64_t) cpuinfo_linux_get_processor_max_frequency(x86_linux_processors[i].linux_id) * UINT64_C(1000);
+				clusters[cluster_index] = (struct cpuinfo_cluster) {
+					.processor_start = processor_index,
+					.processor_count = 0,
+					.core_start = core_index,
+					.core_count = 0,
+					.cluster_id = cluster_index - packages[package_index].cluster_start,
+					.package = packages + package_index,
+					.vendor = core_type->vendor,
+					.uarch = core_type->uarch,
+					.cpuid = core_type->cpuid,
+					.frequency = frequency,
+				};
+				cluster_isa[cluster_index] = core_types_isa[core_type - core_types];
+				last_core_type = core_type->core_type;
+			}
+			clusters[cluster_index].processor_count++;
+
 			if (apid_core_id != last_apic_core_id) {
 				/* new core */
 				cores[core_index] = (struct cpuinfo_core) {
 					.processor_start = processor_index,
 					.processor_count = 1,
 					.core_id = core_id,
-					.cluster = clusters + package_index,
+					.cluster = clusters + cluster_index,
 					.package = packages + package_index,
-					.vendor = x86_processor.vendor,
-					.uarch = x86_processor.uarch,
-					.cpuid = x86_processor.cpuid,
+					.vendor = core_type->vendor,
+					.uarch = core_type->uarch,
+					.cpuid = core_type->cpuid,
+					.frequency = clusters[cluster_index].frequency,
 				};
-				clusters[package_index].core_count += 1;
+				clusters[cluster_index].core_count += 1;
 				packages[package_index].core_count += 1;
 				last_apic_core_id = apid_core_id;
 			} else {
@@ -348,45 +452,22 @@ void cpuinfo_x86_linux_init(void) {
 				cores[core_index].processor_count++;
 			}
 
-			if (apic_package_id != last_apic_package_id) {
-				/* new cluster/package */
-
-				clusters[package_index].processor_start = processor_index;
-				clusters[package_index].processor_count = 1;
-				clusters[package_index].core_start = core_index;
-				clusters[package_index].package = packages + package_index;
-				clusters[package_index].vendor = x86_processor.vendor;
-				clusters[package_index].uarch = x86_processor.uarch;
-				clusters[package_index].cpuid = x86_processor.cpuid;
-				packages[package_index].processor_start = processor_index;
-				packages[package_index].processor_count = 1;
-				packages[package_index].core_start = core_index;
-				packages[package_index].cluster_start = package_index;
-				packages[package_index].cluster_count = 1;
-				cpuinfo_x86_format_package_name(x86_processor.vendor, brand_string, packages[package_index].name);
-				last_apic_package_id = apic_package_id;
-			} else {
-				/* another logical processor on the same cluster/package */
-				clusters[package_index].processor_count++;
-				packages[package_index].processor_count++;
-			}
-
 			linux_cpu_to_processor_map[x86_linux_processors[i].linux_id] = processors + processor_index;
 			linux_cpu_to_core_map[x86_linux_processors[i].linux_id] = cores + core_index;
 
-			if (x86_processor.cache.l1i.size != 0) {
-				const uint32_t l1i_id = apic_id & ~bit_mask(x86_processor.cache.l1i.apic_bits);
+			if (core_type->cache.l1i.size != 0) {
+				const uint32_t l1i_id = apic_id & ~bit_mask(core_type->cache.l1i.apic_bits);
 				processors[i].cache.l1i = &l1i[l1i_index];
 				if (l1i_id != last_l1i_id) {
 					/* new cache */
 					last_l1i_id = l1i_id;
 					l1i[++l1i_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l1i.size,
-						.associativity   = x86_processor.cache.l1i.associativity,
-						.sets            = x86_processor.cache.l1i.sets,
-						.partitions      = x86_processor.cache.l1i.partitions,
-						.line_size       = x86_processor.cache.l1i.line_size,
-						.flags           = x86_processor.cache.l1i.flags,
+						.size            = core_type->cache.l1i.size,
+						.associativity   = core_type->cache.l1i.associativity,
+						.sets            = core_type->cache.l1i.sets,
+						.partitions      = core_type->cache.l1i.partitions,
+						.line_size       = core_type->cache.l1i.line_size,
+						.flags           = core_type->cache.l1i.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -399,19 +480,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l1i_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l1d.size != 0) {
-				const uint32_t l1d_id = apic_id & ~bit_mask(x86_processor.cache.l1d.apic_bits);
+			if (core_type->cache.l1d.size != 0) {
+				const uint32_t l1d_id = apic_id & ~bit_mask(core_type->cache.l1d.apic_bits);
 				processors[i].cache.l1d = &l1d[l1d_index];
 				if (l1d_id != last_l1d_id) {
 					/* new cache */
 					last_l1d_id = l1d_id;
 					l1d[++l1d_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l1d.size,
-						.associativity   = x86_processor.cache.l1d.associativity,
-						.sets            = x86_processor.cache.l1d.sets,
-						.partitions      = x86_processor.cache.l1d.partitions,
-						.line_size       = x86_processor.cache.l1d.line_size,
-						.flags           = x86_processor.cache.l1d.flags,
+						.size            = core_type->cache.l1d.size,
+						.associativity   = core_type->cache.l1d.associativity,
+						.sets            = core_type->cache.l1d.sets,
+						.partitions      = core_type->cache.l1d.partitions,
+						.line_size       = core_type->cache.l1d.line_size,
+						.flags           = core_type->cache.l1d.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -424,19 +505,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l1d_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l2.size != 0) {
-				const uint32_t l2_id = apic_id & ~bit_mask(x86_processor.cache.l2.apic_bits);
+			if (core_type->cache.l2.size != 0) {
+				const uint32_t l2_id = apic_id & ~bit_mask(core_type->cache.l2.apic_bits);
 				processors[i].cache.l2 = &l2[l2_index];
 				if (l2_id != last_l2_id) {
 					/* new cache */
 					last_l2_id = l2_id;
 					l2[++l2_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l2.size,
-						.associativity   = x86_processor.cache.l2.associativity,
-						.sets            = x86_processor.cache.l2.sets,
-						.partitions      = x86_processor.cache.l2.partitions,
-						.line_size       = x86_processor.cache.l2.line_size,
-						.flags           = x86_processor.cache.l2.flags,
+						.size            = core_type->cache.l2.size,
+						.associativity   = core_type->cache.l2.associativity,
+						.sets            = core_type->cache.l2.sets,
+						.partitions      = core_type->cache.l2.partitions,
+						.line_size       = core_type->cache.l2.line_size,
+						.flags           = core_type->cache.l2.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -449,19 +530,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l2_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l3.size != 0) {
-				const uint32_t l3_id = apic_id & ~bit_mask(x86_processor.cache.l3.apic_bits);
+			if (core_type->cache.l3.size != 0) {
+				const uint32_t l3_id = apic_id & ~bit_mask(core_type->cache.l3.apic_bits);
 				processors[i].cache.l3 = &l3[l3_index];
 				if (l3_id != last_l3_id) {
 					/* new cache */
 					last_l3_id = l3_id;
 					l3[++l3_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l3.size,
-						.associativity   = x86_processor.cache.l3.associativity,
-						.sets            = x86_processor.cache.l3.sets,
-						.partitions      = x86_processor.cache.l3.partitions,
-						.line_size       = x86_processor.cache.l3.line_size,
-						.flags           = x86_processor.cache.l3.flags,
+						.size            = core_type->cache.l3.size,
+						.associativity   = core_type->cache.l3.associativity,
+						.sets            = core_type->cache.l3.sets,
+						.partitions      = core_type->cache.l3.partitions,
+						.line_size       = core_type->cache.l3.line_size,
+						.flags           = core_type->cache.l3.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -474,19 +555,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l3_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l4.size != 0) {
-				const uint32_t l4_id = apic_id & ~bit_mask(x86_processor.cache.l4.apic_bits);
+			if (core_type->cache.l4.size != 0) {
+				const uint32_t l4_id = apic_id & ~bit_mask(core_type->cache.l4.apic_bits);
 				processors[i].cache.l4 = &l4[l4_index];
 				if (l4_id != last_l4_id) {
 					/* new cache */
 					last_l4_id = l4_id;
 					l4[++l4_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l4.size,
-						.associativity   = x86_processor.cache.l4.associativity,
-						.sets            = x86_processor.cache.l4.sets,
-						.partitions      = x86_processor.cache.l4.partitions,
-						.line_size       = x86_processor.cache.l4.line_size,
-						.flags           = x86_processor.cache.l4.flags,
+						.size            = core_type->cache.l4.size,
+						.associativity   = core_type->cache.l4.associativity,
+						.sets            = core_type->cache.l4.sets,
+						.partitions      = core_type->cache.l4.partitions,
+						.line_size       = core_type->cache.l4.line_size,
+						.flags           = core_type->cache.l4.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -513,6 +594,7 @@ void cpuinfo_x86_linux_init(void) {
 	/* Commit changes */
 	cpuinfo_linux_cpu_to_processor_map = linux_cpu_to_processor_map;
 	cpuinfo_linux_cpu_to_core_map = linux_cpu_to_core_map;
+	cpuinfo_linux_cpu_max = x86_linux_processors_count;
 
 	cpuinfo_processors = processors;
 	cpuinfo_cores = cores;
@@ -523,10 +605,11 @@ void cpuinfo_x86_linux_init(void) {
 	cpuinfo_cache[cpuinfo_cache_level_2]  = l2;
 	cpuinfo_cache[cpuinfo_cache_level_3]  = l3;
 	cpuinfo_cache[cpuinfo_cache_level_4]  = l4;
+	cpuinfo_cluster_isa = cluster_isa;
 
 	cpuinfo_processors_count = processors_count;
 	cpuinfo_cores_count = cores_count;
-	cpuinfo_clusters_count = packages_count;
+	cpuinfo_clusters_count = clusters_count;
 	cpuinfo_packages_count = packages_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_1i] = l1i_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_1d] = l1d_count;
@@ -541,6 +624,7 @@ void cpuinfo_x86_linux_init(void) {
 	clusters = NULL;
 	packages = NULL;
 	l1i = l1d = l2 = l3 = l4 = NULL;
+	cluster_isa = NULL;
 
 cleanup:
 	free(linux_cpu_to_processor_map);
@@ -555,4 +639,5 @@ cleanup:
 	free(l2);
 	free(l3);
 	free(l4);
+	free(cluster_isa);
 }
@@ -1,6 +1,8 @@
 #include <stdbool.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include <stddef.h>
 #include <string.h>
 #include <errno.h>
@@ -24,12 +26,45 @@
 static struct cpuinfo_mock_cpuid* cpuinfo_mock_cpuid_data = NULL;
 static uint32_t cpuinfo_mock_cpuid_entries = 0;
 static uint32_t cpuinfo_mock_cpuid_leaf4_iteration = 0;
+static uint64_t cpuinfo_mock_xcr0 = 0;
+
+static struct cpuinfo_mock_cpuid_dump cpuinfo_mock_default_cpuid = { NULL, 0 };
+static struct cpuinfo_mock_cpuid_dump* cpuinfo_mock_processor_cpuid = NULL;
+static uint32_t cpuinfo_mock_processor_cpuid_count = 0;
 
 void CPUINFO_ABI cpuinfo_mock_set_cpuid(struct cpuinfo_mock_cpuid* dump, size_t entries) {
 	cpuinfo_mock_cpuid_data = dump;
 	cpuinfo_mock_cpuid_entries = entries;	
+	cpuinfo_mock_default_cpuid = (struct cpuinfo_mock_cpuid_dump) { dump, (uint32_t) entries };
 };
 
+void CPUINFO_ABI cpuinfo_mock_set_processor_cpuid(uint32_t processor, struct cpuinfo_mock_cpuid* dump, size_t entries) {
+	if (processor >= cpuinfo_mock_processor_cpuid_count) {
+		struct cpuinfo_mock_cpuid_dump* processor_cpuid =
+			realloc(cpuinfo_mock_processor_cpuid, (processor + 1) * sizeof(struct cpuinfo_mock_cpuid_dump));
+		if (processor_cpuid == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for CPUID dumps of %"PRIu32" processors",
+				(processor + 1) * sizeof(struct cpuinfo_mock_cpuid_dump), processor + 1);
+			return;
+		}
+		memset(processor_cpuid + cpuinfo_mock_processor_cpuid_count, 0,
+			(processor + 1 - cpuinfo_mock_processor_cpuid_count) * sizeof(struct cpuinfo_mock_cpuid_dump));
+		cpuinfo_mock_processor_cpuid = processor_cpuid;
+		cpuinfo_mock_processor_cpuid_count = processor + 1;
+	}
+	cpuinfo_mock_processor_cpuid[processor] = (struct cpuinfo_mock_cpuid_dump) { dump, (uint32_t) entries };
+}
+
+void CPUINFO_ABI cpuinfo_mock_select_processor_cpuid(uint32_t processor) {
+	struct cpuinfo_mock_cpuid_dump dump = cpuinfo_mock_default_cpuid;
+	if (processor < cpuinfo_mock_processor_cpuid_count && cpuinfo_mock_processor_cpuid[processor].data != NULL) {
+		dump = cpuinfo_mock_processor_cpuid[processor];
+	}
+	cpuinfo_mock_cpuid_data = dump.data;
+	cpuinfo_mock_cpuid_entries = dump.entries;
+	cpuinfo_mock_cpuid_leaf4_iteration = 0;
+}
+
 void CPUINFO_ABI cpuinfo_mock_get_cpuid(uint32_t eax, uint32_t regs[restrict static 4]) {
 	if (eax != 4) {
 		cpuinfo_mock_cpuid_leaf4_iteration = 0;
@@ -81,3 +116,155 @@ void CPUINFO_ABI cpuinfo_mock_get_cpuidex(uint32_t eax, uint32_t ecx, uint32_t r
 	}
 	regs[0] = regs[1] = regs[2] = regs[3] = 0;
 }
+
+void CPUINFO_ABI cpuinfo_mock_set_xcr0(uint64_t xcr0) {
+	cpuinfo_mock_xcr0 = xcr0;
+}
+
+uint64_t CPUINFO_ABI cpuinfo_mock_xgetbv(uint32_t ext_ctrl_reg) {
+	/* Only XCR0 (XFEATURE_ENABLED_MASK) is mocked */
+	return ext_ctrl_reg == 0 ? cpuinfo_mock_xcr0 : 0;
+}
+
+void CPUINFO_ABI cpuinfo_mock_set_cpuid_dumps(struct cpuinfo_mock_cpuid_dump* dumps, uint32_t processors_count) {
+	bool default_dump = false;
+	for (uint32_t i = 0; i < processors_count; i++) {
+		if (dumps[i].data != NULL) {
+			if (!default_dump) {
+				cpuinfo_mock_set_cpuid(dumps[i].data, dumps[i].entries);
+				default_dump = true;
+			}
+			cpuinfo_mock_set_processor_cpuid(i, dumps[i].data, dumps[i].entries);
+		}
+	}
+}
+
+void CPUINFO_ABI cpuinfo_mock_free_cpuid_dumps(struct cpuinfo_mock_cpuid_dump* dumps, uint32_t processors_count) {
+	if (dumps != NULL) {
+		for (uint32_t i = 0; i < processors_count; i++) {
+			free(dumps[i].data);
+		}
+		free(dumps);
+	}
+}
+
+/* Dumps of all logical processors parsed from a log, with allocated capacity of every dump */
+struct cpuid_log {
+	struct cpuinfo_mock_cpuid_dump* dumps;
+	uint32_t* capacities;
+	uint32_t processors_count;
+};
+
+static bool select_log_processor(struct cpuid_log log[restrict static 1], uint32_t processor) {
+	if (processor >= log->processors_count) {
+		struct cpuinfo_mock_cpuid_dump* dumps =
+			realloc(log->dumps, (processor + 1) * sizeof(struct cpuinfo_mock_cpuid_dump));
+		if (dumps != NULL) {
+			log->dumps = dumps;
+		}
+		uint32_t* capacities = realloc(log->capacities, (processor + 1) * sizeof(uint32_t));
+		if (capacities != NULL) {
+			log->capacities = capacities;
+		}
+		if (dumps == NULL || capacities == NULL) {
+			cpuinfo_log_error("failed to allocate CPUID dumps of %"PRIu32" processors", processor + 1);
+			return false;
+		}
+		memset(log->dumps + log->processors_count, 0,
+			(processor + 1 - log->processors_count) * sizeof(struct cpuinfo_mock_cpuid_dump));
+		memset(log->capacities + log->processors_count, 0,
+			(processor + 1 - log->processors_count) * sizeof(uint32_t));
+		log->processors_count = processor + 1;
+	}
+	return true;
+}
+
+static bool append_log_entry(struct cpuid_log log[restrict static 1], uint32_t processor, struct cpuinfo_mock_cpuid entry) {
+	struct cpuinfo_mock_cpuid_dump* dump = &log->dumps[processor];
+	if (dump->entries == log->capacities[processor]) {
+		const uint32_t capacity = dump->entries == 0 ? 64 : dump->entries * 2;
+		struct cpuinfo_mock_cpuid* data = realloc(dump->data, capacity * sizeof(struct cpuinfo_mock_cpuid));
+		if (data == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for CPUID dump of processor %"PRIu32,
+				capacity * sizeof(struct cpuinfo_mock_cpuid), processor);
+			return false;
+		}
+		dump->data = data;
+		log->capacities[processor] = capacity;
+	}
+	dump->data[dump->entries++] = entry;
+	return true;
+}
+
+/* Parses a line "CPUID 00000004: 1C000121-0140003F-0000003F-00000001 [SL 00]" of tools/cpuid-dump output */
+static bool parse_log_entry(const char* line, struct cpuinfo_mock_cpuid entry[restrict static 1]) {
+	uint32_t input_eax, eax, ebx, ecx, edx;
+	int length = 0;
+	if (sscanf(line, "CPUID %8"SCNx32": %8"SCNx32"-%8"SCNx32"-%8"SCNx32"-%8"SCNx32"%n",
+		&input_eax, &eax, &ebx, &ecx, &edx, &length) != 5 || length == 0)
+	{
+		return false;
+	}
+
+	/* Vendor and brand string annotations are also bracketed, but never in the form [SL <hex>] */
+	uint32_t input_ecx = 0, subleaf = 0;
+	int subleaf_length = 0;
+	if (sscanf(line + length, " [SL %"SCNx32"]%n", &subleaf, &subleaf_length) == 1 && subleaf_length != 0) {
+		input_ecx = subleaf;
+	}
+	*entry = (struct cpuinfo_mock_cpuid) {
+		.input_eax = input_eax,
+		.input_ecx = input_ecx,
+		.eax = eax,
+		.ebx = ebx,
+		.ecx = ecx,
+		.edx = edx,
+	};
+	return true;
+}
+
+struct cpuinfo_mock_cpuid_dump* CPUINFO_ABI cpuinfo_mock_cpuid_from_log(const char* filename, uint32_t* processors_count) {
+	*processors_count = 0;
+	FILE* file = fopen(filename, "r");
+	if (file == NULL) {
+		cpuinfo_log_error("failed to open CPUID dump %s: %s", filename, strerror(errno));
+		return NULL;
+	}
+
+	bool status = true;
+	struct cpuid_log log = { 0 };
+	uint32_t processor = 0;
+	char line[256];
+	while (status && fgets(line, sizeof(line), file) != NULL) {
+		const size_t line_length = strlen(line);
+		if (line_length != 0 && line[line_length - 1] != '\n' && !feof(file)) {
+			/* Skip the rest of a line longer than any line of tools/cpuid-dump output */
+			int c;
+			do {
+				c = fgetc(file);
+			} while (c != '\n' && c != EOF);
+		}
+
+		struct cpuinfo_mock_cpuid entry;
+		uint32_t next_processor;
+		int length = 0;
+		if (sscanf(line, "CPU %"SCNu32":%n", &next_processor, &length) == 1 && length != 0) {
+			processor = next_processor;
+		} else if (parse_log_entry(line, &entry)) {
+			status = select_log_processor(&log, processor) && append_log_entry(&log, processor, entry);
+		}
+	}
+	fclose(file);
+	free(log.capacities);
+
+	if (status && log.processors_count == 0) {
+		cpuinfo_log_error("failed to parse CPUID dump %s: no CPUID entries found", filename);
+		status = false;
+	}
+	if (!status) {
+		cpuinfo_mock_free_cpuid_dumps(log.dumps, log.processors_count);
+		return NULL;
+	}
+	*processors_count = log.processors_count;
+	return log.dumps;
+}
@@ -53,7 +53,9 @@ void cpuinfo_x86_detect_topology(
 		do {
 			const struct cpuid_regs leafB = cpuidex(UINT32_C(0xB), level);
 			type = (leafB.ecx >> 8) & UINT32_C(0x000000FF);
-			const uint32_t level_shift = leafB.eax & UINT32_C(0x0000001F);
+			/* Shift of the next level ID is cumulative: it includes bits of all lower levels */
+			const uint32_t next_level_shift = leafB.eax & UINT32_C(0x0000001F);
+			const uint32_t level_shift = next_level_shift > total_shift ? next_level_shift - total_shift : 0;
 			const uint32_t x2apic_id   = leafB.edx;
 			// const uint32_t logical_processors = leafB.ebx & UINT32_C(0x0000FFFF);
 			apic_id = x2apic_id;
@@ -81,6 +81,18 @@ enum cpuinfo_uarch cpuinfo_x86_decode_uarch(
 						case 0x8E: // Kaby Lake U/Y
 						case 0x9E: // Kaby Lake H/S
 							return cpuinfo_uarch_kaby_lake;
+						case 0x6A: // Ice Lake-SP
+						case 0x6C: // Ice Lake-D
+						case 0x7D: // Ice Lake-Y
+						case 0x7E: // Ice Lake-U
+							return cpuinfo_uarch_sunny_cove;
+						case 0x8F: // Sapphire Rapids
+						case 0x97: // Alder Lake-S
+						case 0x9A: // Alder Lake-P
+						case 0xB7: // Raptor Lake-S
+						case 0xBA: // Raptor Lake-P
+						case 0xBF: // Raptor Lake-S
+							return cpuinfo_uarch_golden_cove;
 
 						/* Low-power cores */
 						case 0x1C: // Diamondville, Silverthorne, Pineview
@@ -195,3 +207,20 @@ enum cpuinfo_uarch cpuinfo_x86_decode_uarch(
 	}
 	return cpuinfo_uarch_unknown;
 }
+
+enum cpuinfo_uarch cpuinfo_x86_decode_hybrid_uarch(enum cpuinfo_uarch uarch, uint32_t core_type) {
+	/* Cores of hybrid processors report the same family and model, but differ in core type */
+	switch (core_type) {
+		case CPUINFO_X86_CORE_TYPE_ATOM:
+			switch (uarch) {
+				case cpuinfo_uarch_golden_cove: // Alder Lake, Raptor Lake
+					return cpuinfo_uarch_gracemont;
+				default:
+					break;
+			}
+			break;
+		default:
+			break;
+	}
+	return uarch;
+}
@@ -0,0 +1,96 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cpuinfo.h>
+#include <x86/cpuid.h>
+#include <x86/api.h>
+#include <api.h>
+#include <log.h>
+
+
+/* Legacy region (x87 and SSE state) and XSAVE header precede extended state components in the XSAVE area */
+#define XSAVE_LEGACY_REGION_SIZE 512
+#define XSAVE_HEADER_SIZE 64
+
+struct cpuinfo_x86_xsave cpuinfo_x86_xsave = { 0 };
+
+void cpuinfo_x86_detect_xsave(
+	const struct cpuid_regs basic_info,
+	uint32_t max_base_index,
+	struct cpuinfo_x86_xsave xsave[restrict static 1])
+{
+	memset(xsave, 0, sizeof(struct cpuinfo_x86_xsave));
+
+	/*
+	 * OSXSAVE: Operating system enabled XSAVE instructions for application use:
+	 * - Intel, AMD: ecx[bit 26] in basic info = XSAVE/XRSTOR instructions supported by a chip.
+	 * - Intel, AMD: ecx[bit 27] in basic info = XSAVE/XRSTOR instructions enabled by OS.
+	 */
+	const uint32_t osxsave_mask = UINT32_C(0x0C000000);
+	if ((basic_info.ecx & osxsave_mask) != osxsave_mask || max_base_index < UINT32_C(0xD)) {
+		return;
+	}
+
+	#ifndef __native_client__
+		xsave->enabled_components = xgetbv(0);
+	#endif
+
+	/*
+	 * Main leaf of processor extended state enumeration:
+	 * - Intel, AMD: edx:eax in sub-leaf 0 = user state components supported in XCR0.
+	 * - Intel, AMD: ebx in sub-leaf 0 = size of XSAVE area for components currently enabled in XCR0.
+	 * - Intel, AMD: ecx in sub-leaf 0 = size of XSAVE area for all supported components.
+	 */
+	const struct cpuid_regs xsave_info = cpuidex(UINT32_C(0xD), 0);
+	xsave->supported_components = ((uint64_t) xsave_info.edx << 32) | (uint64_t) xsave_info.eax;
+	xsave->size = xsave_info.ebx;
+	xsave->max_size = xsave_info.ecx;
+
+	/* x87 and SSE state components are stored in the legacy region at fixed offsets */
+	xsave->components[0] = (struct cpuinfo_x86_xsave_component) { .size = 160, .offset = 0 };
+	xsave->components[1] = (struct cpuinfo_x86_xsave_component) { .size = 256, .offset = 160 };
+
+	/*
+	 * Sub-leaves 2-31 describe extended state components:
+	 * - Intel, AMD: eax = size of the component.
+	 * - Intel, AMD: ebx = offset of the component in the standard format of the XSAVE area.
+	 * - Intel: ecx[bit 1] = component is aligned on a 64-byte boundary in the compacted format.
+	 * Components in the compacted format are stored in the order of their indices, after the legacy region and header.
+	 */
+	uint32_t compacted_size = XSAVE_LEGACY_REGION_SIZE + XSAVE_HEADER_SIZE;
+	for (uint32_t i = 2; i < CPUINFO_X86_XSAVE_COMPONENTS_MAX; i++) {
+		if (!(xsave->supported_components & (UINT64_C(1) << i))) {
+			continue;
+		}
+
+		const struct cpuid_regs component_info = cpuidex(UINT32_C(0xD), i);
+		struct cpuinfo_x86_xsave_component* component = &xsave->components[i];
+		component->size = component_info.eax;
+		component->offset = component_info.ebx;
+		component->aligned = !!(component_info.ecx & UINT32_C(0x00000002));
+		cpuinfo_log_debug("XSAVE component %"PRIu32": size %"PRIu32", offset %"PRIu32"%s",
+			i, component->size, component->offset, component->aligned ? ", 64-byte aligned" : "");
+
+		if (xsave->enabled_components & (UINT64_C(1) << i)) {
+			if (component->aligned) {
+				compacted_size = (compacted_size + 63) & ~UINT32_C(63);
+			}
+			compacted_size += component->size;
+		}
+	}
+	xsave->compacted_size = compacted_size;
+	cpuinfo_log_debug("XSAVE: XCR0 0x%016"PRIx64", area size %"PRIu32" (max %"PRIu32", compacted %"PRIu32")",
+		xsave->enabled_components, xsave->size, xsave->max_size, xsave->compacted_size);
+}
+
+const struct cpuinfo_x86_xsave* CPUINFO_ABI cpuinfo_get_x86_xsave(void) {
+	if (cpuinfo_processors == NULL) {
+		cpuinfo_log_warning("cpuinfo_get_x86_xsave called before cpuinfo_initialize");
+		return NULL;
+	}
+	if (cpuinfo_x86_xsave.enabled_components == 0) {
+		return NULL;
+	}
+	return &cpuinfo_x86_xsave;
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.hpp>
+
+
+/*
+ * Built with AVX2 and FMA3 in the instruction set baseline on x86-64. Dispatch over these features must fold to a
+ * direct call without cpuinfo_initialize().
+ */
+
+struct avx2_impl {
+	typedef cpuinfo::requirements<cpuinfo::isa::x86_avx2, cpuinfo::isa::x86_fma3> requirements;
+	static int run(int x) { return x + 2; }
+};
+
+struct sse2_impl {
+	typedef cpuinfo::requirements<cpuinfo::isa::x86_sse2> requirements;
+	static int run(int x) { return x + 1; }
+};
+
+static_assert(cpuinfo::isa::x86_avx::baseline, "AVX must be a part of the -mavx2 baseline");
+static_assert(cpuinfo::isa::x86_avx2::baseline, "AVX2 must be a part of the -mavx2 baseline");
+static_assert(cpuinfo::isa::x86_fma3::baseline, "FMA3 must be a part of the -mfma baseline");
+static_assert(!cpuinfo::isa::x86_avx512f::baseline, "AVX-512 must not be a part of the -mavx2 baseline");
+static_assert(avx2_impl::requirements::baseline, "AVX2 implementation must be statically selected");
+
+TEST(BASELINE, folded) {
+	ASSERT_FALSE(cpuinfo_isa.avx2);
+	EXPECT_TRUE(cpuinfo_has_x86_avx2());
+	EXPECT_TRUE(cpuinfo::isa::x86_avx2::available());
+	EXPECT_FALSE(cpuinfo_has_x86_avx512f());
+}
+
+TEST(DISPATCH, folded) {
+	EXPECT_EQ(12, (cpuinfo::dispatch<avx2_impl, sse2_impl>::run(10)));
+	int (*function)(int) = cpuinfo::dispatch<avx2_impl, sse2_impl>::resolve<int(int)>();
+	EXPECT_EQ(&avx2_impl::run, function);
+}
+
+int main(int argc, char* argv[]) {
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
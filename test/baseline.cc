@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+
+
+/*
+ * Built with an instruction set baseline: SSE4.2 and POPCNT on x86-64, ARMv8.1-A on ARM64. Tests run in order, and
+ * the first ones run before cpuinfo_initialize().
+ */
+
+#if CPUINFO_ARCH_X86_64
+TEST(BASELINE, detected) {
+	EXPECT_EQ(1, CPUINFO_BASELINE_X86_SSE3);
+	EXPECT_EQ(1, CPUINFO_BASELINE_X86_SSSE3);
+	EXPECT_EQ(1, CPUINFO_BASELINE_X86_SSE4_1);
+	EXPECT_EQ(1, CPUINFO_BASELINE_X86_SSE4_2);
+	EXPECT_EQ(1, CPUINFO_BASELINE_X86_POPCNT);
+	EXPECT_EQ(0, CPUINFO_BASELINE_X86_BMI2);
+	EXPECT_EQ(0, CPUINFO_BASELINE_X86_SHA);
+	EXPECT_EQ(0, CPUINFO_BASELINE_X86_AVX);
+	EXPECT_EQ(0, CPUINFO_BASELINE_X86_AVX2);
+	EXPECT_EQ(0, CPUINFO_BASELINE_X86_AVX512F);
+}
+
+TEST(BASELINE, folded) {
+	ASSERT_FALSE(cpuinfo_isa.sse4_2);
+	EXPECT_TRUE(cpuinfo_has_x86_sse3());
+	EXPECT_TRUE(cpuinfo_has_x86_ssse3());
+	EXPECT_TRUE(cpuinfo_has_x86_sse4_1());
+	EXPECT_TRUE(cpuinfo_has_x86_sse4_2());
+	EXPECT_TRUE(cpuinfo_has_x86_popcnt());
+	EXPECT_FALSE(cpuinfo_has_x86_bmi2());
+}
+#elif CPUINFO_ARCH_ARM64
+TEST(BASELINE, detected) {
+	EXPECT_EQ(1, CPUINFO_BASELINE_ARM_ATOMICS);
+	EXPECT_EQ(1, CPUINFO_BASELINE_ARM_NEON_RDM);
+	EXPECT_EQ(1, CPUINFO_BASELINE_ARM_CRC32);
+	EXPECT_EQ(0, CPUINFO_BASELINE_ARM_JSCVT);
+	EXPECT_EQ(0, CPUINFO_BASELINE_ARM_I8MM);
+	EXPECT_EQ(0, CPUINFO_BASELINE_ARM_SVE);
+}
+
+TEST(BASELINE, folded) {
+	ASSERT_FALSE(cpuinfo_isa.atomics);
+	EXPECT_TRUE(cpuinfo_has_arm_atomics());
+	EXPECT_TRUE(cpuinfo_has_arm_neon_rdm());
+	EXPECT_TRUE(cpuinfo_has_arm_crc32());
+	EXPECT_FALSE(cpuinfo_has_arm_jscvt());
+}
+#endif
+
+TEST(BASELINE, check) {
+	EXPECT_FALSE(cpuinfo_check_baseline());
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_TRUE(cpuinfo_check_baseline());
+}
+
+int main(int argc, char* argv[]) {
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+
+
+TEST(PROCESSOR_LATENCY, measure) {
+	ASSERT_TRUE(cpuinfo_measure_processor_latencies());
+}
+
+TEST(PROCESSOR_LATENCY, zero_diagonal) {
+	ASSERT_TRUE(cpuinfo_measure_processor_latencies());
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		EXPECT_EQ(0, cpuinfo_get_processor_latency(processor, processor));
+	}
+}
+
+TEST(PROCESSOR_LATENCY, non_zero) {
+	ASSERT_TRUE(cpuinfo_measure_processor_latencies());
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		for (uint32_t j = 0; j < cpuinfo_get_processors_count(); j++) {
+			if (i != j) {
+				EXPECT_NE(0, cpuinfo_get_processor_latency(cpuinfo_get_processor(i), cpuinfo_get_processor(j)));
+			}
+		}
+	}
+}
+
+TEST(PROCESSOR_LATENCY, symmetric) {
+	ASSERT_TRUE(cpuinfo_measure_processor_latencies());
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		for (uint32_t j = 0; j < i; j++) {
+			const cpuinfo_processor* first = cpuinfo_get_processor(i);
+			const cpuinfo_processor* second = cpuinfo_get_processor(j);
+			EXPECT_EQ(cpuinfo_get_processor_latency(first, second), cpuinfo_get_processor_latency(second, first));
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,42 @@
+#include <string.h>
+
+#include <x86/api.h>
+
+#include <decode-interface.h>
+
+
+static struct cpuinfo_x86_decoded_cache decoded_cache(struct cpuinfo_x86_cache cache) {
+	return (struct cpuinfo_x86_decoded_cache) {
+		.size = cache.size,
+		.associativity = cache.associativity,
+		.line_size = cache.line_size,
+	};
+}
+
+void cpuinfo_x86_decode_cpuid_dump(
+	struct cpuinfo_mock_cpuid* dump, uint32_t entries,
+	struct cpuinfo_x86_decoded_cpuid* decoded)
+{
+	cpuinfo_mock_set_cpuid(dump, entries);
+
+	struct cpuinfo_x86_processor processor;
+	memset(&processor, 0, sizeof(processor));
+	cpuinfo_x86_init_processor(&processor);
+
+	char brand_string[48];
+	cpuinfo_x86_normalize_brand_string(processor.brand_string, brand_string);
+
+	memset(decoded, 0, sizeof(struct cpuinfo_x86_decoded_cpuid));
+	decoded->vendor = processor.vendor;
+	decoded->uarch = processor.uarch;
+	decoded->cpuid = processor.cpuid;
+	decoded->core_type = processor.core_type;
+	cpuinfo_x86_format_package_name(processor.vendor, brand_string, decoded->package_name);
+	decoded->l1i = decoded_cache(processor.cache.l1i);
+	decoded->l1d = decoded_cache(processor.cache.l1d);
+	decoded->l2 = decoded_cache(processor.cache.l2);
+	decoded->l3 = decoded_cache(processor.cache.l3);
+	decoded->thread_bits_length = processor.topology.thread_bits_length;
+	decoded->core_bits_length = processor.topology.core_bits_length;
+	decoded->isa = cpuinfo_isa;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct cpuinfo_x86_decoded_cache {
+	uint32_t size;
+	uint32_t associativity;
+	uint32_t line_size;
+};
+
+/* Properties of a logical processor which cpuinfo decodes from CPUID values only */
+struct cpuinfo_x86_decoded_cpuid {
+	enum cpuinfo_vendor vendor;
+	enum cpuinfo_uarch uarch;
+	uint32_t cpuid;
+	uint32_t core_type;
+	char package_name[CPUINFO_PACKAGE_NAME_MAX];
+	struct cpuinfo_x86_decoded_cache l1i;
+	struct cpuinfo_x86_decoded_cache l1d;
+	struct cpuinfo_x86_decoded_cache l2;
+	struct cpuinfo_x86_decoded_cache l3;
+	uint32_t thread_bits_length;
+	uint32_t core_bits_length;
+	struct cpuinfo_x86_isa isa;
+};
+
+/* Decodes the CPUID dump of a logical processor as cpuinfo_initialize would on the processor */
+void cpuinfo_x86_decode_cpuid_dump(
+	struct cpuinfo_mock_cpuid* dump, uint32_t entries,
+	struct cpuinfo_x86_decoded_cpuid* decoded);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+#include <decode-interface.h>
+
+
+/*
+ * Decodes every CPUID dump in the corpus, loaded at run-time, as cpuinfo_initialize would on the dumped processor.
+ * Dumps are tools/cpuid-dump logs in CPUINFO_CPUID_DUMPS_DIR and archives of x86 systems in CPUINFO_MOCK_DUMPS_DIR
+ * (both in the environment or at compile-time). Decoding needs only the CPUID values, so unlike initialization it
+ * runs in this process for every dump.
+ */
+
+static std::string dumps_directory(const char* variable, const char* default_directory) {
+	const char* directory = getenv(variable);
+	return directory != nullptr ? directory : default_directory;
+}
+
+static std::string cpuid_dumps_directory() {
+#ifdef CPUINFO_CPUID_DUMPS_DIR
+	return dumps_directory("CPUINFO_CPUID_DUMPS_DIR", CPUINFO_CPUID_DUMPS_DIR);
+#else
+	return dumps_directory("CPUINFO_CPUID_DUMPS_DIR", "test/cpuid");
+#endif
+}
+
+static std::string mock_dumps_directory() {
+#ifdef CPUINFO_MOCK_DUMPS_DIR
+	return dumps_directory("CPUINFO_MOCK_DUMPS_DIR", CPUINFO_MOCK_DUMPS_DIR);
+#else
+	return dumps_directory("CPUINFO_MOCK_DUMPS_DIR", "test/mock");
+#endif
+}
+
+static bool has_suffix(const std::string& name, const std::string& suffix) {
+	return name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static bool read_text(const std::string& path, std::string& text) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	text = stream.str();
+	return true;
+}
+
+static void list_directory(const std::string& directory_path, const std::string& suffix, std::vector<std::string>& dumps) {
+	DIR* directory = opendir(directory_path.c_str());
+	if (directory == nullptr) {
+		return;
+	}
+	while (const struct dirent* entry = readdir(directory)) {
+		const std::string name = entry->d_name;
+		if (!has_suffix(name, suffix)) {
+			continue;
+		}
+		const std::string path = directory_path + "/" + name;
+		std::string text;
+		if (suffix == ".h" &&
+			(!read_text(path, text) || text.find("struct cpuinfo_mock_cpuid cpuid_dump[]") == std::string::npos))
+		{
+			continue;
+		}
+		dumps.push_back(path);
+	}
+	closedir(directory);
+}
+
+/* Lists paths of tools/cpuid-dump logs and of archives of x86 systems */
+static std::vector<std::string> list_dumps() {
+	std::vector<std::string> dumps;
+	list_directory(cpuid_dumps_directory(), ".log", dumps);
+	list_directory(mock_dumps_directory(), ".h", dumps);
+	std::sort(dumps.begin(), dumps.end());
+	return dumps;
+}
+
+static std::string base_name(const std::string& path) {
+	const size_t separator = path.rfind('/');
+	return separator == std::string::npos ? path : path.substr(separator + 1);
+}
+
+/* CPUID dumps of logical processors, indexed by processor, as cpuinfo_mock_cpuid_from_log returns them */
+class CpuidDumps {
+public:
+	explicit CpuidDumps(const std::string& path) {
+		if (has_suffix(path, ".log")) {
+			dumps_ = cpuinfo_mock_cpuid_from_log(path.c_str(), &processors_count_);
+			return;
+		}
+
+		/* Archives of hybrid processors also include the dump of an E-core */
+		size_t entries = 0, atom_entries = 0;
+		cpuinfo_mock_cpuid* data = cpuinfo_mock_cpuid_from_archive(path.c_str(), "cpuid_dump", &entries);
+		cpuinfo_mock_cpuid* atom_data = cpuinfo_mock_cpuid_from_archive(path.c_str(), "cpuid_dump_atom", &atom_entries);
+		if (data == nullptr) {
+			free(atom_data);
+			return;
+		}
+		processors_count_ = atom_data != nullptr ? 2 : 1;
+		dumps_ = static_cast<cpuinfo_mock_cpuid_dump*>(calloc(processors_count_, sizeof(cpuinfo_mock_cpuid_dump)));
+		dumps_[0] = cpuinfo_mock_cpuid_dump { data, (uint32_t) entries };
+		if (atom_data != nullptr) {
+			dumps_[1] = cpuinfo_mock_cpuid_dump { atom_data, (uint32_t) atom_entries };
+		}
+	}
+
+	~CpuidDumps() {
+		cpuinfo_mock_free_cpuid_dumps(dumps_, processors_count_);
+	}
+
+	CpuidDumps(const CpuidDumps&) = delete;
+	CpuidDumps& operator=(const CpuidDumps&) = delete;
+
+	uint32_t processors_count() const {
+		return processors_count_;
+	}
+
+	const cpuinfo_mock_cpuid_dump& operator[](uint32_t processor) const {
+		return dumps_[processor];
+	}
+
+private:
+	cpuinfo_mock_cpuid_dump* dumps_ = nullptr;
+	uint32_t processors_count_ = 0;
+};
+
+/* Expected decoding of the dump of one logical processor, cross-checked with the test of the device */
+struct ExpectedCpuid {
+	const char* dump;
+	uint32_t processor;
+	cpuinfo_uarch uarch;
+	uint32_t core_type;
+	const char* package_name;
+	uint32_t l1i_size;
+	uint32_t l1d_size;
+	uint32_t l2_size;
+	uint32_t l3_size;
+	bool sse4_2;
+};
+
+static const ExpectedCpuid expected_cpuids[] = {
+	{"alldocube-iwork8.log", 0, cpuinfo_uarch_airmont, 0, "Intel Atom x5-Z8350", 32 * 1024, 24 * 1024, 1024 * 1024, 0, true},
+	{"memo-pad-7.log", 0, cpuinfo_uarch_silvermont, 0, "Intel Atom Z3745", 32 * 1024, 24 * 1024, 1024 * 1024, 0, true},
+	{"zenfone-2.log", 0, cpuinfo_uarch_silvermont, 0, "Intel Atom Z3580", 32 * 1024, 24 * 1024, 1024 * 1024, 0, true},
+	{"zenfone-2e.log", 0, cpuinfo_uarch_saltwell, 0, "Intel Atom Z2560", 32 * 1024, 24 * 1024, 512 * 1024, 0, false},
+	{"zenfone-c.log", 0, cpuinfo_uarch_saltwell, 0, "Intel Atom Z2520", 32 * 1024, 24 * 1024, 512 * 1024, 0, false},
+	{"alldocube-iwork8.h", 0, cpuinfo_uarch_airmont, 0, "Intel Atom x5-Z8350", 32 * 1024, 24 * 1024, 1024 * 1024, 0, true},
+	{"memo-pad-7.h", 0, cpuinfo_uarch_silvermont, 0, "Intel Atom Z3745", 32 * 1024, 24 * 1024, 1024 * 1024, 0, true},
+	{"zenfone-2.h", 0, cpuinfo_uarch_silvermont, 0, "Intel Atom Z3580", 32 * 1024, 24 * 1024, 1024 * 1024, 0, true},
+	{"zenfone-2e.h", 0, cpuinfo_uarch_saltwell, 0, "Intel Atom Z2560", 32 * 1024, 24 * 1024, 512 * 1024, 0, false},
+	{"zenfone-c.h", 0, cpuinfo_uarch_saltwell, 0, "Intel Atom Z2520", 32 * 1024, 24 * 1024, 512 * 1024, 0, false},
+	{"core-i9-12900k.h", 0, cpuinfo_uarch_golden_cove, 0x40, "Intel 12th Gen Core i9-12900K",
+		32 * 1024, 48 * 1024, 1280 * 1024, 30 * 1024 * 1024, true},
+	{"core-i9-12900k.h", 1, cpuinfo_uarch_gracemont, 0x20, "Intel 12th Gen Core i9-12900K",
+		64 * 1024, 32 * 1024, 2 * 1024 * 1024, 30 * 1024 * 1024, true},
+	{"xeon-platinum-8480.h", 0, cpuinfo_uarch_golden_cove, 0, "Intel Xeon Platinum 8480+",
+		32 * 1024, 48 * 1024, 2 * 1024 * 1024, 105 * 1024 * 1024, true},
+};
+
+class CpuidCorpus : public ::testing::TestWithParam<std::string> {
+};
+
+TEST_P(CpuidCorpus, decode) {
+	const std::string name = base_name(GetParam());
+	CpuidDumps dumps(GetParam());
+	ASSERT_NE(0, dumps.processors_count()) << "failed to load " << GetParam();
+
+	for (uint32_t processor = 0; processor < dumps.processors_count(); processor++) {
+		if (dumps[processor].data == nullptr) {
+			continue;
+		}
+		cpuinfo_x86_decoded_cpuid decoded;
+		cpuinfo_x86_decode_cpuid_dump(dumps[processor].data, dumps[processor].entries, &decoded);
+
+		EXPECT_NE(cpuinfo_vendor_unknown, decoded.vendor) << name << " processor " << processor;
+		EXPECT_NE(0, decoded.cpuid) << name << " processor " << processor;
+		EXPECT_NE(0, strlen(decoded.package_name)) << name << " processor " << processor;
+		EXPECT_NE(0, decoded.l1d.size) << name << " processor " << processor;
+		EXPECT_NE(0, decoded.l1d.line_size) << name << " processor " << processor;
+		EXPECT_LE(decoded.l1d.size, decoded.l2.size) << name << " processor " << processor;
+
+		for (const ExpectedCpuid& expected : expected_cpuids) {
+			if (name != expected.dump || processor != expected.processor) {
+				continue;
+			}
+			EXPECT_EQ(expected.uarch, decoded.uarch) << name << " processor " << processor;
+			EXPECT_EQ(expected.core_type, decoded.core_type) << name << " processor " << processor;
+			EXPECT_STREQ(expected.package_name, decoded.package_name) << name << " processor " << processor;
+			EXPECT_EQ(expected.l1i_size, decoded.l1i.size) << name << " processor " << processor;
+			EXPECT_EQ(expected.l1d_size, decoded.l1d.size) << name << " processor " << processor;
+			EXPECT_EQ(expected.l2_size, decoded.l2.size) << name << " processor " << processor;
+			EXPECT_EQ(expected.l3_size, decoded.l3.size) << name << " processor " << processor;
+			EXPECT_EQ(expected.sse4_2, decoded.isa.sse4_2) << name << " processor " << processor;
+		}
+	}
+}
+
+static std::string dump_test_name(const ::testing::TestParamInfo<std::string>& info) {
+	std::string name = base_name(info.param);
+	std::replace_if(name.begin(), name.end(), [](char c) { return !isalnum((unsigned char) c); }, '_');
+	return name;
+}
+
+INSTANTIATE_TEST_CASE_P(dumps, CpuidCorpus, ::testing::ValuesIn(list_dumps()), dump_test_name);
+
+TEST(CPUID_CORPUS, non_empty) {
+	ASSERT_FALSE(list_dumps().empty()) << "no dumps found in " << cpuid_dumps_directory();
+}
+
+TEST(CPUID_CORPUS, logs_match_archives) {
+	for (const std::string& path : list_dumps()) {
+		if (!has_suffix(path, ".log")) {
+			continue;
+		}
+		const std::string name = base_name(path);
+		const std::string archive_path = mock_dumps_directory() + "/" + name.substr(0, name.size() - 4) + ".h";
+		if (access(archive_path.c_str(), R_OK) != 0) {
+			continue;
+		}
+		CpuidDumps log(path), archive(archive_path);
+		ASSERT_NE(0, log.processors_count()) << path;
+		ASSERT_NE(0, archive.processors_count()) << archive_path;
+		ASSERT_EQ(archive[0].entries, log[0].entries) << name;
+		for (uint32_t i = 0; i < log[0].entries; i++) {
+			ASSERT_EQ(0, memcmp(&archive[0].data[i], &log[0].data[i], sizeof(cpuinfo_mock_cpuid)))
+				<< name << " entry " << i;
+		}
+	}
+}
+
+/*
+ * Shifts in CPUID leaf 0xB are cumulative: the core level of Core i9-12900K reports shift 7, which includes the SMT
+ * bit. Decoding 7 core bits would mask the low package bits into core IDs and merge packages of multi-socket systems.
+ */
+TEST(CPUID_TOPOLOGY, cumulative_shift) {
+	CpuidDumps archive(mock_dumps_directory() + "/core-i9-12900k.h");
+	ASSERT_EQ(2, archive.processors_count());
+	for (uint32_t processor = 0; processor < archive.processors_count(); processor++) {
+		cpuinfo_x86_decoded_cpuid decoded;
+		cpuinfo_x86_decode_cpuid_dump(archive[processor].data, archive[processor].entries, &decoded);
+		EXPECT_EQ(1, decoded.thread_bits_length) << "processor " << processor;
+		EXPECT_EQ(6, decoded.core_bits_length) << "processor " << processor;
+	}
+}
+
+/* Writes the dump in the format of tools/cpuid-dump output */
+static void write_log(FILE* file, const cpuinfo_mock_cpuid_dump& dump) {
+	for (uint32_t i = 0; i < dump.entries; i++) {
+		const cpuinfo_mock_cpuid& entry = dump.data[i];
+		fprintf(file, "CPUID %08X: %08X-%08X-%08X-%08X", entry.input_eax, entry.eax, entry.ebx, entry.ecx, entry.edx);
+		if (entry.input_ecx != 0) {
+			fprintf(file, " [SL %02X]", entry.input_ecx);
+		}
+		fprintf(file, "\n");
+	}
+}
+
+TEST(CPUID_LOG, all_processors) {
+	CpuidDumps archive(mock_dumps_directory() + "/core-i9-12900k.h");
+	ASSERT_EQ(2, archive.processors_count());
+
+	/* P-core on logical processor 0 and E-core on logical processor 16, as cpuid-dump --all-processors prints */
+	char path[] = "/tmp/cpuid-dump-XXXXXX.log";
+	const int fd = mkstemps(path, 4);
+	ASSERT_NE(-1, fd);
+	FILE* file = fdopen(fd, "w");
+	ASSERT_TRUE(file);
+	fprintf(file, "CPU 0:\n");
+	write_log(file, archive[0]);
+	fprintf(file, "CPU 16:\n");
+	write_log(file, archive[1]);
+	fclose(file);
+
+	CpuidDumps log(path);
+	unlink(path);
+	ASSERT_EQ(17, log.processors_count());
+	for (uint32_t processor = 1; processor < 16; processor++) {
+		ASSERT_FALSE(log[processor].data) << "processor " << processor;
+	}
+	for (uint32_t i = 0; i < 2; i++) {
+		const cpuinfo_mock_cpuid_dump& expected = archive[i];
+		const cpuinfo_mock_cpuid_dump& actual = log[i == 0 ? 0 : 16];
+		ASSERT_EQ(expected.entries, actual.entries);
+		for (uint32_t j = 0; j < expected.entries; j++) {
+			ASSERT_EQ(0, memcmp(&expected.data[j], &actual.data[j], sizeof(cpuinfo_mock_cpuid))) << "entry " << j;
+		}
+	}
+
+	cpuinfo_x86_decoded_cpuid decoded;
+	cpuinfo_x86_decode_cpuid_dump(log[16].data, log[16].entries, &decoded);
+	ASSERT_EQ(cpuinfo_uarch_gracemont, decoded.uarch);
+}
+
+int main(int argc, char* argv[]) {
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.hpp>
+
+
+struct unsupported_impl {
+	/* Features of different architectures are never supported together */
+	typedef cpuinfo::requirements<cpuinfo::isa::x86_sse, cpuinfo::isa::arm_thumb> requirements;
+	static int run(int x) { return x + 3; }
+};
+
+struct baseline_impl {
+	typedef cpuinfo::requirements<> requirements;
+	static int run(int x) { return x + 2; }
+};
+
+struct fallback_impl {
+	typedef cpuinfo::requirements<> requirements;
+	static int run(int x) { return x + 1; }
+};
+
+static_assert(cpuinfo::requirements<>::baseline, "empty requirements must be statically satisfied");
+static_assert(!cpuinfo::requirements<cpuinfo::isa::x86_sse, cpuinfo::isa::arm_thumb>::baseline,
+	"x86 and ARM features can't be both guaranteed by the compilation target");
+
+TEST(FEATURE, matches_isa_bits) {
+	EXPECT_EQ(cpuinfo_isa_bits_has(&cpuinfo_isa_bits_supported, cpuinfo_isa_x86_avx2),
+		cpuinfo::isa::x86_avx2::available());
+	EXPECT_EQ(cpuinfo_isa_bits_has(&cpuinfo_isa_bits_supported, cpuinfo_isa_arm_neon),
+		cpuinfo::isa::arm_neon::available());
+}
+
+TEST(FEATURE, baseline_available) {
+	if (cpuinfo::isa::x86_sse2::baseline) {
+		EXPECT_TRUE(cpuinfo_has_x86_sse2());
+	}
+	if (cpuinfo::isa::arm_neon::baseline) {
+		EXPECT_TRUE(cpuinfo_has_arm_neon());
+	}
+}
+
+TEST(DISPATCH, skips_unsupported) {
+	EXPECT_EQ(12, (cpuinfo::dispatch<unsupported_impl, baseline_impl, fallback_impl>::run(10)));
+}
+
+TEST(DISPATCH, falls_back) {
+	EXPECT_EQ(11, (cpuinfo::dispatch<unsupported_impl, fallback_impl>::run(10)));
+}
+
+TEST(DISPATCH, resolve) {
+	int (*function)(int) = cpuinfo::dispatch<unsupported_impl, baseline_impl, fallback_impl>::resolve<int(int)>();
+	EXPECT_EQ(&baseline_impl::run, function);
+}
+
+TEST(RANGES, processors) {
+	const cpuinfo::range<cpuinfo_processor> processors = cpuinfo::processors();
+	ASSERT_EQ(cpuinfo_get_processors_count(), processors.size());
+	uint32_t i = 0;
+	for (const cpuinfo_processor& processor : processors) {
+		EXPECT_EQ(cpuinfo_get_processor(i++), &processor);
+	}
+}
+
+TEST(RANGES, caches) {
+	EXPECT_EQ(cpuinfo_get_l1i_caches_count(), cpuinfo::l1i_caches().size());
+	EXPECT_EQ(cpuinfo_get_l1d_caches_count(), cpuinfo::l1d_caches().size());
+	EXPECT_EQ(cpuinfo_get_l2_caches_count(), cpuinfo::l2_caches().size());
+	EXPECT_EQ(cpuinfo_get_l3_caches_count(), cpuinfo::l3_caches().size());
+	EXPECT_EQ(cpuinfo_get_l4_caches_count(), cpuinfo::l4_caches().size());
+}
+
+TEST(RANGES, core_processors) {
+	for (const cpuinfo_core& core : cpuinfo::cores()) {
+		ASSERT_EQ(core.processor_count, cpuinfo::processors(core).size());
+		for (const cpuinfo_processor& processor : cpuinfo::processors(core)) {
+			EXPECT_EQ(&core, processor.core);
+		}
+	}
+}
+
+TEST(RANGES, cluster_cores) {
+	for (const cpuinfo_cluster& cluster : cpuinfo::clusters()) {
+		ASSERT_EQ(cluster.core_count, cpuinfo::cores(cluster).size());
+		for (const cpuinfo_core& core : cpuinfo::cores(cluster)) {
+			EXPECT_EQ(&cluster, core.cluster);
+		}
+		for (const cpuinfo_processor& processor : cpuinfo::processors(cluster)) {
+			EXPECT_EQ(&cluster, processor.cluster);
+		}
+	}
+}
+
+TEST(RANGES, package_clusters) {
+	for (const cpuinfo_package& package : cpuinfo::packages()) {
+		ASSERT_EQ(package.cluster_count, cpuinfo::clusters(package).size());
+		for (const cpuinfo_cluster& cluster : cpuinfo::clusters(package)) {
+			EXPECT_EQ(&package, cluster.package);
+		}
+		EXPECT_EQ(package.core_count, cpuinfo::cores(package).size());
+		EXPECT_EQ(package.processor_count, cpuinfo::processors(package).size());
+	}
+}
+
+TEST(RANGES, cache_sharing) {
+	for (const cpuinfo_cache& cache : cpuinfo::l2_caches()) {
+		ASSERT_EQ(cache.processor_count, cpuinfo::processors(cache).size());
+		for (const cpuinfo_processor& processor : cpuinfo::processors(cache)) {
+			EXPECT_EQ(&cache, processor.cache.l2);
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+
+
+static void generic_kernel(void) {}
+static void tuned_kernel(void) {}
+static void unsupported_kernel(void) {}
+
+static cpuinfo_isa_bits unsupported_isa() {
+	/* Features of different architectures are never supported together */
+	cpuinfo_isa_bits isa = { { 0 } };
+	cpuinfo_isa_bits_add(&isa, cpuinfo_isa_x86_sse);
+	cpuinfo_isa_bits_add(&isa, cpuinfo_isa_arm_thumb);
+	return isa;
+}
+
+TEST(DISPATCH, first_eligible) {
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ unsupported_kernel, unsupported_isa(), NULL, 0, 0, NULL },
+		{ generic_kernel, { { 0 } }, NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 2, NULL, NULL, 0 };
+	ASSERT_TRUE(cpuinfo_dispatch_table_resolve(&table));
+	EXPECT_EQ(generic_kernel, cpuinfo_dispatch_get(&table));
+	cpuinfo_dispatch_table_release(&table);
+}
+
+TEST(DISPATCH, no_eligible) {
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ unsupported_kernel, unsupported_isa(), NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 1, NULL, NULL, 0 };
+	EXPECT_FALSE(cpuinfo_dispatch_table_resolve(&table));
+	EXPECT_FALSE(cpuinfo_dispatch_get(&table));
+	cpuinfo_dispatch_table_release(&table);
+}
+
+TEST(DISPATCH, tuned_preferred) {
+	const enum cpuinfo_uarch uarch = cpuinfo_get_cluster(0)->uarch;
+	bool homogeneous = true;
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		homogeneous &= cpuinfo_get_cluster(i)->uarch == uarch;
+	}
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ generic_kernel, { { 0 } }, NULL, 0, 0, NULL },
+		{ tuned_kernel, { { 0 } }, &uarch, 1, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 2, NULL, NULL, 0 };
+	ASSERT_TRUE(cpuinfo_dispatch_table_resolve(&table));
+	EXPECT_EQ(tuned_kernel, cpuinfo_dispatch_get_for_cluster(&table, cpuinfo_get_cluster(0)));
+	EXPECT_EQ(homogeneous ? tuned_kernel : generic_kernel, cpuinfo_dispatch_get(&table));
+	cpuinfo_dispatch_table_release(&table);
+}
+
+TEST(DISPATCH, uarch_required) {
+	const enum cpuinfo_uarch uarch = cpuinfo_uarch_unknown == cpuinfo_get_cluster(0)->uarch ?
+		cpuinfo_uarch_p5 : cpuinfo_uarch_unknown;
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ tuned_kernel, { { 0 } }, &uarch, 1, CPUINFO_DISPATCH_UARCH_REQUIRED, NULL },
+		{ generic_kernel, { { 0 } }, NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 2, NULL, NULL, 0 };
+	ASSERT_TRUE(cpuinfo_dispatch_table_resolve(&table));
+	EXPECT_EQ(generic_kernel, cpuinfo_dispatch_get_for_cluster(&table, cpuinfo_get_cluster(0)));
+	cpuinfo_dispatch_table_release(&table);
+}
+
+TEST(DISPATCH, all_clusters) {
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ generic_kernel, { { 0 } }, NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 1, NULL, NULL, 0 };
+	ASSERT_TRUE(cpuinfo_dispatch_table_resolve(&table));
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		EXPECT_EQ(generic_kernel, cpuinfo_dispatch_get_for_cluster(&table, cpuinfo_get_cluster(i)));
+	}
+	cpuinfo_dispatch_table_release(&table);
+}
+
+static bool is_first_cluster(const cpuinfo_cluster* cluster) {
+	return cluster == cpuinfo_get_cluster(0);
+}
+
+TEST(DISPATCH, cluster_filter) {
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ tuned_kernel, { { 0 } }, NULL, 0, 0, is_first_cluster },
+		{ generic_kernel, { { 0 } }, NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 2, NULL, NULL, 0 };
+	ASSERT_TRUE(cpuinfo_dispatch_table_resolve(&table));
+	EXPECT_EQ(tuned_kernel, cpuinfo_dispatch_get_for_cluster(&table, cpuinfo_get_cluster(0)));
+	for (uint32_t i = 1; i < cpuinfo_get_clusters_count(); i++) {
+		EXPECT_EQ(generic_kernel, cpuinfo_dispatch_get_for_cluster(&table, cpuinfo_get_cluster(i)));
+	}
+	EXPECT_EQ(cpuinfo_get_clusters_count() == 1 ? tuned_kernel : generic_kernel, cpuinfo_dispatch_get(&table));
+	cpuinfo_dispatch_table_release(&table);
+}
+
+TEST(DISPATCH, cluster_isa) {
+	cpuinfo_isa_bits isa = { { 0 } };
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	cpuinfo_isa_bits_add(&isa, cpuinfo_isa_x86_avx2);
+#elif CPUINFO_ARCH_ARM64
+	cpuinfo_isa_bits_add(&isa, cpuinfo_isa_arm_neon_dot);
+#endif
+	const cpuinfo_dispatch_candidate candidates[] = {
+		{ tuned_kernel, isa, NULL, 0, 0, NULL },
+		{ generic_kernel, { { 0 } }, NULL, 0, 0, NULL },
+	};
+	cpuinfo_dispatch_table table = { candidates, 2, NULL, NULL, 0 };
+	ASSERT_TRUE(cpuinfo_dispatch_table_resolve(&table));
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		const bool supported = cpuinfo_get_cluster_isa(i)->avx2;
+#elif CPUINFO_ARCH_ARM64
+		const bool supported = cpuinfo_get_cluster_isa(i)->dot;
+#else
+		const bool supported = true;
+#endif
+		EXPECT_EQ(supported ? tuned_kernel : generic_kernel,
+			cpuinfo_dispatch_get_for_cluster(&table, cpuinfo_get_cluster(i)));
+	}
+	cpuinfo_dispatch_table_release(&table);
+}
+
+int main(int argc, char* argv[]) {
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
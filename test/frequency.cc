@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <cpuinfo.h>
+
+
+TEST(MEASURED_FREQUENCY, non_zero) {
+	ASSERT_NE(0, cpuinfo_measure_current_core_frequency());
+}
+
+TEST(MEASURED_FREQUENCY, reasonable) {
+	const uint64_t frequency = cpuinfo_measure_current_core_frequency();
+	EXPECT_GE(frequency, UINT64_C(100000000));
+	EXPECT_LE(frequency, UINT64_C(10000000000));
+}
+
+TEST(MEASURED_FREQUENCY, cached_for_cluster) {
+	const uint64_t frequency = cpuinfo_get_current_core_frequency();
+	ASSERT_NE(0, frequency);
+	EXPECT_EQ(frequency, cpuinfo_get_current_core_frequency());
+}
+
+TEST(MEASURED_FREQUENCY, keeps_topology_frequency) {
+	std::vector<uint64_t> core_frequencies, cluster_frequencies;
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		core_frequencies.push_back(cpuinfo_get_core(i)->frequency);
+	}
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		cluster_frequencies.push_back(cpuinfo_get_cluster(i)->frequency);
+	}
+
+	ASSERT_NE(0, cpuinfo_measure_current_core_frequency());
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		EXPECT_EQ(core_frequencies[i], cpuinfo_get_core(i)->frequency);
+	}
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		EXPECT_EQ(cluster_frequencies[i], cpuinfo_get_cluster(i)->frequency);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
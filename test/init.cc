@@ -261,6 +261,30 @@ TEST(CORE, known_uarch) {
 	}
 }
 
+TEST(CORE, known_uarch_info) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		const cpuinfo_core* core = cpuinfo_get_core(i);
+		ASSERT_TRUE(core);
+
+		if (core->uarch != cpuinfo_uarch_unknown) {
+			const cpuinfo_uarch_info* uarch_info = cpuinfo_get_uarch_info(core->uarch);
+			ASSERT_TRUE(uarch_info);
+			EXPECT_EQ(core->uarch, uarch_info->uarch);
+			EXPECT_NE(0, uarch_info->decode_width);
+			EXPECT_LE(uarch_info->decode_width, uarch_info->issue_width);
+			EXPECT_NE(0, uarch_info->fma_units);
+			EXPECT_NE(0, uarch_info->load_units);
+			EXPECT_NE(0, uarch_info->store_units);
+			EXPECT_NE(0, uarch_info->load_store_bits);
+			EXPECT_NE(0, uarch_info->l1d_latency);
+		}
+	}
+}
+
+TEST(UARCH_INFO, unknown) {
+	EXPECT_FALSE(cpuinfo_get_uarch_info(cpuinfo_uarch_unknown));
+}
+
 TEST(CLUSTERS_COUNT, within_bounds) {
 	EXPECT_NE(0, cpuinfo_get_clusters_count());
 	EXPECT_LE(cpuinfo_get_clusters_count(), cpuinfo_get_cores_count());
@@ -451,6 +475,174 @@ TEST(CLUSTER, consistent_frequency) {
 	}
 }
 
+TEST(CORE, non_zero_throughput) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		const cpuinfo_core* core = cpuinfo_get_core(i);
+		ASSERT_TRUE(core);
+
+		cpuinfo_throughput throughput;
+		ASSERT_TRUE(cpuinfo_get_core_throughput(core, &throughput));
+		EXPECT_NE(0, throughput.fp32_ops_per_cycle);
+		EXPECT_NE(0, throughput.fp64_ops_per_cycle);
+		EXPECT_NE(0, throughput.int8_ops_per_cycle);
+		EXPECT_NE(0, throughput.load_bytes_per_cycle);
+		EXPECT_NE(0, throughput.store_bytes_per_cycle);
+		EXPECT_LE(throughput.fp64_ops_per_cycle, throughput.fp32_ops_per_cycle);
+	}
+}
+
+TEST(CLUSTER, consistent_throughput) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		const cpuinfo_cluster* cluster = cpuinfo_get_cluster(i);
+		ASSERT_TRUE(cluster);
+
+		cpuinfo_throughput cluster_throughput;
+		ASSERT_TRUE(cpuinfo_get_cluster_throughput(cluster, &cluster_throughput));
+
+		uint32_t fp32_ops_per_cycle = 0;
+		for (uint32_t j = 0; j < cluster->core_count; j++) {
+			cpuinfo_throughput core_throughput;
+			ASSERT_TRUE(cpuinfo_get_core_throughput(cpuinfo_get_core(cluster->core_start + j), &core_throughput));
+			fp32_ops_per_cycle += core_throughput.fp32_ops_per_cycle;
+		}
+		EXPECT_EQ(fp32_ops_per_cycle, cluster_throughput.fp32_ops_per_cycle);
+		EXPECT_EQ(cluster->frequency, cluster_throughput.frequency);
+		EXPECT_EQ(cluster_throughput.fp32_ops_per_cycle * cluster->frequency, cluster_throughput.fp32_ops_per_second);
+	}
+}
+
+TEST(CLUSTER, valid_blocking) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		const cpuinfo_cluster* cluster = cpuinfo_get_cluster(i);
+		ASSERT_TRUE(cluster);
+
+		cpuinfo_blocking blocking;
+		ASSERT_TRUE(cpuinfo_get_cluster_blocking(cluster, sizeof(float), 6, 16, cluster->processor_count, &blocking));
+		EXPECT_EQ(6, blocking.mr);
+		EXPECT_EQ(16, blocking.nr);
+		EXPECT_NE(0, blocking.kc);
+		EXPECT_NE(0, blocking.mc);
+		EXPECT_EQ(0, blocking.mc % blocking.mr);
+		EXPECT_NE(0, blocking.nc);
+		EXPECT_EQ(0, blocking.nc % blocking.nr);
+
+		const cpuinfo_cache* l1d = cpuinfo_get_processor(cluster->processor_start)->cache.l1d;
+		if (l1d != NULL) {
+			EXPECT_LE((blocking.mr + blocking.nr) * blocking.kc * sizeof(float), l1d->size);
+			EXPECT_LE(blocking.l1_tile_bytes, l1d->size);
+		}
+	}
+}
+
+TEST(CLUSTER, repeatable_blocking) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		const cpuinfo_cluster* cluster = cpuinfo_get_cluster(i);
+		ASSERT_TRUE(cluster);
+
+		cpuinfo_blocking first, second;
+		ASSERT_TRUE(cpuinfo_get_cluster_blocking(cluster, sizeof(double), 8, 4, 1, &first));
+		ASSERT_TRUE(cpuinfo_get_cluster_blocking(cluster, sizeof(double), 8, 4, 1, &second));
+		EXPECT_EQ(first.mc, second.mc);
+		EXPECT_EQ(first.kc, second.kc);
+		EXPECT_EQ(first.nc, second.nc);
+	}
+}
+
+TEST(CLUSTER, non_null_isa) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		EXPECT_TRUE(cpuinfo_get_cluster_isa(i));
+	}
+	EXPECT_FALSE(cpuinfo_get_cluster_isa(cpuinfo_get_clusters_count()));
+}
+
+TEST(CLUSTER, isa_includes_global_isa) {
+	/* ISA structures consist only of bool flags */
+	const bool* global_flags = reinterpret_cast<const bool*>(&cpuinfo_isa);
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		const bool* cluster_flags = reinterpret_cast<const bool*>(cpuinfo_get_cluster_isa(i));
+		ASSERT_TRUE(cluster_flags);
+
+		for (size_t j = 0; j < sizeof(cpuinfo_isa) / sizeof(bool); j++) {
+			if (global_flags[j]) {
+				EXPECT_TRUE(cluster_flags[j]) << "feature #" << j << " of cluster " << i;
+			}
+		}
+	}
+}
+
+TEST(CORE_CLASSES_COUNT, within_bounds) {
+	EXPECT_NE(0, cpuinfo_get_core_classes_count());
+	EXPECT_LE(cpuinfo_get_core_classes_count(), cpuinfo_get_cores_count());
+	EXPECT_FALSE(cpuinfo_get_core_class(cpuinfo_get_core_classes_count()));
+}
+
+TEST(CORE_CLASS, consistent_counts) {
+	uint32_t cores_count = 0, processors_count = 0;
+	for (uint32_t i = 0; i < cpuinfo_get_core_classes_count(); i++) {
+		const cpuinfo_core_class* core_class = cpuinfo_get_core_class(i);
+		ASSERT_TRUE(core_class);
+
+		EXPECT_NE(0, core_class->core_count);
+		EXPECT_NE(0, core_class->processor_count);
+		cores_count += core_class->core_count;
+		processors_count += core_class->processor_count;
+	}
+	EXPECT_EQ(cpuinfo_get_cores_count(), cores_count);
+	EXPECT_EQ(cpuinfo_get_processors_count(), processors_count);
+}
+
+TEST(CORE_CLASS, decreasing_performance) {
+	for (uint32_t i = 0; i < cpuinfo_get_core_classes_count(); i++) {
+		const cpuinfo_core_class* core_class = cpuinfo_get_core_class(i);
+		ASSERT_TRUE(core_class);
+
+		if (i == 0) {
+			EXPECT_EQ(1024, core_class->performance);
+		} else {
+			EXPECT_LT(core_class->performance, cpuinfo_get_core_class(i - 1)->performance);
+		}
+	}
+}
+
+TEST(CORE_CLASS, consistent_clusters) {
+	for (uint32_t i = 0; i < cpuinfo_get_core_classes_count(); i++) {
+		const cpuinfo_core_class* core_class = cpuinfo_get_core_class(i);
+		ASSERT_TRUE(core_class);
+
+		for (uint32_t j = 0; j < core_class->cluster_count; j++) {
+			const cpuinfo_cluster* cluster = cpuinfo_get_cluster_by_performance(core_class->cluster_start + j);
+			ASSERT_TRUE(cluster);
+
+			for (uint32_t k = 0; k < cluster->core_count; k++) {
+				const cpuinfo_core* core = cpuinfo_get_core(cluster->core_start + k);
+				ASSERT_TRUE(core);
+
+				EXPECT_EQ(i, core->core_class);
+			}
+		}
+	}
+	EXPECT_FALSE(cpuinfo_get_cluster_by_performance(cpuinfo_get_clusters_count()));
+}
+
+TEST(CORE_CLASS, consistent_processors) {
+	for (uint32_t i = 0; i < cpuinfo_get_core_classes_count(); i++) {
+		const cpuinfo_core_class* core_class = cpuinfo_get_core_class(i);
+		ASSERT_TRUE(core_class);
+		ASSERT_TRUE(core_class->processors);
+
+		for (uint32_t j = 0; j < core_class->processor_count; j++) {
+			const cpuinfo_processor* processor = core_class->processors[j];
+			ASSERT_TRUE(processor);
+			ASSERT_TRUE(processor->core);
+
+			EXPECT_EQ(i, processor->core->core_class);
+			if (j != 0) {
+				EXPECT_LT(core_class->processors[j - 1], processor);
+			}
+		}
+	}
+}
+
 TEST(PACKAGES_COUNT, within_bounds) {
 	EXPECT_NE(0, cpuinfo_get_packages_count());
 	EXPECT_LE(cpuinfo_get_packages_count(), cpuinfo_get_cores_count());
@@ -467,6 +659,15 @@ TEST(PACKAGE, non_null) {
 	}
 }
 
+TEST(PACKAGE, non_zero_throughput) {
+	for (uint32_t i = 0; i < cpuinfo_get_packages_count(); i++) {
+		cpuinfo_throughput throughput;
+		ASSERT_TRUE(cpuinfo_get_package_throughput(cpuinfo_get_package(i), &throughput));
+		EXPECT_NE(0, throughput.fp32_ops_per_cycle);
+		EXPECT_NE(0, throughput.load_bytes_per_cycle);
+	}
+}
+
 TEST(PACKAGE, non_zero_processors) {
 	for (uint32_t i = 0; i < cpuinfo_get_packages_count(); i++) {
 		const cpuinfo_package* package = cpuinfo_get_package(i);
@@ -1203,6 +1404,53 @@ TEST(L4_CACHE, consistent_processors) {
 	}
 }
 
+TEST(ISA_BITS, empty) {
+	const cpuinfo_isa_bits required = { { 0 } };
+	EXPECT_TRUE(cpuinfo_isa_has_all(&required));
+}
+
+TEST(ISA_BITS, empty_uninitialized) {
+	const cpuinfo_isa_bits required = { { 0 } };
+	cpuinfo_deinitialize();
+	EXPECT_FALSE(cpuinfo_isa_has_all(&required));
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_TRUE(cpuinfo_isa_has_all(&required));
+}
+
+TEST(ISA_BITS, consistent_x86) {
+	cpuinfo_isa_bits required = { { 0 } };
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_x86_sse2);
+	EXPECT_EQ(cpuinfo_has_x86_sse2(), cpuinfo_isa_has_all(&required));
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_x86_avx2);
+	EXPECT_EQ(cpuinfo_has_x86_sse2() && cpuinfo_has_x86_avx2(), cpuinfo_isa_has_all(&required));
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_x86_avx512f);
+	EXPECT_EQ(cpuinfo_has_x86_sse2() && cpuinfo_has_x86_avx2() && cpuinfo_has_x86_avx512f(),
+		cpuinfo_isa_has_all(&required));
+}
+
+TEST(ISA_BITS, consistent_arm) {
+	cpuinfo_isa_bits required = { { 0 } };
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_arm_neon);
+	EXPECT_EQ(cpuinfo_has_arm_neon(), cpuinfo_isa_has_all(&required));
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_arm_neon_dot);
+	EXPECT_EQ(cpuinfo_has_arm_neon() && cpuinfo_has_arm_neon_dot(), cpuinfo_isa_has_all(&required));
+}
+
+TEST(ISA_BITS, cross_architecture) {
+	cpuinfo_isa_bits required = { { 0 } };
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_x86_sse);
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_arm_thumb);
+	EXPECT_FALSE(cpuinfo_isa_has_all(&required));
+}
+
+TEST(ISA_BITS, has) {
+	cpuinfo_isa_bits bits = { { 0 } };
+	EXPECT_FALSE(cpuinfo_isa_bits_has(&bits, cpuinfo_isa_arm_crc32));
+	cpuinfo_isa_bits_add(&bits, cpuinfo_isa_arm_crc32);
+	EXPECT_TRUE(cpuinfo_isa_bits_has(&bits, cpuinfo_isa_arm_crc32));
+	EXPECT_FALSE(cpuinfo_isa_bits_has(&bits, cpuinfo_isa_x86_sha));
+}
+
 int main(int argc, char* argv[]) {
 	cpuinfo_initialize();
 	::testing::InitGoogleTest(&argc, argv);
@@ -342,6 +342,34 @@ TEST(ISA, avx512_4fmaps) {
 	ASSERT_FALSE(cpuinfo_has_x86_avx512_4fmaps());
 }
 
+TEST(ISA, avx512vp2intersect) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512vp2intersect());
+}
+
+TEST(ISA, avx512bf16) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512bf16());
+}
+
+TEST(ISA, avx512fp16) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512fp16());
+}
+
+TEST(ISA, avxvnni) {
+	ASSERT_FALSE(cpuinfo_has_x86_avxvnni());
+}
+
+TEST(ISA, amx_tile) {
+	ASSERT_FALSE(cpuinfo_has_x86_amx_tile());
+}
+
+TEST(ISA, amx_int8) {
+	ASSERT_FALSE(cpuinfo_has_x86_amx_int8());
+}
+
+TEST(ISA, amx_bf16) {
+	ASSERT_FALSE(cpuinfo_has_x86_amx_bf16());
+}
+
 TEST(ISA, hle) {
 	ASSERT_FALSE(cpuinfo_has_x86_hle());
 }
@@ -0,0 +1,23873 @@
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 38930,
+		.content =
+			"processor\t: 0\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 1\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 2\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 3\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 4\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 5\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 6\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 7\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 8\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 9\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 10\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 11\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 12\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 13\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 14\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 15\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 16\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 17\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 18\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 19\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 20\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 21\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 22\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 23\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 24\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 25\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 26\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 27\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 28\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 29\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 30\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 31\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 32\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 33\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 34\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 35\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 36\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 37\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 38\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 39\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 40\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 41\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 42\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 43\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 44\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 45\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 46\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 47\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 48\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 49\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 50\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 51\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 52\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 53\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 54\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 55\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 56\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 57\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 58\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 59\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 60\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 61\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 62\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 63\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 64\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 65\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 66\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 67\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 68\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 69\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 70\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 71\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 72\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 73\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 74\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 75\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 76\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 77\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 78\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 79\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 80\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 81\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 82\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 83\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 84\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 85\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 86\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 87\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 88\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 89\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 90\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 91\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 92\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 93\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 94\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 95\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 96\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 97\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 98\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 99\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 100\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 101\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 102\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 103\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 104\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 105\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 106\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 107\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 108\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 109\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 110\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 111\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 112\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 113\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 114\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 115\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 116\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 117\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 118\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 119\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 120\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 121\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 122\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 123\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 124\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 125\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 126\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 127\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 128\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 129\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 130\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 131\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 132\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 133\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 134\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 135\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 136\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 137\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 138\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 139\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 140\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 141\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 142\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 143\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 144\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 145\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 146\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 147\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 148\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 149\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 150\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 151\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 152\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 153\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 154\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 155\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 156\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 157\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 158\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 159\n"
+			"BogoMIPS\t: 50.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm lrcpc dcpop asimddp ssbs\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x3\n"
+			"CPU part\t: 0xd0c\n"
+			"CPU revision\t: 1\n"
+			"\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 4,
+		.content = "511\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 6,
+		.content = "0-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 6,
+		.content = "0-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 6,
+		.content = "0-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "0-1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/cluster_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/thread_siblings_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "0-1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/cluster_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/thread_siblings_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "2-3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/cluster_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/thread_siblings_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "2-3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/cluster_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/thread_siblings_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "4-5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/cluster_id",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/thread_siblings_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "4-5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/cluster_id",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/thread_siblings_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "6-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/cluster_id",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/thread_siblings_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "6-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/cluster_id",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/thread_siblings_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "8-9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/topology/cluster_id",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/topology/thread_siblings_list",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/topology/cluster_cpus_list",
+		.size = 4,
+		.content = "8-9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/topology/cluster_id",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/topology/thread_siblings_list",
+		.size = 2,
+		.content = "9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "10\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "10\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "10\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "10-11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/topology/cluster_id",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/topology/thread_siblings_list",
+		.size = 3,
+		.content = "10\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "10-11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/topology/cluster_id",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/topology/thread_siblings_list",
+		.size = 3,
+		.content = "11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "12\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "12\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "12\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "12-13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/topology/cluster_id",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/topology/thread_siblings_list",
+		.size = 3,
+		.content = "12\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "12-13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/topology/cluster_id",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/topology/thread_siblings_list",
+		.size = 3,
+		.content = "13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "14\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "14\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "14\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "14-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/topology/cluster_id",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/topology/thread_siblings_list",
+		.size = 3,
+		.content = "14\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "14-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/topology/cluster_id",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/topology/thread_siblings_list",
+		.size = 3,
+		.content = "15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "16-17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/topology/cluster_id",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/topology/thread_siblings_list",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "16-17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/topology/cluster_id",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/topology/thread_siblings_list",
+		.size = 3,
+		.content = "17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "18\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "18\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "18\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "18-19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/topology/cluster_id",
+		.size = 2,
+		.content = "9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/topology/thread_siblings_list",
+		.size = 3,
+		.content = "18\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "18-19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/topology/cluster_id",
+		.size = 2,
+		.content = "9\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/topology/thread_siblings_list",
+		.size = 3,
+		.content = "19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "20\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "20\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "20\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "20-21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/topology/cluster_id",
+		.size = 3,
+		.content = "10\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/topology/thread_siblings_list",
+		.size = 3,
+		.content = "20\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "20-21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/topology/cluster_id",
+		.size = 3,
+		.content = "10\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/topology/thread_siblings_list",
+		.size = 3,
+		.content = "21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "22\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "22\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "22\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "22-23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/topology/cluster_id",
+		.size = 3,
+		.content = "11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/topology/thread_siblings_list",
+		.size = 3,
+		.content = "22\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "22-23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/topology/cluster_id",
+		.size = 3,
+		.content = "11\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/topology/thread_siblings_list",
+		.size = 3,
+		.content = "23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "24\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "24\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "24\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "24-25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/topology/cluster_id",
+		.size = 3,
+		.content = "12\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu24/topology/thread_siblings_list",
+		.size = 3,
+		.content = "24\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "24-25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/topology/cluster_id",
+		.size = 3,
+		.content = "12\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu25/topology/thread_siblings_list",
+		.size = 3,
+		.content = "25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "26\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "26\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "26\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "26-27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/topology/cluster_id",
+		.size = 3,
+		.content = "13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu26/topology/thread_siblings_list",
+		.size = 3,
+		.content = "26\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "26-27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/topology/cluster_id",
+		.size = 3,
+		.content = "13\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu27/topology/thread_siblings_list",
+		.size = 3,
+		.content = "27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "28\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "28\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "28\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "28-29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/topology/cluster_id",
+		.size = 3,
+		.content = "14\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu28/topology/thread_siblings_list",
+		.size = 3,
+		.content = "28\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "28-29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/topology/cluster_id",
+		.size = 3,
+		.content = "14\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu29/topology/thread_siblings_list",
+		.size = 3,
+		.content = "29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "30\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "30\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "30\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "30-31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/topology/cluster_id",
+		.size = 3,
+		.content = "15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu30/topology/thread_siblings_list",
+		.size = 3,
+		.content = "30\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "30-31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/topology/cluster_id",
+		.size = 3,
+		.content = "15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu31/topology/thread_siblings_list",
+		.size = 3,
+		.content = "31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "32\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "32\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "32\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "32-33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/topology/cluster_id",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu32/topology/thread_siblings_list",
+		.size = 3,
+		.content = "32\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "32-33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/topology/cluster_id",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu33/topology/thread_siblings_list",
+		.size = 3,
+		.content = "33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "34\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "34\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "34\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "34-35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/topology/cluster_id",
+		.size = 3,
+		.content = "17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu34/topology/thread_siblings_list",
+		.size = 3,
+		.content = "34\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "34-35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/topology/cluster_id",
+		.size = 3,
+		.content = "17\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu35/topology/thread_siblings_list",
+		.size = 3,
+		.content = "35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "36\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "36\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "36\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "36-37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/topology/cluster_id",
+		.size = 3,
+		.content = "18\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu36/topology/thread_siblings_list",
+		.size = 3,
+		.content = "36\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "36-37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/topology/cluster_id",
+		.size = 3,
+		.content = "18\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu37/topology/thread_siblings_list",
+		.size = 3,
+		.content = "37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "38\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "38\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "38\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "38-39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/topology/cluster_id",
+		.size = 3,
+		.content = "19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu38/topology/thread_siblings_list",
+		.size = 3,
+		.content = "38\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "38-39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/topology/cluster_id",
+		.size = 3,
+		.content = "19\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu39/topology/thread_siblings_list",
+		.size = 3,
+		.content = "39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "40\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "40\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "40\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "40-41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/topology/cluster_id",
+		.size = 3,
+		.content = "20\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu40/topology/thread_siblings_list",
+		.size = 3,
+		.content = "40\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "40-41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/topology/cluster_id",
+		.size = 3,
+		.content = "20\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu41/topology/thread_siblings_list",
+		.size = 3,
+		.content = "41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "42\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "42\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "42\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "42-43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/topology/cluster_id",
+		.size = 3,
+		.content = "21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu42/topology/thread_siblings_list",
+		.size = 3,
+		.content = "42\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "42-43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/topology/cluster_id",
+		.size = 3,
+		.content = "21\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu43/topology/thread_siblings_list",
+		.size = 3,
+		.content = "43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "44\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "44\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "44\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "44-45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/topology/cluster_id",
+		.size = 3,
+		.content = "22\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu44/topology/thread_siblings_list",
+		.size = 3,
+		.content = "44\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "44-45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/topology/cluster_id",
+		.size = 3,
+		.content = "22\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu45/topology/thread_siblings_list",
+		.size = 3,
+		.content = "45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "46\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "46\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "46\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "46-47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/topology/cluster_id",
+		.size = 3,
+		.content = "23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu46/topology/thread_siblings_list",
+		.size = 3,
+		.content = "46\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "46-47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/topology/cluster_id",
+		.size = 3,
+		.content = "23\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu47/topology/thread_siblings_list",
+		.size = 3,
+		.content = "47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "48\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "48\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "48\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "48-49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/topology/cluster_id",
+		.size = 3,
+		.content = "24\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu48/topology/thread_siblings_list",
+		.size = 3,
+		.content = "48\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "48-49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/topology/cluster_id",
+		.size = 3,
+		.content = "24\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu49/topology/thread_siblings_list",
+		.size = 3,
+		.content = "49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "50\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "50\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "50\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "50-51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/topology/cluster_id",
+		.size = 3,
+		.content = "25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu50/topology/thread_siblings_list",
+		.size = 3,
+		.content = "50\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "50-51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/topology/cluster_id",
+		.size = 3,
+		.content = "25\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu51/topology/thread_siblings_list",
+		.size = 3,
+		.content = "51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "52\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "52\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "52\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "52-53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/topology/cluster_id",
+		.size = 3,
+		.content = "26\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu52/topology/thread_siblings_list",
+		.size = 3,
+		.content = "52\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "52-53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/topology/cluster_id",
+		.size = 3,
+		.content = "26\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu53/topology/thread_siblings_list",
+		.size = 3,
+		.content = "53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "54\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "54\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "54\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "54-55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/topology/cluster_id",
+		.size = 3,
+		.content = "27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu54/topology/thread_siblings_list",
+		.size = 3,
+		.content = "54\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "54-55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/topology/cluster_id",
+		.size = 3,
+		.content = "27\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu55/topology/thread_siblings_list",
+		.size = 3,
+		.content = "55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "56\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "56\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "56\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "56-57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/topology/cluster_id",
+		.size = 3,
+		.content = "28\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu56/topology/thread_siblings_list",
+		.size = 3,
+		.content = "56\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "56-57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/topology/cluster_id",
+		.size = 3,
+		.content = "28\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu57/topology/thread_siblings_list",
+		.size = 3,
+		.content = "57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "58\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "58\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "58\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "58-59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/topology/cluster_id",
+		.size = 3,
+		.content = "29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu58/topology/thread_siblings_list",
+		.size = 3,
+		.content = "58\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "58-59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/topology/cluster_id",
+		.size = 3,
+		.content = "29\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu59/topology/thread_siblings_list",
+		.size = 3,
+		.content = "59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "60\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "60\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "60\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "60-61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/topology/cluster_id",
+		.size = 3,
+		.content = "30\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu60/topology/thread_siblings_list",
+		.size = 3,
+		.content = "60\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "60-61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/topology/cluster_id",
+		.size = 3,
+		.content = "30\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu61/topology/thread_siblings_list",
+		.size = 3,
+		.content = "61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "62\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "62\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "62\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "62-63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/topology/cluster_id",
+		.size = 3,
+		.content = "31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu62/topology/thread_siblings_list",
+		.size = 3,
+		.content = "62\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "62-63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/topology/cluster_id",
+		.size = 3,
+		.content = "31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu63/topology/thread_siblings_list",
+		.size = 3,
+		.content = "63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "64-65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/topology/cluster_id",
+		.size = 3,
+		.content = "32\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu64/topology/thread_siblings_list",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "64-65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/topology/cluster_id",
+		.size = 3,
+		.content = "32\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu65/topology/thread_siblings_list",
+		.size = 3,
+		.content = "65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "66\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "66\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "66\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "66-67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/topology/cluster_id",
+		.size = 3,
+		.content = "33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu66/topology/thread_siblings_list",
+		.size = 3,
+		.content = "66\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "66-67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/topology/cluster_id",
+		.size = 3,
+		.content = "33\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu67/topology/thread_siblings_list",
+		.size = 3,
+		.content = "67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "68\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "68\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "68\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "68-69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/topology/cluster_id",
+		.size = 3,
+		.content = "34\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu68/topology/thread_siblings_list",
+		.size = 3,
+		.content = "68\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "68-69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/topology/cluster_id",
+		.size = 3,
+		.content = "34\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu69/topology/thread_siblings_list",
+		.size = 3,
+		.content = "69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "70\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "70\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "70\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "70-71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/topology/cluster_id",
+		.size = 3,
+		.content = "35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu70/topology/thread_siblings_list",
+		.size = 3,
+		.content = "70\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "70-71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/topology/cluster_id",
+		.size = 3,
+		.content = "35\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu71/topology/thread_siblings_list",
+		.size = 3,
+		.content = "71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "72\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "72\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "72\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "72-73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/topology/cluster_id",
+		.size = 3,
+		.content = "36\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu72/topology/thread_siblings_list",
+		.size = 3,
+		.content = "72\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "72-73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/topology/cluster_id",
+		.size = 3,
+		.content = "36\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu73/topology/thread_siblings_list",
+		.size = 3,
+		.content = "73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "74\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "74\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "74\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "74-75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/topology/cluster_id",
+		.size = 3,
+		.content = "37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu74/topology/thread_siblings_list",
+		.size = 3,
+		.content = "74\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "74-75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/topology/cluster_id",
+		.size = 3,
+		.content = "37\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu75/topology/thread_siblings_list",
+		.size = 3,
+		.content = "75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "76\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "76\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "76\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "76-77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/topology/cluster_id",
+		.size = 3,
+		.content = "38\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu76/topology/thread_siblings_list",
+		.size = 3,
+		.content = "76\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "76-77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/topology/cluster_id",
+		.size = 3,
+		.content = "38\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu77/topology/thread_siblings_list",
+		.size = 3,
+		.content = "77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "78\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "78\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "78\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "78-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/topology/cluster_id",
+		.size = 3,
+		.content = "39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu78/topology/thread_siblings_list",
+		.size = 3,
+		.content = "78\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "78-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/topology/cluster_id",
+		.size = 3,
+		.content = "39\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/topology/core_siblings_list",
+		.size = 5,
+		.content = "0-79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu79/topology/thread_siblings_list",
+		.size = 3,
+		.content = "79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "80\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "80\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "80\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "80-81\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/topology/cluster_id",
+		.size = 3,
+		.content = "40\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu80/topology/thread_siblings_list",
+		.size = 3,
+		.content = "80\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "81\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "81\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "81\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "80-81\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/topology/cluster_id",
+		.size = 3,
+		.content = "40\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu81/topology/thread_siblings_list",
+		.size = 3,
+		.content = "81\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "82\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "82\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "82\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "82-83\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/topology/cluster_id",
+		.size = 3,
+		.content = "41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu82/topology/thread_siblings_list",
+		.size = 3,
+		.content = "82\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "83\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "83\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "83\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "82-83\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/topology/cluster_id",
+		.size = 3,
+		.content = "41\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu83/topology/thread_siblings_list",
+		.size = 3,
+		.content = "83\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "84\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "84\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "84\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "84-85\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/topology/cluster_id",
+		.size = 3,
+		.content = "42\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu84/topology/thread_siblings_list",
+		.size = 3,
+		.content = "84\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "85\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "85\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "85\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "84-85\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/topology/cluster_id",
+		.size = 3,
+		.content = "42\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu85/topology/thread_siblings_list",
+		.size = 3,
+		.content = "85\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "86\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "86\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "86\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "86-87\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/topology/cluster_id",
+		.size = 3,
+		.content = "43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu86/topology/thread_siblings_list",
+		.size = 3,
+		.content = "86\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "87\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "87\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "87\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "86-87\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/topology/cluster_id",
+		.size = 3,
+		.content = "43\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu87/topology/thread_siblings_list",
+		.size = 3,
+		.content = "87\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "88\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "88\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "88\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "88-89\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/topology/cluster_id",
+		.size = 3,
+		.content = "44\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu88/topology/thread_siblings_list",
+		.size = 3,
+		.content = "88\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "89\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "89\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "89\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "88-89\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/topology/cluster_id",
+		.size = 3,
+		.content = "44\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu89/topology/thread_siblings_list",
+		.size = 3,
+		.content = "89\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "90\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "90\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "90\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "90-91\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/topology/cluster_id",
+		.size = 3,
+		.content = "45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu90/topology/thread_siblings_list",
+		.size = 3,
+		.content = "90\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "91\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "91\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "91\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "90-91\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/topology/cluster_id",
+		.size = 3,
+		.content = "45\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu91/topology/thread_siblings_list",
+		.size = 3,
+		.content = "91\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "92\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "92\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "92\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "92-93\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/topology/cluster_id",
+		.size = 3,
+		.content = "46\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu92/topology/thread_siblings_list",
+		.size = 3,
+		.content = "92\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "93\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "93\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "93\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "92-93\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/topology/cluster_id",
+		.size = 3,
+		.content = "46\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu93/topology/thread_siblings_list",
+		.size = 3,
+		.content = "93\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "94\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "94\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "94\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "94-95\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/topology/cluster_id",
+		.size = 3,
+		.content = "47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu94/topology/thread_siblings_list",
+		.size = 3,
+		.content = "94\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "95\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "95\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "95\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "94-95\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/topology/cluster_id",
+		.size = 3,
+		.content = "47\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu95/topology/thread_siblings_list",
+		.size = 3,
+		.content = "95\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "96\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "96\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "96\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "96-97\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/topology/cluster_id",
+		.size = 3,
+		.content = "48\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu96/topology/thread_siblings_list",
+		.size = 3,
+		.content = "96\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "97\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "97\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "97\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "96-97\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/topology/cluster_id",
+		.size = 3,
+		.content = "48\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu97/topology/thread_siblings_list",
+		.size = 3,
+		.content = "97\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "98\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "98\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "98\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "98-99\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/topology/cluster_id",
+		.size = 3,
+		.content = "49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu98/topology/thread_siblings_list",
+		.size = 3,
+		.content = "98\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/shared_cpu_list",
+		.size = 3,
+		.content = "99\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/shared_cpu_list",
+		.size = 3,
+		.content = "99\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/shared_cpu_list",
+		.size = 3,
+		.content = "99\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/topology/cluster_cpus_list",
+		.size = 6,
+		.content = "98-99\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/topology/cluster_id",
+		.size = 3,
+		.content = "49\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu99/topology/thread_siblings_list",
+		.size = 3,
+		.content = "99\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "100\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "100\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "100\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "100-101\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/topology/cluster_id",
+		.size = 3,
+		.content = "50\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu100/topology/thread_siblings_list",
+		.size = 4,
+		.content = "100\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "101\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "101\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "101\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "100-101\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/topology/cluster_id",
+		.size = 3,
+		.content = "50\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu101/topology/thread_siblings_list",
+		.size = 4,
+		.content = "101\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "102\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "102\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "102\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "102-103\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/topology/cluster_id",
+		.size = 3,
+		.content = "51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu102/topology/thread_siblings_list",
+		.size = 4,
+		.content = "102\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "103\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "103\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "103\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "102-103\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/topology/cluster_id",
+		.size = 3,
+		.content = "51\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu103/topology/thread_siblings_list",
+		.size = 4,
+		.content = "103\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "104\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "104\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "104\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "104-105\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/topology/cluster_id",
+		.size = 3,
+		.content = "52\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu104/topology/thread_siblings_list",
+		.size = 4,
+		.content = "104\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "105\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "105\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "105\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "104-105\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/topology/cluster_id",
+		.size = 3,
+		.content = "52\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu105/topology/thread_siblings_list",
+		.size = 4,
+		.content = "105\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "106\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "106\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "106\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "106-107\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/topology/cluster_id",
+		.size = 3,
+		.content = "53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu106/topology/thread_siblings_list",
+		.size = 4,
+		.content = "106\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "107\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "107\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "107\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "106-107\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/topology/cluster_id",
+		.size = 3,
+		.content = "53\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu107/topology/thread_siblings_list",
+		.size = 4,
+		.content = "107\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "108\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "108\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "108\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "108-109\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/topology/cluster_id",
+		.size = 3,
+		.content = "54\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu108/topology/thread_siblings_list",
+		.size = 4,
+		.content = "108\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "109\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "109\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "109\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "108-109\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/topology/cluster_id",
+		.size = 3,
+		.content = "54\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu109/topology/thread_siblings_list",
+		.size = 4,
+		.content = "109\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "110\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "110\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "110\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "110-111\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/topology/cluster_id",
+		.size = 3,
+		.content = "55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu110/topology/thread_siblings_list",
+		.size = 4,
+		.content = "110\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "111\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "111\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "111\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "110-111\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/topology/cluster_id",
+		.size = 3,
+		.content = "55\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu111/topology/thread_siblings_list",
+		.size = 4,
+		.content = "111\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "112\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "112\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "112\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "112-113\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/topology/cluster_id",
+		.size = 3,
+		.content = "56\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu112/topology/thread_siblings_list",
+		.size = 4,
+		.content = "112\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "113\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "113\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "113\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "112-113\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/topology/cluster_id",
+		.size = 3,
+		.content = "56\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu113/topology/thread_siblings_list",
+		.size = 4,
+		.content = "113\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "114\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "114\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "114\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "114-115\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/topology/cluster_id",
+		.size = 3,
+		.content = "57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu114/topology/thread_siblings_list",
+		.size = 4,
+		.content = "114\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "115\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "115\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "115\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "114-115\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/topology/cluster_id",
+		.size = 3,
+		.content = "57\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu115/topology/thread_siblings_list",
+		.size = 4,
+		.content = "115\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "116\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "116\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "116\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "116-117\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/topology/cluster_id",
+		.size = 3,
+		.content = "58\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu116/topology/thread_siblings_list",
+		.size = 4,
+		.content = "116\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "117\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "117\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "117\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "116-117\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/topology/cluster_id",
+		.size = 3,
+		.content = "58\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu117/topology/thread_siblings_list",
+		.size = 4,
+		.content = "117\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "118\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "118\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "118\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "118-119\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/topology/cluster_id",
+		.size = 3,
+		.content = "59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu118/topology/thread_siblings_list",
+		.size = 4,
+		.content = "118\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "119\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "119\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "119\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "118-119\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/topology/cluster_id",
+		.size = 3,
+		.content = "59\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu119/topology/thread_siblings_list",
+		.size = 4,
+		.content = "119\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "120\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "120\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "120\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "120-121\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/topology/cluster_id",
+		.size = 3,
+		.content = "60\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu120/topology/thread_siblings_list",
+		.size = 4,
+		.content = "120\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "121\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "121\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "121\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "120-121\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/topology/cluster_id",
+		.size = 3,
+		.content = "60\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu121/topology/thread_siblings_list",
+		.size = 4,
+		.content = "121\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "122\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "122\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "122\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "122-123\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/topology/cluster_id",
+		.size = 3,
+		.content = "61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu122/topology/thread_siblings_list",
+		.size = 4,
+		.content = "122\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "123\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "123\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "123\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "122-123\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/topology/cluster_id",
+		.size = 3,
+		.content = "61\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu123/topology/thread_siblings_list",
+		.size = 4,
+		.content = "123\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "124\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "124\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "124\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "124-125\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/topology/cluster_id",
+		.size = 3,
+		.content = "62\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu124/topology/thread_siblings_list",
+		.size = 4,
+		.content = "124\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "125\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "125\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "125\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "124-125\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/topology/cluster_id",
+		.size = 3,
+		.content = "62\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu125/topology/thread_siblings_list",
+		.size = 4,
+		.content = "125\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "126\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "126\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "126\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "126-127\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/topology/cluster_id",
+		.size = 3,
+		.content = "63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu126/topology/thread_siblings_list",
+		.size = 4,
+		.content = "126\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "127\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "127\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "127\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "126-127\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/topology/cluster_id",
+		.size = 3,
+		.content = "63\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu127/topology/thread_siblings_list",
+		.size = 4,
+		.content = "127\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "128\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "128\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "128\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "128-129\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/topology/cluster_id",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu128/topology/thread_siblings_list",
+		.size = 4,
+		.content = "128\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "129\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "129\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "129\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "128-129\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/topology/cluster_id",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu129/topology/thread_siblings_list",
+		.size = 4,
+		.content = "129\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "130\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "130\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "130\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "130-131\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/topology/cluster_id",
+		.size = 3,
+		.content = "65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu130/topology/thread_siblings_list",
+		.size = 4,
+		.content = "130\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "131\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "131\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "131\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "130-131\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/topology/cluster_id",
+		.size = 3,
+		.content = "65\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu131/topology/thread_siblings_list",
+		.size = 4,
+		.content = "131\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "132\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "132\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "132\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "132-133\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/topology/cluster_id",
+		.size = 3,
+		.content = "66\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu132/topology/thread_siblings_list",
+		.size = 4,
+		.content = "132\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "133\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "133\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "133\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "132-133\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/topology/cluster_id",
+		.size = 3,
+		.content = "66\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu133/topology/thread_siblings_list",
+		.size = 4,
+		.content = "133\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "134\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "134\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "134\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "134-135\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/topology/cluster_id",
+		.size = 3,
+		.content = "67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu134/topology/thread_siblings_list",
+		.size = 4,
+		.content = "134\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "135\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "135\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "135\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "134-135\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/topology/cluster_id",
+		.size = 3,
+		.content = "67\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu135/topology/thread_siblings_list",
+		.size = 4,
+		.content = "135\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "136\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "136\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "136\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "136-137\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/topology/cluster_id",
+		.size = 3,
+		.content = "68\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu136/topology/thread_siblings_list",
+		.size = 4,
+		.content = "136\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "137\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "137\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "137\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "136-137\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/topology/cluster_id",
+		.size = 3,
+		.content = "68\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu137/topology/thread_siblings_list",
+		.size = 4,
+		.content = "137\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "138\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "138\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "138\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "138-139\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/topology/cluster_id",
+		.size = 3,
+		.content = "69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu138/topology/thread_siblings_list",
+		.size = 4,
+		.content = "138\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "139\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "139\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "139\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "138-139\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/topology/cluster_id",
+		.size = 3,
+		.content = "69\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu139/topology/thread_siblings_list",
+		.size = 4,
+		.content = "139\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "140\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "140\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "140\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "140-141\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/topology/cluster_id",
+		.size = 3,
+		.content = "70\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu140/topology/thread_siblings_list",
+		.size = 4,
+		.content = "140\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "141\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "141\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "141\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "140-141\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/topology/cluster_id",
+		.size = 3,
+		.content = "70\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu141/topology/thread_siblings_list",
+		.size = 4,
+		.content = "141\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "142\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "142\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "142\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "142-143\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/topology/cluster_id",
+		.size = 3,
+		.content = "71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu142/topology/thread_siblings_list",
+		.size = 4,
+		.content = "142\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "143\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "143\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "143\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "142-143\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/topology/cluster_id",
+		.size = 3,
+		.content = "71\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu143/topology/thread_siblings_list",
+		.size = 4,
+		.content = "143\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "144\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "144\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "144\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "144-145\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/topology/cluster_id",
+		.size = 3,
+		.content = "72\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu144/topology/thread_siblings_list",
+		.size = 4,
+		.content = "144\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "145\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "145\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "145\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "144-145\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/topology/cluster_id",
+		.size = 3,
+		.content = "72\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu145/topology/thread_siblings_list",
+		.size = 4,
+		.content = "145\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "146\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "146\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "146\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "146-147\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/topology/cluster_id",
+		.size = 3,
+		.content = "73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu146/topology/thread_siblings_list",
+		.size = 4,
+		.content = "146\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "147\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "147\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "147\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "146-147\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/topology/cluster_id",
+		.size = 3,
+		.content = "73\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu147/topology/thread_siblings_list",
+		.size = 4,
+		.content = "147\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "148\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "148\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "148\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "148-149\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/topology/cluster_id",
+		.size = 3,
+		.content = "74\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu148/topology/thread_siblings_list",
+		.size = 4,
+		.content = "148\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "149\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "149\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "149\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "148-149\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/topology/cluster_id",
+		.size = 3,
+		.content = "74\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu149/topology/thread_siblings_list",
+		.size = 4,
+		.content = "149\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "150\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "150\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "150\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "150-151\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/topology/cluster_id",
+		.size = 3,
+		.content = "75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu150/topology/thread_siblings_list",
+		.size = 4,
+		.content = "150\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "151\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "151\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "151\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "150-151\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/topology/cluster_id",
+		.size = 3,
+		.content = "75\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu151/topology/thread_siblings_list",
+		.size = 4,
+		.content = "151\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "152\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "152\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "152\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "152-153\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/topology/cluster_id",
+		.size = 3,
+		.content = "76\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu152/topology/thread_siblings_list",
+		.size = 4,
+		.content = "152\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "153\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "153\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "153\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "152-153\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/topology/cluster_id",
+		.size = 3,
+		.content = "76\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu153/topology/thread_siblings_list",
+		.size = 4,
+		.content = "153\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "154\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "154\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "154\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "154-155\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/topology/cluster_id",
+		.size = 3,
+		.content = "77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu154/topology/thread_siblings_list",
+		.size = 4,
+		.content = "154\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "155\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "155\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "155\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "154-155\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/topology/cluster_id",
+		.size = 3,
+		.content = "77\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu155/topology/thread_siblings_list",
+		.size = 4,
+		.content = "155\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "156\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "156\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "156\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "156-157\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/topology/cluster_id",
+		.size = 3,
+		.content = "78\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu156/topology/thread_siblings_list",
+		.size = 4,
+		.content = "156\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "157\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "157\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "157\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "156-157\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/topology/cluster_id",
+		.size = 3,
+		.content = "78\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu157/topology/thread_siblings_list",
+		.size = 4,
+		.content = "157\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "158\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "158\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "158\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "158-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/topology/cluster_id",
+		.size = 3,
+		.content = "79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu158/topology/thread_siblings_list",
+		.size = 4,
+		.content = "158\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cpufreq/cpuinfo_min_freq",
+		.size = 8,
+		.content = "1000000\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/shared_cpu_list",
+		.size = 4,
+		.content = "159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/shared_cpu_list",
+		.size = 4,
+		.content = "159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/shared_cpu_list",
+		.size = 4,
+		.content = "159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/topology/cluster_cpus_list",
+		.size = 8,
+		.content = "158-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/topology/cluster_id",
+		.size = 3,
+		.content = "79\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/topology/core_siblings_list",
+		.size = 7,
+		.content = "80-159\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/topology/physical_package_id",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu159/topology/thread_siblings_list",
+		.size = 4,
+		.content = "159\n",
+	},
+	{ NULL },
+};
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <stddef.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/*
+ * Core i9-12900K with AVX-512 enabled on the P-cores only. Production firmware disables AVX-512 while E-cores are
+ * enabled; this synthetic configuration makes clusters differ in ISA: the global ISA must be restricted to their
+ * intersection, and each cluster must keep its own features.
+ */
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(2, cpuinfo_get_clusters_count());
+}
+
+TEST(CLUSTERS, isa) {
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0));
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0)->avx512f);
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0)->avx512cd);
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0)->avx512dq);
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0)->avx512bw);
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0)->avx512vl);
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(0)->avx2);
+
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(1));
+	ASSERT_FALSE(cpuinfo_get_cluster_isa(1)->avx512f);
+	ASSERT_FALSE(cpuinfo_get_cluster_isa(1)->avx512cd);
+	ASSERT_FALSE(cpuinfo_get_cluster_isa(1)->avx512dq);
+	ASSERT_FALSE(cpuinfo_get_cluster_isa(1)->avx512bw);
+	ASSERT_FALSE(cpuinfo_get_cluster_isa(1)->avx512vl);
+	ASSERT_TRUE(cpuinfo_get_cluster_isa(1)->avx2);
+}
+
+TEST(ISA, intersection) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512f());
+	ASSERT_FALSE(cpuinfo_has_x86_avx512cd());
+	ASSERT_FALSE(cpuinfo_has_x86_avx512dq());
+	ASSERT_FALSE(cpuinfo_has_x86_avx512bw());
+	ASSERT_FALSE(cpuinfo_has_x86_avx512vl());
+	ASSERT_TRUE(cpuinfo_has_x86_avx2());
+	ASSERT_TRUE(cpuinfo_has_x86_avxvnni());
+}
+
+TEST(THROUGHPUT, cluster_isa) {
+	struct cpuinfo_throughput p_core, e_core;
+	ASSERT_TRUE(cpuinfo_get_core_throughput(cpuinfo_get_core(0), &p_core));
+	ASSERT_TRUE(cpuinfo_get_core_throughput(cpuinfo_get_core(8), &e_core));
+	/* Golden Cove: 2 FMA units, 512-bit with AVX-512 on the P-core cluster */
+	ASSERT_EQ(2 * 16 * 2, p_core.fp32_ops_per_cycle);
+	/* Gracemont: 2 FMA units, 128-bit */
+	ASSERT_EQ(2 * 4 * 2, e_core.fp32_ops_per_cycle);
+}
+
+TEST(THROUGHPUT, int8_dot_product) {
+	struct cpuinfo_throughput e_core;
+	ASSERT_TRUE(cpuinfo_get_core_throughput(cpuinfo_get_core(8), &e_core));
+	/* AVX-VNNI: 4 8-bit multiply-accumulate operations in each 32-bit lane of 2 128-bit units */
+	ASSERT_EQ(2 * 4 * 8, e_core.int8_ops_per_cycle);
+}
+
+TEST(ISA_BITS, cluster) {
+	cpuinfo_isa_bits required = { { 0 } };
+	cpuinfo_isa_bits_add(&required, cpuinfo_isa_x86_avx512f);
+	ASSERT_FALSE(cpuinfo_isa_has_all(&required));
+}
+
+#include <core-i9-12900k.h>
+
+/* Sets bits in the registers of the CPUID leaf of a CPUID dump */
+static void set_cpuid_bits(
+	struct cpuinfo_mock_cpuid* dump, size_t entries,
+	uint32_t input_eax, uint32_t input_ecx, uint32_t eax, uint32_t ebx)
+{
+	for (size_t i = 0; i < entries; i++) {
+		if (dump[i].input_eax == input_eax && dump[i].input_ecx == input_ecx) {
+			dump[i].eax |= eax;
+			dump[i].ebx |= ebx;
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	const size_t entries = sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid);
+	/* AVX512F, AVX512DQ, AVX512CD, AVX512BW, AVX512VL */
+	set_cpuid_bits(cpuid_dump, entries, 0x00000007, 0, 0, UINT32_C(0xD0030000));
+	/* Opmask, ZMM_Hi256, Hi16_ZMM state components */
+	set_cpuid_bits(cpuid_dump, entries, 0x0000000D, 0, UINT32_C(0x000000E0), 0);
+
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, entries);
+	/* The calling thread starts on a P-core; logical processors 16-23 are E-cores */
+	for (uint32_t i = 16; i < 24; i++) {
+		cpuinfo_mock_set_processor_cpuid(i, cpuid_dump_atom, sizeof(cpuid_dump_atom) / sizeof(cpuinfo_mock_cpuid));
+	}
+	/* x87, SSE, AVX, opmask, ZMM, PKRU state components */
+	cpuinfo_mock_set_xcr0(UINT64_C(0x00000000000002E7));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <stddef.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/*
+ * Core i9-12900K with every logical processor reporting the CPUID of the P-cores, as on a non-hybrid processor. All
+ * cores form a single cluster, which must still report the maximum frequency from cpufreq.
+ */
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(1, cpuinfo_get_clusters_count());
+}
+
+TEST(CLUSTERS, frequency) {
+	ASSERT_EQ(UINT64_C(5200000000), cpuinfo_get_cluster(0)->frequency);
+}
+
+TEST(CORES, frequency) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(UINT64_C(5200000000), cpuinfo_get_core(i)->frequency);
+	}
+}
+
+TEST(THROUGHPUT, per_second) {
+	struct cpuinfo_throughput throughput;
+	ASSERT_TRUE(cpuinfo_get_package_throughput(cpuinfo_get_package(0), &throughput));
+	ASSERT_EQ(UINT64_C(5200000000), throughput.frequency);
+	ASSERT_NE(0, throughput.fp32_ops_per_second);
+	ASSERT_EQ(throughput.fp32_ops_per_cycle * throughput.frequency, throughput.fp32_ops_per_second);
+}
+
+#include <core-i9-12900k.h>
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	/* x87, SSE, AVX, PKRU state components */
+	cpuinfo_mock_set_xcr0(UINT64_C(0x0000000000000207));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
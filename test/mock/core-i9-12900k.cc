@@ -0,0 +1,329 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(24, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, non_null) {
+	ASSERT_TRUE(cpuinfo_get_processors());
+}
+
+TEST(PROCESSORS, smt_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		if (i < 16) {
+			ASSERT_EQ(i % 2, cpuinfo_get_processor(i)->smt_id);
+		} else {
+			ASSERT_EQ(0, cpuinfo_get_processor(i)->smt_id);
+		}
+	}
+}
+
+TEST(PROCESSORS, core) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		if (i < 16) {
+			ASSERT_EQ(cpuinfo_get_core(i / 2), cpuinfo_get_processor(i)->core);
+		} else {
+			ASSERT_EQ(cpuinfo_get_core(i - 8), cpuinfo_get_processor(i)->core);
+		}
+	}
+}
+
+TEST(PROCESSORS, cluster) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_cluster(i < 16 ? 0 : 1), cpuinfo_get_processor(i)->cluster);
+	}
+}
+
+TEST(PROCESSORS, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(0), cpuinfo_get_processor(i)->package);
+	}
+}
+
+TEST(PROCESSORS, linux_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_processor(i)->linux_id);
+	}
+}
+
+TEST(PROCESSORS, apic_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		if (i < 16) {
+			ASSERT_EQ(i, cpuinfo_get_processor(i)->apic_id);
+		} else {
+			ASSERT_EQ(32 + (i - 16) * 2, cpuinfo_get_processor(i)->apic_id);
+		}
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(16, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, processor_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(i < 8 ? 2 : 1, cpuinfo_get_core(i)->processor_count);
+	}
+}
+
+TEST(CORES, cluster) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_cluster(i < 8 ? 0 : 1), cpuinfo_get_core(i)->cluster);
+	}
+}
+
+TEST(CORES, uarch) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		if (i < 8) {
+			ASSERT_EQ(cpuinfo_uarch_golden_cove, cpuinfo_get_core(i)->uarch);
+		} else {
+			ASSERT_EQ(cpuinfo_uarch_gracemont, cpuinfo_get_core(i)->uarch);
+		}
+	}
+}
+
+TEST(CORES, frequency) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(i < 8 ? UINT64_C(5200000000) : UINT64_C(3900000000), cpuinfo_get_core(i)->frequency);
+	}
+}
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(2, cpuinfo_get_clusters_count());
+}
+
+TEST(CLUSTERS, cluster_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_cluster(i)->cluster_id);
+	}
+}
+
+TEST(CLUSTERS, processors) {
+	ASSERT_EQ(0, cpuinfo_get_cluster(0)->processor_start);
+	ASSERT_EQ(16, cpuinfo_get_cluster(0)->processor_count);
+	ASSERT_EQ(16, cpuinfo_get_cluster(1)->processor_start);
+	ASSERT_EQ(8, cpuinfo_get_cluster(1)->processor_count);
+}
+
+TEST(CLUSTERS, cores) {
+	ASSERT_EQ(0, cpuinfo_get_cluster(0)->core_start);
+	ASSERT_EQ(8, cpuinfo_get_cluster(0)->core_count);
+	ASSERT_EQ(8, cpuinfo_get_cluster(1)->core_start);
+	ASSERT_EQ(8, cpuinfo_get_cluster(1)->core_count);
+}
+
+TEST(CLUSTERS, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_golden_cove, cpuinfo_get_cluster(0)->uarch);
+	ASSERT_EQ(cpuinfo_uarch_gracemont, cpuinfo_get_cluster(1)->uarch);
+}
+
+TEST(CLUSTERS, cpuid) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		ASSERT_EQ(UINT32_C(0x00090672), cpuinfo_get_cluster(i)->cpuid);
+	}
+}
+
+TEST(CLUSTERS, frequency) {
+	ASSERT_EQ(UINT64_C(5200000000), cpuinfo_get_cluster(0)->frequency);
+	ASSERT_EQ(UINT64_C(3900000000), cpuinfo_get_cluster(1)->frequency);
+}
+
+TEST(CLUSTERS, isa) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		ASSERT_TRUE(cpuinfo_get_cluster_isa(i));
+		ASSERT_TRUE(cpuinfo_get_cluster_isa(i)->avx2);
+		ASSERT_TRUE(cpuinfo_get_cluster_isa(i)->avxvnni);
+		ASSERT_FALSE(cpuinfo_get_cluster_isa(i)->avx512f);
+	}
+}
+
+TEST(CORE_CLASSES, count) {
+	ASSERT_EQ(2, cpuinfo_get_core_classes_count());
+}
+
+TEST(CORE_CLASSES, clusters) {
+	ASSERT_EQ(cpuinfo_get_cluster(0), cpuinfo_get_cluster_by_performance(0));
+	ASSERT_EQ(cpuinfo_get_cluster(1), cpuinfo_get_cluster_by_performance(1));
+	for (uint32_t i = 0; i < cpuinfo_get_core_classes_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_core_class(i)->cluster_start);
+		ASSERT_EQ(1, cpuinfo_get_core_class(i)->cluster_count);
+	}
+}
+
+TEST(CORE_CLASSES, processors) {
+	ASSERT_EQ(16, cpuinfo_get_core_class(0)->processor_count);
+	ASSERT_EQ(8, cpuinfo_get_core_class(1)->processor_count);
+	ASSERT_EQ(cpuinfo_get_processor(0), cpuinfo_get_core_class(0)->processors[0]);
+	ASSERT_EQ(cpuinfo_get_processor(16), cpuinfo_get_core_class(1)->processors[0]);
+}
+
+TEST(CORE_CLASSES, performance) {
+	ASSERT_EQ(1024, cpuinfo_get_core_class(0)->performance);
+	ASSERT_EQ(320, cpuinfo_get_core_class(1)->performance);
+}
+
+TEST(CORES, core_class) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(i < 8 ? 0 : 1, cpuinfo_get_core(i)->core_class);
+	}
+}
+
+TEST(PACKAGES, count) {
+	ASSERT_EQ(1, cpuinfo_get_packages_count());
+}
+
+TEST(PACKAGES, name) {
+	ASSERT_EQ("Intel 12th Gen Core i9-12900K",
+		std::string(cpuinfo_get_package(0)->name,
+			strnlen(cpuinfo_get_package(0)->name, CPUINFO_PACKAGE_NAME_MAX)));
+}
+
+TEST(PACKAGES, processors) {
+	ASSERT_EQ(0, cpuinfo_get_package(0)->processor_start);
+	ASSERT_EQ(24, cpuinfo_get_package(0)->processor_count);
+}
+
+TEST(PACKAGES, cores) {
+	ASSERT_EQ(0, cpuinfo_get_package(0)->core_start);
+	ASSERT_EQ(16, cpuinfo_get_package(0)->core_count);
+}
+
+TEST(PACKAGES, clusters) {
+	ASSERT_EQ(0, cpuinfo_get_package(0)->cluster_start);
+	ASSERT_EQ(2, cpuinfo_get_package(0)->cluster_count);
+}
+
+TEST(ISA, avx2) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx2());
+}
+
+TEST(ISA, avxvnni) {
+	ASSERT_TRUE(cpuinfo_has_x86_avxvnni());
+}
+
+TEST(ISA, avx512f) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512f());
+}
+
+TEST(ISA, sha) {
+	ASSERT_TRUE(cpuinfo_has_x86_sha());
+}
+
+TEST(ISA, gfni) {
+	ASSERT_TRUE(cpuinfo_has_x86_gfni());
+}
+
+TEST(XSAVE, non_null) {
+	ASSERT_TRUE(cpuinfo_get_x86_xsave());
+}
+
+TEST(XSAVE, enabled_components) {
+	ASSERT_EQ(UINT64_C(0x0000000000000207), cpuinfo_get_x86_xsave()->enabled_components);
+}
+
+TEST(XSAVE, size) {
+	ASSERT_EQ(2696, cpuinfo_get_x86_xsave()->size);
+	ASSERT_EQ(2696, cpuinfo_get_x86_xsave()->max_size);
+}
+
+TEST(XSAVE, compacted_size) {
+	ASSERT_EQ(840, cpuinfo_get_x86_xsave()->compacted_size);
+}
+
+TEST(XSAVE, components) {
+	const struct cpuinfo_x86_xsave* xsave = cpuinfo_get_x86_xsave();
+	ASSERT_EQ(160, xsave->components[0].size);
+	ASSERT_EQ(256, xsave->components[1].size);
+	ASSERT_EQ(160, xsave->components[1].offset);
+	ASSERT_EQ(256, xsave->components[2].size);
+	ASSERT_EQ(576, xsave->components[2].offset);
+	ASSERT_EQ(8, xsave->components[9].size);
+	ASSERT_EQ(2688, xsave->components[9].offset);
+}
+
+TEST(L1I, count) {
+	ASSERT_EQ(16, cpuinfo_get_l1i_caches_count());
+}
+
+TEST(L1I, size) {
+	for (uint32_t i = 0; i < cpuinfo_get_l1i_caches_count(); i++) {
+		ASSERT_EQ(i < 8 ? 32 * 1024 : 64 * 1024, cpuinfo_get_l1i_cache(i)->size);
+	}
+}
+
+TEST(L1D, count) {
+	ASSERT_EQ(16, cpuinfo_get_l1d_caches_count());
+}
+
+TEST(L1D, size) {
+	for (uint32_t i = 0; i < cpuinfo_get_l1d_caches_count(); i++) {
+		ASSERT_EQ(i < 8 ? 48 * 1024 : 32 * 1024, cpuinfo_get_l1d_cache(i)->size);
+	}
+}
+
+TEST(L1D, processors) {
+	for (uint32_t i = 0; i < cpuinfo_get_l1d_caches_count(); i++) {
+		ASSERT_EQ(i < 8 ? i * 2 : i + 8, cpuinfo_get_l1d_cache(i)->processor_start);
+		ASSERT_EQ(i < 8 ? 2 : 1, cpuinfo_get_l1d_cache(i)->processor_count);
+	}
+}
+
+TEST(L2, count) {
+	ASSERT_EQ(10, cpuinfo_get_l2_caches_count());
+}
+
+TEST(L2, size) {
+	for (uint32_t i = 0; i < cpuinfo_get_l2_caches_count(); i++) {
+		ASSERT_EQ(i < 8 ? 1280 * 1024 : 2 * 1024 * 1024, cpuinfo_get_l2_cache(i)->size);
+	}
+}
+
+TEST(L2, processors) {
+	for (uint32_t i = 0; i < cpuinfo_get_l2_caches_count(); i++) {
+		if (i < 8) {
+			ASSERT_EQ(i * 2, cpuinfo_get_l2_cache(i)->processor_start);
+			ASSERT_EQ(2, cpuinfo_get_l2_cache(i)->processor_count);
+		} else {
+			ASSERT_EQ(16 + (i - 8) * 4, cpuinfo_get_l2_cache(i)->processor_start);
+			ASSERT_EQ(4, cpuinfo_get_l2_cache(i)->processor_count);
+		}
+	}
+}
+
+TEST(L3, count) {
+	ASSERT_EQ(1, cpuinfo_get_l3_caches_count());
+}
+
+TEST(L3, size) {
+	ASSERT_EQ(30 * 1024 * 1024, cpuinfo_get_l3_cache(0)->size);
+}
+
+TEST(L3, processors) {
+	ASSERT_EQ(0, cpuinfo_get_l3_cache(0)->processor_start);
+	ASSERT_EQ(24, cpuinfo_get_l3_cache(0)->processor_count);
+}
+
+TEST(L4, none) {
+	ASSERT_EQ(0, cpuinfo_get_l4_caches_count());
+	ASSERT_FALSE(cpuinfo_get_l4_caches());
+}
+
+#include <core-i9-12900k.h>
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	/* The calling thread starts on a P-core; logical processors 16-23 are E-cores */
+	for (uint32_t i = 16; i < 24; i++) {
+		cpuinfo_mock_set_processor_cpuid(i, cpuid_dump_atom, sizeof(cpuid_dump_atom) / sizeof(cpuinfo_mock_cpuid));
+	}
+	/* x87, SSE, AVX, PKRU state components */
+	cpuinfo_mock_set_xcr0(UINT64_C(0x0000000000000207));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
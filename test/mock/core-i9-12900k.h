@@ -0,0 +1,1548 @@
+struct cpuinfo_mock_cpuid cpuid_dump[] = {
+	{
+		.input_eax = 0x00000000,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000020,
+		.ebx = 0x756E6547,
+		.ecx = 0x6C65746E,
+		.edx = 0x49656E69,
+	},
+	{
+		.input_eax = 0x00000001,
+		.input_ecx = 0x00000000,
+		.eax = 0x00090672,
+		.ebx = 0x00800800,
+		.ecx = 0x7FFAFBFF,
+		.edx = 0xBFEBFBFF,
+	},
+	{
+		.input_eax = 0x00000002,
+		.input_ecx = 0x00000000,
+		.eax = 0x00FEFF01,
+		.ebx = 0x000000F0,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000000,
+		.eax = 0xFC004121,
+		.ebx = 0x02C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000001,
+		.eax = 0xFC004122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000002,
+		.eax = 0xFC004143,
+		.ebx = 0x0240003F,
+		.ecx = 0x000007FF,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000003,
+		.eax = 0xFC1FC163,
+		.ebx = 0x02C0003F,
+		.ecx = 0x00009FFF,
+		.edx = 0x00000004,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000005,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000040,
+		.ebx = 0x00000040,
+		.ecx = 0x00000003,
+		.edx = 0x10102020,
+	},
+	{
+		.input_eax = 0x00000006,
+		.input_ecx = 0x00000000,
+		.eax = 0x00DF8FF7,
+		.ebx = 0x00000002,
+		.ecx = 0x00000409,
+		.edx = 0x00000003,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000002,
+		.ebx = 0x239C07A9,
+		.ecx = 0x1A4007A4,
+		.edx = 0xBC1CC410,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000001,
+		.eax = 0x00400810,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000007,
+		.ebx = 0x00000018,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000002,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000207,
+		.ebx = 0x00000A88,
+		.ecx = 0x00000A88,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000001,
+		.eax = 0x0000000F,
+		.ebx = 0x00000A88,
+		.ecx = 0x00019900,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000100,
+		.ebx = 0x00000240,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000008,
+		.eax = 0x00000080,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000009,
+		.eax = 0x00000008,
+		.ebx = 0x00000A80,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000B,
+		.eax = 0x00000010,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000C,
+		.eax = 0x00000018,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000F,
+		.eax = 0x00000328,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000010,
+		.eax = 0x00000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001A,
+		.input_ecx = 0x00000000,
+		.eax = 0x40000001,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.input_ecx = 0x00000000,
+		.eax = 0x80000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000001,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000121,
+		.edx = 0x2C100800,
+	},
+	{
+		.input_eax = 0x80000002,
+		.input_ecx = 0x00000000,
+		.eax = 0x68743231,
+		.ebx = 0x6E654720,
+		.ecx = 0x746E4920,
+		.edx = 0x52286C65,
+	},
+	{
+		.input_eax = 0x80000003,
+		.input_ecx = 0x00000000,
+		.eax = 0x6F432029,
+		.ebx = 0x54286572,
+		.ecx = 0x6920294D,
+		.edx = 0x32312D39,
+	},
+	{
+		.input_eax = 0x80000004,
+		.input_ecx = 0x00000000,
+		.eax = 0x4B303039,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000006,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x05007040,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000100,
+	},
+	{
+		.input_eax = 0x80000008,
+		.input_ecx = 0x00000000,
+		.eax = 0x00003027,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+struct cpuinfo_mock_cpuid cpuid_dump_atom[] = {
+	{
+		.input_eax = 0x00000000,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000020,
+		.ebx = 0x756E6547,
+		.ecx = 0x6C65746E,
+		.edx = 0x49656E69,
+	},
+	{
+		.input_eax = 0x00000001,
+		.input_ecx = 0x00000000,
+		.eax = 0x00090672,
+		.ebx = 0x20800800,
+		.ecx = 0x7FFAFBFF,
+		.edx = 0xBFEBFBFF,
+	},
+	{
+		.input_eax = 0x00000002,
+		.input_ecx = 0x00000000,
+		.eax = 0x00FEFF01,
+		.ebx = 0x000000F0,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000000,
+		.eax = 0xFC000121,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000001,
+		.eax = 0xFC000122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000007F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000002,
+		.eax = 0xFC01C143,
+		.ebx = 0x03C0003F,
+		.ecx = 0x000007FF,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000003,
+		.eax = 0xFC1FC163,
+		.ebx = 0x02C0003F,
+		.ecx = 0x00009FFF,
+		.edx = 0x00000004,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000005,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000040,
+		.ebx = 0x00000040,
+		.ecx = 0x00000003,
+		.edx = 0x10102020,
+	},
+	{
+		.input_eax = 0x00000006,
+		.input_ecx = 0x00000000,
+		.eax = 0x00DF8FF7,
+		.ebx = 0x00000002,
+		.ecx = 0x00000409,
+		.edx = 0x00000003,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000002,
+		.ebx = 0x239C07A9,
+		.ecx = 0x1A4007A4,
+		.edx = 0xBC1CC410,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000001,
+		.eax = 0x00400810,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000001,
+		.ecx = 0x00000100,
+		.edx = 0x00000020,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000007,
+		.ebx = 0x00000018,
+		.ecx = 0x00000201,
+		.edx = 0x00000020,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000002,
+		.edx = 0x00000020,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000207,
+		.ebx = 0x00000A88,
+		.ecx = 0x00000A88,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000001,
+		.eax = 0x0000000F,
+		.ebx = 0x00000A88,
+		.ecx = 0x00019900,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000100,
+		.ebx = 0x00000240,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000008,
+		.eax = 0x00000080,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000009,
+		.eax = 0x00000008,
+		.ebx = 0x00000A80,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000B,
+		.eax = 0x00000010,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000C,
+		.eax = 0x00000018,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000F,
+		.eax = 0x00000328,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000010,
+		.eax = 0x00000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001A,
+		.input_ecx = 0x00000000,
+		.eax = 0x20000001,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.input_ecx = 0x00000000,
+		.eax = 0x80000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000001,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000121,
+		.edx = 0x2C100800,
+	},
+	{
+		.input_eax = 0x80000002,
+		.input_ecx = 0x00000000,
+		.eax = 0x68743231,
+		.ebx = 0x6E654720,
+		.ecx = 0x746E4920,
+		.edx = 0x52286C65,
+	},
+	{
+		.input_eax = 0x80000003,
+		.input_ecx = 0x00000000,
+		.eax = 0x6F432029,
+		.ebx = 0x54286572,
+		.ecx = 0x6920294D,
+		.edx = 0x32312D39,
+	},
+	{
+		.input_eax = 0x80000004,
+		.input_ecx = 0x00000000,
+		.eax = 0x4B303039,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000006,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x05007040,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000100,
+	},
+	{
+		.input_eax = 0x80000008,
+		.input_ecx = 0x00000000,
+		.eax = 0x00003027,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 40524,
+		.content =
+			"processor\t: 0\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 0\n"
+			"initial apicid\t: 0\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 1\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 1\n"
+			"initial apicid\t: 1\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 2\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 2\n"
+			"initial apicid\t: 2\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 3\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 3\n"
+			"initial apicid\t: 3\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 4\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 8\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 4\n"
+			"initial apicid\t: 4\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 5\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 8\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 5\n"
+			"initial apicid\t: 5\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 6\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 12\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 6\n"
+			"initial apicid\t: 6\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 7\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 12\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 7\n"
+			"initial apicid\t: 7\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 8\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 16\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 8\n"
+			"initial apicid\t: 8\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 9\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 16\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 9\n"
+			"initial apicid\t: 9\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 10\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 20\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 10\n"
+			"initial apicid\t: 10\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 11\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 20\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 11\n"
+			"initial apicid\t: 11\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 12\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 24\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 12\n"
+			"initial apicid\t: 12\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 13\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 24\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 13\n"
+			"initial apicid\t: 13\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 14\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 28\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 14\n"
+			"initial apicid\t: 14\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 15\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 28\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 15\n"
+			"initial apicid\t: 15\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 16\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 32\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 32\n"
+			"initial apicid\t: 32\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 17\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 33\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 34\n"
+			"initial apicid\t: 34\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 18\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 34\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 36\n"
+			"initial apicid\t: 36\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 19\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 35\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 38\n"
+			"initial apicid\t: 38\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 20\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 36\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 40\n"
+			"initial apicid\t: 40\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 21\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 37\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 42\n"
+			"initial apicid\t: 42\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 22\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 38\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 44\n"
+			"initial apicid\t: 44\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 23\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 151\n"
+			"model name\t: 12th Gen Intel(R) Core(TM) i9-12900K\n"
+			"stepping\t: 2\n"
+			"microcode\t: 0x2c\n"
+			"cpu MHz\t\t: 3200.000\n"
+			"cache size\t: 30720 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 24\n"
+			"core id\t\t: 39\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 46\n"
+			"initial apicid\t: 46\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm constant_tsc art arch_perfmon pebs bts rep_good nopl xtopology nonstop_tsc cpuid aperfmperf tsc_known_freq pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 sdbg fma cx16 xtpr pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand lahf_lm abm 3dnowprefetch cpuid_fault epb ssbd ibrs ibpb stibp ibrs_enhanced tpr_shadow flexpriority ept vpid ept_ad fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid rdseed adx smap clflushopt clwb intel_pt sha_ni xsaveopt xsavec xgetbv1 xsaves split_lock_detect avx_vnni dtherm ida arat pln pts hwp hwp_notify hwp_act_window hwp_epp hwp_pkg_req hfi umip pku ospke waitpkg gfni vaes vpclmulqdq rdpid movdiri movdir64b fsrm md_clear serialize pconfig arch_lbr ibt flush_l1d arch_capabilities\n"
+			"vmx flags\t: vnmi preemption_timer posted_intr invvpid ept_x_only ept_ad ept_1gb flexpriority apicv tsc_offset vtpr mtf vapic ept vpid unrestricted_guest vapic_reg vid ple shadow_vmcs ept_mode_based_exec tsc_scaling usr_wait_pause\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs eibrs_pbrsb\n"
+			"bogomips\t: 6374.40\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 48 bits virtual\n"
+			"power management:\n"
+			"\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 5,
+		.content = "8191\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 5,
+		.content = "0-23\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 5,
+		.content = "0-23\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 5,
+		.content = "0-23\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/cpu_atom/cpus",
+		.size = 6,
+		.content = "16-23\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/cpu_core/cpus",
+		.size = 5,
+		.content = "0-15\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu8/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu9/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu10/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu11/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu12/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu13/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu14/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "5200000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu15/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu16/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu17/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu18/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu19/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu20/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu21/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu22/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cpufreq/cpuinfo_max_freq",
+		.size = 8,
+		.content = "3900000\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu23/cpufreq/cpuinfo_min_freq",
+		.size = 7,
+		.content = "800000\n",
+		.offset = 0,
+	},
+	{
+		.path = NULL,
+		.size = 0,
+		.content = NULL,
+		.offset = 0,
+	},
+};
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+#include <corpus.h>
+
+
+/*
+ * Initializes cpuinfo on every dump in the corpus (see corpus.h), and checks that the detected topology is consistent.
+ * Expectations specific to a device remain in its own test. cpuinfo_deinitialize() resets the library between dumps,
+ * so all dumps are initialized in this process.
+ */
+
+/* Returns an empty string if the topology is consistent, or the description of the first inconsistency */
+static std::string check_topology() {
+	std::ostringstream error;
+	const uint32_t processors_count = cpuinfo_get_processors_count();
+	const uint32_t cores_count = cpuinfo_get_cores_count();
+	const uint32_t clusters_count = cpuinfo_get_clusters_count();
+	const uint32_t packages_count = cpuinfo_get_packages_count();
+	if (processors_count == 0 || cores_count == 0 || clusters_count == 0 || packages_count == 0) {
+		error << processors_count << " processors, " << cores_count << " cores, " <<
+			clusters_count << " clusters, " << packages_count << " packages";
+		return error.str();
+	}
+	if (cores_count > processors_count || clusters_count > cores_count) {
+		error << "more cores or clusters than processors: " << processors_count << " processors, " <<
+			cores_count << " cores, " << clusters_count << " clusters";
+		return error.str();
+	}
+
+	for (uint32_t i = 0; i < processors_count; i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		const cpuinfo_core* core = processor->core;
+		if (core == nullptr || processor->cluster == nullptr || processor->package == nullptr) {
+			error << "processor " << i << " has no core, cluster, or package";
+			return error.str();
+		}
+		if (i < core->processor_start || i - core->processor_start >= core->processor_count) {
+			error << "processor " << i << " is outside of processors of its core";
+			return error.str();
+		}
+		if (core->cluster != processor->cluster || core->package != processor->package) {
+			error << "processor " << i << " and its core are in different clusters or packages";
+			return error.str();
+		}
+		const cpuinfo_cache* caches[] = {
+			processor->cache.l1i, processor->cache.l1d, processor->cache.l2, processor->cache.l3, processor->cache.l4,
+		};
+		const char* cache_names[] = { "L1I", "L1D", "L2", "L3", "L4" };
+		for (size_t c = 0; c < sizeof(caches) / sizeof(caches[0]); c++) {
+			const cpuinfo_cache* cache = caches[c];
+			if (cache != nullptr && (i < cache->processor_start || i - cache->processor_start >= cache->processor_count)) {
+				error << "processor " << i << " is outside of processors of its " << cache_names[c] << " cache";
+				return error.str();
+			}
+		}
+	}
+
+	uint32_t core_processors = 0, cluster_cores = 0, package_cores = 0;
+	for (uint32_t i = 0; i < cores_count; i++) {
+		core_processors += cpuinfo_get_core(i)->processor_count;
+	}
+	for (uint32_t i = 0; i < clusters_count; i++) {
+		cluster_cores += cpuinfo_get_cluster(i)->core_count;
+	}
+	for (uint32_t i = 0; i < packages_count; i++) {
+		package_cores += cpuinfo_get_package(i)->core_count;
+	}
+	if (core_processors != processors_count || cluster_cores != cores_count || package_cores != cores_count) {
+		error << "cores cover " << core_processors << " processors, clusters cover " << cluster_cores << " cores, " <<
+			"packages cover " << package_cores << " cores";
+		return error.str();
+	}
+	if (cpuinfo_get_core_classes_count() == 0) {
+		return "no core classes";
+	}
+	return std::string();
+}
+
+/* Summarizes the detected topology, to compare results of repeated initialization */
+static std::string describe_topology() {
+	std::ostringstream description;
+	description << cpuinfo_get_processors_count() << " processors, " << cpuinfo_get_cores_count() << " cores, " <<
+		cpuinfo_get_clusters_count() << " clusters, " << cpuinfo_get_packages_count() << " packages, " <<
+		cpuinfo_get_core_classes_count() << " core classes, caches " << cpuinfo_get_l1i_caches_count() << "/" <<
+		cpuinfo_get_l1d_caches_count() << "/" << cpuinfo_get_l2_caches_count() << "/" <<
+		cpuinfo_get_l3_caches_count() << "/" << cpuinfo_get_l4_caches_count();
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		const cpuinfo_cluster* cluster = cpuinfo_get_cluster(i);
+		description << ", cluster " << i << ": " << cluster->core_start << "+" << cluster->core_count << " cores, uarch " <<
+			cluster->uarch << ", " << cluster->frequency << " Hz";
+	}
+	if (cpuinfo_get_packages_count() != 0) {
+		description << ", package " << cpuinfo_get_package(0)->name;
+	}
+	return description.str();
+}
+
+class MockCorpus : public ::testing::TestWithParam<std::string> {
+};
+
+TEST_P(MockCorpus, consistent_topology) {
+	MockDump dump(GetParam());
+	ASSERT_EQ("", dump.error()) << GetParam();
+	dump.install();
+	ASSERT_TRUE(cpuinfo_initialize()) << GetParam();
+	const std::string error = check_topology();
+	cpuinfo_deinitialize();
+	ASSERT_EQ("", error) << GetParam();
+}
+
+TEST_P(MockCorpus, reinitialize) {
+	MockDump dump(GetParam());
+	ASSERT_EQ("", dump.error()) << GetParam();
+	dump.install();
+	ASSERT_TRUE(cpuinfo_initialize()) << GetParam();
+	const std::string first = describe_topology();
+	cpuinfo_deinitialize();
+	ASSERT_EQ(0, cpuinfo_get_processors_count());
+	ASSERT_FALSE(cpuinfo_get_processors());
+	ASSERT_EQ(0, cpuinfo_get_core_classes_count());
+
+	dump.install();
+	ASSERT_TRUE(cpuinfo_initialize()) << GetParam();
+	const std::string second = describe_topology();
+	cpuinfo_deinitialize();
+	ASSERT_EQ(first, second) << GetParam();
+}
+
+TEST_P(MockCorpus, memoized_blocking) {
+	MockDump dump(GetParam());
+	ASSERT_EQ("", dump.error()) << GetParam();
+	dump.install();
+	ASSERT_TRUE(cpuinfo_initialize()) << GetParam();
+	ASSERT_EQ(0, cpuinfo_mock_get_cluster_geometry_computations());
+	bool computed = true;
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		cpuinfo_blocking first, second;
+		computed &= cpuinfo_get_cluster_blocking(cpuinfo_get_cluster(i), sizeof(double), 8, 4, 1, &first);
+		computed &= cpuinfo_get_cluster_blocking(cpuinfo_get_cluster(i), sizeof(float), 16, 6, 2, &second);
+	}
+	const uint32_t computations = cpuinfo_mock_get_cluster_geometry_computations();
+	cpuinfo_deinitialize();
+	EXPECT_TRUE(computed) << GetParam();
+	/* Geometry of all clusters is computed on the first call, and reused for all other clusters and arguments */
+	EXPECT_EQ(1, computations) << GetParam();
+	EXPECT_EQ(0, cpuinfo_mock_get_cluster_geometry_computations());
+}
+
+static std::string dump_test_name(const ::testing::TestParamInfo<std::string>& info) {
+	std::string name = info.param;
+	if (name.size() > 2 && name.compare(name.size() - 2, 2, ".h") == 0) {
+		name.resize(name.size() - 2);
+	}
+	std::replace_if(name.begin(), name.end(), [](char c) { return !isalnum((unsigned char) c); }, '_');
+	return name;
+}
+
+INSTANTIATE_TEST_CASE_P(dumps, MockCorpus, ::testing::ValuesIn(list_mock_dumps()), dump_test_name);
+
+TEST(MOCK_CORPUS, non_empty) {
+	ASSERT_FALSE(list_mock_dumps().empty()) << "no dumps found in " << mock_dumps_directory();
+}
+
+int main(int argc, char* argv[]) {
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/*
+ * Dumps of the mock corpus, loaded at run-time: archives (C headers generated by the filesystem dump scripts) and
+ * directory trees with proc/cpuinfo in the dumps directory, which is CPUINFO_MOCK_DUMPS_DIR in the environment or at
+ * compile-time.
+ */
+
+static inline std::string mock_dumps_directory() {
+	const char* directory = getenv("CPUINFO_MOCK_DUMPS_DIR");
+#ifdef CPUINFO_MOCK_DUMPS_DIR
+	if (directory == nullptr) {
+		directory = CPUINFO_MOCK_DUMPS_DIR;
+	}
+#endif
+	return directory != nullptr ? directory : "test/mock";
+}
+
+static inline bool mock_read_text(const std::string& path, std::string& text) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	text = stream.str();
+	return true;
+}
+
+static inline bool mock_is_directory(const std::string& path) {
+	struct stat path_stat;
+	return stat(path.c_str(), &path_stat) == 0 && S_ISDIR(path_stat.st_mode);
+}
+
+/*
+ * Lists names of dumps of systems with the architecture of the host: cpuinfo parses only the native /proc/cpuinfo
+ * format. Array declarations are split in string literals so that this header does not look like an archive.
+ */
+static inline std::vector<std::string> list_mock_dumps() {
+	std::vector<std::string> dumps;
+	const std::string directory_path = mock_dumps_directory();
+	DIR* directory = opendir(directory_path.c_str());
+	if (directory == nullptr) {
+		return dumps;
+	}
+	while (const struct dirent* entry = readdir(directory)) {
+		const std::string name = entry->d_name;
+		const std::string path = directory_path + "/" + name;
+		std::string text;
+		if (name.size() > 2 && name.compare(name.size() - 2, 2, ".h") == 0) {
+			if (!mock_read_text(path, text) || text.find("struct cpuinfo_mock_file " "filesystem[]") == std::string::npos) {
+				continue;
+			}
+			/* Archives of x86 systems include CPUID dumps */
+			const bool x86_dump = text.find("struct cpuinfo_mock_cpuid " "cpuid_dump[]") != std::string::npos;
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+			if (x86_dump) {
+#else
+			if (!x86_dump) {
+#endif
+				dumps.push_back(name);
+			}
+		} else if (name[0] != '.' && mock_is_directory(path) && mock_read_text(path + "/proc/cpuinfo", text)) {
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+			/* Directory dumps have no CPUID data, and are only usable on ARM */
+			dumps.push_back(name);
+#endif
+		}
+	}
+	closedir(directory);
+	std::sort(dumps.begin(), dumps.end());
+	return dumps;
+}
+
+/* Mock data of one dump. The object owns the data, and must outlive initialization of cpuinfo after install(). */
+class MockDump {
+public:
+	explicit MockDump(const std::string& name) {
+		const std::string path = mock_dumps_directory() + "/" + name;
+		const bool archive = !mock_is_directory(path);
+		files_ = archive ?
+			cpuinfo_mock_filesystem_from_archive(path.c_str()) : cpuinfo_mock_filesystem_from_directory(path.c_str());
+		if (files_ == nullptr) {
+			error_ = "failed to load filesystem dump";
+			return;
+		}
+#if defined(__ANDROID__)
+		if (archive) {
+			properties_ = cpuinfo_mock_properties_from_archive(path.c_str());
+		}
+#endif
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		cpuid_dump_ = cpuinfo_mock_cpuid_from_archive(path.c_str(), "cpuid_dump", &cpuid_entries_);
+		if (cpuid_dump_ == nullptr) {
+			error_ = "failed to load CPUID dump";
+		}
+#endif
+	}
+
+	~MockDump() {
+		cpuinfo_mock_free_filesystem(files_);
+		cpuinfo_mock_free_properties(properties_);
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		free(cpuid_dump_);
+#endif
+	}
+
+	MockDump(const MockDump&) = delete;
+	MockDump& operator=(const MockDump&) = delete;
+
+	/* Empty if the dump loaded successfully */
+	const std::string& error() const {
+		return error_;
+	}
+
+	/* Installs the mock data; cpuinfo_initialize() must be called afterwards */
+	void install() {
+		cpuinfo_mock_filesystem(files_);
+#if defined(__ANDROID__)
+		if (properties_ != nullptr) {
+			cpuinfo_mock_android_properties(properties_);
+		}
+#endif
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		cpuinfo_mock_set_cpuid(cpuid_dump_, cpuid_entries_);
+#endif
+	}
+
+private:
+	std::string error_;
+	cpuinfo_mock_file* files_ = nullptr;
+	cpuinfo_mock_property* properties_ = nullptr;
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	cpuinfo_mock_cpuid* cpuid_dump_ = nullptr;
+	size_t cpuid_entries_ = 0;
+#endif
+};
@@ -0,0 +1,1345 @@
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 2896,
+		.content =
+			"processor\t: 0\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 1\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 2\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 3\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 4\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 5\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 6\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n"
+			"processor\t: 7\n"
+			"BogoMIPS\t: 2100.00\n"
+			"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics fphp asimdhp cpuid asimdrdm jscvt fcma lrcpc dcpop sha3 sm3 sm4 asimddp sha512 sve asimdfhm dit uscat ilrcpc flagm ssbs paca pacg dcpodp svei8mm svebf16 i8mm bf16 dgh rng\n"
+			"CPU implementer\t: 0x41\n"
+			"CPU architecture: 8\n"
+			"CPU variant\t: 0x1\n"
+			"CPU part\t: 0xd40\n"
+			"CPU revision\t: 1\n"
+			"\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 4,
+		.content = "511\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu0/topology/thread_siblings_list",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu1/topology/thread_siblings_list",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu2/topology/thread_siblings_list",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu3/topology/thread_siblings_list",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu4/topology/thread_siblings_list",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu5/topology/thread_siblings_list",
+		.size = 2,
+		.content = "5\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu6/topology/thread_siblings_list",
+		.size = 2,
+		.content = "6\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/shared_cpu_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/type",
+		.size = 5,
+		.content = "Data\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index0/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/level",
+		.size = 2,
+		.content = "1\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/number_of_sets",
+		.size = 4,
+		.content = "256\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/shared_cpu_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/size",
+		.size = 4,
+		.content = "64K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/type",
+		.size = 12,
+		.content = "Instruction\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index1/ways_of_associativity",
+		.size = 2,
+		.content = "4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/level",
+		.size = 2,
+		.content = "2\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/number_of_sets",
+		.size = 5,
+		.content = "2048\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/shared_cpu_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/size",
+		.size = 6,
+		.content = "1024K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index2/ways_of_associativity",
+		.size = 2,
+		.content = "8\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/coherency_line_size",
+		.size = 3,
+		.content = "64\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/level",
+		.size = 2,
+		.content = "3\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/number_of_sets",
+		.size = 6,
+		.content = "32768\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/shared_cpu_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/size",
+		.size = 7,
+		.content = "32768K\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/type",
+		.size = 8,
+		.content = "Unified\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/cache/index3/ways_of_associativity",
+		.size = 3,
+		.content = "16\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/core_siblings_list",
+		.size = 4,
+		.content = "0-7\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/physical_package_id",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/cpu7/topology/thread_siblings_list",
+		.size = 2,
+		.content = "7\n",
+	},
+	{ NULL },
+};
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+#include <synthetic-topology.h>
+
+
+/* 2 packages x 2 dies x 8 cores x 2 hardware threads */
+static SyntheticTopology topology(2, 2, 8, 2);
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(64, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, non_null) {
+	ASSERT_TRUE(cpuinfo_get_processors());
+}
+
+TEST(PROCESSORS, smt_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(i % 2, cpuinfo_get_processor(i)->smt_id);
+	}
+}
+
+TEST(PROCESSORS, core) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_core(i / 2), cpuinfo_get_processor(i)->core);
+	}
+}
+
+TEST(PROCESSORS, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(i / 32), cpuinfo_get_processor(i)->package);
+	}
+}
+
+TEST(PROCESSORS, l1d) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_l1d_cache(i / 2), cpuinfo_get_processor(i)->cache.l1d);
+	}
+}
+
+TEST(PROCESSORS, l2) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_l2_cache(i / 2), cpuinfo_get_processor(i)->cache.l2);
+	}
+}
+
+TEST(PROCESSORS, l3) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_l3_cache(i / 16), cpuinfo_get_processor(i)->cache.l3);
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(32, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, processor_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(2, cpuinfo_get_core(i)->processor_count);
+	}
+}
+
+TEST(CORES, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(i / 16), cpuinfo_get_core(i)->package);
+	}
+}
+
+TEST(PACKAGES, count) {
+	ASSERT_EQ(2, cpuinfo_get_packages_count());
+}
+
+TEST(PACKAGES, core_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_packages_count(); i++) {
+		ASSERT_EQ(16, cpuinfo_get_package(i)->core_count);
+		ASSERT_EQ(32, cpuinfo_get_package(i)->processor_count);
+	}
+}
+
+TEST(L1D, count) {
+	ASSERT_EQ(32, cpuinfo_get_l1d_caches_count());
+}
+
+TEST(L1D, size) {
+	ASSERT_EQ(48 * 1024, cpuinfo_get_l1d_cache(0)->size);
+}
+
+TEST(L1I, count) {
+	ASSERT_EQ(32, cpuinfo_get_l1i_caches_count());
+}
+
+TEST(L2, count) {
+	ASSERT_EQ(32, cpuinfo_get_l2_caches_count());
+}
+
+TEST(L2, size) {
+	ASSERT_EQ(2 * 1024 * 1024, cpuinfo_get_l2_cache(0)->size);
+}
+
+TEST(L3, count) {
+	ASSERT_EQ(4, cpuinfo_get_l3_caches_count());
+}
+
+TEST(L3, processor_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_l3_caches_count(); i++) {
+		ASSERT_EQ(16, cpuinfo_get_l3_cache(i)->processor_count);
+	}
+}
+
+TEST(L3, size) {
+	ASSERT_EQ(8 * 1920 * 1024, cpuinfo_get_l3_cache(0)->size);
+}
+
+int main(int argc, char* argv[]) {
+	topology.install();
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+#if !(CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM64)
+	#error Synthetic topologies are supported only for x86 and ARM64
+#endif
+
+
+/*
+ * Synthesizes mock /proc/cpuinfo, /sys/devices/system/cpu, and (on x86) CPUID dump of a server with the specified
+ * number of packages (sockets), dies per package, cores per die, and hardware threads per core.
+ *
+ * - x86: Intel Xeon (Sapphire Rapids) processors. APIC ID fields for threads, cores, and dies are sized to the next
+ *   power of 2, and CPUID leaves 0xB and 0x1F describe them. Linux enumerates the first thread of every core before
+ *   SMT siblings, so hardware threads of a core have non-consecutive processor numbers.
+ * - ARM64: ThunderX2 processors. Hardware threads of a core and cores of a die have consecutive processor numbers,
+ *   and dies are reported as clusters in cluster_cpus_list.
+ *
+ * L1 and L2 caches are private to a core, and L3 cache is shared by all cores of a die. The object owns all mock data,
+ * and must outlive initialization of cpuinfo after install().
+ */
+class SyntheticTopology {
+public:
+	SyntheticTopology(uint32_t packages, uint32_t dies_per_package, uint32_t cores_per_die, uint32_t threads_per_core) :
+		packages_(packages),
+		dies_per_package_(dies_per_package),
+		cores_per_die_(cores_per_die),
+		threads_per_core_(threads_per_core)
+	{
+		thread_bits_ = bit_length(threads_per_core);
+		core_bits_ = bit_length(cores_per_die);
+		die_bits_ = bit_length(dies_per_package);
+
+		const uint32_t cores = cores_count();
+		for (uint32_t i = 0; i < processors_count(); i++) {
+			Processor processor;
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+			processor.thread = i / cores;
+			const uint32_t core = i % cores;
+#else
+			processor.thread = i % threads_per_core;
+			const uint32_t core = i / threads_per_core;
+#endif
+			processor.core = core % cores_per_die;
+			processor.die = core / cores_per_die % dies_per_package;
+			processor.package = core / cores_per_die / dies_per_package;
+			processor.apic_id = (((processor.package << die_bits_ | processor.die) << core_bits_ | processor.core)
+				<< thread_bits_) | processor.thread;
+			processors_.push_back(processor);
+		}
+
+		generate_filesystem();
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		generate_cpuid();
+#endif
+	}
+
+	uint32_t packages_count() const {
+		return packages_;
+	}
+
+	uint32_t dies_count() const {
+		return packages_ * dies_per_package_;
+	}
+
+	uint32_t cores_count() const {
+		return dies_count() * cores_per_die_;
+	}
+
+	uint32_t processors_count() const {
+		return cores_count() * threads_per_core_;
+	}
+
+	cpuinfo_mock_file* filesystem() {
+		return files_.data();
+	}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	cpuinfo_mock_cpuid* cpuid_dump() {
+		return cpuid_.data();
+	}
+
+	size_t cpuid_dump_entries() const {
+		return cpuid_.size();
+	}
+#endif
+
+	/* Installs the mock data; cpuinfo_initialize() must be called afterwards */
+	void install() {
+		cpuinfo_mock_filesystem(filesystem());
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		cpuinfo_mock_set_cpuid(cpuid_dump(), cpuid_dump_entries());
+		/* x87, SSE, AVX, AVX-512 state components */
+		cpuinfo_mock_set_xcr0(UINT64_C(0x00000000000000E7));
+#else
+		/* fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics cpuid asimdrdm */
+		cpuinfo_set_hwcap(UINT64_C(0x00000000000019FF));
+#endif
+	}
+
+private:
+	struct Processor {
+		uint32_t package;
+		uint32_t die;
+		uint32_t core;
+		uint32_t thread;
+		uint32_t apic_id;
+	};
+
+	/* Number of bits to represent values in [0, count - 1] */
+	static uint32_t bit_length(uint32_t count) {
+		uint32_t bits = 0;
+		while ((UINT32_C(1) << bits) < count) {
+			bits++;
+		}
+		return bits;
+	}
+
+	/* Formats a sorted list of processors in the Linux cpulist format, e.g. "0-27,56-83\n" */
+	static std::string cpulist(const std::vector<uint32_t>& processors) {
+		std::string list;
+		for (size_t i = 0; i < processors.size(); ) {
+			size_t j = i;
+			while (j + 1 < processors.size() && processors[j + 1] == processors[j] + 1) {
+				j++;
+			}
+			if (!list.empty()) {
+				list += ",";
+			}
+			list += std::to_string(processors[i]);
+			if (j != i) {
+				list += "-" + std::to_string(processors[j]);
+			}
+			i = j + 1;
+		}
+		return list + "\n";
+	}
+
+	template<class Predicate>
+	std::string siblings(Predicate same_group) const {
+		std::vector<uint32_t> group;
+		for (uint32_t i = 0; i < processors_count(); i++) {
+			if (same_group(processors_[i])) {
+				group.push_back(i);
+			}
+		}
+		return cpulist(group);
+	}
+
+	void add(const std::string& path, const std::string& content) {
+		strings_.push_back(path);
+		const char* path_string = strings_.back().c_str();
+		strings_.push_back(content);
+		files_.push_back(cpuinfo_mock_file { path_string, content.size(), strings_.back().c_str(), 0 });
+	}
+
+	void add_cache(const std::string& prefix, uint32_t level, const char* type, uint32_t size_kb,
+		uint32_t associativity, const std::string& shared_cpu_list)
+	{
+		add(prefix + "level", std::to_string(level) + "\n");
+		add(prefix + "type", std::string(type) + "\n");
+		add(prefix + "size", std::to_string(size_kb) + "K\n");
+		add(prefix + "ways_of_associativity", std::to_string(associativity) + "\n");
+		add(prefix + "number_of_sets", std::to_string(size_kb * 1024 / (associativity * 64)) + "\n");
+		add(prefix + "coherency_line_size", "64\n");
+		add(prefix + "shared_cpu_list", shared_cpu_list);
+	}
+
+	void generate_filesystem() {
+		std::string proc_cpuinfo;
+		for (uint32_t i = 0; i < processors_count(); i++) {
+			const Processor& processor = processors_[i];
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+			proc_cpuinfo += "processor\t: " + std::to_string(i) + "\n"
+				"vendor_id\t: GenuineIntel\n"
+				"cpu family\t: 6\n"
+				"model\t\t: 143\n"
+				"model name\t: Intel(R) Xeon(R) Platinum 8480+\n"
+				"physical id\t: " + std::to_string(processor.package) + "\n"
+				"siblings\t: " + std::to_string(dies_per_package_ * cores_per_die_ * threads_per_core_) + "\n"
+				"core id\t\t: " + std::to_string(processor.die * cores_per_die_ + processor.core) + "\n"
+				"cpu cores\t: " + std::to_string(dies_per_package_ * cores_per_die_) + "\n"
+				"apicid\t\t: " + std::to_string(processor.apic_id) + "\n"
+				"initial apicid\t: " + std::to_string(processor.apic_id) + "\n"
+				"\n";
+#else
+			proc_cpuinfo += "processor\t: " + std::to_string(i) + "\n"
+				"BogoMIPS\t: 400.00\n"
+				"Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics cpuid asimdrdm\n"
+				"CPU implementer\t: 0x43\n"
+				"CPU architecture: 8\n"
+				"CPU variant\t: 0x1\n"
+				"CPU part\t: 0x0af\n"
+				"CPU revision\t: 2\n"
+				"\n";
+#endif
+		}
+		add("/proc/cpuinfo", proc_cpuinfo);
+
+		const std::string all_processors = "0-" + std::to_string(processors_count() - 1) + "\n";
+		add("/sys/devices/system/cpu/kernel_max", "4095\n");
+		add("/sys/devices/system/cpu/possible", all_processors);
+		add("/sys/devices/system/cpu/present", all_processors);
+		add("/sys/devices/system/cpu/online", all_processors);
+		add("/sys/devices/system/cpu/offline", "\n");
+
+		/* Siblings lists are the same for all processors of a group: format each list once */
+		std::vector<std::string> package_siblings(packages_count()), die_siblings(dies_count());
+		std::vector<std::string> core_siblings(cores_count());
+		for (uint32_t i = 0; i < processors_count(); i++) {
+			const Processor& processor = processors_[i];
+			const uint32_t die = processor.package * dies_per_package_ + processor.die;
+			const uint32_t core = die * cores_per_die_ + processor.core;
+			if (processor.thread != 0) {
+				continue;
+			}
+			if (core_siblings[core].empty()) {
+				core_siblings[core] = siblings([&](const Processor& other) {
+					return other.package == processor.package && other.die == processor.die && other.core == processor.core;
+				});
+			}
+			if (die_siblings[die].empty()) {
+				die_siblings[die] = siblings([&](const Processor& other) {
+					return other.package == processor.package && other.die == processor.die;
+				});
+			}
+			if (package_siblings[processor.package].empty()) {
+				package_siblings[processor.package] = siblings([&](const Processor& other) {
+					return other.package == processor.package;
+				});
+			}
+		}
+
+		for (uint32_t i = 0; i < processors_count(); i++) {
+			const Processor& processor = processors_[i];
+			const uint32_t die = processor.package * dies_per_package_ + processor.die;
+			const uint32_t core = die * cores_per_die_ + processor.core;
+
+			const std::string cpu = "/sys/devices/system/cpu/cpu" + std::to_string(i);
+			add(cpu + "/cpufreq/cpuinfo_max_freq", "2200000\n");
+			add(cpu + "/cpufreq/cpuinfo_min_freq", "1000000\n");
+			add(cpu + "/topology/physical_package_id", std::to_string(processor.package) + "\n");
+			add(cpu + "/topology/die_id", std::to_string(processor.die) + "\n");
+			add(cpu + "/topology/core_id", std::to_string(processor.core) + "\n");
+			add(cpu + "/topology/core_siblings_list", package_siblings[processor.package]);
+			add(cpu + "/topology/die_cpus_list", die_siblings[die]);
+			add(cpu + "/topology/thread_siblings_list", core_siblings[core]);
+#if CPUINFO_ARCH_ARM64
+			add(cpu + "/topology/cluster_id", std::to_string(die) + "\n");
+			add(cpu + "/topology/cluster_cpus_list", die_siblings[die]);
+#endif
+			add_cache(cpu + "/cache/index0/", 1, "Data", 48, 12, core_siblings[core]);
+			add_cache(cpu + "/cache/index1/", 1, "Instruction", 32, 8, core_siblings[core]);
+			add_cache(cpu + "/cache/index2/", 2, "Unified", 2048, 16, core_siblings[core]);
+			add_cache(cpu + "/cache/index3/", 3, "Unified", 1920 * cores_per_die_, 15, die_siblings[die]);
+		}
+
+		files_.push_back(cpuinfo_mock_file { nullptr, 0, nullptr, 0 });
+	}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	void add_cpuid(uint32_t eax, uint32_t ecx, uint32_t regs_eax, uint32_t regs_ebx, uint32_t regs_ecx, uint32_t regs_edx) {
+		cpuid_.push_back(cpuinfo_mock_cpuid { eax, ecx, regs_eax, regs_ebx, regs_ecx, regs_edx });
+	}
+
+	/* Deterministic cache parameters (leaf 4) of a cache shared by processors with the same APIC ID above the bits */
+	void add_cache_cpuid(uint32_t index, uint32_t type, uint32_t level, uint32_t size_kb, uint32_t associativity,
+		uint32_t sharing_bits, bool inclusive)
+	{
+		const uint32_t package_bits = die_bits_ + core_bits_;
+		const uint32_t max_cores = package_bits >= 6 ? 63 : (UINT32_C(1) << package_bits) - 1;
+		const uint32_t sets = size_kb * 1024 / (associativity * 64);
+		add_cpuid(4, index,
+			type | level << 5 | UINT32_C(0x100) | ((UINT32_C(1) << sharing_bits) - 1) << 14 | max_cores << 26,
+			(associativity - 1) << 22 | 63,
+			sets - 1,
+			inclusive ? UINT32_C(0x2) : 0);
+	}
+
+	/* Extended topology enumeration (leaves 0xB and 0x1F) of the processor with APIC ID 0 */
+	void add_topology_cpuid(uint32_t leaf, bool dies) {
+		const uint32_t core_shift = thread_bits_ + core_bits_ + (dies ? 0 : die_bits_);
+		const uint32_t die_shift = thread_bits_ + core_bits_ + die_bits_;
+		uint32_t level = 0;
+		add_cpuid(leaf, level, thread_bits_, threads_per_core_, level | 1 << 8, 0);
+		level++;
+		add_cpuid(leaf, level, core_shift, threads_per_core_ * cores_per_die_ * (dies ? 1 : dies_per_package_),
+			level | 2 << 8, 0);
+		level++;
+		if (dies) {
+			add_cpuid(leaf, level, die_shift, threads_per_core_ * cores_per_die_ * dies_per_package_, level | 5 << 8, 0);
+			level++;
+		}
+		add_cpuid(leaf, level, 0, 0, level, 0);
+	}
+
+	void generate_cpuid() {
+		const uint32_t package_processors = dies_per_package_ * cores_per_die_ * threads_per_core_;
+		const uint32_t logical_processors = package_processors > 255 ? 255 : package_processors;
+		/* "GenuineIntel" */
+		add_cpuid(0x00000000, 0, 0x0000001F, 0x756E6547, 0x6C65746E, 0x49656E69);
+		/* Family 6 model 0x8F (Sapphire Rapids), HTT, x2APIC, OSXSAVE, AVX */
+		add_cpuid(0x00000001, 0, 0x000806F8, logical_processors << 16 | 0x00000800, 0x7FFEFBFF, 0xBFEBFBFF);
+		/* Descriptor 0xFF: use leaf 4 */
+		add_cpuid(0x00000002, 0, 0x00FEFF01, 0x000000F0, 0x00000000, 0x00000000);
+		add_cache_cpuid(0, 1, 1, 48, 12, thread_bits_, false);
+		add_cache_cpuid(1, 2, 1, 32, 8, thread_bits_, false);
+		add_cache_cpuid(2, 3, 2, 2048, 16, thread_bits_, false);
+		add_cache_cpuid(3, 3, 3, 1920 * cores_per_die_, 15, thread_bits_ + core_bits_, false);
+		add_cpuid(0x00000004, 4, 0x00000000, 0x00000000, 0x00000000, 0x00000000);
+		/* AVX2, AVX-512 F/DQ/CD/BW/VL, BMI1/2 */
+		add_cpuid(0x00000007, 0, 0x00000000, 0xF1BF07AB, 0x00000000, 0x00000000);
+		add_topology_cpuid(0x0000000B, false);
+		add_topology_cpuid(0x0000001F, true);
+		add_cpuid(0x80000000, 0, 0x80000008, 0x00000000, 0x00000000, 0x00000000);
+		add_cpuid(0x80000001, 0, 0x00000000, 0x00000000, 0x00000121, 0x2C100800);
+		/* "Intel(R) Xeon(R) Platinum 8480+" */
+		add_cpuid(0x80000002, 0, 0x65746E49, 0x2952286C, 0x6F655820, 0x2952286E);
+		add_cpuid(0x80000003, 0, 0x616C5020, 0x756E6974, 0x3438206D, 0x002B3038);
+		add_cpuid(0x80000004, 0, 0x00000000, 0x00000000, 0x00000000, 0x00000000);
+	}
+#endif
+
+	uint32_t packages_;
+	uint32_t dies_per_package_;
+	uint32_t cores_per_die_;
+	uint32_t threads_per_core_;
+	uint32_t thread_bits_;
+	uint32_t core_bits_;
+	uint32_t die_bits_;
+	std::vector<Processor> processors_;
+	/* Deque never moves its elements, so that paths and contents referenced by mock files remain valid */
+	std::deque<std::string> strings_;
+	std::vector<cpuinfo_mock_file> files_;
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	std::vector<cpuinfo_mock_cpuid> cpuid_;
+#endif
+};
@@ -0,0 +1,486 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(2, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, non_null) {
+	ASSERT_TRUE(cpuinfo_get_processors());
+}
+
+TEST(PROCESSORS, smt_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_processor(i)->smt_id);
+	}
+}
+
+TEST(PROCESSORS, core) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_core(0), cpuinfo_get_processor(i)->core);
+	}
+}
+
+TEST(PROCESSORS, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(0), cpuinfo_get_processor(i)->package);
+	}
+}
+
+TEST(PROCESSORS, linux_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_processor(i)->linux_id);
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(1, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, processor_count) {
+	ASSERT_EQ(2, cpuinfo_get_core(0)->processor_count);
+}
+
+TEST(CORES, vendor) {
+	ASSERT_EQ(cpuinfo_vendor_intel, cpuinfo_get_core(0)->vendor);
+}
+
+TEST(CORES, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_golden_cove, cpuinfo_get_core(0)->uarch);
+}
+
+TEST(CORES, cpuid) {
+	ASSERT_EQ(UINT32_C(0x000806F8), cpuinfo_get_core(0)->cpuid);
+}
+
+TEST(PACKAGES, count) {
+	ASSERT_EQ(1, cpuinfo_get_packages_count());
+}
+
+TEST(PACKAGES, name) {
+	ASSERT_EQ("Intel Xeon Platinum 8480+",
+		std::string(cpuinfo_get_package(0)->name,
+			strnlen(cpuinfo_get_package(0)->name, CPUINFO_PACKAGE_NAME_MAX)));
+}
+
+TEST(ISA, rdtsc) {
+	ASSERT_TRUE(cpuinfo_has_x86_rdtsc());
+}
+
+TEST(ISA, rdtscp) {
+	ASSERT_TRUE(cpuinfo_has_x86_rdtscp());
+}
+
+TEST(ISA, rdpid) {
+	ASSERT_TRUE(cpuinfo_has_x86_rdpid());
+}
+
+TEST(ISA, clzero) {
+	ASSERT_FALSE(cpuinfo_has_x86_clzero());
+}
+
+TEST(ISA, mwait) {
+	ASSERT_TRUE(cpuinfo_has_x86_mwait());
+}
+
+TEST(ISA, mwaitx) {
+	ASSERT_FALSE(cpuinfo_has_x86_mwaitx());
+}
+
+TEST(ISA, fxsave) {
+	ASSERT_TRUE(cpuinfo_has_x86_fxsave());
+}
+
+TEST(ISA, xsave) {
+	ASSERT_TRUE(cpuinfo_has_x86_xsave());
+}
+
+TEST(ISA, fpu) {
+	ASSERT_TRUE(cpuinfo_has_x86_fpu());
+}
+
+TEST(ISA, mmx) {
+	ASSERT_TRUE(cpuinfo_has_x86_mmx());
+}
+
+TEST(ISA, mmx_plus) {
+	ASSERT_TRUE(cpuinfo_has_x86_mmx_plus());
+}
+
+TEST(ISA, 3dnow) {
+	ASSERT_FALSE(cpuinfo_has_x86_3dnow());
+}
+
+TEST(ISA, 3dnow_plus) {
+	ASSERT_FALSE(cpuinfo_has_x86_3dnow_plus());
+}
+
+TEST(ISA, 3dnow_geode) {
+	ASSERT_FALSE(cpuinfo_has_x86_3dnow_geode());
+}
+
+TEST(ISA, prefetch) {
+	ASSERT_FALSE(cpuinfo_has_x86_prefetch());
+}
+
+TEST(ISA, prefetchw) {
+	ASSERT_TRUE(cpuinfo_has_x86_prefetchw());
+}
+
+TEST(ISA, prefetchwt1) {
+	ASSERT_FALSE(cpuinfo_has_x86_prefetchwt1());
+}
+
+TEST(ISA, daz) {
+	ASSERT_TRUE(cpuinfo_has_x86_daz());
+}
+
+TEST(ISA, sse) {
+	ASSERT_TRUE(cpuinfo_has_x86_sse());
+}
+
+TEST(ISA, sse2) {
+	ASSERT_TRUE(cpuinfo_has_x86_sse2());
+}
+
+TEST(ISA, sse3) {
+	ASSERT_TRUE(cpuinfo_has_x86_sse3());
+}
+
+TEST(ISA, ssse3) {
+	ASSERT_TRUE(cpuinfo_has_x86_ssse3());
+}
+
+TEST(ISA, sse4_1) {
+	ASSERT_TRUE(cpuinfo_has_x86_sse4_1());
+}
+
+TEST(ISA, sse4_2) {
+	ASSERT_TRUE(cpuinfo_has_x86_sse4_2());
+}
+
+TEST(ISA, sse4a) {
+	ASSERT_FALSE(cpuinfo_has_x86_sse4a());
+}
+
+TEST(ISA, misaligned_sse) {
+	ASSERT_FALSE(cpuinfo_has_x86_misaligned_sse());
+}
+
+TEST(ISA, avx) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx());
+}
+
+TEST(ISA, fma3) {
+	ASSERT_TRUE(cpuinfo_has_x86_fma3());
+}
+
+TEST(ISA, fma4) {
+	ASSERT_FALSE(cpuinfo_has_x86_fma4());
+}
+
+TEST(ISA, xop) {
+	ASSERT_FALSE(cpuinfo_has_x86_xop());
+}
+
+TEST(ISA, f16c) {
+	ASSERT_TRUE(cpuinfo_has_x86_f16c());
+}
+
+TEST(ISA, avx2) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx2());
+}
+
+TEST(ISA, avx512f) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512f());
+}
+
+TEST(ISA, avx512pf) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512pf());
+}
+
+TEST(ISA, avx512er) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512er());
+}
+
+TEST(ISA, avx512cd) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512cd());
+}
+
+TEST(ISA, avx512dq) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512dq());
+}
+
+TEST(ISA, avx512bw) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512bw());
+}
+
+TEST(ISA, avx512vl) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512vl());
+}
+
+TEST(ISA, avx512ifma) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512ifma());
+}
+
+TEST(ISA, avx512vbmi) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512vbmi());
+}
+
+TEST(ISA, avx512vbmi2) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512vbmi2());
+}
+
+TEST(ISA, avx512bitalg) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512bitalg());
+}
+
+TEST(ISA, avx512vpopcntdq) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512vpopcntdq());
+}
+
+TEST(ISA, avx512vnni) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512vnni());
+}
+
+TEST(ISA, avx512_4vnniw) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512_4vnniw());
+}
+
+TEST(ISA, avx512_4fmaps) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512_4fmaps());
+}
+
+TEST(ISA, avx512vp2intersect) {
+	ASSERT_FALSE(cpuinfo_has_x86_avx512vp2intersect());
+}
+
+TEST(ISA, avx512bf16) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512bf16());
+}
+
+TEST(ISA, avx512fp16) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512fp16());
+}
+
+TEST(ISA, avxvnni) {
+	ASSERT_TRUE(cpuinfo_has_x86_avxvnni());
+}
+
+TEST(ISA, amx_tile) {
+	ASSERT_TRUE(cpuinfo_has_x86_amx_tile());
+}
+
+TEST(ISA, amx_int8) {
+	ASSERT_TRUE(cpuinfo_has_x86_amx_int8());
+}
+
+TEST(ISA, amx_bf16) {
+	ASSERT_TRUE(cpuinfo_has_x86_amx_bf16());
+}
+
+TEST(ISA, hle) {
+	ASSERT_FALSE(cpuinfo_has_x86_hle());
+}
+
+TEST(ISA, rtm) {
+	ASSERT_TRUE(cpuinfo_has_x86_rtm());
+}
+
+TEST(ISA, xtest) {
+	ASSERT_TRUE(cpuinfo_has_x86_xtest());
+}
+
+TEST(ISA, mpx) {
+	ASSERT_FALSE(cpuinfo_has_x86_mpx());
+}
+
+TEST(ISA, cmov) {
+	ASSERT_TRUE(cpuinfo_has_x86_cmov());
+}
+
+TEST(ISA, cmpxchg8b) {
+	ASSERT_TRUE(cpuinfo_has_x86_cmpxchg8b());
+}
+
+TEST(ISA, cmpxchg16b) {
+	ASSERT_TRUE(cpuinfo_has_x86_cmpxchg16b());
+}
+
+TEST(ISA, clwb) {
+	ASSERT_TRUE(cpuinfo_has_x86_clwb());
+}
+
+TEST(ISA, movbe) {
+	ASSERT_TRUE(cpuinfo_has_x86_movbe());
+}
+
+TEST(ISA, lahf_sahf) {
+	ASSERT_TRUE(cpuinfo_has_x86_lahf_sahf());
+}
+
+TEST(ISA, lzcnt) {
+	ASSERT_TRUE(cpuinfo_has_x86_lzcnt());
+}
+
+TEST(ISA, popcnt) {
+	ASSERT_TRUE(cpuinfo_has_x86_popcnt());
+}
+
+TEST(ISA, tbm) {
+	ASSERT_FALSE(cpuinfo_has_x86_tbm());
+}
+
+TEST(ISA, bmi) {
+	ASSERT_TRUE(cpuinfo_has_x86_bmi());
+}
+
+TEST(ISA, bmi2) {
+	ASSERT_TRUE(cpuinfo_has_x86_bmi2());
+}
+
+TEST(ISA, adx) {
+	ASSERT_TRUE(cpuinfo_has_x86_adx());
+}
+
+TEST(ISA, aes) {
+	ASSERT_TRUE(cpuinfo_has_x86_aes());
+}
+
+TEST(ISA, vaes) {
+	ASSERT_TRUE(cpuinfo_has_x86_vaes());
+}
+
+TEST(ISA, pclmulqdq) {
+	ASSERT_TRUE(cpuinfo_has_x86_pclmulqdq());
+}
+
+TEST(ISA, vpclmulqdq) {
+	ASSERT_TRUE(cpuinfo_has_x86_vpclmulqdq());
+}
+
+TEST(ISA, gfni) {
+	ASSERT_TRUE(cpuinfo_has_x86_gfni());
+}
+
+TEST(ISA, rdrand) {
+	ASSERT_TRUE(cpuinfo_has_x86_rdrand());
+}
+
+TEST(ISA, rdseed) {
+	ASSERT_TRUE(cpuinfo_has_x86_rdseed());
+}
+
+TEST(ISA, sha) {
+	ASSERT_TRUE(cpuinfo_has_x86_sha());
+}
+
+TEST(AMX, request) {
+	ASSERT_TRUE(cpuinfo_request_x86_amx());
+}
+
+TEST(XSAVE, non_null) {
+	ASSERT_TRUE(cpuinfo_get_x86_xsave());
+}
+
+TEST(XSAVE, enabled_components) {
+	ASSERT_EQ(UINT64_C(0x00000000000602E7), cpuinfo_get_x86_xsave()->enabled_components);
+}
+
+TEST(XSAVE, supported_components) {
+	ASSERT_EQ(UINT64_C(0x00000000000602E7), cpuinfo_get_x86_xsave()->supported_components);
+}
+
+TEST(XSAVE, size) {
+	ASSERT_EQ(11008, cpuinfo_get_x86_xsave()->size);
+	ASSERT_EQ(11008, cpuinfo_get_x86_xsave()->max_size);
+}
+
+TEST(XSAVE, compacted_size) {
+	ASSERT_EQ(10752, cpuinfo_get_x86_xsave()->compacted_size);
+}
+
+TEST(XSAVE, avx512_components) {
+	const struct cpuinfo_x86_xsave* xsave = cpuinfo_get_x86_xsave();
+	ASSERT_EQ(64, xsave->components[5].size);
+	ASSERT_EQ(1088, xsave->components[5].offset);
+	ASSERT_EQ(512, xsave->components[6].size);
+	ASSERT_EQ(1152, xsave->components[6].offset);
+	ASSERT_EQ(1024, xsave->components[7].size);
+	ASSERT_EQ(1664, xsave->components[7].offset);
+}
+
+TEST(XSAVE, amx_components) {
+	const struct cpuinfo_x86_xsave* xsave = cpuinfo_get_x86_xsave();
+	ASSERT_EQ(64, xsave->components[17].size);
+	ASSERT_EQ(2752, xsave->components[17].offset);
+	ASSERT_TRUE(xsave->components[17].aligned);
+	ASSERT_EQ(8192, xsave->components[18].size);
+	ASSERT_EQ(2816, xsave->components[18].offset);
+	ASSERT_TRUE(xsave->components[18].aligned);
+}
+
+TEST(XSAVE, unsupported_components) {
+	const struct cpuinfo_x86_xsave* xsave = cpuinfo_get_x86_xsave();
+	ASSERT_EQ(0, xsave->components[3].size);
+	ASSERT_EQ(0, xsave->components[4].size);
+	ASSERT_EQ(0, xsave->components[8].size);
+}
+
+TEST(L1I, size) {
+	for (uint32_t i = 0; i < cpuinfo_get_l1i_caches_count(); i++) {
+		ASSERT_EQ(32 * 1024, cpuinfo_get_l1i_cache(i)->size);
+	}
+}
+
+TEST(L1D, count) {
+	ASSERT_EQ(1, cpuinfo_get_l1d_caches_count());
+}
+
+TEST(L1D, size) {
+	ASSERT_EQ(48 * 1024, cpuinfo_get_l1d_cache(0)->size);
+}
+
+TEST(L1D, associativity) {
+	ASSERT_EQ(12, cpuinfo_get_l1d_cache(0)->associativity);
+}
+
+TEST(L2, size) {
+	ASSERT_EQ(2 * 1024 * 1024, cpuinfo_get_l2_cache(0)->size);
+}
+
+TEST(L2, associativity) {
+	ASSERT_EQ(16, cpuinfo_get_l2_cache(0)->associativity);
+}
+
+TEST(L3, size) {
+	ASSERT_EQ(105 * 1024 * 1024, cpuinfo_get_l3_cache(0)->size);
+}
+
+TEST(L3, associativity) {
+	ASSERT_EQ(15, cpuinfo_get_l3_cache(0)->associativity);
+}
+
+TEST(L3, flags) {
+	ASSERT_EQ(CPUINFO_CACHE_UNIFIED | CPUINFO_CACHE_COMPLEX_INDEXING, cpuinfo_get_l3_cache(0)->flags);
+}
+
+TEST(L4, none) {
+	ASSERT_EQ(0, cpuinfo_get_l4_caches_count());
+	ASSERT_FALSE(cpuinfo_get_l4_caches());
+}
+
+#include <xeon-platinum-8480.h>
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	/* x87, SSE, AVX, AVX-512, PKRU, AMX state components */
+	cpuinfo_mock_set_xcr0(UINT64_C(0x00000000000602E7));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,412 @@
+struct cpuinfo_mock_cpuid cpuid_dump[] = {
+	{
+		.input_eax = 0x00000000,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000020,
+		.ebx = 0x756E6547,
+		.ecx = 0x6C65746E,
+		.edx = 0x49656E69,
+	},
+	{
+		.input_eax = 0x00000001,
+		.input_ecx = 0x00000000,
+		.eax = 0x000806F8,
+		.ebx = 0x00020800,
+		.ecx = 0x7FFEFBFF,
+		.edx = 0xBFEBFBFF,
+	},
+	{
+		.input_eax = 0x00000002,
+		.input_ecx = 0x00000000,
+		.eax = 0x00FEFF01,
+		.ebx = 0x000000F0,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000000,
+		.eax = 0x00004121,
+		.ebx = 0x02C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000001,
+		.eax = 0x00004122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000002,
+		.eax = 0x00004143,
+		.ebx = 0x03C0003F,
+		.ecx = 0x000007FF,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000003,
+		.eax = 0x00004163,
+		.ebx = 0x0380003F,
+		.ecx = 0x0001BFFF,
+		.edx = 0x00000004,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0xF3BFFFEF,
+		.ecx = 0x7B417FFE,
+		.edx = 0xFFDD4430,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000001,
+		.eax = 0x00001C30,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000000,
+		.eax = 0x000602E7,
+		.ebx = 0x00002B00,
+		.ecx = 0x00002B00,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000001,
+		.eax = 0x0000001F,
+		.ebx = 0x00002B00,
+		.ecx = 0x00001800,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000100,
+		.ebx = 0x00000240,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000005,
+		.eax = 0x00000040,
+		.ebx = 0x00000440,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000006,
+		.eax = 0x00000200,
+		.ebx = 0x00000480,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000007,
+		.eax = 0x00000400,
+		.ebx = 0x00000680,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000008,
+		.eax = 0x00000080,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000009,
+		.eax = 0x00000008,
+		.ebx = 0x00000A80,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000B,
+		.eax = 0x00000010,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000C,
+		.eax = 0x00000018,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000E,
+		.eax = 0x00000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x0000000F,
+		.eax = 0x00000328,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000010,
+		.eax = 0x00000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000011,
+		.eax = 0x00000040,
+		.ebx = 0x00000AC0,
+		.ecx = 0x00000002,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000012,
+		.eax = 0x00002000,
+		.ebx = 0x00000B00,
+		.ecx = 0x00000006,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001D,
+		.input_ecx = 0x00000001,
+		.eax = 0x04002000,
+		.ebx = 0x00080040,
+		.ecx = 0x00000010,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001E,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00004010,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.input_ecx = 0x00000000,
+		.eax = 0x80000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000001,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000121,
+		.edx = 0x2C100800,
+	},
+	{
+		.input_eax = 0x80000002,
+		.input_ecx = 0x00000000,
+		.eax = 0x65746E49,
+		.ebx = 0x2952286C,
+		.ecx = 0x6F655820,
+		.edx = 0x2952286E,
+	},
+	{
+		.input_eax = 0x80000003,
+		.input_ecx = 0x00000000,
+		.eax = 0x616C5020,
+		.ebx = 0x756E6974,
+		.ecx = 0x3438206D,
+		.edx = 0x002B3038,
+	},
+	{
+		.input_eax = 0x80000004,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000005,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000006,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x08007040,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000100,
+	},
+	{
+		.input_eax = 0x80000008,
+		.input_ecx = 0x00000000,
+		.eax = 0x0000392E,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 2800,
+		.content =
+			"processor\t: 0\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 143\n"
+			"model name\t: Intel(R) Xeon(R) Platinum 8480+\n"
+			"stepping\t: 8\n"
+			"microcode\t: 0x2b000161\n"
+			"cpu MHz\t\t: 2000.000\n"
+			"cache size\t: 107520 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 2\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 1\n"
+			"apicid\t\t: 0\n"
+			"initial apicid\t: 0\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush mmx fxsr sse sse2 ss ht syscall nx pdpe1gb rdtscp lm constant_tsc rep_good nopl xtopology nonstop_tsc cpuid tsc_known_freq pni pclmulqdq ssse3 fma cx16 pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand hypervisor lahf_lm abm 3dnowprefetch invpcid_single ssbd ibrs ibpb stibp ibrs_enhanced fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid avx512f avx512dq rdseed adx smap avx512ifma clflushopt clwb avx512cd sha_ni avx512bw avx512vl xsaveopt xsavec xgetbv1 xsaves avx_vnni avx512_bf16 wbnoinvd ida arat avx512vbmi umip pku ospke waitpkg avx512_vbmi2 gfni vaes vpclmulqdq avx512_vnni avx512_bitalg tme avx512_vpopcntdq la57 rdpid cldemote movdiri movdir64b md_clear serialize tsxldtrk amx_bf16 avx512_fp16 amx_tile amx_int8 flush_l1d arch_capabilities\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs\n"
+			"bogomips\t: 4000.00\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 57 bits virtual\n"
+			"power management:\n"
+			"\n"
+			"processor\t: 1\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 143\n"
+			"model name\t: Intel(R) Xeon(R) Platinum 8480+\n"
+			"stepping\t: 8\n"
+			"microcode\t: 0x2b000161\n"
+			"cpu MHz\t\t: 2000.000\n"
+			"cache size\t: 107520 KB\n"
+			"physical id\t: 0\n"
+			"siblings\t: 2\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 1\n"
+			"apicid\t\t: 1\n"
+			"initial apicid\t: 1\n"
+			"fpu\t\t: yes\n"
+			"fpu_exception\t: yes\n"
+			"cpuid level\t: 32\n"
+			"wp\t\t: yes\n"
+			"flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush mmx fxsr sse sse2 ss ht syscall nx pdpe1gb rdtscp lm constant_tsc rep_good nopl xtopology nonstop_tsc cpuid tsc_known_freq pni pclmulqdq ssse3 fma cx16 pdcm pcid sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave avx f16c rdrand hypervisor lahf_lm abm 3dnowprefetch invpcid_single ssbd ibrs ibpb stibp ibrs_enhanced fsgsbase tsc_adjust bmi1 avx2 smep bmi2 erms invpcid avx512f avx512dq rdseed adx smap avx512ifma clflushopt clwb avx512cd sha_ni avx512bw avx512vl xsaveopt xsavec xgetbv1 xsaves avx_vnni avx512_bf16 wbnoinvd ida arat avx512vbmi umip pku ospke waitpkg avx512_vbmi2 gfni vaes vpclmulqdq avx512_vnni avx512_bitalg tme avx512_vpopcntdq la57 rdpid cldemote movdiri movdir64b md_clear serialize tsxldtrk amx_bf16 avx512_fp16 amx_tile amx_int8 flush_l1d arch_capabilities\n"
+			"bugs\t\t: spectre_v1 spectre_v2 spec_store_bypass swapgs\n"
+			"bogomips\t: 4000.00\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"address sizes\t: 46 bits physical, 57 bits virtual\n"
+			"power management:\n"
+			"\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 5,
+		.content = "8191\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 4,
+		.content = "0-1\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 4,
+		.content = "0-1\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 4,
+		.content = "0-1\n",
+		.offset = 0,
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+		.offset = 0,
+	},
+	{
+		.path = NULL,
+		.size = 0,
+		.content = NULL,
+		.offset = 0,
+	},
+};
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#define CPUINFO_GPU_NAME_MAX 64
+
+extern "C" bool cpuinfo_arm_android_get_chipset_gpu_map_entry(
+	size_t index,
+	uint32_t chipset_series[1],
+	uint32_t chipset_model[1],
+	char chipset_suffix[1],
+	char gpu_name[CPUINFO_GPU_NAME_MAX]);
+
+extern "C" void cpuinfo_arm_android_parse_chipset_gpu(
+	uint32_t chipset_series,
+	uint32_t chipset_model,
+	char chipset_suffix,
+	char gpu_name[CPUINFO_GPU_NAME_MAX]);
+
+extern "C" const char* cpuinfo_android_get_gpu_renderer_map_entry(
+	size_t index,
+	char gpu_name[CPUINFO_GPU_NAME_MAX]);
+
+extern "C" void cpuinfo_android_parse_gpu_renderer(
+	const char* renderer,
+	char gpu_name[CPUINFO_GPU_NAME_MAX]);
+
+struct ChipsetGpuEntry {
+	uint32_t chipset_series;
+	uint32_t chipset_model;
+	char chipset_suffix;
+	std::string gpu;
+};
+
+struct GpuRendererEntry {
+	std::string renderer;
+	std::string gpu;
+};
+
+inline std::vector<ChipsetGpuEntry> chipset_gpu_map() {
+	std::vector<ChipsetGpuEntry> entries;
+	ChipsetGpuEntry entry;
+	char gpu_name[CPUINFO_GPU_NAME_MAX];
+	while (cpuinfo_arm_android_get_chipset_gpu_map_entry(
+		entries.size(), &entry.chipset_series, &entry.chipset_model, &entry.chipset_suffix, gpu_name))
+	{
+		entry.gpu = std::string(gpu_name, strnlen(gpu_name, CPUINFO_GPU_NAME_MAX));
+		entries.push_back(entry);
+	}
+	return entries;
+}
+
+inline std::vector<GpuRendererEntry> gpu_renderer_map() {
+	std::vector<GpuRendererEntry> entries;
+	char gpu_name[CPUINFO_GPU_NAME_MAX];
+	while (const char* renderer = cpuinfo_android_get_gpu_renderer_map_entry(entries.size(), gpu_name)) {
+		entries.push_back(GpuRendererEntry { renderer, std::string(gpu_name, strnlen(gpu_name, CPUINFO_GPU_NAME_MAX)) });
+	}
+	return entries;
+}
+
+inline std::string parse_chipset_gpu(uint32_t chipset_series, uint32_t chipset_model, char chipset_suffix) {
+	char gpu_name[CPUINFO_GPU_NAME_MAX];
+	cpuinfo_arm_android_parse_chipset_gpu(chipset_series, chipset_model, chipset_suffix, gpu_name);
+	return std::string(gpu_name, strnlen(gpu_name, CPUINFO_GPU_NAME_MAX));
+}
+
+inline std::string parse_gpu_renderer(const char* renderer) {
+	char gpu_name[CPUINFO_GPU_NAME_MAX];
+	cpuinfo_android_parse_gpu_renderer(renderer, gpu_name);
+	return std::string(gpu_name, strnlen(gpu_name, CPUINFO_GPU_NAME_MAX));
+}
+
+/* Reference lookup by linear search: the first entry in table order with matching chipset */
+inline std::string search_chipset_gpu(
+	const std::vector<ChipsetGpuEntry>& entries,
+	uint32_t chipset_series, uint32_t chipset_model, char chipset_suffix)
+{
+	for (const ChipsetGpuEntry& entry : entries) {
+		if (entry.chipset_series == chipset_series && entry.chipset_model == chipset_model &&
+			(entry.chipset_suffix == '*' || entry.chipset_suffix == chipset_suffix))
+		{
+			return entry.gpu;
+		}
+	}
+	return std::string();
+}
+
+TEST(CHIPSET_GPU_MAP, non_empty) {
+	EXPECT_FALSE(chipset_gpu_map().empty());
+}
+
+TEST(CHIPSET_GPU_MAP, sorted) {
+	const std::vector<ChipsetGpuEntry> entries = chipset_gpu_map();
+	for (size_t i = 1; i < entries.size(); i++) {
+		const ChipsetGpuEntry& previous = entries[i - 1];
+		const ChipsetGpuEntry& current = entries[i];
+		EXPECT_TRUE(previous.chipset_series < current.chipset_series ||
+			(previous.chipset_series == current.chipset_series && previous.chipset_model <= current.chipset_model))
+			<< "entry " << i << " (series " << current.chipset_series << ", model " << current.chipset_model << ") "
+			<< "follows entry " << i - 1 << " (series " << previous.chipset_series << ", model "
+			<< previous.chipset_model << ")";
+	}
+}
+
+/*
+ * Binary search must find the same GPU as the linear search which it replaced: the first entry in table order with a
+ * matching chipset. Checks every chipset series, every chipset model in the table and its neighbours, and every chipset
+ * suffix in the table as well as none and an unknown suffix.
+ */
+TEST(CHIPSET_GPU_MAP, matches_linear_search) {
+	const std::vector<ChipsetGpuEntry> entries = chipset_gpu_map();
+	uint32_t max_chipset_series = 0;
+	std::set<uint32_t> chipset_models;
+	std::set<char> chipset_suffixes = { '\0', 'Z' };
+	for (const ChipsetGpuEntry& entry : entries) {
+		max_chipset_series = std::max(max_chipset_series, entry.chipset_series);
+		chipset_models.insert(entry.chipset_model - 1);
+		chipset_models.insert(entry.chipset_model);
+		chipset_models.insert(entry.chipset_model + 1);
+		if (entry.chipset_suffix != '*') {
+			chipset_suffixes.insert(entry.chipset_suffix);
+		}
+	}
+
+	for (uint32_t chipset_series = 0; chipset_series <= max_chipset_series + 1; chipset_series++) {
+		for (uint32_t chipset_model : chipset_models) {
+			for (char chipset_suffix : chipset_suffixes) {
+				ASSERT_EQ(search_chipset_gpu(entries, chipset_series, chipset_model, chipset_suffix),
+					parse_chipset_gpu(chipset_series, chipset_model, chipset_suffix))
+					<< "chipset series " << chipset_series << ", model " << chipset_model
+					<< ", suffix " << (chipset_suffix != '\0' ? std::string(1, chipset_suffix) : "none");
+			}
+		}
+	}
+}
+
+TEST(GPU_RENDERER_MAP, non_empty) {
+	EXPECT_FALSE(gpu_renderer_map().empty());
+}
+
+TEST(GPU_RENDERER_MAP, sorted) {
+	const std::vector<GpuRendererEntry> entries = gpu_renderer_map();
+	for (size_t i = 1; i < entries.size(); i++) {
+		EXPECT_LT(strcmp(entries[i - 1].renderer.c_str(), entries[i].renderer.c_str()), 0)
+			<< "\"" << entries[i].renderer << "\" follows \"" << entries[i - 1].renderer << "\"";
+	}
+}
+
+TEST(GPU_RENDERER_MAP, entries_found) {
+	for (const GpuRendererEntry& entry : gpu_renderer_map()) {
+		EXPECT_EQ(entry.gpu, parse_gpu_renderer(entry.renderer.c_str())) << entry.renderer;
+	}
+}
+
+/* GPU names which the decoder reported before the exactly matched GL_RENDERER strings moved to a sorted table */
+TEST(GPU_RENDERER, known_renderers) {
+	EXPECT_EQ("Qualcomm Adreno 306", parse_gpu_renderer("Adreno (TM) 306"));
+	EXPECT_EQ("Qualcomm Adreno 530", parse_gpu_renderer("Adreno (TM) 530"));
+	EXPECT_EQ("Vivante GC1000", parse_gpu_renderer("GC1000 core"));
+	EXPECT_EQ("Vivante GC4000", parse_gpu_renderer("Immersion.16"));
+	EXPECT_EQ("Intel Gen 8", parse_gpu_renderer("Intel(R) HD Graphics for Atom(TM) x5/x7"));
+	EXPECT_EQ("Intel Gen 7", parse_gpu_renderer("Intel(R) HD Graphics for BayTrail"));
+	EXPECT_EQ("ARM Mali-400", parse_gpu_renderer("Mali-400 MP"));
+	EXPECT_EQ("ARM Mali-G71", parse_gpu_renderer("Mali-G71"));
+	EXPECT_EQ("ARM Mali-T628", parse_gpu_renderer("Mali-T628"));
+	EXPECT_EQ("ARM Mali-T760", parse_gpu_renderer("Mali-T764"));
+	EXPECT_EQ("Intel HD Graphics 400", parse_gpu_renderer("Mesa DRI Intel(R) HD Graphics 400 (Braswell)"));
+	EXPECT_EQ("Intel Gen 6", parse_gpu_renderer("Mesa DRI Intel(R) Sandybridge Mobile x86/MMX/SSE2"));
+	EXPECT_EQ("Nvidia Tegra ", parse_gpu_renderer("NVIDIA Tegra"));
+	EXPECT_EQ("Nvidia Tegra 3", parse_gpu_renderer("NVIDIA Tegra 3"));
+	EXPECT_EQ("Vivante GC5000", parse_gpu_renderer("PXA1928 GPU"));
+	EXPECT_EQ("PowerVR Rogue G6200", parse_gpu_renderer("PowerVR Rogue G6200"));
+	EXPECT_EQ("PowerVR Rogue GE8100", parse_gpu_renderer("PowerVR Rogue GE8100"));
+	EXPECT_EQ("PowerVR Rogue GX6250", parse_gpu_renderer("PowerVR Rogue GX6250"));
+	EXPECT_EQ("PowerVR Rogue G6200", parse_gpu_renderer("PowerVR Rogue Han"));
+	EXPECT_EQ("PowerVR Rogue G6430", parse_gpu_renderer("PowerVR Rogue Hood"));
+	EXPECT_EQ("PowerVR Rogue GT7400+", parse_gpu_renderer("PowerVR Rogue Marlowe"));
+	EXPECT_EQ("PowerVR SGX544", parse_gpu_renderer("PowerVR SGX 544MP"));
+	EXPECT_EQ("ARM Mali-T720", parse_gpu_renderer("Sapphire 650"));
+	EXPECT_EQ("Broadcom VideoCore 4", parse_gpu_renderer("VideoCore IV HW"));
+	EXPECT_EQ("Vivante GC7000UL", parse_gpu_renderer("Vivante GC7000UL"));
+}
+
+TEST(GPU_RENDERER, unknown_renderers) {
+	EXPECT_EQ("", parse_gpu_renderer(""));
+	EXPECT_EQ("", parse_gpu_renderer("Immersion"));
+	EXPECT_EQ("", parse_gpu_renderer("Immersion.160"));
+	EXPECT_EQ("", parse_gpu_renderer("NVIDIA Tegra 3 "));
+	EXPECT_EQ("", parse_gpu_renderer("NVIDIA Tegra 4"));
+	EXPECT_EQ("", parse_gpu_renderer("PowerVR Rogue"));
+	EXPECT_EQ("", parse_gpu_renderer("Sapphire 65"));
+	EXPECT_EQ("", parse_gpu_renderer("Vivante GC1000"));
+}
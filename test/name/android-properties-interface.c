@@ -1,5 +1,6 @@
 #include <string.h>
 
+#include <linux/api.h>
 #include <arm/api.h>
 #include <arm/linux/api.h>
 #include <arm/android/api.h>
@@ -113,3 +114,171 @@ void cpuinfo_arm_android_parse_ro_chipname(
 		cpuinfo_arm_chipset_to_string(&chipset, chipset_name);
 	}
 }
+
+/*
+ * Functions below decode and fix up chipset like the functions above, but don't format chipset name, and return the
+ * decoded chipset series. They are used to benchmark chipset decoding.
+ */
+
+uint32_t cpuinfo_arm_android_decode_chipset_properties(
+	const char proc_cpuinfo_hardware[CPUINFO_HARDWARE_VALUE_MAX],
+	const char ro_product_board[CPUINFO_BUILD_PROP_VALUE_MAX],
+	const char ro_board_platform[CPUINFO_BUILD_PROP_VALUE_MAX],
+	const char ro_mediatek_platform[CPUINFO_BUILD_PROP_VALUE_MAX],
+	const char ro_arch[CPUINFO_BUILD_PROP_VALUE_MAX],
+	const char ro_chipname[CPUINFO_BUILD_PROP_VALUE_MAX],
+	uint32_t cores,
+	uint32_t max_cpu_freq_max)
+{
+	struct cpuinfo_android_properties properties;
+	strncpy(properties.proc_cpuinfo_hardware, proc_cpuinfo_hardware, CPUINFO_HARDWARE_VALUE_MAX);
+	strncpy(properties.ro_product_board, ro_product_board, CPUINFO_BUILD_PROP_VALUE_MAX);
+	strncpy(properties.ro_board_platform, ro_board_platform, CPUINFO_BUILD_PROP_VALUE_MAX);
+	strncpy(properties.ro_mediatek_platform, ro_mediatek_platform, CPUINFO_BUILD_PROP_VALUE_MAX);
+	strncpy(properties.ro_arch, ro_arch, CPUINFO_BUILD_PROP_VALUE_MAX);
+	strncpy(properties.ro_chipname, ro_chipname, CPUINFO_BUILD_PROP_VALUE_MAX);
+
+	return (uint32_t) cpuinfo_arm_android_decode_chipset(&properties, cores, max_cpu_freq_max).series;
+}
+
+uint32_t cpuinfo_arm_android_decode_proc_cpuinfo_hardware(
+	const char hardware[CPUINFO_HARDWARE_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max, bool is_tegra)
+{
+	struct cpuinfo_arm_chipset chipset =
+		cpuinfo_arm_linux_decode_chipset_from_proc_cpuinfo_hardware(hardware, cores, max_cpu_freq_max, is_tegra);
+	if (chipset.series != cpuinfo_arm_chipset_series_unknown) {
+		cpuinfo_arm_fixup_chipset(&chipset, cores, max_cpu_freq_max);
+	}
+	return (uint32_t) chipset.series;
+}
+
+uint32_t cpuinfo_arm_android_decode_ro_product_board(
+	const char board[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max)
+{
+	struct cpuinfo_arm_chipset chipset =
+		cpuinfo_arm_android_decode_chipset_from_ro_product_board(board, cores, max_cpu_freq_max);
+	if (chipset.series != cpuinfo_arm_chipset_series_unknown) {
+		cpuinfo_arm_fixup_chipset(&chipset, cores, max_cpu_freq_max);
+	}
+	return (uint32_t) chipset.series;
+}
+
+uint32_t cpuinfo_arm_android_decode_ro_board_platform(
+	const char platform[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max)
+{
+	struct cpuinfo_arm_chipset chipset =
+		cpuinfo_arm_android_decode_chipset_from_ro_board_platform(platform, cores, max_cpu_freq_max);
+	if (chipset.series != cpuinfo_arm_chipset_series_unknown) {
+		cpuinfo_arm_fixup_chipset(&chipset, cores, max_cpu_freq_max);
+	}
+	return (uint32_t) chipset.series;
+}
+
+uint32_t cpuinfo_arm_android_decode_ro_mediatek_platform(
+	const char platform[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max)
+{
+	struct cpuinfo_arm_chipset chipset = cpuinfo_arm_android_decode_chipset_from_ro_mediatek_platform(platform);
+	if (chipset.series != cpuinfo_arm_chipset_series_unknown) {
+		cpuinfo_arm_fixup_chipset(&chipset, cores, max_cpu_freq_max);
+	}
+	return (uint32_t) chipset.series;
+}
+
+uint32_t cpuinfo_arm_android_decode_ro_arch(
+	const char arch[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max)
+{
+	struct cpuinfo_arm_chipset chipset = cpuinfo_arm_android_decode_chipset_from_ro_arch(arch);
+	if (chipset.series != cpuinfo_arm_chipset_series_unknown) {
+		cpuinfo_arm_fixup_chipset(&chipset, cores, max_cpu_freq_max);
+	}
+	return (uint32_t) chipset.series;
+}
+
+uint32_t cpuinfo_arm_android_decode_ro_chipname(
+	const char chipname[CPUINFO_BUILD_PROP_VALUE_MAX], uint32_t cores, uint32_t max_cpu_freq_max)
+{
+	struct cpuinfo_arm_chipset chipset = cpuinfo_arm_android_decode_chipset_from_ro_chipname(chipname);
+	if (chipset.series != cpuinfo_arm_chipset_series_unknown) {
+		cpuinfo_arm_fixup_chipset(&chipset, cores, max_cpu_freq_max);
+	}
+	return (uint32_t) chipset.series;
+}
+
+/*
+ * Functions below look up and decode GPU like cpuinfo initialization on Android, and return the GPU series. They are
+ * used to benchmark GPU lookup.
+ */
+
+uint32_t cpuinfo_arm_android_lookup_chipset_gpu(uint32_t chipset_series, uint32_t chipset_model, char chipset_suffix) {
+	const struct cpuinfo_arm_chipset chipset = {
+		.series = (enum cpuinfo_arm_chipset_series) chipset_series,
+		.model = chipset_model,
+		.suffix = { [0] = chipset_suffix },
+	};
+	struct cpuinfo_android_gpu gpu;
+	if (!cpuinfo_arm_android_lookup_gpu(&chipset, &gpu)) {
+		return (uint32_t) cpuinfo_android_gpu_series_unknown;
+	}
+	return (uint32_t) gpu.series;
+}
+
+uint32_t cpuinfo_android_decode_gpu_renderer(const char* renderer) {
+	return (uint32_t) cpuinfo_android_decode_gpu(renderer).series;
+}
+
+/*
+ * Functions below read entries of the GPU tables in table order, and look up GPU like cpuinfo initialization on
+ * Android. GPU names are formatted like cpuinfo reports them, and are empty if the GPU is unknown. They are used to
+ * test the GPU tables.
+ */
+
+bool cpuinfo_arm_android_get_chipset_gpu_map_entry(
+	size_t index, uint32_t chipset_series[1], uint32_t chipset_model[1], char chipset_suffix[1],
+	char gpu_name[CPUINFO_GPU_NAME_MAX])
+{
+	struct cpuinfo_arm_chipset chipset;
+	struct cpuinfo_android_gpu gpu;
+	if (!cpuinfo_arm_android_get_chipset_gpu_entry(index, &chipset, &gpu)) {
+		return false;
+	}
+	*chipset_series = (uint32_t) chipset.series;
+	*chipset_model = chipset.model;
+	*chipset_suffix = chipset.suffix[0];
+	cpuinfo_android_gpu_to_string(&gpu, gpu_name);
+	return true;
+}
+
+void cpuinfo_arm_android_parse_chipset_gpu(
+	uint32_t chipset_series, uint32_t chipset_model, char chipset_suffix,
+	char gpu_name[CPUINFO_GPU_NAME_MAX])
+{
+	const struct cpuinfo_arm_chipset chipset = {
+		.series = (enum cpuinfo_arm_chipset_series) chipset_series,
+		.model = chipset_model,
+		.suffix = { [0] = chipset_suffix },
+	};
+	struct cpuinfo_android_gpu gpu;
+	if (!cpuinfo_arm_android_lookup_gpu(&chipset, &gpu)) {
+		gpu_name[0] = 0;
+	} else {
+		cpuinfo_android_gpu_to_string(&gpu, gpu_name);
+	}
+}
+
+const char* cpuinfo_android_get_gpu_renderer_map_entry(size_t index, char gpu_name[CPUINFO_GPU_NAME_MAX]) {
+	struct cpuinfo_android_gpu gpu;
+	const char* renderer = cpuinfo_android_get_gpu_renderer_entry(index, &gpu);
+	if (renderer != NULL) {
+		cpuinfo_android_gpu_to_string(&gpu, gpu_name);
+	}
+	return renderer;
+}
+
+void cpuinfo_android_parse_gpu_renderer(const char* renderer, char gpu_name[CPUINFO_GPU_NAME_MAX]) {
+	const struct cpuinfo_android_gpu gpu = cpuinfo_android_decode_gpu(renderer);
+	if (gpu.series == cpuinfo_android_gpu_series_unknown) {
+		gpu_name[0] = 0;
+	} else {
+		cpuinfo_android_gpu_to_string(&gpu, gpu_name);
+	}
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(SVE_LENGTH, unsupported) {
+	cpuinfo_set_sve_vl(-1);
+	EXPECT_EQ(0, cpuinfo_get_max_arm_sve_length());
+}
+
+TEST(SVE_LENGTH, vl128) {
+	cpuinfo_set_sve_vl(16);
+	EXPECT_EQ(128, cpuinfo_get_max_arm_sve_length());
+}
+
+TEST(SVE_LENGTH, vl256) {
+	cpuinfo_set_sve_vl(32);
+	EXPECT_EQ(256, cpuinfo_get_max_arm_sve_length());
+}
+
+TEST(SVE_LENGTH, vl512) {
+	cpuinfo_set_sve_vl(64);
+	EXPECT_EQ(512, cpuinfo_get_max_arm_sve_length());
+}
+
+TEST(SVE_LENGTH, vl2048) {
+	cpuinfo_set_sve_vl(256);
+	EXPECT_EQ(2048, cpuinfo_get_max_arm_sve_length());
+}
+
+TEST(SVE_LENGTH, ignores_flags) {
+	/* PR_SVE_SET_VL_ONEXEC and PR_SVE_VL_INHERIT flags are reported in the high bits */
+	cpuinfo_set_sve_vl((1 << 17) | 32);
+	EXPECT_EQ(256, cpuinfo_get_max_arm_sve_length());
+}
@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <cpuinfo.h>
+
+
+int main(int argc, char** argv) {
+	if (!cpuinfo_initialize()) {
+		fprintf(stderr, "failed to initialize CPU information\n");
+		exit(EXIT_FAILURE);
+	}
+
+	const uint32_t processors_count = cpuinfo_get_processors_count();
+	if (!cpuinfo_measure_processor_latencies()) {
+		fprintf(stderr, "failed to measure latencies between %"PRIu32" processors\n", processors_count);
+		exit(EXIT_FAILURE);
+	}
+
+	printf("Round-trip latency, ns:\n");
+	printf("%8s", "");
+	for (uint32_t j = 0; j < processors_count; j++) {
+		printf("%6d", cpuinfo_get_processor(j)->linux_id);
+	}
+	printf("\n");
+	for (uint32_t i = 0; i < processors_count; i++) {
+		const struct cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		printf("%8d", processor->linux_id);
+		for (uint32_t j = 0; j < processors_count; j++) {
+			if (i == j) {
+				printf("%6s", "-");
+			} else {
+				printf("%6"PRIu32, cpuinfo_get_processor_latency(processor, cpuinfo_get_processor(j)));
+			}
+		}
+		printf("\n");
+	}
+}
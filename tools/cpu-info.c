@@ -71,6 +71,10 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Sky Lake";
 		case cpuinfo_uarch_kaby_lake:
 			return "Kaby Lake";
+		case cpuinfo_uarch_sunny_cove:
+			return "Sunny Cove";
+		case cpuinfo_uarch_golden_cove:
+			return "Golden Cove";
 		case cpuinfo_uarch_willamette:
 			return "Willamette";
 		case cpuinfo_uarch_prescott:
@@ -83,6 +87,8 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Silvermont";
 		case cpuinfo_uarch_airmont:
 			return "Airmont";
+		case cpuinfo_uarch_gracemont:
+			return "Gracemont";
 		case cpuinfo_uarch_knights_ferry:
 			return "Knights Ferry";
 		case cpuinfo_uarch_knights_corner:
@@ -155,6 +161,10 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Cortex-A72";
 		case cpuinfo_uarch_cortex_a73:
 			return "Cortex-A73";
+		case cpuinfo_uarch_neoverse_n1:
+			return "Neoverse N1";
+		case cpuinfo_uarch_neoverse_v1:
+			return "Neoverse V1";
 		case cpuinfo_uarch_scorpion:
 			return "Scorpion";
 		case cpuinfo_uarch_krait:
@@ -181,6 +191,8 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Hurricane";
 		case cpuinfo_uarch_thunderx:
 			return "ThunderX";
+		case cpuinfo_uarch_thunderx2:
+			return "ThunderX2";
 		case cpuinfo_uarch_pj4:
 			return "PJ4";
 		default:
@@ -225,6 +237,12 @@ int main(int argc, char** argv) {
 			printf(", %s %s\n", vendor_string, uarch_string);
 		}
 	}
+	printf("Core classes (fastest first):\n");
+	for (uint32_t i = 0; i < cpuinfo_get_core_classes_count(); i++) {
+		const struct cpuinfo_core_class* core_class = cpuinfo_get_core_class(i);
+		printf("\t%"PRIu32": %"PRIu32" cores, %"PRIu32" processors, performance %"PRIu32"/1024\n",
+			i, core_class->core_count, core_class->processor_count, core_class->performance);
+	}
 	printf("Logical processors:\n");
 	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
 		const struct cpuinfo_processor* processor = cpuinfo_get_processor(i);
@@ -1,5 +1,12 @@
+#if defined(__linux__)
+	#define _GNU_SOURCE 1
+	#include <sched.h>
+	#include <errno.h>
+#endif
 #include <stdio.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <inttypes.h>
 #include <string.h>
 
@@ -38,7 +45,7 @@ static void print_cpuid_brand_string(struct cpuid_regs regs, uint32_t eax) {
 		eax, regs.eax, regs.ebx, regs.ecx, regs.edx, brand_string);
 }
 
-int main(int argc, char** argv) {
+static void print_cpuid_dump(void) {
 	const uint32_t max_base_index = cpuid(0).eax;
 	uint32_t max_structured_index = 0, max_trace_index = 0, max_socid_index = 0;
 	bool has_sgx = false;
@@ -126,3 +133,54 @@ int main(int argc, char** argv) {
 		}
 	}
 }
+
+static void print_usage(const char* program_name) {
+	fprintf(stderr, "Usage: %s [--all-processors]\n", program_name);
+#if defined(__linux__)
+	fprintf(stderr, "  --all-processors  dump CPUID of every logical processor, preceded by a \"CPU <n>:\" line\n");
+#endif
+}
+
+int main(int argc, char** argv) {
+	bool all_processors = false;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--all-processors") == 0) {
+			all_processors = true;
+		} else {
+			print_usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (!all_processors) {
+		print_cpuid_dump();
+		return EXIT_SUCCESS;
+	}
+
+#if defined(__linux__)
+	/* Hybrid processors report different CPUID values on cores of different types */
+	cpu_set_t affinity;
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &affinity) != 0) {
+		fprintf(stderr, "failed to get thread affinity: %s\n", strerror(errno));
+		return EXIT_FAILURE;
+	}
+	for (int processor = 0; processor < CPU_SETSIZE; processor++) {
+		if (!CPU_ISSET(processor, &affinity)) {
+			continue;
+		}
+		cpu_set_t processor_affinity;
+		CPU_ZERO(&processor_affinity);
+		CPU_SET(processor, &processor_affinity);
+		if (sched_setaffinity(0, sizeof(cpu_set_t), &processor_affinity) != 0) {
+			fprintf(stderr, "failed to pin thread to processor %d: %s\n", processor, strerror(errno));
+			return EXIT_FAILURE;
+		}
+		printf("CPU %d:\n", processor);
+		print_cpuid_dump();
+	}
+	return EXIT_SUCCESS;
+#else
+	fprintf(stderr, "--all-processors is supported only on Linux\n");
+	return EXIT_FAILURE;
+#endif
+}
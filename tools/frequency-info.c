@@ -0,0 +1,48 @@
+#define _GNU_SOURCE 1
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+
+#include <sched.h>
+
+#include <cpuinfo.h>
+
+
+int main(int argc, char** argv) {
+	if (!cpuinfo_initialize()) {
+		fprintf(stderr, "failed to initialize CPU information\n");
+		exit(EXIT_FAILURE);
+	}
+
+	printf("Clusters:\n");
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		const struct cpuinfo_cluster* cluster = cpuinfo_get_cluster(i);
+		const struct cpuinfo_processor* processor = cpuinfo_get_processor(cluster->processor_start);
+
+		/* Move to the first logical processor of the cluster: measurement is done on the current core */
+		cpu_set_t affinity;
+		CPU_ZERO(&affinity);
+		CPU_SET(processor->linux_id, &affinity);
+		if (sched_setaffinity(0, sizeof(cpu_set_t), &affinity) != 0) {
+			fprintf(stderr, "failed to pin thread to processor %d: %s\n", processor->linux_id, strerror(errno));
+			continue;
+		}
+
+		const uint64_t frequency = cpuinfo_measure_current_core_frequency();
+		if (frequency == 0) {
+			printf("\t%"PRIu32": measurement failed\n", i);
+		} else {
+			printf("\t%"PRIu32": %"PRIu64" MHz (processor %d)\n", i, (frequency + UINT64_C(500000)) / UINT64_C(1000000),
+				processor->linux_id);
+		}
+	}
+
+	printf("Cores (frequency reported by the OS):\n");
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		const struct cpuinfo_core* core = cpuinfo_get_core(i);
+		printf("\t%"PRIu32": %"PRIu64" MHz\n", i, (core->frequency + UINT64_C(500000)) / UINT64_C(1000000));
+	}
+}
@@ -69,6 +69,13 @@ int main(int argc, char** argv) {
 		printf("\tAVX512VNNI: %s\n", cpuinfo_has_x86_avx512vnni() ? "yes" : "no");
 		printf("\tAVX512_4VNNIW: %s\n", cpuinfo_has_x86_avx512_4vnniw() ? "yes" : "no");
 		printf("\tAVX512_4FMAPS: %s\n", cpuinfo_has_x86_avx512_4fmaps() ? "yes" : "no");
+		printf("\tAVX512VP2INTERSECT: %s\n", cpuinfo_has_x86_avx512vp2intersect() ? "yes" : "no");
+		printf("\tAVX512_BF16: %s\n", cpuinfo_has_x86_avx512bf16() ? "yes" : "no");
+		printf("\tAVX512_FP16: %s\n", cpuinfo_has_x86_avx512fp16() ? "yes" : "no");
+		printf("\tAVX-VNNI: %s\n", cpuinfo_has_x86_avxvnni() ? "yes" : "no");
+		printf("\tAMX-TILE: %s\n", cpuinfo_has_x86_amx_tile() ? "yes" : "no");
+		printf("\tAMX-INT8: %s\n", cpuinfo_has_x86_amx_int8() ? "yes" : "no");
+		printf("\tAMX-BF16: %s\n", cpuinfo_has_x86_amx_bf16() ? "yes" : "no");
 
 
 	printf("Multi-threading extensions:\n");
@@ -108,6 +115,20 @@ int main(int argc, char** argv) {
 		printf("\tFXSAVE/FXSTOR: %s\n", cpuinfo_has_x86_fxsave() ? "yes" : "no");
 		printf("\tXSAVE/XSTOR: %s\n", cpuinfo_has_x86_xsave() ? "yes" : "no");
 
+	const struct cpuinfo_x86_xsave* xsave = cpuinfo_get_x86_xsave();
+	if (xsave != NULL) {
+		printf("XSAVE state:\n");
+			printf("\tXCR0: 0x%016llx\n", (unsigned long long) xsave->enabled_components);
+			printf("\tXSAVE area size: %u bytes (max %u bytes)\n", xsave->size, xsave->max_size);
+			printf("\tXSAVEC area size: %u bytes\n", xsave->compacted_size);
+			for (unsigned int i = 0; i < CPUINFO_X86_XSAVE_COMPONENTS_MAX; i++) {
+				if (xsave->enabled_components & (UINT64_C(1) << i)) {
+					printf("\tcomponent %u: %u bytes at offset %u\n",
+						i, xsave->components[i].size, xsave->components[i].offset);
+				}
+			}
+	}
+
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
 
 #if CPUINFO_ARCH_ARM
@@ -151,6 +172,14 @@ int main(int argc, char** argv) {
 		printf("\tARM v8.2 FP16 arithmetics: %s\n", cpuinfo_has_arm_fp16_arith() ? "yes" : "no");
 		printf("\tARM v8.3 JS conversion: %s\n", cpuinfo_has_arm_jscvt() ? "yes" : "no");
 		printf("\tARM v8.3 complex FMA: %s\n", cpuinfo_has_arm_fcma() ? "yes" : "no");
+		printf("\tARM v8.2 dot product: %s\n", cpuinfo_has_arm_neon_dot() ? "yes" : "no");
+		printf("\tARM v8.2 FP16 widening multiply-accumulate: %s\n", cpuinfo_has_arm_fhm() ? "yes" : "no");
+		printf("\tARM v8.6 Int8 matrix multiplication: %s\n", cpuinfo_has_arm_i8mm() ? "yes" : "no");
+		printf("\tARM v8.6 BFloat16: %s\n", cpuinfo_has_arm_bf16() ? "yes" : "no");
+		printf("\tSVE: %s\n", cpuinfo_has_arm_sve() ? "yes" : "no");
+		printf("\tSVE BFloat16: %s\n", cpuinfo_has_arm_sve_bf16() ? "yes" : "no");
+		printf("\tSVE Int8 matrix multiplication: %s\n", cpuinfo_has_arm_sve_i8mm() ? "yes" : "no");
+		printf("\tSVE2: %s\n", cpuinfo_has_arm_sve2() ? "yes" : "no");
 
 	printf("Cryptography extensions:\n");
 		printf("\tAES: %s\n", cpuinfo_has_arm_aes() ? "yes" : "no");